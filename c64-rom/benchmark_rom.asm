@@ -0,0 +1,337 @@
+.file [name="benchmark_rom.bin", type="bin", segments="Code"]
+
+//
+// Benchmark cartridge: time what the C64 gets from the pico with CIA 2's timers, show the
+// results and send them back to the pico.  The "bench on" USB command serves this instead of
+// the loader at the next reset (see firmware/benchmark.h).
+//
+// Each result is in C64 cycles, with the screen blanked and interrupts off so nothing steals
+// any, less the cycles the timer takes to start and stop:
+//
+//  - copy: COPY_WINDOWS windows of 1K copied into RAM, with CMD_NEXT_PAGE and a wait for the
+//    pico after each, like the loader's generic copy
+//  - round_trip: ROUND_TRIPS of CMD_PING, each waited for
+//  - poll: POLLS reads of the status while the pico is ready
+//
+
+.const COPY_WINDOWS = 16
+.const ROUND_TRIPS = 64
+.const POLLS = 256              // the poll loop counts x round from 0
+.const NUM_RESULTS = 3
+
+//
+// 1k window, and where its copies go
+//
+.label copy_source = $8400
+.label copy_dest = $c000
+
+//
+// 256 byte window to send commands by reading from
+//
+.label command_area = $9e00
+.const CMD_GET_STATUS = 0
+.const CMD_NEXT_PAGE = 1
+.const CMD_PING = 6
+.const CMD_BENCH_RESULT = 7     // then the result's number + 1, then its 8 nibbles + 1
+.const UNLOCK = List().add($43, $36, $34, $21)  // UNLOCK_MAGIC in command.pio ("C64!")
+
+//
+// CIA 2's timers, with B counting A's underflows so together they count 32 bits of cycles down
+// from $ffffffff
+//
+.label cia2_timer_a = $dd04
+.label cia2_timer_b = $dd06
+.label cia2_control_a = $dd0e
+.label cia2_control_b = $dd0f
+
+//
+// Results, 4 bytes each in 6502 byte order
+//
+.label results = $c400
+.label overhead = results + NUM_RESULTS * 4
+.label elapsed = overhead + 4
+.label result_offset = $fb      // offset into results of the one being shown or sent
+.label bytes_left = $fc
+.label screen_pointer = $fd     // 2 bytes
+
+.label screen = $0400
+.const RESULT_ROW = 2           // first result's row on the screen
+.const VALUE_COLUMN = 13        // where each result's hex digits go
+
+
+.segment Code [start=$8000, max=$83ff]
+
+*=$8000                         // cartridge header
+.word start                     // start address
+.word start                     // NMI ISR address
+.encoding "petscii_mixed"
+.text "CBM80"                   // cartridge signature
+.encoding "screencode_upper"
+
+start:  sei
+        jsr $ff81               // kernal: initialize VIC-II
+        jsr $ff84               // kernal: initialize CIA
+
+        lda #0
+        sta $d020               // black border
+        sta $d021               // black background
+        lda #$0b                // blank the screen, so there are no badlines
+        sta $d011
+
+        // the cycles timer_start and timer_stop take between them, to take off each result
+        jsr timer_start
+        jsr timer_stop
+        ldx #3
+!:      lda elapsed, x
+        sta overhead, x
+        dex
+        bpl !-
+
+        // the command area stays unlocked for the whole run: unlocking it again would send the
+        // magic bytes as commands, and there are fewer than the guard's 128
+        jsr unlock
+
+        // copy: the window into RAM, a window at a time
+        jsr timer_start
+        ldy #COPY_WINDOWS
+copy_window:
+        ldx #0
+!:      lda copy_source, x
+        sta copy_dest, x
+        lda copy_source + $100, x
+        sta copy_dest + $100, x
+        lda copy_source + $200, x
+        sta copy_dest + $200, x
+        lda copy_source + $300, x
+        sta copy_dest + $300, x
+        inx
+        bne !-
+        lda command_area + CMD_NEXT_PAGE
+!:      lda command_area + CMD_GET_STATUS
+        bne !-
+        dey
+        bne copy_window
+        jsr timer_stop
+        ldx #0
+        jsr store_result
+
+        // round_trip: a command that does nothing, waited for
+        jsr timer_start
+        ldy #ROUND_TRIPS
+round_trip:
+        lda command_area + CMD_PING
+!:      lda command_area + CMD_GET_STATUS
+        bne !-
+        dey
+        bne round_trip
+        jsr timer_stop
+        ldx #4
+        jsr store_result
+
+        // poll: the status of an idle pico
+        jsr timer_start
+        ldx #0
+!:      lda command_area + CMD_GET_STATUS
+        dex
+        bne !-
+        jsr timer_stop
+        ldx #8
+        jsr store_result
+
+        // show the results
+        ldx #SCREEN_TEXT_SIZE
+show:   lda screen_text - 1, x
+        sta screen - 1, x
+        dex
+        bne show
+        lda #1                  // white text
+!:      sta $d800, x
+        inx
+        bne !-
+        lda #0
+        sta result_offset
+show_result:
+        lda result_offset       // the result's row
+        lsr
+        lsr
+        tax
+        lda result_screen_lo, x
+        sta screen_pointer
+        lda result_screen_hi, x
+        sta screen_pointer + 1
+        lda result_offset       // most significant byte first
+        clc
+        adc #3
+        tax
+        ldy #0
+show_byte:
+        lda results, x
+        lsr
+        lsr
+        lsr
+        lsr
+        jsr show_digit
+        lda results, x
+        and #$0f
+        jsr show_digit
+        dex
+        cpy #8
+        bne show_byte
+        lda result_offset
+        clc
+        adc #4
+        sta result_offset
+        cmp #NUM_RESULTS * 4
+        bne show_result
+        lda #$1b                // screen back on
+        sta $d011
+
+        // and send them to the pico: CMD_BENCH_RESULT, the result's number + 1, then each nibble
+        // of its value + 1, most significant first (so none is the status read)
+        lda #0
+        sta result_offset
+send_result:
+        lda #CMD_BENCH_RESULT
+        jsr send
+        lda result_offset
+        lsr
+        lsr
+        clc
+        adc #1
+        jsr send
+        lda result_offset
+        clc
+        adc #3
+        tay
+        lda #4
+        sta bytes_left
+send_byte:
+        lda results, y
+        lsr
+        lsr
+        lsr
+        lsr
+        clc
+        adc #1
+        jsr send
+        lda results, y
+        and #$0f
+        clc
+        adc #1
+        jsr send
+        dey
+        dec bytes_left
+        bne send_byte
+        lda result_offset
+        clc
+        adc #4
+        sta result_offset
+        cmp #NUM_RESULTS * 4
+        bne send_result
+
+done:   jmp done
+
+
+//
+// Unlock the command area, which ignores reads until it sees this sequence, and wait for the
+// pico
+//
+unlock:
+.for (var i = 0; i < UNLOCK.size(); i++) {
+        lda command_area + UNLOCK.get(i)
+}
+wait_ready:
+        lda command_area + CMD_GET_STATUS
+        bne wait_ready
+        rts
+
+//
+// Send command A and wait for the pico to handle it.  Leaves y alone.
+//
+send:   tax
+        lda command_area, x
+        jmp wait_ready
+
+//
+// Start both timers from $ffffffff: B first, so it's counting before A can underflow
+//
+timer_start:
+        lda #$ff
+        sta cia2_timer_a
+        sta cia2_timer_a + 1
+        sta cia2_timer_b
+        sta cia2_timer_b + 1
+        lda #%01010001          // count A's underflows, load the latch, start
+        sta cia2_control_b
+        lda #%00010001          // count cycles, load the latch, start
+        sta cia2_control_a
+        rts
+
+//
+// Stop the timers, and put the cycles they counted in elapsed: what's left of $ffffffff,
+// inverted
+//
+timer_stop:
+        lda #0
+        sta cia2_control_a      // B stops with A
+        lda cia2_timer_a
+        eor #$ff
+        sta elapsed
+        lda cia2_timer_a + 1
+        eor #$ff
+        sta elapsed + 1
+        lda cia2_timer_b
+        eor #$ff
+        sta elapsed + 2
+        lda cia2_timer_b + 1
+        eor #$ff
+        sta elapsed + 3
+        rts
+
+//
+// Put elapsed less overhead in the result at offset x into results.  Unrolled, as a loop's
+// compare would lose the borrow.
+//
+store_result:
+        sec
+.for (var i = 0; i < 4; i++) {
+        lda elapsed + i
+        sbc overhead + i
+        sta results + i, x
+}
+        rts
+
+//
+// Show the hex digit in A at screen_pointer + y, and move y on
+//
+show_digit:
+        ora #$30                // '0'-'9' are $30-$39 in screen codes
+        cmp #$3a
+        bcc !+
+        sbc #$39                // and 'A'-'F' are 1-6 (carry is set)
+!:      sta (screen_pointer), y
+        iny
+        rts
+
+result_screen_lo:
+.for (var i = 0; i < NUM_RESULTS; i++) {
+        .byte <(screen + (RESULT_ROW + i) * 40 + VALUE_COLUMN)
+}
+result_screen_hi:
+.for (var i = 0; i < NUM_RESULTS; i++) {
+        .byte >(screen + (RESULT_ROW + i) * 40 + VALUE_COLUMN)
+}
+
+.macro line(s) {
+        .text s
+        .fill 40 - s.size(), ' '
+}
+screen_text:
+        line("PICO CARTRIDGE BENCHMARK")
+        line("")
+        line("COPY        $         CYCLES, " + toIntString(COPY_WINDOWS) + "K")
+        line("ROUND TRIP  $         CYCLES, " + toIntString(ROUND_TRIPS))
+        line("POLL        $         CYCLES, " + toIntString(POLLS))
+screen_text_end:
+.label SCREEN_TEXT_SIZE = screen_text_end - screen_text
+.errorif SCREEN_TEXT_SIZE > 255, "the screen text is copied with an 8 bit index"
@@ -6,13 +6,17 @@
 .const NUM_1K_NUFLI_BLOX = floor(NUFLI_SIZE/1024)  // number of full 1K NUFLI blocks
                                                    // (remainder is not counted)
 
+.const BYTES_LEFT = NUFLI_SIZE & $03ff              // copied from a partial window at the end
+
 //
-// Zero-page pointers (used to copy to different offsets into nufli_dest)
+// Unrolled window copier, run from RAM so its destinations can be patched for each window
 //
-.label dest_ptr1 = $f8
-.label dest_ptr2 = $fa
-.label dest_ptr3 = $fc
-.label dest_ptr4 = $fe
+.label copier = $c000
+.label dest_page = $fe          // destination high byte for the current window
+.const SECTION_SIZE = 32        // bytes copied by each lda/sta pair
+.const NUM_SECTIONS = 1024 / SECTION_SIZE
+.const SECTION_CODE_SIZE = 6    // lda abs,x + sta abs,x
+.errorif mod(BYTES_LEFT, SECTION_SIZE) != 0, "NUFLI_SIZE must be a multiple of SECTION_SIZE"
 
 //
 // 1k window to copy NUFLI from
@@ -28,6 +32,43 @@
 .label command_area = $9e00
 .const CMD_GET_STATUS = 0
 .const CMD_NEXT_PAGE = 1
+.const CMD_CHECK_CRC = 3
+.const CMD_SAVE_NUFLI = 4
+.const CMD_LOAD_OPEN = 5
+.const CMD_NO_ROMH = 8          // page the image through the window, with no routine at $A000
+.const CMD_SELECT_CART = $10    // + n: serve cartridge n from the library
+.const UNLOCK = List().add($43, $36, $34, $21)  // UNLOCK_MAGIC in command.pio ("C64!")
+
+// Read the unlock sequence, twice where the guard can have relocked since the last command: the
+// pico stops the command program for a few cycles to relock it, and a read in those cycles isn't
+// answered, so the first sequence can lose a read and the second then unlocks it
+.macro unlock(times) {
+.for (var i = 0; i < times * UNLOCK.size(); i++) {
+        lda command_area + UNLOCK.get(mod(i, UNLOCK.size()))
+}
+}
+
+//
+// Mailbox of results from the pico
+//
+.label mailbox = $8800
+.label mailbox_nufli_crc = mailbox + 0     // CRC-32 of the NUFLI image (4 bytes)
+.label mailbox_window_crc = mailbox + 4    // CRC-32 of the current 1k window (4 bytes)
+.label mailbox_flash_busy = mailbox + 8    // $ff while the pico is writing to flash
+.label mailbox_copy_routine = mailbox + 9  // $ff if the pico made a copy routine for the image
+.label mailbox_d64_device = mailbox + 10   // device number to LOAD from the pico's D64, or 0
+.label mailbox_load_error = mailbox + 11   // KERNAL error number for CMD_LOAD_OPEN, or 0
+.label mailbox_load_address = mailbox + 12 // load address of the opened file (2 bytes)
+.label mailbox_load_size = mailbox + 14    // size of the opened file without its address (2 bytes)
+.label mailbox_cart_count = mailbox + 16   // cartridges in the library menu, or 0 for no menu
+
+//
+// Copy routine the pico generates for the image it's serving (see firmware/copy_gen.c), and the
+// signature it serves at the top of ROMH.  In the 8K switch position only ROML is mapped, and
+// $A000-$BFFF is BASIC.
+//
+.label copy_routine = $a000
+.label romh_signature = $bffc
 
 
 .segment Code [start=$8000]
@@ -55,65 +96,386 @@ clear:  sta $0400, x
         dex
         bne clear
 
-        ldx #NUM_1K_NUFLI_BLOX  // copy the NUFLI 1 KB at a time
-        lda #<nufli_dest        // put copy destinations in $f8,$fa,$fc,$fe
-        sta dest_ptr1
-        sta dest_ptr2
-        sta dest_ptr3
-        sta dest_ptr4
-        lda #>nufli_dest
-        sta dest_ptr1 + 1
-        lda #>(nufli_dest + $100)
-        sta dest_ptr2 + 1
-        lda #>(nufli_dest + $200)
-        sta dest_ptr3 + 1
-        lda #>(nufli_dest + $300)
-        sta dest_ptr4 + 1
+        // unlock the command area, which ignores reads until it sees this sequence.  It starts
+        // locked and only relocks once unlocked, so once is enough here.
+        unlock(1)
+        jsr wait_ready          // the pico fills in the mailbox before it's ready
+        lda mailbox_cart_count  // with cartridges in the library, let the user pick one first
+        beq no_menu
+        jmp menu
+no_menu:
+        lda mailbox_d64_device  // with a D64 mounted, go to BASIC with LOAD hooked instead
+        beq load_image
+        jmp basic_boot
+load_image:
+        lda mailbox_copy_routine
+        beq generic
+        ldx #3
+check_romh:
+        lda romh_signature, x
+        cmp romh_signature_value, x
+        bne no_romh
+        dex
+        bpl check_romh
+        jmp copy_routine        // the pico's copy routine knows the image, so use that
+no_romh:
+        lda command_area + CMD_NO_ROMH  // no ROMH: have the image sent for the copy loop
+        jsr wait_ready
 
-        ldy #0
-copy1k: lda command_area + CMD_GET_STATUS
-        sta $d020               // flash border if the pico's cpu is busy
-        bne copy1k              // loop until status is not busy
-        lda copy_source, y
-        sta (dest_ptr1), y
-        lda copy_source + $100, y
-        sta (dest_ptr2), y
-        lda copy_source + $200, y
-        sta (dest_ptr3), y
-        lda copy_source + $300, y
-        sta (dest_ptr4), y
-        iny
-        bne copy1k
+        // install the window copier in RAM, where set_dest can patch its destinations
+generic:
+        ldx #0
+install: lda copier_rom, x
+        sta copier, x
+        inx
+        cpx #COPIER_SIZE
+        bne install
 
+        lda #>nufli_dest        // copy the NUFLI 1 KB at a time
+        sta dest_page
+        ldy #NUM_1K_NUFLI_BLOX  // (the copier leaves y alone)
+copy1k: jsr wait_ready
+        lda dest_page
+        jsr set_dest
+        ldx #SECTION_SIZE - 1
+        jsr copier
         lda command_area + CMD_NEXT_PAGE    // advance the source window by 1 KB
+        lda dest_page                       // advance the destination by 1 KB
         clc
-        lda #4                              // advance the dest addrs by 1 KB (high byte of #$400)
-        adc dest_ptr1 + 1
-        sta dest_ptr1 + 1
-        lda #4
-        adc dest_ptr2 + 1
-        sta dest_ptr2 + 1
-        lda #4
-        adc dest_ptr3 + 1
-        sta dest_ptr3 + 1
-        lda #4
-        adc dest_ptr4 + 1
-        sta dest_ptr4 + 1
-
-        dex                     // loop copying whole KBs
+        adc #4
+        sta dest_page
+        dey                     // loop copying whole KBs
         bne copy1k
 
-        // copy the remaining data 256 bytes at a time
-        // (could be optimized by trying 768 at a time, then 512, then up to 256)
-        ldx #0
-.const BYTES_LEFT = NUFLI_SIZE & $03ff
-.for(var i = 0; i < BYTES_LEFT; i += 256) {
-        .if (BYTES_LEFT - i < 256) {
-                ldx #(BYTES_LEFT - i)
-        }
-copy:   lda copy_source + i, x
-        sta nufli_dest + NUM_1K_NUFLI_BLOX*1024 + i, x
-        inx
-        bne copy
+.if (BYTES_LEFT > 0) {
+        // copy the remaining data by entering the copier at the last section it needs, and
+        // looping back to there instead of the first
+        jsr wait_ready
+        lda dest_page
+        jsr set_dest
+        lda #<tail_entry
+        sta copier_loop + 1
+        lda #>tail_entry
+        sta copier_loop + 2
+        ldx #SECTION_SIZE - 1
+        jsr tail_entry
 }
         jmp nufli_exec          // Finished copying! Execute!
+
+
+//
+// Wait for the pico to finish the last command (once per window)
+//
+wait_ready:
+        lda command_area + CMD_GET_STATUS
+        sta $d020               // flash border if the pico's cpu is busy
+        bne wait_ready          // loop until status is not busy
+        rts
+
+//
+// Point the copier's sections at the destination page in A
+//
+set_dest:
+        clc
+.for (var k = 0; k < NUM_SECTIONS; k++) {
+    .if (k > 0 && mod(k * SECTION_SIZE, 256) == 0) {
+        adc #1                  // next page (carry stays clear)
+    }
+        sta copier + (NUM_SECTIONS - 1 - k) * SECTION_CODE_SIZE + 5
+}
+        rts
+
+//
+// Copy a 1K window, SECTION_SIZE bytes apart at a time: each pass copies byte x of every
+// section, with x counting down from SECTION_SIZE - 1.  The sections are in reverse order so
+// a partial window can be copied by entering part way through (see tail_entry).
+//
+// lda abs,x never crosses a page here, so this costs 9 cycles a byte plus 7 a pass.
+//
+copier_rom:
+.pseudopc copier {
+.for (var k = NUM_SECTIONS - 1; k >= 0; k--) {
+        lda copy_source + k * SECTION_SIZE, x
+        sta nufli_dest + k * SECTION_SIZE, x    // high byte patched by set_dest
+}
+        dex
+        bmi copied
+copier_loop:
+        jmp copier              // patched to tail_entry for the last window
+copied: rts
+}
+copier_rom_end:
+.label COPIER_SIZE = copier_rom_end - copier_rom
+.label tail_entry = copier + (NUM_SECTIONS - BYTES_LEFT / SECTION_SIZE) * SECTION_CODE_SIZE
+
+
+//
+// D64 mode: boot to BASIC with the KERNAL's ILOAD vector pointing at iload, so LOAD for
+// mailbox_d64_device reads files from the pico's D64 (see firmware/d64.h).  Only the 8K
+// switch position leaves BASIC in, so this falls back to loading the image without it.
+//
+.label iload_vector = $0330
+.label kernal_iload = $f4a5     // the KERNAL's own load, for every other device
+.label kernal_searching = $f5af // print "SEARCHING FOR <name>" in direct mode
+.label kernal_loading = $f5d2   // print "LOADING"
+.label status = $90             // KERNAL I/O status
+.label load_end = $ae           // where the next byte goes, then the end address (2 bytes)
+.label name_length = $b7
+.label secondary = $b9          // 0 to load at load_start, otherwise at the file's address
+.label device = $ba
+.label name = $bb               // file name pointer (2 bytes)
+.label load_start = $c3         // the address LOAD was called with (2 bytes)
+.label load_source = $a3        // window pointer: serial bus scratch, unused while we load
+.label load_left = $c1          // bytes left to copy (2 bytes)
+.const FILE_NOT_FOUND = 4
+
+basic_boot:
+        ldx #2
+check_basic:
+        lda $a004, x            // "CBM" of BASIC's "CBMBASIC"
+        cmp basic_signature, x
+        beq !+
+        jmp load_image          // no BASIC in the 16K position
+!:      dex
+        bpl check_basic
+
+        jsr $ff87               // kernal: RAMTAS, clear low RAM and find the top of memory
+        jsr $ff8a               // kernal: RESTOR, default vectors
+        jsr $ff81               // kernal: initialize VIC-II again, after RAMTAS
+        lda #<iload
+        sta iload_vector
+        lda #>iload
+        sta iload_vector + 1
+        cli
+        jmp ($a000)             // BASIC cold start, which leaves the ILOAD vector alone
+
+basic_signature:
+        .byte $43, $42, $4d     // "CBM" in PETSCII
+romh_signature_value:
+        .byte $52, $4f, $4d, $48    // "ROMH" in ASCII, ROMH_SIGNATURE in the firmware
+
+//
+// ILOAD hook.  The KERNAL's LOAD at $F49E has put its X/Y address in load_start, and comes
+// here with the verify flag in A: its own ILOAD is what stores that at $93.  Anything but a
+// LOAD with a name from the D64's device goes to the KERNAL, which also reports the errors for
+// those, and so does "$", so a real drive can still list its directory.
+//
+iload:  pha
+        lda mailbox_d64_device
+        beq to_kernal
+        cmp device
+        bne to_kernal
+        tsx
+        lda $0101, x            // the verify flag, pushed above
+        bne to_kernal
+        lda name_length
+        beq to_kernal
+        ldy #0
+        lda (name), y
+        cmp #'$'
+        beq to_kernal
+        pla
+        jmp load_d64
+to_kernal:
+        pla
+        jmp kernal_iload
+
+load_d64:
+        jsr kernal_searching
+
+        // the guard relocks after a second without a command, so unlock it for every LOAD
+        unlock(2)
+        jsr load_wait
+
+        // send the name: CMD_LOAD_OPEN, its length + 1 (so it's never the status read), then
+        // each character
+        lda command_area + CMD_LOAD_OPEN
+        jsr load_wait
+        ldx name_length
+        inx
+        lda command_area, x
+        jsr load_wait
+        ldy #0
+send_name:
+        lda (name), y
+        tax
+        lda command_area, x
+        jsr load_wait
+        iny
+        cpy name_length
+        bne send_name
+
+        lda mailbox_load_error
+        beq found
+        sec                     // the pico couldn't open it: return the KERNAL error
+        rts
+
+found:  jsr kernal_loading
+        ldx load_start
+        ldy load_start + 1
+        lda secondary
+        beq !+
+        ldx mailbox_load_address
+        ldy mailbox_load_address + 1
+!:      stx load_end
+        sty load_end + 1
+        lda mailbox_load_size
+        sta load_left
+        lda mailbox_load_size + 1
+        sta load_left + 1
+
+        // copy whole pages from the window while there are any left, then the last part page
+load_window:
+        jsr load_wait
+        lda #<copy_source
+        sta load_source
+        lda #>copy_source
+        sta load_source + 1
+        ldx #4                  // pages in the window
+load_page:
+        ldy #0
+        lda load_left + 1
+        beq load_last
+!:      lda (load_source), y
+        sta (load_end), y
+        iny
+        bne !-
+        inc load_source + 1
+        inc load_end + 1
+        dec load_left + 1
+        dex
+        bne load_page
+        lda command_area + CMD_NEXT_PAGE
+        jmp load_window
+
+load_last:
+        cpy load_left
+        beq loaded
+        lda (load_source), y
+        sta (load_end), y
+        iny
+        bne load_last
+loaded: tya                     // return the end address in x/y, like the KERNAL
+        clc
+        adc load_end
+        sta load_end
+        tax
+        lda load_end + 1
+        adc #0
+        sta load_end + 1
+        tay
+        lda #0
+        sta status
+        clc
+        rts
+
+//
+// Wait for the pico like wait_ready, without flashing the border under BASIC
+//
+load_wait:
+        lda command_area + CMD_GET_STATUS
+        bne load_wait
+        rts
+
+
+//
+// Cartridge library: show the pico's menu of the cartridges it has, and wait for 1-9 to pick
+// one, or space to carry on booting.  The pick is sent from RAM, since the pico stops serving
+// this ROM, and the stub there resets into the cartridge as soon as it's being served.
+//
+.label menu_screen = $8c00      // 1000 screen codes
+.label cart_switch = $8900      // address and value of a byte to poll, for each cartridge
+.label switch_stub = $033c      // cassette buffer
+.label cart_index = $02
+.const KEY_SPACE = 9            // index in the key tables
+
+menu:   ldx #0
+show:   lda menu_screen, x
+        sta $0400, x
+        lda menu_screen + $100, x
+        sta $0500, x
+        lda menu_screen + $200, x
+        sta $0600, x
+        lda menu_screen + $300, x   // past the end is sprite pointers, which don't matter
+        sta $0700, x
+        inx
+        bne show
+        lda #1                  // white text
+        jsr paint
+
+scan:   ldx #KEY_SPACE
+key:    lda key_columns, x
+        sta $dc00
+        lda $dc01
+        and key_rows, x
+        beq pressed
+        dex
+        bpl key
+        bmi scan
+pressed:
+        cpx #KEY_SPACE
+        beq picked
+        cpx mailbox_cart_count
+        bcs scan                // no cartridge with that number
+picked: stx cart_index
+
+        // the guard has relocked while the menu was up, maybe just now
+        unlock(2)
+        jsr wait_ready
+        ldx cart_index
+        cpx #KEY_SPACE
+        bne switch
+        lda #0                  // hide the menu, black on black
+        jsr paint
+        jmp no_menu
+
+switch: txa                     // table entries are 3 bytes (carry is clear after cpx)
+        asl
+        adc cart_index
+        tay
+        ldx #SWITCH_STUB_SIZE - 1
+install_stub:
+        lda switch_stub_rom, x
+        sta switch_stub, x
+        dex
+        bpl install_stub
+        lda cart_switch, y
+        sta switch_poll + 1
+        lda cart_switch + 1, y
+        sta switch_poll + 2
+        lda cart_switch + 2, y
+        sta switch_value + 1
+        ldx cart_index
+        jmp switch_stub
+
+switch_stub_rom:
+.pseudopc switch_stub {
+        lda command_area + CMD_SELECT_CART, x
+switch_poll:
+        lda $ffff               // patched: a byte of this ROM that the cartridge's differs from
+switch_value:
+        cmp #0                  // patched: the cartridge's byte there
+        bne switch_poll
+        jmp ($fffc)             // reset, and the KERNAL starts the cartridge
+}
+switch_stub_rom_end:
+.label SWITCH_STUB_SIZE = switch_stub_rom_end - switch_stub_rom
+
+//
+// Fill colour RAM with the colour in A
+//
+paint:  ldx #0
+!:      sta $d800, x
+        sta $d900, x
+        sta $da00, x
+        sta $db00, x
+        inx
+        bne !-
+        rts
+
+// Keyboard matrix positions of 1-9 and space: the CIA 1 port A value that selects each key's
+// column, and its bit in port B
+key_columns:
+        .byte $7f, $7f, $fd, $fd, $fb, $fb, $f7, $f7, $ef, $7f
+key_rows:
+        .byte $01, $08, $01, $08, $01, $08, $01, $08, $01, $10
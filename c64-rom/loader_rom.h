@@ -1,3 +0,0 @@
-#pragma once
-
-extern const uint8_t loader_rom[157];
@@ -1,2884 +0,0 @@
-#include <stdint.h>
-
-const uint8_t raspi[23042] = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-	0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-	0xE0, 0xFD, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xFF,
-	0xFE, 0x55, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-	0xFF, 0x07, 0xFF, 0xFF, 0x00, 0x08, 0x00, 0x00,
-	0x08, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFE, 0x00,
-	0x00, 0x00, 0x00, 0x37, 0xDF, 0x04, 0x03, 0xFF,
-	0xFC, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00,
-	0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-	0xFF, 0x00, 0x10, 0x00, 0x00, 0x0F, 0xFF, 0x00,
-	0x3F, 0xFF, 0x01, 0xFF, 0xFF, 0x01, 0x00, 0x00,
-	0x01, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x01, 0xFF,
-	0xFF, 0x03, 0xFF, 0xFF, 0x00, 0x07, 0x00, 0x00,
-	0x01, 0x00, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F,
-	0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-	0xFF, 0x01, 0xFF, 0xFF, 0x00, 0x80, 0x00, 0x00,
-	0x80, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xC0, 0x01,
-	0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xF0,
-	0x1F, 0xFF, 0xE0, 0x3F, 0x1F, 0xF5, 0x55, 0x3F,
-	0xEA, 0xAA, 0xFF, 0xE1, 0xFF, 0xFF, 0xC1, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x03,
-	0xFF, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-	0xFC, 0xFF, 0xE0, 0xFC, 0x03, 0xFF, 0xFF, 0x07,
-	0xFF, 0xD9, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xE0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x2A, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
-	0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0x40, 0x40, 0x40, 0x40, 0x40,
-	0x80, 0xA8, 0x8A, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
-	0xF0, 0x80, 0xA8, 0xA8, 0xA8, 0xA8, 0x8A, 0xF0,
-	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xA8, 0xA8, 0x8F,
-	0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0x00, 0x00, 0xF0,
-	0xF0, 0xF0, 0xF0, 0x40, 0x40, 0x40, 0x40, 0x40,
-	0x40, 0xF0, 0x80, 0x80, 0x80, 0x20, 0xF0, 0xF0,
-	0x20, 0xA8, 0xA8, 0xA8, 0xA8, 0x80, 0x80, 0x80,
-	0xF0, 0xF0, 0x80, 0xA8, 0xA8, 0xA8, 0xF0, 0x4E,
-	0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0x00, 0x00, 0xF0,
-	0xF0, 0xF0, 0xF0, 0x40, 0x40, 0x40, 0x40, 0x40,
-	0x46, 0xF0, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF0,
-	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-	0x20, 0x80, 0x80, 0xA8, 0xA8, 0xA8, 0x20, 0x40,
-	0x40, 0xE4, 0xE4, 0xE4, 0x40, 0x00, 0x00, 0xF0,
-	0xF0, 0xF0, 0xF0, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4,
-	0xE4, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-	0x80, 0x80, 0x80, 0xA8, 0xA8, 0x8A, 0x60, 0xF4,
-	0xF4, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0xF0,
-	0xF0, 0xF0, 0xF0, 0x40, 0x40, 0x40, 0x40, 0x40,
-	0x40, 0x40, 0x20, 0xA8, 0xA8, 0xA8, 0xA8, 0x80,
-	0xF0, 0x80, 0x82, 0x80, 0x80, 0x80, 0x80, 0xF0,
-	0x80, 0x80, 0x80, 0xA8, 0xA8, 0x8A, 0x64, 0x64,
-	0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x00, 0xF0,
-	0xF0, 0xF0, 0xF0, 0x64, 0x64, 0x64, 0x64, 0x64,
-	0x64, 0x64, 0x64, 0x64, 0x60, 0xF0, 0xF0, 0xF0,
-	0xF0, 0x80, 0x80, 0x80, 0x80, 0xA8, 0xA8, 0x20,
-	0xF0, 0xF0, 0xF0, 0xF0, 0x60, 0x6F, 0x6F, 0x6F,
-	0x6F, 0x64, 0x64, 0x64, 0x64, 0x00, 0x00, 0xF0,
-	0xF0, 0xF0, 0xF0, 0x64, 0x64, 0x64, 0x64, 0x64,
-	0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x60, 0xF0,
-	0x80, 0x80, 0x80, 0x80, 0x80, 0xAF, 0xAF, 0xA0,
-	0xF0, 0x60, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-	0x64, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00, 0xF0,
-	0xF0, 0xF0, 0xF0, 0x60, 0x60, 0x60, 0x60, 0x60,
-	0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
-	0x60, 0xF0, 0xA0, 0xA8, 0xA8, 0x8A, 0xF0, 0x6F,
-	0x6F, 0x6F, 0x6F, 0x60, 0x60, 0x60, 0x60, 0x60,
-	0x60, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00, 0xF0,
-	0xF0, 0xF0, 0xF0, 0x60, 0x60, 0x60, 0x60, 0x60,
-	0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
-	0x60, 0x60, 0x60, 0x00, 0x00, 0x60, 0x60, 0x60,
-	0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
-	0x60, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xC8, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x80,
-	0x0F, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E,
-	0x0E, 0x0E, 0x06, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E,
-	0x0E, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
-	0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
-	0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
-	0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
-	0x0F, 0x0E, 0x0F, 0x0F, 0x06, 0x0A, 0x0A, 0x0A,
-	0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0E,
-	0x0E, 0x0E, 0x0E, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E,
-	0x0E, 0x0E, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
-	0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
-	0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
-	0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x0E, 0x04, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05,
-	0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x00, 0x00, 0x0B,
-	0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x0B, 0x0F, 0x04, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-	0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
-	0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
-	0x00, 0x00, 0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x0A,
-	0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
-	0x0E, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x04, 0x04, 0x06, 0x06, 0x04, 0x04, 0x0F, 0x0F,
-	0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xF0, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE,
-	0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xFC,
-	0x00, 0x07, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF,
-	0xFE, 0x00, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0x80,
-	0x03, 0xFF, 0x80, 0xAA, 0xEA, 0xAA, 0x55, 0x55,
-	0x55, 0x03, 0xFF, 0xFE, 0x03, 0xFF, 0xFC, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-	0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x80, 0x00, 0x08, 0xC0, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x80, 0x00,
-	0x00, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0x00,
-	0x7F, 0xFF, 0x01, 0xFF, 0xFF, 0x01, 0xFF, 0xFF,
-	0x01, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x7F,
-	0xFF, 0x01, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x00,
-	0x00, 0x3E, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF,
-	0x80, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xE0, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x03,
-	0xFF, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0xFF,
-	0xC0, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xE0, 0x03,
-	0xFF, 0xE0, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00,
-	0x00, 0xFF, 0xF0, 0x3F, 0xFF, 0xE0, 0x7F, 0x80,
-	0x15, 0x55, 0x00, 0x00, 0x00, 0xFF, 0xC1, 0xFF,
-	0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xF0, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x00,
-	0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xC0,
-	0x00, 0xFF, 0xE1, 0xFC, 0xF8, 0xF1, 0xF8, 0x0F,
-	0xFB, 0xAA, 0x38, 0x55, 0x55, 0x00, 0x1F, 0xC0,
-	0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x54, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00,
-	0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0x40, 0x40, 0x40, 0x40, 0x40,
-	0xF0, 0x8A, 0x2A, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
-	0xF0, 0x80, 0x80, 0x80, 0x80, 0xA8, 0xA8, 0x20,
-	0xF0, 0xF0, 0xF0, 0xF0, 0x2F, 0x28, 0x8A, 0xF0,
-	0x4E, 0xE4, 0xE4, 0xE4, 0xE4, 0x00, 0x00, 0xF0,
-	0xF0, 0xF0, 0xF0, 0x40, 0x40, 0x40, 0x40, 0x40,
-	0x40, 0xF0, 0x80, 0x80, 0x80, 0x80, 0xF0, 0xF0,
-	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-	0xF0, 0xF0, 0x80, 0xA8, 0xA8, 0x8A, 0xF0, 0x46,
-	0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0x00, 0x00, 0xF0,
-	0xF0, 0xF0, 0xF0, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4,
-	0xE4, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF0,
-	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x82,
-	0x20, 0x80, 0x80, 0xA8, 0xA8, 0xA8, 0x20, 0x40,
-	0x40, 0xE4, 0xE4, 0x40, 0x40, 0x00, 0x00, 0xF0,
-	0xF0, 0xF0, 0xF0, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4,
-	0xE4, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-	0x20, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-	0x80, 0x80, 0x80, 0xA8, 0xA8, 0x8A, 0x64, 0xF4,
-	0xF4, 0x40, 0x40, 0x64, 0x64, 0x00, 0x00, 0xF0,
-	0xF0, 0xF0, 0xF0, 0x40, 0x40, 0x40, 0x40, 0x40,
-	0x40, 0x64, 0x60, 0x8A, 0xA8, 0xA8, 0xA8, 0x80,
-	0xF0, 0xF0, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF0,
-	0x80, 0x80, 0x80, 0xA8, 0xA8, 0x8F, 0x64, 0x64,
-	0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x00, 0xF0,
-	0xF0, 0xF0, 0xF0, 0x64, 0x64, 0x64, 0x64, 0x64,
-	0x64, 0x64, 0x64, 0xF0, 0xA8, 0xA8, 0xA8, 0x80,
-	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
-	0x80, 0x80, 0x80, 0x8A, 0x2F, 0x64, 0x64, 0x64,
-	0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x00, 0xF0,
-	0xF0, 0xF0, 0xF0, 0x64, 0x64, 0x64, 0x64, 0x64,
-	0x64, 0x6F, 0x6F, 0x6F, 0x60, 0xF0, 0xF0, 0xF0,
-	0x20, 0x80, 0x80, 0x80, 0x80, 0xAF, 0xAF, 0xA0,
-	0xF0, 0xF0, 0xF0, 0x60, 0x6F, 0x6F, 0x6F, 0x6F,
-	0x6F, 0x64, 0x64, 0x64, 0x64, 0x00, 0x00, 0xF0,
-	0xF0, 0xF0, 0xF0, 0x64, 0x64, 0x64, 0x64, 0x64,
-	0x64, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x60, 0xF0,
-	0x20, 0x82, 0x80, 0x80, 0x80, 0xA8, 0xA8, 0x20,
-	0xF0, 0x60, 0x64, 0x64, 0x60, 0x60, 0x60, 0x60,
-	0x60, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00, 0xF0,
-	0xF0, 0xF0, 0xF0, 0x60, 0x60, 0x60, 0x60, 0x60,
-	0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
-	0x60, 0xF0, 0xF0, 0x20, 0x20, 0x20, 0xF0, 0x60,
-	0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
-	0x60, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xC9, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x81,
-	0x0F, 0x0F, 0x0E, 0x00, 0x00, 0x00, 0x0B, 0x06,
-	0x04, 0x06, 0x0B, 0x04, 0x0C, 0x0C, 0x0C, 0x0C,
-	0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
-	0x0C, 0x0C, 0x0B, 0x0B, 0x0B, 0x0A, 0x0A, 0x0A,
-	0x0A, 0x0A, 0x0A, 0x0A, 0x02, 0x02, 0x00, 0x00,
-	0x02, 0x0F, 0x0A, 0x0A, 0x0A, 0x0A, 0x0F, 0x02,
-	0x02, 0x02, 0x0A, 0x0A, 0x0A, 0x02, 0x02, 0x08,
-	0x0F, 0x02, 0x00, 0x00, 0x00, 0x02, 0x08, 0x08,
-	0x08, 0x0A, 0x0A, 0x0A, 0x08, 0x0A, 0x0A, 0x0A,
-	0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
-	0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0F, 0x0A,
-	0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x02,
-	0x08, 0x0F, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x0D, 0x00, 0x00, 0x06, 0x06, 0x05, 0x0B, 0x0C,
-	0x0C, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x0C,
-	0x0F, 0x0B, 0x05, 0x0B, 0x0B, 0x08, 0x08, 0x0A,
-	0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0F, 0x00,
-	0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
-	0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x08, 0x0A, 0x0A, 0x0A, 0x0A, 0x02,
-	0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
-	0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0F, 0x00,
-	0x08, 0x08, 0x08, 0x08, 0x08, 0x0F, 0x00, 0x00,
-	0x00, 0x0F, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
-	0x00, 0x00, 0x7F, 0x80, 0x8F, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-	0x03, 0xFF, 0xE0, 0x03, 0xFF, 0xF0, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x83, 0xFF, 0xFF, 0x03,
-	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x01, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-	0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00,
-	0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
-	0x01, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x00, 0x3F,
-	0xFF, 0x00, 0x3F, 0xFF, 0x01, 0xFF, 0xFF, 0x01,
-	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xC0, 0x7F, 0xFF, 0xC0, 0x3F, 0xFF, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x3E, 0x00,
-	0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-	0xC0, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xE0, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00,
-	0x00, 0x01, 0x00, 0x00, 0xFF, 0xF0, 0x7F, 0xFF,
-	0xE0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0x81, 0xFF, 0xFF, 0x03, 0xFF, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-	0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80,
-	0x00, 0xFF, 0x00, 0x00, 0xE0, 0x73, 0xF8, 0xC0,
-	0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x1E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4,
-	0x40, 0x28, 0x2F, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
-	0xF0, 0x82, 0x80, 0x80, 0x80, 0xA8, 0xA8, 0x20,
-	0xF0, 0xF0, 0xF0, 0x28, 0xA8, 0x2A, 0x28, 0xF0,
-	0x4E, 0xE4, 0xE4, 0xE4, 0xE4, 0x00, 0x00, 0xF0,
-	0xF0, 0xF0, 0xF0, 0x40, 0x40, 0x40, 0x40, 0x40,
-	0x40, 0xF0, 0x80, 0x80, 0x80, 0x80, 0xF0, 0xF0,
-	0x80, 0x80, 0x80, 0x80, 0x80, 0xA8, 0xA8, 0x8A,
-	0xF0, 0x80, 0xA8, 0xA8, 0xA8, 0xA8, 0xF0, 0x40,
-	0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0x00, 0x00, 0xF0,
-	0xF0, 0xF0, 0xF0, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4,
-	0xE4, 0x60, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x82,
-	0x80, 0x80, 0x80, 0xA8, 0xA8, 0xA8, 0x20, 0x46,
-	0xF4, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0xF0,
-	0xF0, 0xF0, 0xF0, 0x40, 0x40, 0xE4, 0xE4, 0xE4,
-	0xE4, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-	0xF0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-	0x80, 0x80, 0x80, 0xA8, 0xA8, 0x8A, 0x64, 0xF4,
-	0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x00, 0xF0,
-	0xF0, 0xF0, 0xF0, 0x64, 0x40, 0x40, 0x40, 0x40,
-	0x40, 0xF4, 0x64, 0x8A, 0xA8, 0xA8, 0xA8, 0x80,
-	0xF0, 0xF0, 0xF0, 0x20, 0x80, 0x20, 0xF0, 0xF0,
-	0x80, 0x80, 0x80, 0xA8, 0x8A, 0x6F, 0x64, 0x64,
-	0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x00, 0xF0,
-	0xF0, 0xF0, 0xF0, 0x64, 0x64, 0x64, 0x64, 0x64,
-	0x64, 0x64, 0x64, 0x64, 0xF2, 0x8A, 0xA8, 0x80,
-	0xF0, 0xF0, 0xF0, 0x20, 0x20, 0xF0, 0xF0, 0xF0,
-	0x80, 0xA8, 0xA8, 0x8A, 0xF0, 0x64, 0x64, 0x64,
-	0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x00, 0xF0,
-	0xF0, 0xF0, 0xF0, 0x64, 0x64, 0x64, 0x64, 0x64,
-	0x64, 0x64, 0x64, 0x64, 0x64, 0x40, 0xF0, 0xF0,
-	0x80, 0x80, 0x80, 0x80, 0x80, 0xAF, 0xAF, 0xA0,
-	0xF0, 0xF0, 0x60, 0x64, 0x64, 0x64, 0x64, 0x64,
-	0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x00, 0xF0,
-	0xF0, 0xF0, 0xF0, 0x64, 0x64, 0x64, 0x64, 0x64,
-	0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x60,
-	0xF0, 0x80, 0x80, 0x80, 0x80, 0xA8, 0xA8, 0xF0,
-	0x60, 0xF6, 0xF6, 0x60, 0x60, 0x60, 0x60, 0x60,
-	0x60, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00, 0xF0,
-	0xF0, 0xF0, 0xF0, 0x60, 0x60, 0x60, 0x60, 0x60,
-	0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
-	0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60,
-	0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
-	0x60, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xCA, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0x82,
-	0x0F, 0x0F, 0x0F, 0x06, 0x0E, 0x0C, 0x0C, 0x0C,
-	0x0C, 0x0C, 0x0C, 0x0B, 0x0D, 0x0D, 0x0C, 0x0C,
-	0x0B, 0x0B, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x0B, 0x04, 0x06, 0x0F, 0x0F, 0x0F,
-	0x0F, 0x0F, 0x0F, 0x06, 0x0A, 0x06, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-	0x0E, 0x0E, 0x0E, 0x0F, 0x06, 0x00, 0x00, 0x1F,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
-	0x04, 0x04, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
-	0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
-	0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
-	0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
-	0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
-	0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
-	0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
-	0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
-	0x0F, 0x0F, 0x06, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
-	0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x17, 0x0F,
-	0x0F, 0x15, 0x0F, 0x0F, 0x0F, 0x0F, 0x13, 0x11,
-	0x1D, 0x1B, 0x19, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
-	0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
-	0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x5F, 0xFF,
-	0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x03, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x3F, 0xE1, 0x00, 0x1F, 0xFF, 0x00,
-	0xD0, 0x00, 0x00, 0xF0, 0x00, 0xFF, 0xFF, 0xC0,
-	0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x07, 0xFF,
-	0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-	0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xE0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
-	0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-	0x03, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x03, 0xFF,
-	0xFF, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x81,
-	0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0xE0, 0x1F, 0xFF, 0xC0, 0x1F,
-	0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF,
-	0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xE0, 0x00,
-	0xFF, 0xC0, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00,
-	0x10, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0xFF,
-	0xE0, 0xFF, 0xFF, 0xC0, 0xFF, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0xFF, 0x03, 0xFF, 0xFC, 0x03,
-	0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80,
-	0x3F, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4,
-	0x40, 0xF0, 0x80, 0x82, 0x80, 0xF0, 0xF0, 0xF0,
-	0x20, 0xA8, 0xA8, 0xA8, 0xA8, 0x80, 0x80, 0x80,
-	0xF0, 0xF0, 0x20, 0x8A, 0xA8, 0x8A, 0xF0, 0x64,
-	0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0x00, 0x00, 0xF0,
-	0xF0, 0xF0, 0xF0, 0x40, 0x40, 0x40, 0x40, 0x40,
-	0x40, 0xF0, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF0,
-	0x80, 0x80, 0x80, 0x80, 0x80, 0xA8, 0xA8, 0xA8,
-	0x20, 0x80, 0xA8, 0xA8, 0xA8, 0xA8, 0x20, 0x40,
-	0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0x00, 0x00, 0xF0,
-	0xF0, 0xF0, 0xF0, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4,
-	0xE4, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-	0x80, 0x80, 0x80, 0xA8, 0xA8, 0xA8, 0x02, 0xF4,
-	0xF4, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0xF0,
-	0xF0, 0xF0, 0xF0, 0x40, 0x40, 0x40, 0x40, 0xE4,
-	0xE4, 0x40, 0x80, 0xA8, 0xA8, 0xA8, 0xA8, 0x80,
-	0xF0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x20,
-	0x80, 0x80, 0x80, 0xA8, 0xA8, 0x8A, 0x64, 0x64,
-	0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x00, 0xF0,
-	0xF0, 0xF0, 0xF0, 0x64, 0x64, 0x64, 0x40, 0x40,
-	0x40, 0xF4, 0x64, 0x82, 0xA8, 0xA8, 0xA8, 0x80,
-	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
-	0x80, 0x80, 0x80, 0xA8, 0x28, 0x64, 0x64, 0x64,
-	0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x00, 0xF0,
-	0xF0, 0xF0, 0xF0, 0x64, 0x64, 0x64, 0x64, 0x64,
-	0x64, 0x64, 0x64, 0x64, 0xF0, 0xF2, 0x28, 0xF0,
-	0xF0, 0xF0, 0x80, 0xA8, 0xA8, 0xA8, 0x80, 0xF0,
-	0xF0, 0x8A, 0x80, 0xF0, 0x60, 0x64, 0x64, 0x64,
-	0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x00, 0xF0,
-	0xF0, 0xF0, 0xF0, 0x64, 0x64, 0x64, 0x64, 0x64,
-	0x64, 0x40, 0x40, 0x40, 0x40, 0x40, 0xF0, 0xF0,
-	0x80, 0x80, 0x80, 0x80, 0x80, 0xAF, 0xAF, 0xA0,
-	0xF0, 0xF0, 0x60, 0x64, 0x64, 0x64, 0x64, 0x64,
-	0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x00, 0xF0,
-	0xF0, 0xF0, 0xF0, 0x60, 0x60, 0x60, 0x60, 0x60,
-	0x60, 0x64, 0x64, 0x64, 0x64, 0x64, 0x60, 0xF6,
-	0x60, 0x08, 0xA8, 0xA8, 0xA8, 0xA8, 0x28, 0xF0,
-	0xF6, 0xF6, 0xF6, 0x60, 0x60, 0x60, 0x60, 0x60,
-	0x60, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00, 0xF0,
-	0xF0, 0xF0, 0xF0, 0x60, 0x60, 0x60, 0x60, 0x60,
-	0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
-	0x60, 0x60, 0x60, 0x00, 0x00, 0x00, 0x60, 0x60,
-	0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
-	0x60, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xCB, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0x83,
-	0x78, 0xA9, 0x01, 0x20, 0x40, 0x3F, 0xA9, 0x10,
-	0x8D, 0x14, 0x03, 0xA9, 0x31, 0x8D, 0x15, 0x03,
-	0xA2, 0x2F, 0xBD, 0xC0, 0x3F, 0x9D, 0x00, 0xD0,
-	0xCA, 0x10, 0xF7, 0xA9, 0x00, 0x85, 0xFB, 0xA9,
-	0x10, 0x85, 0xFC, 0xA2, 0x00, 0x8A, 0x29, 0x03,
-	0xA8, 0xB9, 0x48, 0x33, 0x8D, 0x50, 0x30, 0xB9,
-	0x44, 0x33, 0x8D, 0x3D, 0x30, 0xB9, 0x40, 0x33,
-	0x8D, 0xA4, 0x30, 0xA8, 0xB9, 0x00, 0x33, 0x99,
-	0x00, 0x33, 0xC8, 0xC0, 0x07, 0xD0, 0xF5, 0xBD,
-	0x01, 0x24, 0xA0, 0x28, 0x20, 0xB0, 0x33, 0x8D,
-	0x00, 0x33, 0x8C, 0x08, 0x33, 0xBD, 0x81, 0x24,
-	0xA0, 0x29, 0x20, 0xB0, 0x33, 0x8D, 0x0B, 0x33,
-	0x8C, 0x0D, 0x33, 0xBD, 0x01, 0x28, 0xA0, 0x2A,
-	0x20, 0xB0, 0x33, 0x8D, 0x10, 0x33, 0x8C, 0x12,
-	0x33, 0xBD, 0x81, 0x28, 0xA0, 0x2B, 0x20, 0xB0,
-	0x33, 0x8D, 0x15, 0x33, 0x8C, 0x17, 0x33, 0xBD,
-	0x01, 0x2C, 0xA0, 0x2C, 0x20, 0xB0, 0x33, 0x8D,
-	0x1A, 0x33, 0x8C, 0x1C, 0x33, 0xBD, 0x81, 0x2C,
-	0xA0, 0x2D, 0x20, 0xB0, 0x33, 0x8D, 0x1F, 0x33,
-	0x8C, 0x21, 0x33, 0xBD, 0x4C, 0x33, 0x8D, 0x24,
-	0x33, 0x86, 0x02, 0xA2, 0x00, 0xA0, 0x00, 0xBD,
-	0x00, 0x33, 0x91, 0xFB, 0xC8, 0xE8, 0xE0, 0x28,
-	0xD0, 0xF5, 0x98, 0x18, 0x65, 0xFB, 0x90, 0x02,
-	0xE6, 0xFC, 0x85, 0xFB, 0xA6, 0x02, 0xE8, 0xE0,
-	0x64, 0xF0, 0x03, 0x4C, 0x25, 0x30, 0xA0, 0x05,
-	0xB9, 0xD0, 0x33, 0x91, 0xFB, 0x88, 0x10, 0xF8,
-	0xA9, 0x00, 0x8D, 0xBE, 0x19, 0xA9, 0xDD, 0x8D,
-	0xBF, 0x19, 0xA9, 0x3A, 0x85, 0x3A, 0xA9, 0xA0,
-	0x8D, 0x26, 0x10, 0xA2, 0x27, 0xBD, 0x80, 0x22,
-	0x9D, 0x80, 0x02, 0xBD, 0xD8, 0x73, 0x9D, 0xD8,
-	0x33, 0xCA, 0x10, 0xF1, 0xA2, 0x07, 0xBD, 0xF8,
-	0x23, 0x9D, 0xF8, 0x03, 0xA9, 0x00, 0x9D, 0xF8,
-	0x7F, 0xA9, 0xFE, 0x9D, 0xF8, 0x07, 0xCA, 0x10,
-	0xED, 0xAD, 0x0D, 0xDC, 0x58, 0x4C, 0x0D, 0x31,
-	0xA9, 0x2A, 0x8D, 0x12, 0xD0, 0xA9, 0x30, 0x8D,
-	0x14, 0x03, 0xEE, 0x19, 0xD0, 0x58, 0xEA, 0xEA,
-	0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA,
-	0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0x4C, 0x1E, 0x31,
-	0xBA, 0x8A, 0x18, 0x69, 0x06, 0xAA, 0x9A, 0xA0,
-	0xFF, 0xB9, 0x01, 0xDC, 0x29, 0xFC, 0xAE, 0x12,
-	0xD0, 0xE0, 0x2A, 0xF0, 0x00, 0x8C, 0x18, 0xD0,
-	0x09, 0x02, 0x8D, 0x00, 0xDD, 0xA2, 0x2B, 0x8E,
-	0x01, 0xD0, 0x8E, 0x03, 0xD0, 0x8E, 0x05, 0xD0,
-	0x8E, 0x07, 0xD0, 0x8E, 0x09, 0xD0, 0x8E, 0x0B,
-	0xD0, 0x8E, 0x0D, 0xD0, 0x8E, 0x0F, 0xD0, 0xAE,
-	0x00, 0x24, 0x8E, 0x28, 0xD0, 0xAE, 0x80, 0x24,
-	0x8E, 0x29, 0xD0, 0xAE, 0x00, 0x28, 0x8E, 0x2A,
-	0xD0, 0xAE, 0x80, 0x28, 0x8E, 0x2B, 0xD0, 0xAE,
-	0x00, 0x2C, 0x8E, 0x2C, 0xD0, 0xAE, 0x80, 0x2C,
-	0x8E, 0x2D, 0xD0, 0xA2, 0xAA, 0x8E, 0x01, 0xD0,
-	0x8E, 0x03, 0xD0, 0x8E, 0x05, 0xD0, 0x8E, 0x07,
-	0xD0, 0x8E, 0x09, 0xD0, 0x8E, 0x0B, 0xD0, 0x8E,
-	0x0D, 0xD0, 0x8E, 0x0F, 0xD0, 0x09, 0x01, 0x8D,
-	0xBC, 0x19, 0xA9, 0x00, 0x8C, 0x17, 0xD0, 0x99,
-	0x18, 0xD0, 0x8C, 0x17, 0xD0, 0xA0, 0x05, 0x88,
-	0xD0, 0xFD, 0xAD, 0xF0, 0x3F, 0x8D, 0x26, 0xD0,
-	0xAD, 0xF1, 0x3F, 0x8D, 0x25, 0xD0, 0xAD, 0xF7,
-	0x3F, 0x8D, 0x27, 0xD0, 0xAD, 0xF6, 0x3F, 0x8D,
-	0x2E, 0xD0, 0x24, 0x00, 0xA9, 0x38, 0xA0, 0x78,
-	0x8C, 0x18, 0xD0, 0xA2, 0x3E, 0x20, 0x00, 0x10,
-	0xA9, 0x00, 0x8D, 0x17, 0xD0, 0xA9, 0x29, 0x8D,
-	0x12, 0xD0, 0xA9, 0x10, 0x8D, 0x14, 0x03, 0xEE,
-	0x19, 0xD0, 0x4C, 0x81, 0xEA, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x3C,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
-	0x28, 0xD0, 0xA0, 0x00, 0x8C, 0x29, 0xD0, 0xA0,
-	0x00, 0x8C, 0x2A, 0xD0, 0xA0, 0x00, 0x8C, 0x2B,
-	0xD0, 0xA0, 0x00, 0x8C, 0x2C, 0xD0, 0xA0, 0x00,
-	0x8C, 0x2D, 0xD0, 0xA0, 0x00, 0x8C, 0x18, 0xD0,
-	0xA4, 0x3A, 0x8C, 0x11, 0xD0, 0xA0, 0x00, 0xA0,
-	0x3C, 0x8C, 0x11, 0xD0, 0xA0, 0x00, 0xA0, 0x00,
-	0x8E, 0x11, 0xD0, 0x8D, 0x11, 0xD0, 0xA0, 0x00,
-	0x02, 0x00, 0x00, 0x02, 0x39, 0x28, 0x2F, 0x34,
-	0x06, 0x06, 0x06, 0x03, 0x68, 0x58, 0x48, 0x38,
-	0x28, 0x18, 0x08, 0x78, 0x68, 0x58, 0x48, 0x38,
-	0x28, 0x18, 0x08, 0x78, 0x68, 0x58, 0x48, 0x38,
-	0x28, 0x18, 0x08, 0x78, 0x68, 0x58, 0x48, 0x38,
-	0x28, 0x18, 0x08, 0x78, 0x68, 0x58, 0x48, 0x38,
-	0x28, 0x18, 0x08, 0x78, 0x68, 0x58, 0x48, 0x38,
-	0x28, 0x18, 0x08, 0x78, 0x68, 0x58, 0x48, 0x38,
-	0x28, 0x18, 0x08, 0x78, 0x68, 0x58, 0x48, 0x38,
-	0x28, 0x18, 0x08, 0x03, 0x98, 0xA8, 0xB8, 0x88,
-	0x98, 0xA8, 0xB8, 0x88, 0x98, 0xA8, 0xB8, 0x88,
-	0x98, 0xA8, 0xB8, 0x88, 0x98, 0xA8, 0xB8, 0x98,
-	0xA8, 0xB8, 0x88, 0x98, 0xA8, 0xB8, 0x88, 0x98,
-	0xA8, 0xB8, 0x88, 0x98, 0xA8, 0xB8, 0x88, 0x18,
-	0x85, 0x03, 0x4A, 0x4A, 0x4A, 0x4A, 0xF0, 0x15,
-	0xC9, 0x01, 0xD0, 0x08, 0xA5, 0x03, 0x29, 0x0F,
-	0xA8, 0xA9, 0xD4, 0x60, 0xC9, 0x02, 0xD0, 0x02,
-	0xA9, 0x00, 0x09, 0x20, 0xA8, 0xA5, 0x03, 0x60,
-	0xA0, 0x10, 0x8C, 0x11, 0xD0, 0x60, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x55, 0xAA, 0x55, 0xAA, 0xAA, 0x55, 0xAA, 0x55,
-	0x51, 0xAC, 0x55, 0xAA, 0xAA, 0x55, 0xAA, 0x55,
-	0x11, 0x44, 0x51, 0xAA, 0xAA, 0x55, 0xAA, 0x55,
-	0x11, 0x44, 0x11, 0xA8, 0xAE, 0x55, 0xAA, 0x55,
-	0x14, 0x46, 0x12, 0x45, 0xEE, 0xBB, 0xAA, 0x55,
-	0x03, 0x01, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xB0,
-	0xAA, 0x55, 0xD5, 0x4B, 0x21, 0x04, 0x00, 0x00,
-	0x60, 0xE0, 0x40, 0x80, 0x80, 0x00, 0x00, 0x01,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xAA,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02,
-	0x03, 0x0E, 0x15, 0x3A, 0x15, 0xAA, 0xAA, 0x55,
-	0xAA, 0x55, 0x55, 0xAA, 0x55, 0xAA, 0xAA, 0x55,
-	0xAA, 0x55, 0x55, 0xAA, 0x55, 0xAA, 0xAA, 0x55,
-	0xAA, 0x55, 0x55, 0xAA, 0x55, 0xAA, 0xAA, 0x55,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0x55, 0xAA,
-	0x5C, 0xAE, 0xAA, 0x55, 0xAA, 0x55, 0x55, 0xAA,
-	0x00, 0x00, 0x80, 0x40, 0x20, 0x90, 0x58, 0xA8,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-	0x00, 0x00, 0x00, 0x00, 0x03, 0x10, 0x75, 0xAA,
-	0x00, 0x00, 0x00, 0x7F, 0xAA, 0x55, 0xAA, 0x55,
-	0x02, 0x03, 0x02, 0x01, 0x60, 0x90, 0x58, 0xAC,
-	0xAA, 0x54, 0x56, 0xAC, 0xD8, 0x00, 0x00, 0x00,
-	0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-	0x02, 0x05, 0x15, 0x3A, 0x75, 0xEA, 0x2A, 0x55,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x56,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xA8, 0x22,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x22, 0x88, 0x22,
-	0xAA, 0x55, 0xAA, 0x52, 0x88, 0x22, 0x88, 0x22,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x75, 0xEE,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x58, 0xA8, 0x54, 0xAC, 0x54, 0xAC, 0x56, 0xAB,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x0F, 0x0E, 0x1D, 0x3A, 0x35, 0x3A, 0x35, 0x2A,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x56, 0xAB, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x00, 0x80, 0x60, 0xB8, 0x56, 0xA9, 0x55, 0xAA,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x04, 0x06, 0x0D, 0x0E, 0x0D, 0x0A, 0x0D, 0x1A,
-	0xAA, 0x55, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0xAA, 0x55, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0xAA, 0x55, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0xAA, 0x55, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0xAA, 0x55, 0xAA, 0x55,
-	0x55, 0xAA, 0x55, 0xAA, 0xAA, 0x55, 0xAA, 0x55,
-	0x54, 0xAC, 0x56, 0xAB, 0x55, 0xAA, 0xAA, 0x54,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x0E,
-	0x03, 0x0E, 0x15, 0x2A, 0x2A, 0x55, 0xAA, 0x55,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xA8, 0x50, 0x56, 0xAF, 0xA8, 0x54, 0xAA, 0x54,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
-	0x03, 0x04, 0x03, 0x07, 0x0F, 0x07, 0x0F, 0x1D,
-	0xAA, 0x22, 0x88, 0x22, 0x88, 0x22, 0x88, 0x22,
-	0x88, 0x22, 0x88, 0x22, 0x88, 0x22, 0x88, 0x22,
-	0x88, 0x22, 0x88, 0x22, 0x88, 0x22, 0x88, 0x22,
-	0x88, 0x22, 0x88, 0x22, 0x88, 0x22, 0x88, 0x22,
-	0x88, 0x22, 0x88, 0x22, 0x88, 0x22, 0x88, 0x20,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x77, 0xDD, 0x88, 0x22, 0x88, 0x22, 0x88, 0x22,
-	0x75, 0xDD, 0x88, 0x22, 0x88, 0x22, 0x88, 0x22,
-	0x55, 0xFA, 0x88, 0x22, 0x88, 0x22, 0x88, 0x22,
-	0x55, 0xAA, 0xAA, 0x20, 0x88, 0x22, 0x88, 0x22,
-	0x55, 0xAA, 0xAA, 0x55, 0x8A, 0x22, 0x88, 0x22,
-	0x56, 0xAB, 0xAA, 0x55, 0xAA, 0x41, 0x88, 0x22,
-	0x00, 0x00, 0x80, 0x80, 0x40, 0xC0, 0xE0, 0xE0,
-	0x75, 0x4A, 0x75, 0x7A, 0x35, 0x3A, 0x35, 0x3A,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x58, 0xAC, 0x54, 0xAF, 0x55, 0xAA, 0x55, 0xAA,
-	0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x40, 0xC0,
-	0x1D, 0x1A, 0x0D, 0x0A, 0x0D, 0x0E, 0x0D, 0x06,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAB, 0x55, 0xAA, 0x55, 0xAA, 0x56, 0xAC,
-	0x80, 0x00, 0x80, 0x00, 0x00, 0x01, 0x03, 0x03,
-	0x1D, 0x3A, 0x75, 0xEA, 0xD5, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xAA, 0x54, 0xAA, 0x54, 0xAA, 0x54, 0xAA, 0x54,
-	0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x7F, 0xFE,
-	0x17, 0x3D, 0x37, 0x5D, 0x37, 0x7F, 0x00, 0x00,
-	0x77, 0xDD, 0x77, 0xDF, 0x00, 0x00, 0x00, 0x00,
-	0x88, 0x22, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x88, 0x22, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x88, 0x22, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x88, 0x22, 0x88, 0x22, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x88, 0x22, 0x88, 0x22, 0x88, 0x02, 0xFF, 0xFF,
-	0x88, 0x22, 0x88, 0x22, 0x88, 0x22, 0xFF, 0xFF,
-	0x88, 0x22, 0x88, 0x22, 0x88, 0x22, 0x88, 0x02,
-	0x88, 0x22, 0x88, 0x22, 0x88, 0x22, 0x88, 0x22,
-	0xE0, 0xF0, 0xE0, 0xF0, 0xF8, 0xF8, 0xFC, 0xDC,
-	0x15, 0x1A, 0x0D, 0x0E, 0x0D, 0x04, 0x03, 0x03,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0xAA, 0x55,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0xAA, 0x55,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0xAA, 0x55,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0xAA, 0x55,
-	0x60, 0xB0, 0x58, 0xB8, 0x58, 0xA8, 0x54, 0xAC,
-	0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x55, 0xAA, 0x55, 0x6A, 0xD5, 0x3A, 0x1D, 0x06,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAE,
-	0x54, 0xA8, 0x58, 0x90, 0x60, 0x80, 0x80, 0x00,
-	0x05, 0x06, 0x0D, 0x0A, 0x1D, 0x1A, 0x15, 0x1A,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0x57, 0xAE, 0x56, 0xAE, 0x54, 0xA8, 0x58, 0x90,
-	0x00, 0x01, 0x01, 0x02, 0x02, 0x04, 0x0C, 0x0C,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x44,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x11, 0x44,
-	0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x44, 0x11, 0x44,
-	0xFF, 0xFF, 0xFF, 0xFF, 0x11, 0x44, 0x11, 0x44,
-	0xFF, 0xFF, 0x00, 0x04, 0x11, 0x44, 0x11, 0x44,
-	0xFF, 0xFF, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x44, 0x11, 0x44,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x44,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x44,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xF6, 0xFE, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x01, 0x00, 0x80, 0x80, 0x40, 0x60, 0x10, 0x08,
-	0x2A, 0x15, 0x75, 0x1A, 0x0D, 0x04, 0x01, 0x00,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x15,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0x54, 0xAC, 0x56, 0xAE, 0x56, 0xAC, 0x54, 0xAC,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x55, 0x6A, 0x35, 0x03, 0x00, 0x00, 0x00, 0x00,
-	0x55, 0xAA, 0x55, 0xAA, 0xF5, 0x02, 0x00, 0x00,
-	0x55, 0xAA, 0x55, 0xAA, 0x57, 0x50, 0x00, 0x00,
-	0x55, 0xAA, 0x55, 0xBC, 0xE0, 0x00, 0x00, 0x00,
-	0x58, 0xF0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x35, 0x3A, 0x35, 0x7A, 0x35, 0x7A, 0x35, 0x3A,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xAA, 0x55, 0xAA, 0x56, 0x56, 0xB8, 0x18, 0x60,
-	0x60, 0xC0, 0x80, 0x00, 0x00, 0x01, 0x01, 0x06,
-	0x01, 0x14, 0x31, 0x64, 0xD1, 0xC4, 0x11, 0x44,
-	0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44,
-	0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x48,
-	0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x15, 0xAA,
-	0x11, 0x44, 0x11, 0x44, 0x11, 0x4A, 0x55, 0xAA,
-	0x11, 0x44, 0x11, 0x44, 0x11, 0xEA, 0x55, 0xAA,
-	0x11, 0x44, 0x11, 0x46, 0x55, 0xAA, 0x55, 0xAA,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x55, 0xAA,
-	0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0xAA,
-	0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x66,
-	0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0xC4,
-	0x10, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44,
-	0x00, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44,
-	0x00, 0x40, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44,
-	0x04, 0x07, 0x01, 0x44, 0x11, 0x44, 0x11, 0x44,
-	0x00, 0x00, 0x80, 0x20, 0x18, 0x46, 0x11, 0x44,
-	0x0A, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x60,
-	0xAA, 0x55, 0x55, 0x7A, 0x00, 0x00, 0x00, 0x00,
-	0xAA, 0x55, 0xAA, 0x55, 0x56, 0x00, 0x00, 0x00,
-	0x5C, 0xB8, 0x78, 0xC0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x3A,
-	0x00, 0x00, 0x00, 0x00, 0x03, 0xFA, 0x55, 0xAA,
-	0x00, 0x00, 0x00, 0x02, 0x0A, 0x55, 0x55, 0xAA,
-	0x00, 0x00, 0x00, 0x12, 0xAA, 0x55, 0x55, 0xAA,
-	0x00, 0x00, 0x00, 0x00, 0x80, 0x55, 0xAA, 0x55,
-	0x00, 0x00, 0x00, 0x00, 0x80, 0xF0, 0xA8, 0x55,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x20,
-	0x15, 0x1A, 0x0D, 0x03, 0x00, 0x00, 0x00, 0x00,
-	0x55, 0xAA, 0xAA, 0x55, 0xF5, 0x02, 0x00, 0x00,
-	0x55, 0xAA, 0xAA, 0x54, 0xFE, 0x00, 0x00, 0x00,
-	0x55, 0xAE, 0x78, 0x80, 0x00, 0x00, 0x00, 0x00,
-	0x80, 0x00, 0x00, 0x00, 0x03, 0x06, 0x35, 0xEA,
-	0x0D, 0x1A, 0x35, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x11, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x15, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAE,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xBD,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x57, 0xDD,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x77, 0xDD,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0x8F, 0x77, 0xDD,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xDD, 0x77, 0xDD,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xCA, 0x77, 0xDD,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x77, 0xDD,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0x8A, 0x77, 0xDD,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x75, 0xDD,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xDD,
-	0x11, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xDD,
-	0x11, 0x84, 0x55, 0xAA, 0xAA, 0x55, 0x55, 0xDA,
-	0x11, 0x24, 0x55, 0xAA, 0xAA, 0x55, 0x55, 0xEA,
-	0x11, 0x44, 0x55, 0xAA, 0xAA, 0x55, 0x55, 0xAE,
-	0x14, 0x47, 0x15, 0xAA, 0xAA, 0x55, 0x55, 0xAA,
-	0x00, 0x00, 0x80, 0x60, 0xA8, 0x56, 0x55, 0xDD,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xD0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x01, 0x06, 0x0D, 0x1A, 0x0D, 0x0A, 0x0D, 0x02,
-	0xD5, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xA8, 0x50, 0xAA, 0x50, 0xA8, 0x58, 0xA8, 0x60,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-	0x00, 0x00, 0x00, 0x01, 0x07, 0x1D, 0xF7, 0xDD,
-	0x0F, 0x3A, 0xF7, 0xDD, 0x77, 0xDD, 0x77, 0xDD,
-	0x55, 0xBF, 0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD,
-	0x55, 0xDD, 0x77, 0xDD, 0x77, 0xDD, 0x77, 0xFF,
-	0x75, 0xDD, 0x77, 0xDD, 0x77, 0xDD, 0x77, 0xFF,
-	0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD, 0x77, 0xFF,
-	0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD, 0x77, 0xFF,
-	0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD, 0xFF, 0xFF,
-	0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD, 0xFF, 0xFF,
-	0x77, 0xDD, 0x77, 0xDD, 0x77, 0xFF, 0xFF, 0xFF,
-	0x77, 0xDD, 0x77, 0xDD, 0x77, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x77, 0xDD, 0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB,
-	0x77, 0xDD, 0x77, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x77, 0xDD, 0x77, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x77, 0xDD, 0x77, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x77, 0xDD, 0x77, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x77, 0xDD, 0x77, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x77, 0xDD, 0x77, 0xDD, 0x77, 0xFF, 0xFF, 0xFF,
-	0x77, 0xDD, 0x77, 0xDD, 0x77, 0xFF, 0xFF, 0xFF,
-	0x57, 0xDD, 0x77, 0xDD, 0x77, 0xFF, 0xFF, 0xFF,
-	0x77, 0xDD, 0x77, 0xDD, 0x77, 0xFF, 0xFF, 0xFF,
-	0x77, 0xDD, 0x77, 0xDD, 0x7F, 0xFF, 0xFF, 0xFF,
-	0x76, 0xDD, 0x77, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0xE0, 0xFE, 0x00, 0x00, 0xFF, 0xFB,
-	0x01, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xFC,
-	0x55, 0x6A, 0x35, 0x1A, 0xF8, 0xFE, 0x00, 0x00,
-	0x55, 0xAA, 0x55, 0xAA, 0xAA, 0x15, 0x0A, 0x00,
-	0x55, 0xAA, 0x55, 0xAA, 0xAA, 0x55, 0xAA, 0x55,
-	0x55, 0xAA, 0x55, 0xAA, 0xAA, 0x55, 0xAA, 0x55,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x54, 0x56, 0xF0,
-	0xAA, 0x54, 0xA8, 0x50, 0x18, 0x40, 0x00, 0x00,
-	0x20, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x07,
-	0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xEE, 0xBB,
-	0x0F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xEE, 0xBB,
-	0x77, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xEE, 0xBB,
-	0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xBB,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBB, 0xEE, 0xBB,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBB, 0xEE, 0xBB,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xBB, 0xEE, 0xBB,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBB, 0xEE, 0xBB,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xBB, 0xEE, 0xBB,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xBB, 0xEE, 0xBB,
-	0xFF, 0xFF, 0xFF, 0xFB, 0xEE, 0xBB, 0xEE, 0xBB,
-	0xFF, 0xFF, 0xFF, 0xFB, 0xEE, 0xBB, 0xEE, 0xBB,
-	0xFF, 0xFF, 0xFF, 0xBB, 0xEE, 0xBB, 0xEE, 0xBB,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xEE, 0xBB, 0xEE, 0x55, 0xAA, 0x53, 0x88, 0x00,
-	0xEE, 0xBB, 0xEE, 0x55, 0xAA, 0x24, 0x88, 0x00,
-	0xEE, 0xBB, 0xEE, 0x55, 0xAA, 0x35, 0x88, 0x00,
-	0xEE, 0xBB, 0xEE, 0x55, 0xAA, 0x33, 0x88, 0x00,
-	0xEE, 0xBB, 0xEE, 0x57, 0xAA, 0x16, 0x88, 0x00,
-	0xEF, 0xBB, 0xEE, 0x3B, 0xAA, 0x11, 0x88, 0x00,
-	0xFF, 0xBB, 0xEE, 0x71, 0xAA, 0x61, 0x88, 0x00,
-	0xFE, 0xBB, 0xEE, 0x75, 0xAA, 0x55, 0x88, 0x00,
-	0xFE, 0xBB, 0xEE, 0x35, 0xAA, 0x34, 0x88, 0x00,
-	0xEE, 0xBB, 0xEE, 0xD5, 0xAA, 0x26, 0x88, 0x00,
-	0xEE, 0xBB, 0xEE, 0x55, 0xAA, 0x43, 0x88, 0x00,
-	0xEE, 0xBB, 0xEE, 0x55, 0xAA, 0x12, 0x88, 0x00,
-	0xEE, 0xBB, 0xEE, 0x55, 0xAA, 0x01, 0x88, 0x00,
-	0xEE, 0xBB, 0xEE, 0x55, 0xAA, 0x50, 0x88, 0x00,
-	0x00, 0x00, 0xE0, 0x50, 0xAA, 0x21, 0x88, 0x00,
-	0x00, 0x00, 0xFF, 0xFF, 0x80, 0x60, 0x88, 0x00,
-	0xB0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x16, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00,
-	0x00, 0x00, 0x00, 0x05, 0x0A, 0x22, 0x88, 0x00,
-	0x0E, 0x5B, 0xAA, 0x55, 0xAA, 0x22, 0x88, 0x00,
-	0xEE, 0xBB, 0xAA, 0x55, 0xAA, 0x22, 0x88, 0x00,
-	0xEE, 0xD3, 0xAA, 0x55, 0xAA, 0x22, 0x88, 0x00,
-	0xEE, 0xF9, 0xAA, 0x55, 0xAA, 0x22, 0x88, 0x00,
-	0xEE, 0x37, 0xAA, 0x55, 0xAA, 0x22, 0x88, 0x00,
-	0xEE, 0xDF, 0xAA, 0x55, 0xAA, 0x22, 0x88, 0x00,
-	0xEE, 0x79, 0xAA, 0x55, 0xAA, 0x22, 0x88, 0x00,
-	0xEE, 0x55, 0xAA, 0x55, 0xAA, 0x22, 0x88, 0x00,
-	0xAE, 0x55, 0xAA, 0x55, 0x88, 0x22, 0x88, 0x00,
-	0xEE, 0x55, 0xAA, 0x55, 0x88, 0x22, 0x88, 0x00,
-	0xEA, 0x55, 0xAA, 0x55, 0x88, 0x22, 0x88, 0x00,
-	0xEE, 0x55, 0xAA, 0x55, 0x88, 0x22, 0x88, 0x00,
-	0xEE, 0x55, 0xAA, 0x55, 0x88, 0x22, 0x88, 0x00,
-	0xEA, 0x55, 0xAA, 0x55, 0x88, 0x22, 0x88, 0x00,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x8D, 0x0D, 0xDC, 0xA2, 0x43, 0xAD, 0xA6, 0x02,
-	0xF0, 0x02, 0xA2, 0x47, 0x8E, 0x58, 0x3F, 0xA2,
-	0x00, 0x86, 0xFB, 0x85, 0xFC, 0xE8, 0xBD, 0xBF,
-	0x43, 0xBC, 0xBF, 0x4B, 0xF0, 0xF5, 0x91, 0xFB,
-	0xE0, 0x1E, 0xD0, 0xF1, 0x60, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x18, 0x2B, 0x30, 0x2B, 0x60, 0x2B, 0x90, 0x2B,
-	0xC0, 0x2B, 0xF0, 0x2B, 0x20, 0x2B, 0x18, 0x2B,
-	0x40, 0x78, 0x29, 0x00, 0x00, 0xFF, 0x08, 0x00,
-	0x14, 0x00, 0x01, 0xFF, 0x80, 0x7E, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
-	0xF0, 0xC0, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5,
-	0xC5, 0xC5, 0xC0, 0x0F, 0xFD, 0x06, 0x5B, 0x50,
-	0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x0F,
-	0xFD, 0xD0, 0xD0, 0xD0, 0xD0, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
-	0xF4, 0x04, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0x50,
-	0x50, 0x50, 0x50, 0xB0, 0x0B, 0xC5, 0xC5, 0xC5,
-	0xBC, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC0, 0x0F,
-	0xFD, 0xD0, 0xD0, 0xD0, 0xD0, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-	0xE0, 0xFE, 0x4F, 0xBC, 0xC5, 0xC5, 0xC5, 0x50,
-	0x50, 0x50, 0xF0, 0xF0, 0xF0, 0xF0, 0xC0, 0xC5,
-	0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xBE, 0xF0, 0xF0,
-	0xF0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-	0xE0, 0xFE, 0xFE, 0x6E, 0x82, 0xA8, 0xA8, 0x80,
-	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x20,
-	0x80, 0x80, 0x80, 0x00, 0x60, 0xE4, 0xE0, 0xE0,
-	0xE0, 0xE0, 0xE0, 0xE0, 0xE3, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-	0xE0, 0xEF, 0x8F, 0xA8, 0xA8, 0x8A, 0xF0, 0xF0,
-	0xF0, 0xF0, 0x08, 0xA8, 0xA8, 0x8A, 0x82, 0xF0,
-	0xF0, 0xF0, 0xA8, 0xA8, 0xA8, 0x8F, 0xEF, 0xFE,
-	0xFE, 0xE0, 0xE3, 0xE3, 0xE3, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-	0xE0, 0xF0, 0x80, 0xF0, 0x08, 0xA8, 0xA8, 0xA8,
-	0xA8, 0xA8, 0xA8, 0x08, 0x00, 0xA8, 0xA8, 0xA8,
-	0xA8, 0xA8, 0xA8, 0x8A, 0xF0, 0x8A, 0xF0, 0xE4,
-	0xFE, 0xE3, 0xE3, 0xE0, 0xE0, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xE4, 0xE4, 0xFE, 0xFE, 0xE0,
-	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xA8,
-	0xA8, 0xA8, 0xA8, 0x80, 0xF0, 0x8A, 0xA8, 0xA8,
-	0xA8, 0xA8, 0xA8, 0xA8, 0x8F, 0xA8, 0xA8, 0xA8,
-	0x6F, 0xE4, 0xE4, 0xE4, 0xE4, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0x40, 0x40, 0x40, 0x40, 0x40,
-	0x80, 0xA8, 0x80, 0xF0, 0xF0, 0xF0, 0x82, 0xA2,
-	0x20, 0xF0, 0xA0, 0xAF, 0xAF, 0xA8, 0x82, 0xF0,
-	0xF2, 0x28, 0xF0, 0xF0, 0xF0, 0xA8, 0xA8, 0x8A,
-	0x4E, 0xE4, 0xE4, 0xE4, 0xE4, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF,
-	0xC1, 0x00, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x54,
-	0x00, 0x00, 0xFF, 0xFD, 0x54, 0xFF, 0xFE, 0xAA,
-	0x00, 0x00, 0xAA, 0xBF, 0xFF, 0x55, 0x7F, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
-	0x00, 0x00, 0xFF, 0xFD, 0x54, 0xFF, 0xFA, 0xAA,
-	0x00, 0x00, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55,
-	0x00, 0x00, 0x00, 0x0C, 0x00, 0x03, 0x00, 0x00,
-	0x0E, 0x00, 0x03, 0x80, 0x00, 0x03, 0xE0, 0x00,
-	0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00,
-	0x00, 0x00, 0x10, 0x00, 0x00, 0x20, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00,
-	0x00, 0x00, 0xFF, 0x03, 0xFF, 0xFF, 0x03, 0xFF,
-	0x00, 0x00, 0x80, 0x00, 0x00, 0x08, 0x00, 0x00,
-	0x00, 0x00, 0x1F, 0x00, 0x3F, 0x1F, 0x00, 0x7F,
-	0x00, 0x00, 0x00, 0xFC, 0x07, 0xFF, 0x40, 0x0F,
-	0xFF, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41,
-	0x00, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0x41,
-	0x00, 0x00, 0xF0, 0x3F, 0xFF, 0xE0, 0x7F, 0xFF,
-	0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x8F, 0xFF, 0xC0, 0xC3, 0xFF, 0xC1,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80,
-	0x00, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0x03, 0xFF,
-	0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x0D, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
-	0x00, 0x00, 0xFE, 0x0F, 0xF8, 0xFE, 0x0F, 0xFE,
-	0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0F, 0x00,
-	0x00, 0x00, 0x07, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC,
-	0x00, 0x00, 0x00, 0xFF, 0xC0, 0x7E, 0xFF, 0xC0,
-	0x7E, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xE0, 0x00,
-	0x00, 0x00, 0x3F, 0xDF, 0xC0, 0x3F, 0x8F, 0xE0,
-	0x00, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFE, 0x20,
-	0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x7F, 0xFF,
-	0x00, 0x00, 0x0F, 0x00, 0x1F, 0x0F, 0x00, 0x1F,
-	0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x08, 0x80,
-	0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00,
-	0x30, 0xC0, 0x0F, 0xFE, 0x32, 0xFE, 0x32, 0x2A,
-	0xFE, 0xFF, 0x2C, 0x31, 0xB6, 0xA9, 0xC1, 0x8C,
-	0x17, 0xD0, 0xBE, 0xD5, 0xC0, 0x0F, 0x33, 0xD5,
-	0xB4, 0xFC, 0x04, 0x04, 0x04, 0x01, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xE0, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0xD0, 0xD8,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
-	0xF0, 0xB0, 0xCB, 0xCF, 0xCF, 0xCF, 0xCF, 0xC5,
-	0xC5, 0x0C, 0x0C, 0xFD, 0xFD, 0x40, 0xB0, 0xC5,
-	0xC5, 0xC5, 0xC5, 0x50, 0x50, 0x5B, 0x5B, 0xB0,
-	0xFD, 0xD0, 0xD0, 0xD0, 0xD0, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
-	0xF0, 0xC0, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0x50,
-	0x50, 0x50, 0x50, 0x50, 0x0B, 0xC5, 0xC5, 0xC5,
-	0xC5, 0xBC, 0xC5, 0x50, 0x50, 0x50, 0xB0, 0xF0,
-	0xFD, 0xD0, 0xD0, 0xD0, 0xD0, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-	0xE0, 0xFE, 0xE6, 0xBC, 0xC5, 0xC5, 0xC5, 0x50,
-	0x50, 0x50, 0xF0, 0xF0, 0xF0, 0xF0, 0xB0, 0x50,
-	0x50, 0x50, 0x50, 0xC5, 0xCB, 0x4F, 0xF4, 0xF0,
-	0xF0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-	0xE0, 0xFE, 0xFE, 0xEF, 0xF0, 0x80, 0x8A, 0x82,
-	0x80, 0x20, 0x80, 0x80, 0x80, 0xA8, 0x80, 0x20,
-	0x80, 0x80, 0x20, 0x00, 0x40, 0xE0, 0xE0, 0xE0,
-	0xE0, 0xE0, 0xE0, 0xE0, 0xE3, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-	0xE0, 0xFE, 0x6F, 0xA8, 0xA8, 0x8A, 0xF0, 0xF0,
-	0xF0, 0x28, 0xA8, 0xA8, 0xA8, 0xA8, 0x8A, 0xF0,
-	0xF0, 0x20, 0x8A, 0xA8, 0xA8, 0xF0, 0xEF, 0xFE,
-	0xFE, 0xE0, 0xE3, 0xE3, 0xE3, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-	0xE6, 0x40, 0xF0, 0xF0, 0xF0, 0x8A, 0xA8, 0xA8,
-	0xA8, 0xA8, 0xA8, 0x80, 0xF0, 0x82, 0x80, 0x80,
-	0x80, 0x80, 0x80, 0x8A, 0xF0, 0xF0, 0xF0, 0xE6,
-	0xFE, 0xE3, 0xE3, 0xE3, 0xE0, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xE4, 0xFE, 0xFE, 0xFE, 0xE0,
-	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xA8,
-	0xA8, 0xA8, 0xA8, 0xA0, 0xF0, 0x8A, 0xA8, 0xA8,
-	0xA8, 0xA8, 0xA8, 0xA8, 0x8F, 0xA8, 0xA8, 0x8A,
-	0x4F, 0xE0, 0xE4, 0xE4, 0xE4, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xE4, 0xE4, 0xE4, 0xE4, 0x60,
-	0x80, 0x80, 0x80, 0xF0, 0xF0, 0x80, 0x80, 0xAF,
-	0xA2, 0xA0, 0x20, 0xA2, 0xAF, 0x8A, 0xF0, 0x28,
-	0xA8, 0xA8, 0x2A, 0xF0, 0xF0, 0x8A, 0xA8, 0xA8,
-	0xE6, 0xE4, 0xE4, 0xE4, 0xE4, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0xC1, 0x00, 0x00, 0xC1, 0x00, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-	0x02, 0xAA, 0x00, 0x05, 0x54, 0x00, 0x00, 0xFF,
-	0xFF, 0x54, 0xFF, 0xFE, 0xAC, 0x00, 0x00, 0xAA,
-	0xBF, 0xFF, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-	0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0xFF,
-	0xFD, 0x56, 0xFF, 0xFA, 0xA8, 0x00, 0x00, 0xAA,
-	0xAA, 0xAB, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00,
-	0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0x00, 0x07,
-	0xC0, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x80,
-	0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-	0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-	0x10, 0x0F, 0x00, 0x10, 0x00, 0x00, 0x00, 0xFF,
-	0x03, 0xFF, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0x00,
-	0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x1F,
-	0x00, 0x1F, 0x0F, 0x00, 0x1F, 0x00, 0x00, 0x00,
-	0xFF, 0x80, 0x7F, 0xFE, 0x01, 0xFF, 0x00, 0xFF,
-	0xE0, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-	0x18, 0x80, 0x00, 0x20, 0x80, 0x00, 0x00, 0x00,
-	0x0F, 0xFF, 0xF0, 0x1F, 0xFF, 0x00, 0x00, 0x00,
-	0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x3F,
-	0xFF, 0xC0, 0x1F, 0xFF, 0xC1, 0x00, 0x00, 0xFF,
-	0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-	0x7F, 0xC0, 0x03, 0x1F, 0xE0, 0x07, 0x00, 0x03,
-	0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x7F,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x08, 0x03, 0x80, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x01, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x03, 0x00, 0x08, 0x00, 0x00, 0x00,
-	0xFF, 0x80, 0x3E, 0xFF, 0xC0, 0x3E, 0x00, 0x01,
-	0xF0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x7F,
-	0xFF, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0xFF,
-	0xC0, 0x10, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x03,
-	0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x0F,
-	0x00, 0x3F, 0x0F, 0x00, 0x3F, 0x00, 0x00, 0xFF,
-	0xFE, 0x20, 0xFF, 0xFC, 0x20, 0x00, 0x00, 0x00,
-	0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-	0x30, 0x00, 0x10, 0x00, 0x33, 0x00, 0x33, 0x28,
-	0xBE, 0xBF, 0x8D, 0x31, 0x29, 0x09, 0x09, 0x8D,
-	0xBC, 0x19, 0x8C, 0x24, 0x00, 0x10, 0x33, 0x00,
-	0xA4, 0x3A, 0x06, 0x06, 0x06, 0x03, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xE1, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0xD1, 0xD9,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
-	0xF0, 0xF0, 0xC0, 0xC0, 0xCB, 0xCF, 0xCF, 0xC5,
-	0xC5, 0xC0, 0x0E, 0xFD, 0xFD, 0x0F, 0xF0, 0xC0,
-	0xC5, 0xC5, 0xC5, 0x50, 0x50, 0x50, 0xF0, 0xF0,
-	0xFD, 0xD0, 0xD0, 0xD0, 0xD0, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
-	0xF0, 0xBC, 0xC5, 0xC5, 0xC5, 0xC5, 0xCB, 0x50,
-	0x50, 0x50, 0x50, 0x50, 0xB0, 0xC5, 0xC5, 0xC5,
-	0xC5, 0xBC, 0xC5, 0xC5, 0xC5, 0xC5, 0xB0, 0x0F,
-	0xFD, 0xD0, 0xD0, 0xD0, 0xD0, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-	0xE0, 0xFE, 0xF0, 0xC5, 0xC5, 0xC5, 0xC5, 0x50,
-	0x50, 0x50, 0xF0, 0xF0, 0xF0, 0xF0, 0xB0, 0x50,
-	0x50, 0x50, 0x50, 0xC5, 0xC5, 0xBC, 0xEF, 0xFD,
-	0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-	0xE0, 0xFE, 0xFE, 0xFE, 0x60, 0xF0, 0xF0, 0xF0,
-	0xF0, 0xF0, 0x80, 0x80, 0x80, 0xA0, 0x20, 0xF0,
-	0xF0, 0xF0, 0xF0, 0x40, 0xE0, 0x00, 0xE0, 0xE0,
-	0xE0, 0xE0, 0xE0, 0xE0, 0xE3, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-	0xE0, 0xFE, 0x6F, 0xA8, 0xA8, 0xA8, 0x2A, 0xF0,
-	0xF0, 0x8A, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0x80,
-	0xF0, 0x80, 0xA8, 0xA8, 0x8A, 0xF0, 0xFE, 0xFE,
-	0xFE, 0xE0, 0xE3, 0xE3, 0xE3, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-	0xE0, 0x6E, 0xF0, 0xF0, 0xF0, 0x8A, 0xA8, 0xA8,
-	0xA8, 0xA8, 0xA8, 0x20, 0xF0, 0x80, 0x80, 0x80,
-	0x80, 0x80, 0x80, 0x28, 0xF0, 0xF0, 0x6E, 0xFE,
-	0xFE, 0xE3, 0xE3, 0xE3, 0xE3, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xFE, 0xFE, 0xFE, 0xFE, 0xE0,
-	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xA8,
-	0xA8, 0xA8, 0xA8, 0x08, 0xF0, 0xA8, 0xA8, 0xA8,
-	0xA8, 0xA8, 0xA8, 0xA8, 0x28, 0xA8, 0xA8, 0x8A,
-	0x64, 0xE0, 0xE0, 0xE4, 0xE4, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xE4, 0xE4, 0xE4, 0xE4, 0x40,
-	0x80, 0x80, 0x80, 0xF0, 0xF0, 0x80, 0x80, 0xA8,
-	0xA8, 0xA0, 0xF0, 0x20, 0x20, 0xF0, 0xF2, 0x8A,
-	0xA8, 0xA8, 0x8A, 0xF0, 0xF0, 0xA8, 0xA8, 0x8A,
-	0x6F, 0xE4, 0xE4, 0xE4, 0xE4, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x03, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0x00,
-	0x05, 0x55, 0x00, 0x00, 0xFF, 0xFF, 0x54, 0xFF,
-	0xFF, 0xAC, 0x00, 0x00, 0xAB, 0xFF, 0xFF, 0x55,
-	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-	0x00, 0x03, 0x00, 0x00, 0xFF, 0xD5, 0x56, 0xFF,
-	0xFA, 0xAA, 0x00, 0x00, 0xAA, 0xAA, 0xAF, 0x55,
-	0x55, 0x57, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
-	0xFC, 0x00, 0x3F, 0x00, 0x1F, 0x00, 0x00, 0x0F,
-	0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x7F,
-	0xFF, 0x80, 0x00, 0x00, 0x01, 0xE7, 0xFF, 0x01,
-	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00,
-	0x08, 0x00, 0x00, 0x00, 0xFF, 0x03, 0xFF, 0xFF,
-	0x03, 0xFF, 0x00, 0x00, 0xD0, 0x00, 0x0E, 0xC0,
-	0x00, 0x03, 0x00, 0x00, 0x0F, 0x00, 0x07, 0x0F,
-	0x00, 0x0F, 0x00, 0x00, 0xFE, 0x00, 0x3F, 0x00,
-	0x00, 0xC0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0xFF,
-	0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x02,
-	0x01, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00,
-	0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x7F,
-	0xFF, 0xC0, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
-	0xC0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
-	0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0xFF, 0x03,
-	0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x7F,
-	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-	0x90, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00,
-	0x00, 0x70, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-	0xFF, 0x80, 0x3F, 0x00, 0x00, 0x7C, 0x00, 0x00,
-	0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x7F,
-	0xFF, 0x00, 0x00, 0x00, 0xFB, 0xE0, 0x00, 0xFF,
-	0xE0, 0x10, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x07,
-	0xFF, 0xFF, 0x00, 0x00, 0x0E, 0x00, 0x3E, 0x0E,
-	0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x0E, 0x20, 0x00, 0x00, 0x01, 0x08, 0x00, 0x00,
-	0x08, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x3F, 0x00,
-	0x00, 0x1C, 0x20, 0x40, 0x41, 0xA8, 0xA9, 0xAF,
-	0xD3, 0xD8, 0xE0, 0x00, 0x3C, 0x48, 0xA5, 0xA7,
-	0xA8, 0xA9, 0xAC, 0xD2, 0xDE, 0xDF, 0x00, 0x05,
-	0x28, 0x29, 0x48, 0x49, 0x4A, 0x4B, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xE2, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0xD2, 0xDA,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xF5, 0xF0, 0xF0, 0xF0, 0xF0,
-	0xF0, 0x60, 0xB0, 0xB0, 0xCB, 0xCB, 0xCB, 0xCB,
-	0xBC, 0xF0, 0x6F, 0xFD, 0xFD, 0xF0, 0xF0, 0x0C,
-	0xC0, 0xC0, 0xC0, 0xB0, 0xC0, 0xB0, 0xF0, 0x0F,
-	0xFD, 0xD0, 0xD0, 0xD0, 0xD0, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
-	0xF0, 0xB0, 0xC5, 0xC5, 0xC5, 0x0C, 0xC5, 0x50,
-	0x50, 0x50, 0x50, 0xB0, 0xF0, 0xC5, 0xC5, 0xC5,
-	0xC5, 0xC5, 0xBC, 0xC5, 0xC5, 0xC5, 0xC0, 0xE0,
-	0xF0, 0xD0, 0xD0, 0xD0, 0xD0, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-	0xE0, 0xEF, 0xCB, 0xC5, 0xC5, 0xC5, 0xC5, 0x50,
-	0x50, 0x0B, 0xF0, 0xF0, 0xF0, 0xF0, 0xB0, 0xC5,
-	0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xF6, 0xFD,
-	0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-	0xE0, 0xFE, 0xFE, 0xFE, 0x40, 0xF0, 0xF0, 0xF0,
-	0xF0, 0xF0, 0x20, 0x80, 0x80, 0x20, 0xF0, 0xF0,
-	0xF0, 0xF0, 0xF0, 0x04, 0xFE, 0xF0, 0xF0, 0xFE,
-	0xFE, 0xE0, 0xE0, 0xE0, 0xE3, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-	0xE0, 0xFE, 0xF4, 0x8A, 0xA8, 0xA8, 0x8A, 0xF0,
-	0x00, 0x8A, 0xA8, 0xA8, 0xA8, 0x80, 0x80, 0x80,
-	0xF0, 0x80, 0x80, 0xA8, 0x80, 0xF0, 0xFE, 0xFE,
-	0xFE, 0xE0, 0xE0, 0xE3, 0xE3, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-	0xE0, 0xEF, 0xF0, 0xF0, 0xF0, 0xA2, 0xA8, 0x80,
-	0x80, 0x80, 0x80, 0xF0, 0xF0, 0x80, 0x80, 0x80,
-	0x80, 0x80, 0x80, 0xF0, 0xF2, 0x8F, 0x6E, 0xFE,
-	0xFE, 0xE3, 0xE3, 0xE3, 0xE3, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xFE, 0xFE, 0xFE, 0xFE, 0xE0,
-	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xA8,
-	0xA8, 0xA8, 0xA8, 0x80, 0x20, 0xA8, 0xA8, 0xA8,
-	0xA8, 0xA8, 0xA8, 0xA8, 0x8F, 0xA8, 0xA8, 0x8A,
-	0xE6, 0xE0, 0xE0, 0xE0, 0xE4, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xE4, 0xE4, 0xE4, 0xE4, 0x40,
-	0x80, 0x80, 0x80, 0xF0, 0x20, 0x80, 0x80, 0xA8,
-	0xA8, 0x8A, 0x80, 0xF0, 0xF0, 0xF0, 0x8A, 0xA8,
-	0xA8, 0xA8, 0xA8, 0x8A, 0xF0, 0x8A, 0xA8, 0x8A,
-	0x6F, 0xE4, 0xE4, 0xE4, 0xE4, 0x00, 0x00, 0xF0,
-	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-	0x00, 0x00, 0x2A, 0xAA, 0x00, 0x55, 0x55, 0x00,
-	0x00, 0x7F, 0xFF, 0x57, 0xFF, 0xFF, 0xAA, 0x00,
-	0x00, 0xAB, 0xFF, 0xFF, 0x57, 0xFF, 0xFF, 0x00,
-	0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x01, 0x00,
-	0x00, 0xFF, 0xD5, 0x56, 0xFF, 0xEA, 0xAA, 0x00,
-	0x00, 0xAA, 0xAA, 0xAF, 0x55, 0x55, 0x7F, 0x00,
-	0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00,
-	0x00, 0x3C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-	0x00, 0x3F, 0xFF, 0xE0, 0x3F, 0xFF, 0xC0, 0x00,
-	0x00, 0x80, 0x01, 0x84, 0x00, 0x06, 0x73, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00,
-	0x00, 0xFF, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0x00,
-	0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x0C, 0x00,
-	0x00, 0x07, 0x80, 0x03, 0x07, 0x80, 0x03, 0x00,
-	0x00, 0xFE, 0x00, 0xFF, 0xFC, 0x00, 0x7F, 0x00,
-	0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-	0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFC, 0x00, 0x00,
-	0x00, 0xCF, 0xFC, 0x00, 0x46, 0xFC, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00,
-	0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x40, 0x00,
-	0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0x00,
-	0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
-	0x00, 0x00, 0x08, 0x00, 0x00, 0x10, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-	0x00, 0x1F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFC, 0x00,
-	0x00, 0x00, 0x24, 0x00, 0x20, 0x04, 0x6F, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0C, 0x00,
-	0x00, 0xFF, 0xC0, 0x3F, 0xFF, 0x80, 0x3F, 0x00,
-	0x00, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x1C, 0x00, 0x00, 0x3C, 0x00, 0x00,
-	0x00, 0xFE, 0xFC, 0x00, 0xFF, 0xFE, 0x00, 0x00,
-	0x00, 0x10, 0x00, 0x40, 0xF0, 0x00, 0x20, 0x00,
-	0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-	0x00, 0x0F, 0x00, 0x7C, 0x0F, 0x00, 0x3E, 0x00,
-	0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x15, 0x00,
-	0x00, 0x0C, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
-	0x00, 0x7F, 0x00, 0x3F, 0xFF, 0x80, 0x3F, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xE3, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0xD3, 0xDB,
-	0xF0, 0xF0, 0xF0, 0xF5, 0xF0, 0xF0, 0xF0, 0xF0,
-	0xF0, 0xEF, 0xF0, 0xBF, 0xF0, 0xBC, 0xCB, 0xBF,
-	0xF0, 0x6F, 0xF6, 0xFD, 0xFD, 0xFD, 0x0F, 0xF0,
-	0xB0, 0xB0, 0x05, 0xB0, 0xB0, 0xF0, 0xF0, 0xFD,
-	0xFD, 0xD0, 0xD0, 0xD0, 0xD0, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
-	0xF0, 0x0C, 0xC5, 0xC5, 0xC5, 0x0C, 0xC5, 0xC5,
-	0xC5, 0xC5, 0xC5, 0x50, 0x0F, 0xC0, 0xC5, 0xC5,
-	0xC5, 0xC5, 0xCB, 0x05, 0xC5, 0xC5, 0x0C, 0x04,
-	0xFD, 0xD0, 0xD0, 0xD0, 0xD0, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-	0xE0, 0xEF, 0xBC, 0xC5, 0xC5, 0xC5, 0xC5, 0x50,
-	0x5B, 0xB0, 0xB0, 0xF0, 0xF0, 0xCB, 0xBC, 0xC5,
-	0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xBC, 0x6F, 0xFD,
-	0xFD, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-	0xE0, 0xFE, 0xFE, 0xEF, 0xF0, 0xC0, 0xC5, 0x0C,
-	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
-	0xC0, 0xC0, 0x0C, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
-	0xFE, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-	0xE0, 0xFE, 0xEF, 0xA8, 0xA8, 0xA8, 0x8A, 0x20,
-	0x80, 0xA8, 0xA8, 0xA8, 0xA8, 0x80, 0x80, 0x80,
-	0x20, 0x82, 0x80, 0xA8, 0x80, 0x60, 0xFE, 0xFE,
-	0xFE, 0xE0, 0xE0, 0xE3, 0xE3, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-	0xE0, 0xFE, 0x28, 0x8A, 0xF0, 0x2F, 0x8A, 0x80,
-	0x80, 0x80, 0x80, 0xF0, 0xF0, 0x80, 0x80, 0x80,
-	0x80, 0x80, 0x80, 0xF0, 0xA8, 0xA8, 0xE6, 0xFE,
-	0xFE, 0xE3, 0xE3, 0xE3, 0xE3, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xFE, 0xFE, 0xFE, 0xFE, 0xE0,
-	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-	0x80, 0x80, 0x80, 0x80, 0x80, 0xA8, 0xA8, 0xA8,
-	0xA8, 0xA8, 0xA8, 0xA8, 0x82, 0xA8, 0xA8, 0x8F,
-	0xE6, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xE4, 0xE4, 0xE4, 0xE4, 0xE0,
-	0x80, 0x80, 0x80, 0xF0, 0x80, 0x80, 0x80, 0xA8,
-	0xA8, 0xA8, 0x8A, 0xF0, 0xF0, 0xF0, 0x8A, 0xA8,
-	0xA8, 0xA8, 0xA8, 0x8A, 0xF0, 0x8A, 0xA8, 0xA8,
-	0xF0, 0xE4, 0xE4, 0xE4, 0xE4, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x02, 0xAA,
-	0xAA, 0x01, 0x55, 0x55, 0x00, 0x00, 0x7F, 0xFF,
-	0xD5, 0x3F, 0xFF, 0xAA, 0x00, 0x00, 0xBF, 0xFF,
-	0xFF, 0x57, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0xFF, 0xF5,
-	0x54, 0xFF, 0xEA, 0xAA, 0x00, 0x00, 0xAA, 0xAA,
-	0xFF, 0x55, 0x55, 0x7F, 0x00, 0x00, 0x00, 0x00,
-	0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0xFF, 0xFF,
-	0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x1F,
-	0xF8, 0x1E, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFF,
-	0x7B, 0x1F, 0xFF, 0x9C, 0x00, 0x00, 0x00, 0x10,
-	0x00, 0x00, 0x10, 0x03, 0x00, 0x00, 0xFF, 0x03,
-	0xFF, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x01,
-	0xC0, 0x20, 0x00, 0x20, 0x00, 0x00, 0x07, 0xC0,
-	0x00, 0x07, 0x80, 0x01, 0x00, 0x00, 0xFE, 0x01,
-	0xFF, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x00,
-	0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF8,
-	0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-	0x00, 0xDF, 0xE0, 0x00, 0x00, 0x00, 0x10, 0x00,
-	0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-	0xC0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-	0x84, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-	0xFF, 0x00, 0x07, 0xFF, 0x00, 0x00, 0xFE, 0x0E,
-	0x00, 0xEF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-	0xF8, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-	0x08, 0x0E, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02,
-	0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00,
-	0x0E, 0x00, 0x00, 0x01, 0x00, 0x00, 0xFF, 0xC0,
-	0xFF, 0xFF, 0x80, 0x7F, 0x00, 0x00, 0xF0, 0x00,
-	0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xC7, 0xC0,
-	0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xF0, 0x7C,
-	0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00,
-	0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00,
-	0xFC, 0x0E, 0x00, 0x7C, 0x00, 0x00, 0xC0, 0x01,
-	0x20, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-	0x1F, 0x3F, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x3E,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xE4, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0xD4, 0xDC,
-	0xF0, 0xF0, 0xF0, 0xF5, 0xF0, 0xF0, 0xF0, 0xF0,
-	0xF0, 0xFE, 0xFE, 0x6E, 0xF0, 0xF0, 0xF0, 0xF0,
-	0xF0, 0xF6, 0xF0, 0xFD, 0xFD, 0xFD, 0xFD, 0xE0,
-	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0xFD, 0xFD,
-	0xFD, 0xD0, 0xD0, 0xD0, 0xD0, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE,
-	0xF0, 0xC0, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5,
-	0xC5, 0xC5, 0x5C, 0x0E, 0xF0, 0xC0, 0xCF, 0xCF,
-	0xCF, 0xCF, 0xCF, 0xC5, 0xC5, 0xC5, 0xC5, 0x0E,
-	0xFD, 0xD0, 0xD0, 0xD0, 0xD0, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-	0xE0, 0x6E, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0x50,
-	0x50, 0xB0, 0x5B, 0x00, 0xF0, 0xC5, 0xC5, 0xCB,
-	0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xE0, 0xFD,
-	0xFD, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-	0xE0, 0xFE, 0xFE, 0xEF, 0xFB, 0xCB, 0xC5, 0xC5,
-	0xC0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xC0,
-	0xC5, 0xC5, 0xC0, 0xC0, 0x0F, 0xF0, 0xF0, 0xF0,
-	0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-	0xE0, 0xFE, 0xEF, 0xA8, 0xA8, 0xA8, 0xA8, 0x80,
-	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-	0x80, 0x80, 0x80, 0xA8, 0x80, 0xE0, 0xFE, 0xFE,
-	0xFE, 0xE0, 0xE0, 0xE3, 0xE3, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-	0xE0, 0xFE, 0x8A, 0xA8, 0xA2, 0xF0, 0x8A, 0x80,
-	0x80, 0x80, 0x80, 0xF0, 0xF0, 0x80, 0x82, 0x80,
-	0x80, 0x80, 0x80, 0x8A, 0xA8, 0xA8, 0xEF, 0xFE,
-	0xFE, 0xE0, 0xE3, 0xE3, 0xE3, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE6,
-	0x60, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-	0x80, 0x80, 0x80, 0x80, 0x80, 0xA8, 0xA8, 0xA8,
-	0xA8, 0xA8, 0xA8, 0x8A, 0x8F, 0xA8, 0x8A, 0x2F,
-	0x4E, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xE4, 0xE4, 0xE4, 0xE4, 0xE0,
-	0x80, 0x80, 0x82, 0x20, 0x80, 0x80, 0x80, 0xA8,
-	0xA8, 0xA8, 0x8A, 0xF0, 0xF0, 0x28, 0xA8, 0xA8,
-	0xA8, 0xA8, 0xA8, 0x8A, 0xF0, 0xA8, 0xA8, 0xA8,
-	0xF0, 0xE4, 0xE4, 0xE4, 0xE4, 0xF0, 0xF0, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0x00, 0x00, 0x0A, 0xAA, 0xAA, 0x05, 0x55,
-	0x55, 0x00, 0x00, 0x3F, 0xFF, 0xF5, 0x3F, 0xFF,
-	0xEA, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x5F, 0xFF,
-	0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0A,
-	0xAC, 0x00, 0x00, 0xAA, 0xAB, 0xFF, 0x55, 0x55,
-	0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
-	0x07, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0x1E, 0x07, 0xFE, 0x1E, 0x0F,
-	0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x07, 0xFF,
-	0xFF, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F,
-	0xE0, 0x00, 0x00, 0x7F, 0x01, 0xFF, 0xFF, 0x03,
-	0xFF, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x03,
-	0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xC0,
-	0x00, 0x00, 0x00, 0xFF, 0x01, 0xFF, 0xFE, 0x01,
-	0xFF, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00,
-	0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xC0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00,
-	0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
-	0x80, 0x00, 0x00, 0x00, 0x01, 0x84, 0x00, 0x00,
-	0x14, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0xFF,
-	0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x03,
-	0xFF, 0x00, 0x00, 0xFC, 0x3F, 0x80, 0xFE, 0x1E,
-	0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x0F, 0xFF,
-	0xE0, 0x00, 0x00, 0x00, 0x80, 0x00, 0x01, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x08,
-	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF,
-	0xFF, 0x00, 0x00, 0xFF, 0xC1, 0xFF, 0xFF, 0xC1,
-	0xFF, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xF0, 0x00,
-	0x00, 0x00, 0x00, 0x81, 0xE0, 0x00, 0xC3, 0xC0,
-	0x00, 0x00, 0x00, 0xC0, 0x7C, 0x00, 0xF0, 0x7E,
-	0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x08,
-	0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x02, 0x00,
-	0x00, 0x00, 0x00, 0x1F, 0x01, 0xF8, 0x0F, 0x00,
-	0xFC, 0x00, 0x00, 0x00, 0x00, 0x80, 0x70, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-	0x00, 0x00, 0x00, 0x1F, 0x00, 0x1F, 0x3F, 0x00,
-	0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xE5, 0x5A, 0x5B, 0x5C, 0x5D, 0x5E, 0xD5, 0xDD,
-	0xF0, 0xF0, 0xF0, 0x35, 0xFE, 0xFE, 0xFE, 0xFE,
-	0xFE, 0xFE, 0xFE, 0xFE, 0xE0, 0xF0, 0xF0, 0x40,
-	0x40, 0xF0, 0xF0, 0xFD, 0xFD, 0xFD, 0xFD, 0xFE,
-	0x4F, 0x64, 0xF0, 0x40, 0x40, 0xD0, 0xD0, 0xD0,
-	0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE,
-	0xF0, 0xC0, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5,
-	0xC5, 0xC5, 0x5C, 0x0F, 0x0F, 0xC0, 0xCF, 0xCF,
-	0xCF, 0xCF, 0xCF, 0x50, 0x50, 0x50, 0x0B, 0xE0,
-	0xFD, 0xD0, 0xD0, 0xD0, 0xD0, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-	0xE0, 0xE0, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0x50,
-	0xB0, 0xB0, 0x50, 0xB0, 0xF0, 0xC5, 0xC5, 0xB5,
-	0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0x0C, 0xF6,
-	0xFD, 0xD0, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-	0xE0, 0xFE, 0xEF, 0x4E, 0xBC, 0xC5, 0xC5, 0xC5,
-	0xC5, 0xC0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xC0,
-	0xC5, 0xC5, 0xC5, 0xC5, 0x60, 0xF4, 0xF0, 0xF0,
-	0xF0, 0x00, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-	0xE0, 0xFE, 0xFE, 0x8F, 0xA8, 0xA8, 0xA8, 0x80,
-	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-	0x80, 0x80, 0x80, 0xA8, 0x00, 0xE0, 0xE0, 0xE0,
-	0xE0, 0xE0, 0xE0, 0xE0, 0xE3, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-	0xE0, 0xFE, 0xA8, 0xA8, 0xA8, 0xF0, 0xF0, 0x20,
-	0x82, 0x80, 0xF0, 0xF0, 0xF0, 0xF0, 0x80, 0xA8,
-	0xA8, 0x80, 0xF0, 0xA8, 0xA8, 0x82, 0xFE, 0xFE,
-	0xFE, 0xE0, 0xE3, 0xE3, 0xE3, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE,
-	0x60, 0x80, 0x80, 0x20, 0x80, 0x80, 0x80, 0xA8,
-	0xA8, 0xA8, 0xA8, 0x80, 0x80, 0xA8, 0xA8, 0xA8,
-	0xA8, 0xA8, 0xA8, 0x8A, 0x2F, 0xA8, 0x8A, 0xF0,
-	0xE4, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xE4, 0xE4, 0xE4, 0xFE, 0xE0,
-	0x80, 0x80, 0x80, 0x20, 0x80, 0x80, 0x80, 0xA8,
-	0xA8, 0xA8, 0x8A, 0xF0, 0xF0, 0x8A, 0xA8, 0xA8,
-	0xA8, 0xA8, 0xA8, 0x8A, 0xF0, 0xA8, 0xA8, 0xA8,
-	0xF0, 0x4E, 0xE4, 0xE4, 0xE4, 0xF0, 0xF0, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x2A, 0xAA, 0xAA, 0x15, 0x55, 0x55, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x10, 0x00, 0x0A, 0x00, 0x00,
-	0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x00, 0x00,
-	0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xFD, 0x50, 0x00, 0x00, 0x04, 0x00, 0x00,
-	0xAA, 0xAB, 0xFF, 0x55, 0x57, 0xFF, 0x00, 0x00,
-	0x00, 0x00, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-	0x1E, 0x01, 0xFF, 0x1E, 0x03, 0xFF, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-	0x01, 0xFE, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-	0x1F, 0x01, 0xFF, 0x3E, 0x01, 0xFF, 0x00, 0x00,
-	0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-	0x01, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-	0xFF, 0x03, 0xFF, 0xFE, 0x03, 0xFF, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-	0x0F, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x00, 0x00,
-	0x00, 0x01, 0x20, 0x00, 0x01, 0x02, 0x00, 0x00,
-	0xC0, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x00, 0x00,
-	0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-	0xF8, 0x7F, 0x80, 0xFC, 0x7F, 0x80, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x03, 0x00, 0x80, 0x00, 0x00,
-	0x00, 0x03, 0x7F, 0x00, 0x07, 0xFF, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x00, 0x00,
-	0xFF, 0x83, 0xFF, 0xFF, 0x83, 0xFF, 0x00, 0x00,
-	0xC0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x78, 0x00, 0x80, 0xF0, 0x00, 0x00, 0x00,
-	0x00, 0x7C, 0x00, 0x80, 0x7C, 0x00, 0x00, 0x00,
-	0x0F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x00, 0x00,
-	0x10, 0x80, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-	0x1F, 0x03, 0xF0, 0x1F, 0x01, 0xF8, 0x00, 0x00,
-	0xFF, 0xFE, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-	0x00, 0x3F, 0xFF, 0x00, 0x1F, 0xFF, 0x00, 0x00,
-	0x1F, 0x00, 0x1F, 0x1F, 0x00, 0x1F, 0x00, 0x00,
-	0x00, 0x04, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xE6, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0xD6, 0xDE,
-	0xF0, 0xF0, 0xF0, 0x53, 0xE3, 0xE0, 0xE0, 0xE0,
-	0xE0, 0xFE, 0xFE, 0xFE, 0xEF, 0xEF, 0xF0, 0xE0,
-	0x00, 0x00, 0x00, 0x00, 0xD0, 0xFD, 0xFD, 0xFD,
-	0xFD, 0xFE, 0xFE, 0xD4, 0xD0, 0xD0, 0xD0, 0xD0,
-	0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
-	0xF0, 0x0C, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5,
-	0xC5, 0xC5, 0xC0, 0xF0, 0xF0, 0xC0, 0xC5, 0xC5,
-	0xC5, 0xC5, 0xC5, 0x50, 0x50, 0x50, 0x50, 0xF0,
-	0xFD, 0xD0, 0xD0, 0xD0, 0xD0, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE,
-	0xFE, 0x04, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0x50,
-	0xB0, 0x50, 0x50, 0x50, 0xB0, 0xC5, 0xC5, 0xC5,
-	0xBC, 0xC5, 0xC5, 0xC5, 0xC5, 0x5C, 0x0C, 0x0F,
-	0xFD, 0xD0, 0xD0, 0xD0, 0x00, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-	0xE0, 0xFE, 0xEF, 0xF0, 0xCB, 0xC5, 0xC5, 0x50,
-	0x50, 0xB0, 0xF0, 0xF0, 0xF0, 0xF0, 0xB0, 0xC5,
-	0xC5, 0xC5, 0xC5, 0xC5, 0xB5, 0x6F, 0xF0, 0xF0,
-	0xF0, 0x00, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-	0xE0, 0xFE, 0xFE, 0xEF, 0xA8, 0xA8, 0xA8, 0x80,
-	0x20, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-	0x80, 0x80, 0x80, 0x80, 0x00, 0xE6, 0xE0, 0xE0,
-	0xE0, 0xE0, 0xE0, 0xE3, 0xE3, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-	0xE0, 0xEF, 0x82, 0xA8, 0xA8, 0x8F, 0xF0, 0xF0,
-	0xF0, 0xF0, 0xF0, 0xF0, 0x20, 0xF0, 0xF0, 0x8A,
-	0x82, 0xF0, 0x28, 0xA8, 0xA8, 0x8F, 0xFE, 0xFE,
-	0xFE, 0xE0, 0xE3, 0xE3, 0xE3, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE,
-	0x40, 0x20, 0x80, 0xF0, 0x80, 0x80, 0x80, 0xA8,
-	0xA8, 0xA8, 0xA8, 0x80, 0x08, 0xA8, 0xA8, 0xA8,
-	0xA8, 0xA8, 0xA8, 0x8A, 0xF0, 0xA8, 0xA8, 0x6F,
-	0xFE, 0xE3, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0xF0, 0xF0, 0xE4, 0xE4, 0xFE, 0xFE, 0xE0,
-	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xA8,
-	0xA8, 0xA8, 0x8A, 0x20, 0xF0, 0x8A, 0xA8, 0xA8,
-	0xA8, 0xA8, 0xA8, 0xA8, 0x2F, 0xA8, 0xA8, 0xA8,
-	0xF0, 0xE4, 0xE4, 0xE4, 0xE4, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x15, 0x55, 0x55, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-	0x0F, 0xFF, 0xF7, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-	0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x08,
-	0x00, 0x00, 0x08, 0x00, 0x00, 0xFF, 0xFD, 0x54,
-	0xFF, 0xFA, 0xAC, 0x00, 0x00, 0xAA, 0xBF, 0xFF,
-	0x55, 0x5F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03,
-	0x00, 0x00, 0x03, 0x00, 0x00, 0xFF, 0xFD, 0x55,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA,
-	0x1E, 0x00, 0xFF, 0x00, 0x00, 0x55, 0x50, 0x0C,
-	0x00, 0x03, 0xD2, 0x00, 0x00, 0x03, 0xF0, 0x00,
-	0x01, 0xFC, 0x00, 0x00, 0x00, 0x0E, 0x00, 0xFF,
-	0x1F, 0x01, 0xFF, 0x00, 0x00, 0x20, 0x00, 0x00,
-	0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-	0x00, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x03, 0xFF,
-	0xFE, 0x03, 0xFF, 0x00, 0x00, 0x0C, 0x00, 0x00,
-	0x18, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-	0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-	0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x22,
-	0x00, 0x02, 0x22, 0x00, 0x00, 0xE0, 0x7F, 0xFF,
-	0xC0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x01, 0x00, 0x00, 0x00, 0xE1, 0xFF, 0xC0,
-	0xF1, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0x81, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xA3,
-	0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x1F, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x87, 0xFF,
-	0xFF, 0x07, 0xFF, 0x00, 0x00, 0xC0, 0x00, 0x00,
-	0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00,
-	0x00, 0x3C, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE,
-	0x00, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-	0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xE0, 0x00,
-	0x1F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x07, 0xF0,
-	0x1F, 0x03, 0xF0, 0x00, 0x00, 0xFF, 0xFE, 0x00,
-	0xFF, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-	0x00, 0x3F, 0xFF, 0x00, 0x00, 0x0F, 0x00, 0x1F,
-	0x0F, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x18, 0x80,
-	0x00, 0x04, 0x80, 0x00, 0x00, 0x00, 0xFC, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xE7, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0xD7, 0xDF,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x55, 0xAA, 0xAB, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0x55, 0xAA, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0x55, 0xAA, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0x55, 0xAA, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0x55, 0xAA, 0xAA, 0x57, 0xAA, 0x57, 0xAE, 0x7B,
-	0x11, 0xC4, 0xEE, 0xBB, 0xEE, 0xBB, 0xEE, 0xBB,
-	0xEE, 0xBB, 0xEE, 0xBB, 0xEE, 0xBB, 0x12, 0xFC,
-	0xEE, 0xBB, 0xEE, 0xBB, 0xE0, 0x00, 0x00, 0x00,
-	0xEE, 0xBB, 0xE8, 0x80, 0x20, 0x00, 0x00, 0x01,
-	0x11, 0x48, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x11, 0x18, 0x00, 0x00, 0x00, 0x00, 0x60, 0x46,
-	0x8F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1C,
-	0x00, 0x04, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x0E,
-	0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xFF, 0xFF, 0x1F, 0x1F, 0x08, 0x07,
-	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F,
-	0x00, 0x00, 0xFF, 0xFD, 0xFF, 0xFD, 0xF7, 0xFD,
-	0x88, 0x22, 0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD,
-	0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD,
-	0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDE, 0x03, 0x07,
-	0x77, 0xDD, 0xFF, 0xC2, 0x80, 0x00, 0x00, 0x00,
-	0x77, 0xDF, 0x38, 0xC0, 0x00, 0x00, 0x00, 0x0E,
-	0x76, 0xF0, 0x20, 0x00, 0x00, 0x00, 0x03, 0x1F,
-	0xF5, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0,
-	0xAA, 0x01, 0x01, 0x00, 0x00, 0x00, 0xE0, 0x40,
-	0xAA, 0x55, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20,
-	0xAA, 0x55, 0xAA, 0x55, 0xD0, 0x00, 0x00, 0x00,
-	0xAA, 0x55, 0xAA, 0x55, 0x55, 0x6A, 0x1F, 0x05,
-	0xAA, 0x55, 0xAA, 0x55, 0x55, 0xAA, 0x55, 0xEA,
-	0xAA, 0x55, 0xAA, 0x55, 0x55, 0xAA, 0x55, 0xAA,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xAA, 0x56, 0xAA, 0x52, 0xA8, 0x42, 0x88, 0x62,
-	0x88, 0x22, 0x88, 0x22, 0x88, 0x22, 0x88, 0x22,
-	0x88, 0x22, 0x88, 0x22, 0x88, 0x22, 0x88, 0x22,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x57, 0xAE, 0x5B,
-	0xEE, 0xBB, 0xEE, 0xBB, 0xEE, 0xBB, 0xEE, 0xBB,
-	0xE8, 0xB0, 0xE8, 0xA0, 0xE0, 0xA0, 0xE8, 0xB0,
-	0x80, 0x00, 0x00, 0x00, 0x0F, 0x20, 0x0D, 0x07,
-	0x00, 0x03, 0x0D, 0x06, 0x03, 0xAA, 0x55, 0xAA,
-	0x00, 0xE0, 0x56, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0xE8, 0x2B, 0x15, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x1F, 0x2A, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x8F, 0xFA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x86, 0xE7, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x82, 0x45, 0x65, 0xB2, 0x55, 0xAA, 0x55, 0xAA,
-	0x00, 0x00, 0x80, 0xC0, 0x0E, 0x06, 0x55, 0xAA,
-	0x10, 0x08, 0xFC, 0xFE, 0x7F, 0x3F, 0xE0, 0xF0,
-	0x77, 0xDD, 0xF7, 0x5D, 0x37, 0x3D, 0xC0, 0xE0,
-	0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD, 0x76, 0xDC,
-	0xFE, 0xF0, 0x0F, 0x1F, 0xC0, 0x80, 0x7F, 0xFE,
-	0x00, 0x00, 0x00, 0x00, 0x21, 0x40, 0x2A, 0x55,
-	0xF7, 0xE3, 0x3C, 0x7D, 0x55, 0xAA, 0xAA, 0x55,
-	0x1C, 0x4C, 0xD7, 0xAA, 0x55, 0xAA, 0xAA, 0x55,
-	0x3E, 0xEB, 0x55, 0xAA, 0x55, 0xAA, 0xAA, 0x55,
-	0x3F, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0xAA, 0x55,
-	0x8D, 0x60, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xE0, 0xC0, 0x80, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0x00, 0x7E, 0xAA, 0x50, 0xA8, 0x55, 0xAA, 0x55,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xAA, 0x50,
-	0xE0, 0xF8, 0x03, 0x01, 0x82, 0x04, 0xFC, 0xF8,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0xAA, 0x55, 0xAA, 0x54, 0xA8, 0x52, 0x88, 0x52,
-	0x88, 0x22, 0x88, 0x22, 0x88, 0x22, 0x88, 0x22,
-	0x88, 0x22, 0x88, 0x22, 0x88, 0x22, 0x88, 0x22,
-	0x88, 0x22, 0x88, 0x22, 0x88, 0x22, 0x88, 0x22,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x57,
-	0xAE, 0x7B, 0xAE, 0xBB, 0xEE, 0xBB, 0xEE, 0xBB,
-	0xEE, 0xBB, 0xEE, 0xBB, 0xEE, 0xBB, 0xEE, 0xBB,
-	0xE8, 0xA0, 0xE0, 0xE0, 0xE0, 0xA0, 0xE8, 0xB0,
-	0xF0, 0xF8, 0x01, 0x01, 0x3F, 0x1F, 0xF0, 0xF8,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAB, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xEA, 0x6D, 0xB8, 0x56, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xEA, 0x40, 0x38,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0xF8, 0xF8, 0xA8, 0x56, 0xAA, 0x55, 0x55, 0xAA,
-	0x07, 0x07, 0xF8, 0xFC, 0x7E, 0x7E, 0x80, 0x00,
-	0xF8, 0xF8, 0x07, 0x07, 0xE0, 0xC0, 0x1F, 0x3F,
-	0x03, 0x06, 0x0D, 0x1A, 0x15, 0x3A, 0x55, 0x7F,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x56, 0xF0,
-	0xAA, 0x55, 0xAA, 0x55, 0x57, 0xA1, 0x60, 0x80,
-	0xAA, 0x55, 0xAA, 0x05, 0xD5, 0xAA, 0x55, 0xAA,
-	0xAA, 0x55, 0xAA, 0x55, 0x55, 0xAA, 0x55, 0xAA,
-	0xA8, 0x58, 0x07, 0x05, 0x55, 0xAB, 0x01, 0x03,
-	0x03, 0x01, 0x01, 0x01, 0x7E, 0xFC, 0xF8, 0xF0,
-	0x55, 0xAA, 0x55, 0xA9, 0x57, 0xA9, 0x57, 0xAD,
-	0x88, 0x22, 0x88, 0x22, 0x88, 0x22, 0x88, 0x22,
-	0x88, 0x22, 0x88, 0x22, 0x88, 0x22, 0x88, 0x22,
-	0x88, 0x22, 0x88, 0x22, 0x88, 0x22, 0x88, 0x22,
-	0x88, 0x22, 0x88, 0x22, 0x88, 0x22, 0x88, 0x22,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xAE, 0x5B, 0xAE, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xEE, 0xBB, 0xEE, 0xBB, 0xAE, 0x7B, 0xAE, 0x7B,
-	0xEE, 0xBB, 0xEE, 0xBB, 0xEE, 0xBB, 0xEE, 0xBB,
-	0xE8, 0xB0, 0xE0, 0xB0, 0xE8, 0xBE, 0xEE, 0xBB,
-	0x01, 0x00, 0x0E, 0x08, 0x07, 0x01, 0x7F, 0x7F,
-	0x55, 0xEA, 0xD5, 0xAA, 0x55, 0xAA, 0xD5, 0x4A,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x07, 0x01, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x35, 0x1E, 0x80, 0xE0, 0x5C, 0xAA, 0x55, 0xAA,
-	0xAA, 0x55, 0xAA, 0x55, 0x02, 0x00, 0x80, 0x60,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0x2A, 0x15,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0x20, 0x20, 0xA0, 0x40, 0xA0, 0x40, 0x18, 0x10,
-	0x00, 0x00, 0x00, 0x01, 0xFE, 0xFE, 0xFE, 0xFE,
-	0xD5, 0xAA, 0xD5, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAB,
-	0x55, 0xAA, 0x55, 0xAA, 0x56, 0xB8, 0x20, 0x01,
-	0x55, 0xAF, 0x18, 0x61, 0x04, 0x10, 0xF5, 0xAA,
-	0x62, 0x08, 0x35, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0xAA, 0x55, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0xAA, 0x55, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0xAA, 0x55, 0x55, 0xAA,
-	0xF8, 0xE0, 0xEE, 0x02, 0x04, 0x08, 0xE0, 0x80,
-	0x0C, 0x04, 0xF8, 0xF8, 0x07, 0x17, 0xE0, 0x80,
-	0x57, 0xDD, 0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD,
-	0x88, 0x22, 0x88, 0x22, 0x88, 0x22, 0x88, 0x22,
-	0x88, 0x22, 0x88, 0x22, 0x88, 0x22, 0x88, 0x22,
-	0x88, 0x22, 0x88, 0x22, 0x88, 0x22, 0x88, 0x22,
-	0x88, 0x22, 0x88, 0x22, 0x88, 0x22, 0x80, 0x00,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xAA, 0x55, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0xAA, 0x55, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0xAA, 0x55, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0xAE, 0x57, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0xEE, 0xBB, 0x11, 0x44, 0x11, 0x64, 0x51, 0xAC,
-	0xEE, 0xBA, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44,
-	0x7F, 0x7E, 0x80, 0x80, 0x20, 0x10, 0x18, 0x48,
-	0x15, 0x3A, 0xD5, 0x2A, 0x15, 0x06, 0x01, 0x0E,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0xA8, 0x54, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0x0C, 0x02, 0x40, 0x10, 0xA8, 0x52, 0xAA, 0x55,
-	0xAA, 0x55, 0xC0, 0x20, 0x08, 0x02, 0x80, 0x40,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x56, 0x04, 0x70,
-	0xA0, 0x40, 0x20, 0x00, 0x7F, 0xFF, 0x00, 0x00,
-	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xD5, 0xAA, 0xD5, 0x6A, 0x35, 0x1A, 0x03, 0x00,
-	0x55, 0xAA, 0x55, 0xAB, 0x56, 0xB8, 0x20, 0x80,
-	0x54, 0x90, 0x40, 0x01, 0x03, 0x07, 0x15, 0x4A,
-	0x0C, 0x10, 0x75, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0xAA, 0x54, 0x55, 0xAA, 0x57, 0xAE, 0x18, 0x0E,
-	0x7F, 0x0F, 0x1F, 0x3F, 0x80, 0x01, 0x04, 0x04,
-	0x80, 0x80, 0x3F, 0x5D, 0xF7, 0xDD, 0x77, 0xDD,
-	0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD,
-	0x88, 0x22, 0x88, 0x22, 0x88, 0x20, 0x80, 0x00,
-	0x88, 0x22, 0x88, 0x20, 0x00, 0x00, 0x00, 0x00,
-	0x88, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xEA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x51, 0xA8, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x11, 0x44, 0x51, 0x84, 0x51, 0xA8, 0x55, 0xAA,
-	0x18, 0x48, 0xE8, 0xBA, 0xEE, 0xBB, 0xEE, 0x7B,
-	0x0F, 0x01, 0x00, 0x00, 0x80, 0xE0, 0x18, 0x58,
-	0x55, 0xAA, 0xD5, 0x3A, 0x0C, 0x06, 0x30, 0x04,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0x1F, 0x07, 0xA8, 0x52, 0xA8, 0x50, 0xA8, 0x48,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x02, 0x0C, 0x08, 0x08, 0x04, 0x03, 0x01,
-	0xD5, 0xAA, 0xAA, 0x55, 0xAA, 0x55, 0x55, 0xAA,
-	0x55, 0xAA, 0xAA, 0x55, 0xAA, 0x55, 0x55, 0xAA,
-	0x55, 0xAA, 0xAA, 0x55, 0xAA, 0x55, 0x55, 0xAA,
-	0x55, 0xAA, 0xAA, 0x55, 0xAA, 0x55, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAB, 0xF8, 0xF0, 0x55, 0xAE,
-	0x56, 0xB8, 0x20, 0x80, 0x00, 0x01, 0x82, 0x04,
-	0x03, 0x07, 0x08, 0x10, 0x3F, 0x7F, 0xFF, 0xFF,
-	0x77, 0xDD, 0x77, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x11, 0x44,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x55, 0xEA, 0x55, 0xDA, 0x75, 0xDE, 0x75, 0xDD,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xEA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0xAE, 0x53, 0xAE, 0x55, 0xAE, 0x55, 0xAA, 0x55,
-	0x18, 0x4C, 0x12, 0x44, 0xEE, 0x7B, 0xAE, 0x5B,
-	0x00, 0x00, 0x80, 0x60, 0x18, 0x48, 0x14, 0x42,
-	0x3F, 0x07, 0x04, 0x10, 0x00, 0x00, 0x00, 0x00,
-	0x55, 0xAA, 0x55, 0xAA, 0xFF, 0x00, 0x00, 0x03,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0xD5, 0xF8,
-	0xAA, 0x55, 0x55, 0xAA, 0x55, 0xAA, 0x01, 0x7F,
-	0xAA, 0x55, 0x55, 0xAA, 0xF8, 0xA0, 0x00, 0x00,
-	0x10, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xD5, 0x6A, 0x3F, 0x1A, 0x03, 0x00, 0x00, 0x00,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0x0A, 0x07, 0x00,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0xFF, 0x03,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xE0, 0x1F, 0x07,
-	0x55, 0xAE, 0x5C, 0xAA, 0xE8, 0x00, 0x00, 0x00,
-	0x60, 0x00, 0x00, 0x01, 0xF8, 0xF8, 0x03, 0x1F,
-	0x04, 0x08, 0x0F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFB,
-	0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x11, 0x44,
-	0x00, 0x04, 0x01, 0x44, 0x11, 0x44, 0x11, 0x44,
-	0x01, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44,
-	0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD,
-	0x75, 0xCA, 0x75, 0xDE, 0x77, 0xDD, 0x77, 0xDD,
-	0x55, 0xAA, 0x55, 0xAA, 0x75, 0xAA, 0x75, 0xCA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xAE, 0x57, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xEE, 0xBB, 0xAE, 0x5B, 0x56, 0xAC, 0x08, 0x20,
-	0xE0, 0x4C, 0x18, 0x40, 0x00, 0x00, 0x00, 0x01,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0A, 0x55,
-	0x00, 0x00, 0x00, 0x00, 0x4A, 0xAA, 0xAA, 0x55,
-	0x00, 0x00, 0x00, 0x00, 0xA0, 0xAA, 0x55, 0xAB,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x03, 0x06, 0x15, 0x2A,
-	0x00, 0x01, 0x0D, 0x4A, 0x55, 0xAA, 0x55, 0xAA,
-	0x0F, 0xEA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0xFC, 0xAB, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x00, 0x20, 0xAA, 0x54, 0xAA, 0x55, 0x55, 0xAA,
-	0x00, 0x00, 0x00, 0xC0, 0xE0, 0xB8, 0x56, 0xAB,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x81,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x55, 0xAA,
-	0x00, 0x00, 0x00, 0x00, 0x80, 0xBF, 0x55, 0xAA,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x78, 0xAB,
-	0xFE, 0xF8, 0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x3F, 0xFF, 0x00, 0x60, 0x10, 0x0C, 0x02, 0x01,
-	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x04, 0x11, 0x44,
-	0xFF, 0xFF, 0x00, 0x04, 0x11, 0x44, 0x11, 0x44,
-	0xFE, 0xFB, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44,
-	0xEE, 0xBB, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44,
-	0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44,
-	0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44,
-	0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x40,
-	0x11, 0x44, 0x11, 0x44, 0x11, 0x46, 0x55, 0xAA,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD,
-	0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD,
-	0x75, 0xDD, 0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD,
-	0x55, 0xAA, 0x75, 0xDA, 0x75, 0xDE, 0x77, 0xDD,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xDA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xAA, 0x56, 0xA8, 0x50, 0x58, 0xB0, 0x60, 0xC0,
-	0x80, 0x00, 0x00, 0x01, 0x00, 0x01, 0x02, 0x05,
-	0x02, 0x05, 0x2A, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0x55, 0xAE,
-	0x56, 0xAC, 0x58, 0xB0, 0x60, 0x80, 0x80, 0x00,
-	0x00, 0x01, 0x03, 0x03, 0x07, 0x02, 0x03, 0x01,
-	0xD5, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0xAA, 0x55,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0xAA, 0x55,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0xAA, 0x55,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0xAA, 0x55,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x40, 0xE0, 0x70, 0xB0, 0x58, 0xA8, 0x58, 0xB8,
-	0xD5, 0x6A, 0x35, 0x1A, 0x0D, 0x00, 0x01, 0x00,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0x6A,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0xE0, 0xF8, 0xA8, 0x56, 0xAA, 0x55, 0xAA, 0x55,
-	0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xC0, 0xF0, 0xB8,
-	0x51, 0x14, 0x09, 0x04, 0x03, 0x01, 0x01, 0x00,
-	0x11, 0x44, 0x11, 0x44, 0xEE, 0xBB, 0xEE, 0x7B,
-	0x11, 0x44, 0x11, 0x44, 0xEE, 0xBB, 0xEE, 0xB9,
-	0x11, 0x44, 0x11, 0x44, 0xEE, 0xBB, 0xEA, 0xD5,
-	0x11, 0x44, 0x11, 0x42, 0x15, 0xAA, 0x55, 0xAA,
-	0x11, 0x44, 0x15, 0x2A, 0x55, 0xAA, 0x55, 0xAA,
-	0x15, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD,
-	0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD,
-	0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD,
-	0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD,
-	0x77, 0xDA, 0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD,
-	0x55, 0xAA, 0x55, 0xCA, 0x75, 0xDC, 0x77, 0xDD,
-	0xAA, 0x55, 0xAA, 0x54, 0xAA, 0x50, 0x56, 0xFE,
-	0x80, 0x00, 0x80, 0x80, 0x80, 0x01, 0x01, 0x01,
-	0x35, 0x4A, 0x2A, 0x15, 0x2A, 0x55, 0xAA, 0x55,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xAA, 0x55, 0xAA, 0x54, 0x56, 0xAC, 0x58, 0xE0,
-	0x58, 0x90, 0x60, 0x80, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x55, 0x6A, 0x35, 0x1A, 0x0C, 0x01, 0x00, 0x00,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x15, 0xC0, 0xFE,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x15,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0x55, 0xAA, 0xAA, 0x55, 0xAA, 0x55, 0x55, 0xFA,
-	0x55, 0xAA, 0xAA, 0x54, 0x57, 0xB8, 0x80, 0x00,
-	0x58, 0xB0, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x75, 0x1A, 0x0D, 0x03, 0x01, 0x00, 0x00, 0x00,
-	0x55, 0xAA, 0xAA, 0x55, 0xD5, 0x6A, 0x0A, 0x01,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0x58, 0xFC, 0x56, 0xAB, 0xAA, 0x54, 0xAA, 0x55,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80,
-	0x2E, 0x1B, 0x0E, 0x15, 0x15, 0x1A, 0x15, 0x1A,
-	0xEE, 0x95, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x77, 0xDD,
-	0x55, 0xAA, 0x55, 0xAA, 0x57, 0x9D, 0x77, 0xDD,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x77, 0xFD, 0xF7, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD, 0xF7, 0xFD,
-	0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD,
-	0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD,
-	0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD,
-	0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD,
-	0x76, 0xDC, 0x88, 0x20, 0x88, 0x20, 0x88, 0x20,
-	0x01, 0x01, 0x00, 0x01, 0x07, 0x02, 0x04, 0x04,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x56, 0x5C, 0xE0,
-	0xAA, 0x50, 0xA0, 0x60, 0x80, 0x00, 0x00, 0x00,
-	0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-	0x00, 0x00, 0x00, 0x00, 0x03, 0x1E, 0x75, 0xAA,
-	0x00, 0x00, 0x0F, 0x7A, 0x55, 0xAA, 0x55, 0xAA,
-	0x00, 0x00, 0xFE, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x00, 0x00, 0x80, 0x98, 0x56, 0xAA, 0x55, 0xAA,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x60, 0xB8,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x0E,
-	0x00, 0x00, 0x0F, 0x1A, 0x55, 0xAA, 0x55, 0xAA,
-	0x00, 0x7D, 0xAA, 0x55, 0x55, 0xAA, 0x55, 0xAA,
-	0x00, 0xF0, 0xAA, 0x55, 0x55, 0xAA, 0x55, 0xAA,
-	0x00, 0x00, 0xC0, 0xB8, 0x56, 0xAB, 0x55, 0xAA,
-	0x00, 0x01, 0x00, 0x00, 0x00, 0xC0, 0x60, 0xB8,
-	0xAA, 0x55, 0x0A, 0x05, 0x0D, 0x01, 0x00, 0x00,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0x0A, 0x05,
-	0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x80, 0x00,
-	0x02, 0x05, 0x02, 0x01, 0x0D, 0x06, 0x0F, 0x07,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xA8, 0x62,
-	0xAA, 0x55, 0xAA, 0x55, 0xA8, 0x42, 0x88, 0x22,
-	0x55, 0xAB, 0x55, 0xDD, 0x77, 0xDD, 0x77, 0xDD,
-	0x57, 0xDD, 0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD,
-	0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD,
-	0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xF7, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x77, 0xDD, 0x77, 0xDD, 0xF7, 0xDD, 0xFF, 0xFF,
-	0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD,
-	0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDE, 0x7C, 0xD0,
-	0x78, 0xD8, 0x08, 0x20, 0x80, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE,
-	0x00, 0x01, 0x1D, 0x3A, 0x75, 0x6A, 0x2A, 0x55,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0x55, 0xAA, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0x55, 0xAA, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0x55, 0xAA, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0x54, 0xAE, 0xAA, 0x54, 0xAA, 0x55, 0xAA, 0x55,
-	0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x3F, 0x1F,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE,
-	0x0D, 0x1A, 0x35, 0x6A, 0x55, 0xAA, 0x2A, 0x55,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0xAA, 0x55,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0xAA, 0x55,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0xAA, 0x55,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0xAA, 0x55,
-	0x54, 0xAE, 0x55, 0xAA, 0x55, 0xAA, 0xAA, 0x55,
-	0x00, 0x00, 0x80, 0x40, 0x40, 0xE0, 0x58, 0xB8,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x49,
-	0x08, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-	0x88, 0x22, 0x88, 0x22, 0x3F, 0x1F, 0x07, 0x01,
-	0x88, 0x22, 0x88, 0x22, 0x88, 0x22, 0x88, 0x22,
-	0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD,
-	0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD, 0x7F, 0xFF,
-	0x77, 0xDD, 0x77, 0xDD, 0x7F, 0xFF, 0xFF, 0xFF,
-	0x77, 0xDD, 0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-	0x08, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFC, 0xF8,
-	0x78, 0x60, 0x40, 0x80, 0x80, 0x00, 0x01, 0x03,
-	0x03, 0x04, 0x0D, 0x3A, 0x15, 0xAA, 0x55, 0xAA,
-	0x56, 0xA9, 0x55, 0xAB, 0x55, 0xAA, 0x55, 0xAA,
-	0x00, 0x00, 0x80, 0x00, 0x80, 0x80, 0x80, 0x80,
-	0x03, 0x06, 0x0D, 0x0E, 0x0D, 0x1A, 0x15, 0x3A,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0xAA, 0x55, 0xAA, 0x55, 0x55, 0xAA, 0x55, 0xAA,
-	0xAA, 0x55, 0xAA, 0x55, 0x55, 0xAA, 0x55, 0xAA,
-	0xAA, 0x55, 0xAA, 0x55, 0x55, 0xAA, 0x55, 0xAA,
-	0xAA, 0x55, 0xAA, 0x55, 0x55, 0xAA, 0x55, 0xAA,
-	0xE0, 0xE0, 0xE0, 0xB0, 0x50, 0xB0, 0x50, 0xB0,
-	0xFE, 0xFE, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0x58, 0xAC, 0x54, 0xAE, 0x56, 0xAB, 0xAA, 0x54,
-	0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x81, 0x01,
-	0x2A, 0x55, 0x2A, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0x80, 0x40, 0x58, 0xAE, 0x56, 0xAB, 0xAA, 0x55,
-	0x01, 0x01, 0x00, 0x00, 0x00, 0x80, 0x80, 0xC0,
-	0x08, 0x22, 0x3F, 0x1F, 0x30, 0x10, 0x0F, 0x07,
-	0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0xBB, 0xEE, 0xBB,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xBF,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF8, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0,
-	0x07, 0x0E, 0x0D, 0x1A, 0x15, 0x3A, 0x35, 0x3A,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-	0x35, 0x3A, 0x35, 0x3A, 0x35, 0x3A, 0x35, 0x3A,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0x70, 0xE0, 0x1F, 0x1F, 0x80, 0x00, 0xC0, 0x80,
-	0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xAA, 0x55, 0x2A, 0x55, 0xD5, 0x6A, 0x75, 0x3A,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xAA, 0x54, 0xAA, 0x54, 0xAA, 0x54, 0xAA, 0x54,
-	0x81, 0x81, 0x82, 0x82, 0x81, 0x81, 0x81, 0x01,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0x60, 0x90, 0x58, 0xB8, 0x58, 0xA8, 0xA0, 0x50,
-	0x07, 0x03, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x7B,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBB, 0xEE, 0xBB,
-	0xFF, 0xFF, 0xFE, 0xFB, 0xEE, 0xBB, 0xEE, 0xBB,
-	0xFF, 0xFB, 0xEE, 0xBB, 0xEE, 0xBB, 0xEE, 0xBB,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xEE, 0xBB, 0xEE, 0xBB, 0xEE, 0xBB, 0xEE, 0xBB,
-	0xEE, 0xBB, 0xEE, 0xBB, 0xEE, 0xBB, 0xEE, 0xBB,
-	0x00, 0x00, 0xEE, 0xBB, 0xEE, 0xBB, 0xEE, 0xBB,
-	0x00, 0x00, 0x00, 0x00, 0xEE, 0xBB, 0xEE, 0xBB,
-	0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
-	0x35, 0x7A, 0x75, 0x2A, 0x75, 0x2A, 0x35, 0x3A,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAB, 0x55, 0xAB, 0x55, 0xAA, 0x56, 0xAE,
-	0x80, 0x80, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00,
-	0x35, 0x3A, 0x15, 0x1A, 0x0D, 0x0E, 0x05, 0x03,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0x55, 0xAA, 0x56, 0xAC, 0x58, 0xB8, 0x60, 0xC0,
-	0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x15, 0x1A, 0x0D, 0x04, 0x02, 0x01, 0x00, 0x00,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xD5, 0x7A,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xAA, 0x54, 0x56, 0xAC, 0x54, 0xA8, 0x58, 0xB0,
-	0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xAA, 0x55, 0x2A, 0x55, 0x2A, 0x55, 0xD5, 0x6A,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xA8, 0x50, 0xA8, 0x50, 0xA8, 0x50, 0xA8, 0x50,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x6E, 0x3B, 0x91, 0x44, 0x6E, 0x3B, 0x6E, 0x3B,
-	0xEE, 0xBB, 0xEE, 0xBB, 0xEE, 0xBB, 0xEE, 0xBB,
-	0xEE, 0xBB, 0xEE, 0xBB, 0xEE, 0xBB, 0xEE, 0xBB,
-	0xEE, 0xBB, 0xEE, 0xBB, 0xEE, 0xB9, 0xAE, 0x55,
-	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xEE, 0xBB, 0xEE, 0xBB, 0xEE, 0xBB, 0x55, 0xAA,
-	0xEE, 0xBB, 0xEE, 0xBB, 0xEE, 0xBB, 0x11, 0x44,
-	0xEE, 0xBB, 0xEE, 0xBB, 0xEE, 0xBB, 0x11, 0x44,
-	0xEE, 0xBB, 0xEE, 0xBB, 0xEE, 0xBB, 0x11, 0x44,
-	0xE0, 0xE0, 0xE0, 0xF0, 0x18, 0x08, 0x18, 0x48,
-	0x35, 0x1A, 0x15, 0x1A, 0x0D, 0x0E, 0x0D, 0x04,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0xAA, 0x55,
-	0x56, 0xAC, 0x54, 0xAC, 0x58, 0xA8, 0x58, 0xF0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x55, 0xEA, 0xF5, 0x1A, 0x0D, 0x03, 0x00, 0x00,
-	0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x35, 0x00,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x00,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x50, 0x18, 0x00,
-	0x55, 0xAE, 0xA8, 0x60, 0x80, 0x00, 0x00, 0x00,
-	0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0A, 0x15,
-	0x00, 0x00, 0x00, 0x01, 0x0A, 0x55, 0xAA, 0x55,
-	0x00, 0x00, 0x00, 0xB0, 0xAA, 0x55, 0xAA, 0x55,
-	0x00, 0x00, 0x00, 0x00, 0xE0, 0xAE, 0xAA, 0x55,
-	0x15, 0x06, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0,
-	0xAA, 0x55, 0x55, 0x4A, 0x10, 0x03, 0x00, 0x00,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x15, 0x00, 0x00,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x56, 0x78, 0x00,
-	0xAA, 0x54, 0x57, 0xAE, 0x78, 0xC0, 0x00, 0x00,
-	0x60, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xD5, 0x6A, 0x0A, 0x05, 0x35, 0x1A, 0x02, 0x05,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0x58, 0xA8, 0x58, 0xB0, 0xA0, 0x40, 0x60, 0xC0,
-	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x06,
-	0x6E, 0x3B, 0xEE, 0x5D, 0xAA, 0x55, 0xAA, 0x55,
-	0xEE, 0xB5, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xEA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-	0x00, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xF8, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-	0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-	0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x80,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-	0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-	0xFE, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-	0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFE,
-	0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-	0xFF, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x40,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-	0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xFF,
-	0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-	0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-	0x00, 0xA0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-	0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-	0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFE, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-	0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xA8, 0x00,
-	0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-	0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-	0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-	0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-	0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x50, 0x00,
-	0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xC0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-	0xF8, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-	0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-	0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-	0xE4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
-	0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
-	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
-	0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00,
-	0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
-	0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-	0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-	0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-	0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-	0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-};
@@ -1,3 +0,0 @@
-#pragma once
-
-extern const uint8_t raspi[23042];
@@ -0,0 +1,93 @@
+// vim: ts=4:sw=4:sts=4:et
+#include <stdio.h>
+#include <string.h>
+
+#include "activity.h"
+
+// a - b, or 0 if the samples were taken far enough apart for b to be ahead
+static uint64_t difference(uint64_t a, uint64_t b) {
+    return a > b ? a - b : 0;
+}
+
+void activity_reset(activity_t *activity, const uint32_t seen[ACTIVITY_SOURCES], bool unlocked) {
+    uint32_t start[ACTIVITY_SOURCES];
+    memcpy(start, seen, sizeof(start));
+    memset(activity, 0, sizeof(*activity));
+    memcpy(activity->seen, start, sizeof(activity->seen));
+    activity->unlocked = unlocked;
+}
+
+void activity_sample(activity_t *activity, activity_source_t source, uint32_t seen) {
+    activity->totals[source] += (uint32_t)(seen - activity->seen[source]);
+    activity->seen[source] = seen;
+}
+
+void activity_rebase(activity_t *activity, activity_source_t source, uint32_t seen) {
+    activity->seen[source] = seen;
+}
+
+static uint64_t command_area_reads(const activity_t *activity) {
+    return difference(activity->totals[ACTIVITY_ROMH] + activity->totals[ACTIVITY_ROML],
+                      activity->totals[ACTIVITY_WINDOW]);
+}
+
+void activity_guard(activity_t *activity, bool unlocked) {
+    if(unlocked == activity->unlocked) {
+        return;
+    }
+    uint64_t reads = command_area_reads(activity);
+    if(unlocked) {
+        activity->locked_reads += difference(reads, activity->locked_since);
+        activity->unlocks++;
+    } else {
+        activity->locked_since = reads;
+    }
+    activity->unlocked = unlocked;
+}
+
+activity_counts_t activity_counts(const activity_t *activity) {
+    uint64_t reads = command_area_reads(activity);
+    uint64_t locked = activity->locked_reads;
+    if(!activity->unlocked) {
+        locked += difference(reads, activity->locked_since);
+    }
+    activity_counts_t counts = {
+        .romh_reads = activity->totals[ACTIVITY_ROMH],
+        .roml_reads = activity->totals[ACTIVITY_ROML],
+        .window_reads = activity->totals[ACTIVITY_WINDOW],
+        .command_area_reads = reads,
+        .commands = activity->totals[ACTIVITY_COMMANDS],
+        .status_polls = difference(difference(reads, locked), activity->totals[ACTIVITY_COMMANDS]),
+        .filtered_reads = difference(locked, activity->unlocks),
+    };
+    return counts;
+}
+
+size_t activity_export(const activity_t *activity, char *out, size_t size) {
+    activity_counts_t counts = activity_counts(activity);
+    int n = snprintf(out, size, "ACTIVITY romh %llu roml %llu window %llu command_area %llu "
+                     "commands %llu status %llu filtered %llu\n",
+                     (unsigned long long)counts.romh_reads,
+                     (unsigned long long)counts.roml_reads,
+                     (unsigned long long)counts.window_reads,
+                     (unsigned long long)counts.command_area_reads,
+                     (unsigned long long)counts.commands,
+                     (unsigned long long)counts.status_polls,
+                     (unsigned long long)counts.filtered_reads);
+    return n < 0 ? 0 : n;
+}
+
+void activity_led_reset(activity_led_t *led, uint32_t reads) {
+    led->reads = reads;
+    led->hold = 0;
+}
+
+bool activity_led_tick(activity_led_t *led, uint32_t reads) {
+    if(reads != led->reads) {
+        led->reads = reads;
+        led->hold = ACTIVITY_LED_HOLD_TICKS;
+    } else if(led->hold > 0) {
+        led->hold--;
+    }
+    return led->hold > 0;
+}
@@ -0,0 +1,92 @@
+// vim: ts=4:sw=4:sts=4:et
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// What the C64 does on the bus, counted without an interrupt for each read, and the activity
+// LED driven from the counts.
+//
+// The hardware keeps free-running counts: each address decoder pushes to its RX FIFO as a read
+// finishes, and a DMA channel drains it, so its transfer count goes down by one for each read
+// on that ROM line.  The read chain's address channel does the same for the reads the read
+// program answers.  main() samples them, and the commands it's taken, from its idle loop, and
+// works out the rest:
+//
+// - command area reads are the reads on both lines less the ones the read program answered
+// - filtered reads are command area reads while the guard is locked, less the one that unlocks
+//   it each time.  They go on the side of the guard main() last saw, so a read in the few µs
+//   before it sees an unlock or relock can be counted on the wrong side.
+// - status polls are the other command area reads that weren't commands
+//
+// The LED is on for ACTIVITY_LED_HOLD_TICKS after the reads on either line last changed, from
+// a timer every ACTIVITY_LED_TICK_MS that only reads the decoders' DMA counts.
+//
+// tools/activity.py reads the export format, and tools/activity_test.py checks this against it.
+
+// What each DMA channel counting for us starts its transfer count at.  It stops when it runs
+// out, and main() starts it again.
+#define ACTIVITY_DMA_COUNT 0xffffffff
+
+#define ACTIVITY_LED_TICK_MS 10
+#define ACTIVITY_LED_HOLD_TICKS 10
+
+// Longest export: the one line
+#define ACTIVITY_EXPORT_MAX 256
+
+// The counts the hardware and main() keep, each sampled as a free-running 32 bit count
+typedef enum {
+    ACTIVITY_ROMH,      // reads with ROMH low, by its address decoder's DMA channel
+    ACTIVITY_ROML,
+    ACTIVITY_WINDOW,    // reads the read program answered, by the read chain's address channel
+    ACTIVITY_COMMANDS,  // commands main() has taken from the command program
+    ACTIVITY_SOURCES,
+} activity_source_t;
+
+typedef struct {
+    uint64_t romh_reads;
+    uint64_t roml_reads;
+    uint64_t window_reads;
+    uint64_t command_area_reads;
+    uint64_t commands;
+    uint64_t status_polls;
+    uint64_t filtered_reads;
+} activity_counts_t;
+
+typedef struct {
+    uint32_t seen[ACTIVITY_SOURCES];    // the last sample of each
+    uint64_t totals[ACTIVITY_SOURCES];
+    bool unlocked;                      // the guard, as last seen
+    uint64_t unlocks;
+    uint64_t locked_reads;              // command area reads while locked, before locked_since
+    uint64_t locked_since;              // command area reads when it was last seen locking
+} activity_t;
+
+typedef struct {
+    uint32_t reads;     // on both lines, at the last tick
+    unsigned hold;      // ticks left on
+} activity_led_t;
+
+// Start counting from zero, with the sources at seen and the guard as it is
+void activity_reset(activity_t *activity, const uint32_t seen[ACTIVITY_SOURCES], bool unlocked);
+
+// Add what a source has counted since the last sample
+void activity_sample(activity_t *activity, activity_source_t source, uint32_t seen);
+
+// The source starts again from seen, like a DMA channel started again, without counting
+void activity_rebase(activity_t *activity, activity_source_t source, uint32_t seen);
+
+// The guard is (still) unlocked or locked, with the counts sampled up to now
+void activity_guard(activity_t *activity, bool unlocked);
+
+activity_counts_t activity_counts(const activity_t *activity);
+
+// Write the counts as an ACTIVITY line, returning the length it needs (like snprintf)
+size_t activity_export(const activity_t *activity, char *out, size_t size);
+
+// Start the LED off, with the reads on both lines at reads
+void activity_led_reset(activity_led_t *led, uint32_t reads);
+
+// A tick of the LED timer, with the reads on both lines now.  Returns whether it's on.
+bool activity_led_tick(activity_led_t *led, uint32_t reads);
@@ -0,0 +1,42 @@
+// vim: ts=4:sw=4:sts=4:et
+#include <string.h>
+
+#include "asset.h"
+
+
+const asset_t *asset_find(const char *name) {
+    for(size_t i = 0; i < asset_count; i++) {
+        if(strcmp(assets[i].name, name) == 0) {
+            return &assets[i];
+        }
+    }
+    return NULL;
+}
+
+void asset_unpack(const asset_t *asset, uint8_t *dest) {
+    if(!asset->packed_size) {
+        memcpy(dest, asset->data, asset->size);
+        return;
+    }
+
+    // PackBits: n <= 127 is followed by n+1 literal bytes, n >= 129 by a byte to repeat 257-n
+    // times, and 128 is a no-op
+    const uint8_t *src = asset->data;
+    const uint8_t *end = src + asset->packed_size;
+    uint8_t *dest_end = dest + asset->size;
+    while(src < end && dest < dest_end) {
+        uint8_t n = *src++;
+        size_t len = n <= 127 ? (size_t)n + 1 : (size_t)(257 - n);
+        if(len > (size_t)(dest_end - dest)) {
+            len = dest_end - dest;
+        }
+        if(n <= 127) {
+            memcpy(dest, src, len);
+            src += n + 1;
+            dest += len;
+        } else if(n >= 129) {
+            memset(dest, *src++, len);
+            dest += len;
+        }
+    }
+}
@@ -0,0 +1,48 @@
+// vim: ts=4:sw=4:sts=4:et
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Binary assets embedded by c64_assets.cmake.  Each asset also has its own generated header
+// (e.g. raspi.h) declaring its data and CRC-32.
+
+// How an image is sent to the C64 (see copy_gen.h), set with LAYOUT in c64_add_asset()
+typedef enum {
+    ASSET_LAYOUT_LINEAR = 0,  // through the window in order, for the loader's own copy loop
+    ASSET_LAYOUT_SECTIONS,    // a copy routine, with only the sections it copies in the window
+    ASSET_LAYOUT_IMMEDIATE,   // as the operands of a copy routine, one chunk at a time
+} asset_layout_t;
+
+// What an asset is, set with KIND in c64_add_asset()
+typedef enum {
+    ASSET_KIND_RAW = 0,  // data for the firmware to use as it likes
+    ASSET_KIND_PRG,      // a C64 .prg file, with its load address, that the loader can run
+    ASSET_KIND_D64,      // a .d64 disk image that LOAD can read files from (see d64.h)
+    ASSET_KIND_CRT_8K,   // a 16K bank parsed from an 8K .crt: ROML, then ROMH unused
+    ASSET_KIND_CRT_16K,  // a 16K bank parsed from a 16K .crt: ROML, then ROMH
+    ASSET_KIND_SNAPSHOT, // a C64 memory snapshot to resume (see snapshot.h)
+} asset_kind_t;
+
+typedef struct {
+    const char *name;
+    const uint8_t *data;   // PackBits data if packed_size is not 0, otherwise the asset itself
+    uint32_t size;         // unpacked size
+    uint32_t packed_size;  // 0 if not compressed
+    uint32_t align;
+    uint32_t crc32;        // CRC-32 of the unpacked data
+    asset_layout_t layout;
+    asset_kind_t kind;
+    uint16_t exec;         // PRG start address, or 0 to take it from the file (see prg.h)
+} asset_t;
+
+// Generated by embed_asset.py from the assets added to the firmware target
+extern const asset_t assets[];
+extern const size_t asset_count;
+
+// Look up an asset by name, returning NULL if there's no such asset
+const asset_t *asset_find(const char *name);
+
+// Copy an asset's data to dest, unpacking it if it's compressed.  dest must hold asset->size
+// bytes.
+void asset_unpack(const asset_t *asset, uint8_t *dest);
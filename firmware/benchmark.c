@@ -0,0 +1,61 @@
+// vim: ts=4:sw=4:sts=4:et
+#include <stdio.h>
+#include <string.h>
+
+#include "benchmark.h"
+
+static const char *const benchmark_names[BENCHMARK_RESULTS] = {
+    [BENCHMARK_COPY] = "copy",
+    [BENCHMARK_ROUND_TRIP] = "round_trip",
+    [BENCHMARK_POLL] = "poll",
+};
+
+void benchmark_reset(benchmark_t *benchmark) {
+    memset(benchmark, 0, sizeof(*benchmark));
+}
+
+bool benchmark_record(benchmark_t *benchmark, unsigned index, uint32_t cycles) {
+    if(index >= BENCHMARK_RESULTS) {
+        return false;
+    }
+    benchmark->cycles[index] = cycles;
+    benchmark->received |= 1u << index;
+    return true;
+}
+
+const char *benchmark_name(unsigned index) {
+    return index < BENCHMARK_RESULTS ? benchmark_names[index] : NULL;
+}
+
+uint32_t benchmark_count(unsigned index) {
+    switch(index) {
+        case BENCHMARK_COPY:
+            return BENCHMARK_COPY_WINDOWS * BENCHMARK_WINDOW_SIZE;
+        case BENCHMARK_ROUND_TRIP:
+            return BENCHMARK_ROUND_TRIPS;
+        case BENCHMARK_POLL:
+            return BENCHMARK_POLLS;
+        default:
+            return 0;
+    }
+}
+
+size_t benchmark_export(const benchmark_t *benchmark, char *out, size_t size) {
+    unsigned received = 0;
+    for(unsigned i = 0; i < BENCHMARK_RESULTS; i++) {
+        received += (benchmark->received >> i) & 1;
+    }
+    size_t len = 0;
+    int n = snprintf(out, size, "BENCHMARK results %u of %u\n", received, BENCHMARK_RESULTS);
+    len += n > 0 ? n : 0;
+    for(unsigned i = 0; i < BENCHMARK_RESULTS; i++) {
+        if(benchmark->received & (1u << i)) {
+            n = snprintf(len < size ? out + len : NULL, len < size ? size - len : 0,
+                         "BENCH %s cycles %lu count %lu\n", benchmark_names[i],
+                         (unsigned long)benchmark->cycles[i],
+                         (unsigned long)benchmark_count(i));
+            len += n > 0 ? n : 0;
+        }
+    }
+    return len;
+}
@@ -0,0 +1,58 @@
+// vim: ts=4:sw=4:sts=4:et
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Results of the benchmark cartridge, c64-rom/benchmark_rom.asm, which the C64 sends back with
+// CMD_BENCH_RESULT (see command_dispatch.h).
+//
+// The benchmark times with CIA 2's timers what the C64 gets from the cartridge, in C64 cycles:
+// copying windows of 1K into RAM with CMD_NEXT_PAGE between them, round trips of CMD_PING, and
+// polls of the status.  Each result is the cycles for BENCHMARK_COUNTS of what it times, so a
+// rate needs the C64's clock, which the Pico doesn't know.
+//
+// tools/benchmark.py reads the export format, and tools/benchmark_test.py runs the benchmark on
+// the emulated 6502 against a model of the cartridge, and checks the export against it.
+
+// What the benchmark does, as in benchmark_rom.asm
+#define BENCHMARK_COPY_WINDOWS 16
+#define BENCHMARK_WINDOW_SIZE 1024
+#define BENCHMARK_ROUND_TRIPS 64
+#define BENCHMARK_POLLS 256
+
+// Longest export: the summary line, and a BENCH line for every result
+#define BENCHMARK_EXPORT_MAX (32 + BENCHMARK_RESULTS * 56)
+
+typedef enum {
+    BENCHMARK_COPY,         // cycles for BENCHMARK_COPY_WINDOWS windows, in bytes
+    BENCHMARK_ROUND_TRIP,   // cycles for BENCHMARK_ROUND_TRIPS commands
+    BENCHMARK_POLL,         // cycles for BENCHMARK_POLLS status reads
+    BENCHMARK_RESULTS,
+} benchmark_result_t;
+
+typedef struct {
+    uint32_t cycles[BENCHMARK_RESULTS];
+    uint32_t received;      // bit n is set once result n has come
+} benchmark_t;
+
+// Forget the results, for the next run
+void benchmark_reset(benchmark_t *benchmark);
+
+// Keep the cycles the C64 sent for result index.  Returns false if there's no such result.
+bool benchmark_record(benchmark_t *benchmark, unsigned index, uint32_t cycles);
+
+// The name of result index in the export format, or NULL
+const char *benchmark_name(unsigned index);
+
+// How many of what it times result index is the cycles for: bytes, round trips or polls
+uint32_t benchmark_count(unsigned index);
+
+// Write the export format to out, and return its length like snprintf:
+//
+//     BENCHMARK results <received> of <results>
+//     BENCH <name> cycles <cycles> count <count>
+//
+// with a BENCH line for each result that's come, in order.
+size_t benchmark_export(const benchmark_t *benchmark, char *out, size_t size);
@@ -0,0 +1,85 @@
+# Embed binary files in a target with .incbin, instead of converting them to C arrays.
+#
+#   c64_add_asset(<target> <name> <file>
+#                 [SKIP <bytes>] [ALIGN <bytes>] [SECTION <section>] [COMPRESS]
+#                 [LAYOUT <LINEAR|SECTIONS|IMMEDIATE>] [KIND <RAW|PRG|D64|CRT|SNAPSHOT>] [EXEC <address>])
+#
+# Declares `const uint8_t <name>[]` (or `<name>_packed[]` with COMPRESS) and
+# `const uint32_t <name>_crc32` in a generated <name>.h.  Each asset is its own custom command,
+# so only assets whose file changed are regenerated and reassembled.  LAYOUT is how the firmware
+# sends the image to the C64 (asset_layout_t in asset.h), LINEAR if it's not given.  KIND PRG
+# marks a C64 .prg file the loader can run, which can't be skipped into or compressed; EXEC sets
+# its start address if it doesn't start with a BASIC SYS.  KIND D64 marks a .d64 disk image the
+# C64 can LOAD from (see d64.h), which can't be skipped into or compressed either.  KIND CRT
+# parses a .crt into the 16K bank the cartridge library serves (tools/crt.py), failing the
+# build for cartridges this hardware can't serve.  KIND SNAPSHOT marks a C64 memory snapshot to
+# resume (see snapshot.h), checked with tools/snapshot.py, which is served straight from flash too.
+#
+#   c64_asset_manifest(<target>)
+#
+# Call once after adding a target's assets, to generate the `assets` table declared in asset.h
+# and an asset_manifest.json describing them.
+
+find_package(Python3 REQUIRED COMPONENTS Interpreter)
+
+set(C64_EMBED_ASSET ${CMAKE_CURRENT_LIST_DIR}/../tools/embed_asset.py)
+set(C64_CRT_PARSER ${CMAKE_CURRENT_LIST_DIR}/../tools/crt.py)
+set(C64_SNAPSHOT_PARSER ${CMAKE_CURRENT_LIST_DIR}/../tools/snapshot.py)
+set(C64_ASSET_DIR ${CMAKE_CURRENT_BINARY_DIR}/assets)
+
+function(c64_add_asset target name file)
+    cmake_parse_arguments(ASSET "COMPRESS" "SKIP;ALIGN;SECTION;LAYOUT;KIND;EXEC" "" ${ARGN})
+    get_filename_component(file ${file} ABSOLUTE)
+
+    set(args --name ${name} --output-dir ${C64_ASSET_DIR})
+    if(ASSET_SKIP)
+        list(APPEND args --skip ${ASSET_SKIP})
+    endif()
+    if(ASSET_ALIGN)
+        list(APPEND args --align ${ASSET_ALIGN})
+    endif()
+    if(ASSET_SECTION)
+        list(APPEND args --section ${ASSET_SECTION})
+    endif()
+    if(ASSET_COMPRESS)
+        list(APPEND args --compress)
+    endif()
+    if(ASSET_LAYOUT)
+        string(TOLOWER ${ASSET_LAYOUT} layout)
+        list(APPEND args --layout ${layout})
+    endif()
+    if(ASSET_KIND)
+        string(TOLOWER ${ASSET_KIND} kind)
+        list(APPEND args --kind ${kind})
+    endif()
+    if(ASSET_EXEC)
+        list(APPEND args --exec ${ASSET_EXEC})
+    endif()
+
+    set(asm ${C64_ASSET_DIR}/${name}_asset.S)
+    add_custom_command(
+        OUTPUT ${asm} ${C64_ASSET_DIR}/${name}.h ${C64_ASSET_DIR}/${name}.asset.json
+        COMMAND Python3::Interpreter ${C64_EMBED_ASSET} embed ${args} ${file}
+        DEPENDS ${file} ${C64_EMBED_ASSET} ${C64_CRT_PARSER} ${C64_SNAPSHOT_PARSER}
+        COMMENT "Embedding ${name}"
+        VERBATIM)
+
+    # .incbin reads the file when assembling, which CMake can't see
+    set_source_files_properties(${asm} PROPERTIES OBJECT_DEPENDS ${file})
+    target_sources(${target} PRIVATE ${asm})
+    target_include_directories(${target} PRIVATE ${C64_ASSET_DIR})
+    set_property(TARGET ${target} APPEND PROPERTY C64_ASSETS ${C64_ASSET_DIR}/${name}.asset.json)
+endfunction()
+
+function(c64_asset_manifest target)
+    get_property(asset_files TARGET ${target} PROPERTY C64_ASSETS)
+    set(manifest ${C64_ASSET_DIR}/asset_manifest.c)
+    add_custom_command(
+        OUTPUT ${manifest} ${C64_ASSET_DIR}/asset_manifest.json
+        COMMAND Python3::Interpreter ${C64_EMBED_ASSET} manifest
+                --output-dir ${C64_ASSET_DIR} ${asset_files}
+        DEPENDS ${asset_files} ${C64_EMBED_ASSET}
+        COMMENT "Generating asset manifest"
+        VERBATIM)
+    target_sources(${target} PRIVATE ${manifest})
+endfunction()
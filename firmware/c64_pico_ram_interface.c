@@ -1,27 +1,51 @@
 // vim: ts=4:sw=4:sts=4:et
 #include <malloc.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
+#include "hardware/clocks.h"
 #include "hardware/dma.h"
 #include "hardware/irq.h"
 #include "hardware/pio.h"
+#include "hardware/vreg.h"
 #include "pico/binary_info.h"
+#include "pico/multicore.h"
 #include "pico/stdlib.h"
 
 #include "address_decoder.pio.h"
+#include "activity.h"
+#include "asset.h"
+#include "benchmark.h"
+#include "benchmark_rom.h"
+#include "capture.h"
+#include "capture.pio.h"
+#include "cart_bus.h"
+#include "clock_profile.h"
 #include "command.pio.h"
+#include "command_dispatch.h"
+#include "command_loop.h"
+#include "command_stats.h"
+#include "command_trace.h"
+#include "copy_gen.h"
+#include "d64.h"
+#include "dma_crc.h"
+#include "flash_store.h"
+#include "flash_store_pico.h"
+#include "hal_pico.h"
 #include "loader_rom.h"
+#include "page_sync.h"
+#include "prg.h"
 #include "raspi.h"
-#include "read.pio.h"
+#include "read_latency.h"
+#include "read_latency.pio.h"
+#include "read_profile.h"
+#include "snapshot.h"
+#include "usb_console.h"
+#include "window.h"
 
-// Blink error codes
-const uint ERR_ADD_DECODER_PROGRAM = 1;
-const uint ERR_DECODER_PROGRAM_SM = 2;
-const uint ERR_ADD_READ_PROGRAM = 3;
-const uint ERR_READ_PROGRAM_SM = 4;
-const uint ERR_ADD_COMMAND_PROGRAM = 5;
-const uint ERR_COMMAND_PROGRAM_SM = 6;
+// Blink error code, after cart_bus_error_t's
+const uint ERR_NUFLI_CRC = 8;
 
 // Pin assignments
 // Note: PIO programs assume the pins are in this order!
@@ -52,28 +76,341 @@ const uint PIN_ROMH = 26;
 const uint PIN_IE = 27;
 const uint PIN_OE = 28;
 
-// PIO IRQ bits
-const uint PIO_IRQ_ON_READ = 1;
-
 // NUFLI offset in our ROM area
 const uint NUFLI_OFFSET = 0x400;
 const uint NUFLI_WINDOW_SIZE = 0x400;
 
+// Mailbox in our ROM area where the C64 can read results from the Pico
+const uint MAILBOX_OFFSET = 0x800;
+const uint MAILBOX_NUFLI_CRC = 0x00;   // CRC-32 of the NUFLI image (4 bytes, little endian)
+const uint MAILBOX_WINDOW_CRC = 0x04;  // CRC-32 of the NUFLI window (4 bytes, little endian)
+const uint MAILBOX_FLASH_BUSY = 0x08;  // 0xff while writing to flash, otherwise 0x00
+const uint MAILBOX_COPY_ROUTINE = 0x09;  // 0xff if there's a copy routine for the image
+const uint MAILBOX_D64_DEVICE = 0x0a;    // device number LOAD reads the mounted D64 as, or 0
+const uint MAILBOX_LOAD_ERROR = 0x0b;    // KERNAL error number for CMD_LOAD_OPEN, or 0
+const uint MAILBOX_LOAD_ADDRESS = 0x0c;  // load address of the opened file (2 bytes)
+const uint MAILBOX_LOAD_SIZE = 0x0e;     // size of the opened file without its address (2 bytes)
+const uint MAILBOX_CART_COUNT = 0x10;    // cartridges in the library menu, or 0 for no menu
+
+// Cartridge library menu (see build_cart_menu): 3 bytes for each cartridge, the address of a byte
+// where it differs from the loader and its value there, and the screen the loader shows
+const uint CART_SWITCH_OFFSET = 0x900;
+const uint CART_MENU_OFFSET = 0xc00;
+const uint CART_MENU_SIZE = 1000;
+
+// Round trip time of each command, for the C64 to read (see command_stats.h)
+const uint COMMAND_STATS_OFFSET = 0x1000;
+
+// Copy routine generated for the NUFLI image, in ROMH at $A000, and the immediate layout's
+// stubs at $BF00 (after the biggest chunk routine, COPY_GEN_CHUNK_CODE_MAX)
+const uint COPY_ROUTINE_OFFSET = 0x2000;
+const uint COPY_ROUTINE_MAX = 0x1f00;
+const uint STUBS_OFFSET = 0x3f00;
+
+// At the top of ROMH, for the loader to check before it runs anything there: in the 8K switch
+// position the C64 has BASIC at $A000-$BFFF instead
+const uint ROMH_SIGNATURE_OFFSET = 0x3ffc;
+const char ROMH_SIGNATURE[4] = {'R', 'O', 'M', 'H'};
+
+// Flash store keys for the saved NUFLI image, one record per window-sized chunk
+const uint32_t STORE_KEY_NUFLI = 0x4e550000;
+
+
+// KERNAL error number for a file LOAD can't find
+const uint8_t KERNAL_FILE_NOT_FOUND = 4;
+
+// Size of the ROM window exposed to the C64
+#define ROM_SIZE 16384
+
+// Data exposed by the ROM window.  Allocated in main() so it can be 16K aligned.
+char *rom_data;
+
+// RAM copy of the NUFLI image, so it can be patched over USB without reflashing
+uint8_t nufli_image[sizeof(raspi)];
+
+// What CMD_NEXT_PAGE pages through the NUFLI window: the sections the copy routine reads, or
+// the whole image if there's no copy routine
+uint8_t nufli_stream[sizeof(raspi)];
+
+// What the loader loads when the C64 resets: the NUFLI image, or a PRG or snapshot from the
+// catalog picked with the "run" USB command (NULL for the NUFLI image)
+const asset_t *run_asset = NULL;
+prg_t run_prg;
+
+// A snapshot is loaded like a PRG of its RAM from SNAPSHOT_LOAD up, and then CMD_NEXT_PAGE
+// after the last chunk puts its restore routine in the copy routine area instead of wrapping
+// around.  The routine's CMD_NEXT_PAGE wraps around for the next reset.
+bool run_is_snapshot = false;
+snapshot_t run_snapshot;
+bool snapshot_restoring = false;
+
+// What CMD_NEXT_PAGE pages through the NUFLI window (see window.h): nufli_stream, the data of
+// run_prg straight from flash, or a file LOADed from the D64.  The immediate layout for a PRG,
+// nufli_layout for the NUFLI image, or linear for a LOADed file.
+window_t window = {.stream = nufli_stream};
+
+// How the NUFLI image is sent to the C64, from its LAYOUT in the asset manifest, or linear after
+// CMD_NO_ROMH
+asset_layout_t nufli_layout;
+
+// D64 that the loader's ILOAD hook LOADs from (NULL if none is mounted), as the device number in
+// MAILBOX_D64_DEVICE.  The hook sends CMD_LOAD_OPEN and the name (see command_dispatch.h), and
+// the file is read into load_file.
+const asset_t *d64_asset = NULL;
+uint8_t load_file[0x10000];
+
+// Cartridge library: the 8K/16K CRT assets copied to 16K aligned banks in RAM at boot, since
+// flash is too slow to serve reads from.  Switching cartridges is then only pointing the read
+// program at another bank.  The banks are one block, as each 16K aligned block costs up to 16K
+// more in padding.  After load_file, the NUFLI buffers, the read profile and the rest, about
+// 110K of SRAM is left for the heap: rom_data and the capture ring take up to 32K each of it,
+// and CART_MAX banks with their padding the rest.
+#define CART_MAX 3
+typedef struct {
+    const asset_t *asset;
+    char *bank;
+} cart_t;
+cart_t carts[CART_MAX];
+uint cart_count = 0;
+int active_cart = -1;  // index into carts, or -1 for rom_data
+
+// The hardware, and the state machines serving the bus on it (see cart_bus.h)
+const hal_t *hal;
+cart_bus_t bus;
+
+// Persistent storage in the end of flash
+flash_store_t store;
+
+// DMA channel that copies each byte read by the C64 (see hal_pico.c)
+const uint read_dma_channel = HAL_PICO_READ_DMA_CHANNEL;
+
+// Command area guard (see command.pio).  The command program unlocks itself when the C64
+// reads the magic sequence, and we lock it again after COMMAND_GUARD_COMMANDS commands, or
+// after being ready for COMMAND_GUARD_TIMEOUT_MS without one.
+const uint COMMAND_GUARD_COMMANDS = 128;
+const uint COMMAND_GUARD_TIMEOUT_MS = 1000;
+uint guard_sm;
+uint guard_offset;
+uint guard_commands = 0;   // commands since it was unlocked
+uint64_t guard_last_us;    // time of the last command, or since we were ready or it was locked
+uint guard_relocks = 0;
+bool guard_seen_unlocked = false;   // since it was last locked, by guard_poll or a command
 
-typedef enum {
-    CMD_NEXT_PAGE = 0x01,   // Advance the NUFLI window to the next 1K
-    CMD_SLEEP = 0x02,       // Test a slow command that sleeps for 5 seconds
-} command_t;
+// Activity counters (see activity.h).  A DMA channel for each address decoder counts its reads
+// into activity_sink, and the read chain's address channel counts the window reads; main()
+// samples them from its idle loop.  The LED timer only reads the decoders' channels.
+activity_t activity;
+uint activity_dma_channel[2];   // by hal_rom_line_t
+uint32_t activity_sink;
+activity_led_t activity_led;
+repeating_timer_t activity_led_timer;
 
-const uint BLINK_MS = 100;
+// Read latency instrumentation (see read_latency.pio), off until the "latency on" USB command.
+// Set by core 1 once it can be held in RAM while the flash store writes
+volatile bool core1_ready = false;
 
+// A read_latency state machine on PIO1 watches each ROM line, and core 1 collects their counts
+// into read_latency.
+PIO const latency_pio = pio1;
+int latency_offset = -1;
+uint latency_sm[2];
+bool latency_running = false;
+read_latency_t read_latency;
+volatile bool latency_reset_requested = false;
 
-void on_pio_irq();
-void do_a_blink();
-void read_dma_init(PIO pio, uint sm, char *base_address);
+// Profile of the addresses the C64 reads (see read_profile.h), off until the "profile on" USB
+// command.  The read DMA channel chains to profile_dma_channel, which copies the address it just
+// read from into profile_ring, and core 1 adds them to read_profile.
+#define PROFILE_RING_BITS 12
+uint32_t profile_ring[(1 << PROFILE_RING_BITS) / sizeof(uint32_t)]
+        __attribute__((aligned(1 << PROFILE_RING_BITS)));
+int profile_dma_channel = -1;
+bool profile_running = false;
+read_profile_t read_profile;
+volatile bool profile_reset_requested = false;
+
+// Logic analyser capture of the port (see capture.h), armed by the "capture" USB command.  The
+// capture state machine on PIO1 samples the pins, capture_dma_channel copies them into
+// capture_ring, and capture_trigger stops it after the trigger with IRQ 1; capture_poll then
+// finishes it into bus_capture.
+#define CAPTURE_RING_BITS 14
+#define CAPTURE_RING_SIZE (1u << (CAPTURE_RING_BITS - 2))  // samples
+PIO const capture_pio = pio1;
+const uint CAPTURE_IRQ = 1;
+uint32_t *capture_ring = NULL;  // allocated on first use
+int capture_offset = -1;
+uint capture_trigger_offset;
+uint capture_sm;
+uint capture_trigger_sm;
+int capture_dma_channel = -1;
+bool capture_armed = false;
+capture_trigger_t capture_armed_trigger;
+uint32_t capture_post;
+capture_t bus_capture = {.trigger = -1};
+
+// How long each command takes to handle (see command_stats.h), for the "cmdstats" USB command
+// and in the ROM window at COMMAND_STATS_OFFSET.  A command's timing is recorded just after its
+// ready token is put back, so the C64 can see the status before the mailbox is updated.
+command_stats_t command_stats;
+
+// Recording of the commands (see command_trace.h), off until the "trace on" USB command.  Core
+// 1 timestamps each command when the command program pushes it, from the RX FIFO level and the
+// commands main() has taken, so commands that queue while another is handled get the time they
+// really arrived.  Each is recorded with its timing after it's handled.
+#define TRACE_ARRIVALS 8  // power of two, more than the RX FIFO holds
+command_trace_t command_trace;
+bool trace_running = false;
+uint64_t trace_start_us;
+volatile uint32_t commands_taken = 0;     // commands main() has taken from the RX FIFO
+volatile uint32_t commands_arrived = 0;   // commands core 1 has timestamped
+volatile uint64_t command_arrivals_us[TRACE_ARRIVALS];
+uint64_t command_arrival_us;   // when the command being handled arrived
+
+// Time since reset when the bus was enabled, and when the C64 first read from it (0 if it
+// hasn't yet)
+uint64_t boot_bus_enabled_us;
+volatile uint64_t boot_first_read_us = 0;
+
+// System clock profile the build asks for (see clock_profile.h), the one running, and why
+// they're different if they are
+#ifndef C64_CLOCK_PROFILE
+#define C64_CLOCK_PROFILE "default"
+#endif
+const clock_profile_t *clock_profile;
+const char *clock_fallback = NULL;
+uint32_t clock_measured_khz;
+
+// Results the benchmark cartridge sends back (see benchmark.h), while the "bench on" USB command
+// has it served instead of the loader
+benchmark_t benchmark;
+
+
+void on_first_read();
+void print_boot_times();
+void start_clock_profile();
+void set_core_voltage(uint32_t mv);
 void errorblink(int code) __attribute__((noreturn));
+void load_nufli_window();
+void load_restore_routine();
+void build_copy_routine();
+copy_gen_config_t get_copy_config();
+bool guard_unlocked();
+void before_bus_enabled(cart_bus_t *bus);
+void start_activity();
+void sample_activity();
+bool on_activity_led_tick(repeating_timer_t *timer);
+void start_read_latency();
+void stop_read_latency();
+bool start_read_profile(uint start, uint bucket_size);
+void stop_read_profile();
+void stop_core1();
+void restart_core1();
+void collect_instrumentation();
+void start_trace();
+void stop_trace();
+bool start_capture(const capture_trigger_t *trigger, uint32_t post, uint clkdiv);
+void stop_capture();
+void capture_poll();
+void guard_on_command();
+void guard_on_ready();
+void guard_poll();
+void guard_on_unlocked();
+void handle_next_page(void *context);
+void handle_sleep(void *context);
+void handle_check_crc(void *context);
+void handle_save_nufli(void *context);
+void handle_open_load_file(void *context, const char *name, unsigned length);
+void handle_select_cart(void *context, unsigned cart);
+void handle_ping(void *context);
+void handle_bench_result(void *context, unsigned index, uint32_t cycles);
+void handle_no_romh(void *context);
+void before_ready(void *context);
+void after_ready(void *context);
+void wait_for_command(void *context);
+void on_command(void *context, uint32_t command);
+uint64_t take_command_arrival(uint64_t received_us);
+void open_load_file(const char *name, unsigned length);
+void load_carts();
+bool check_cart(const asset_t *asset);
+void build_cart_menu();
+void select_cart(int cart);
+bool serve_benchmark(bool on);
+bool load_saved_nufli();
+bool save_nufli(bool keep);
+void mailbox_put_u32(uint offset, uint32_t value);
+void record_command_timing();
+void on_usb_activity(char *args);
+void on_usb_assets(char *args);
+void on_usb_bench(char *args);
+void on_usb_boot(char *args);
+void on_usb_capture(char *args);
+void on_usb_cart(char *args);
+void on_usb_clock(char *args);
+void on_usb_cmdstats(char *args);
+void on_usb_crc(char *args);
+void on_usb_forget(char *args);
+void on_usb_guard(char *args);
+void on_usb_save(char *args);
+void on_usb_manifest(char *args);
+void on_usb_latency(char *args);
+void on_usb_mount(char *args);
+void on_usb_patch(char *args);
+void on_usb_profile(char *args);
+void on_usb_run(char *args);
+void on_usb_trace(char *args);
 static inline void init_output_pin(uint pin, bool value);
 
+// Commands from the C64 are decoded by dispatcher (see command_dispatch.h), which calls these
+const command_handlers_t command_handlers = {
+    .next_page = handle_next_page,
+    .sleep = handle_sleep,
+    .check_crc = handle_check_crc,
+    .save_nufli = handle_save_nufli,
+    .open_load_file = handle_open_load_file,
+    .select_cart = handle_select_cart,
+    .ping = handle_ping,
+    .bench_result = handle_bench_result,
+    .no_romh = handle_no_romh,
+};
+command_dispatcher_t dispatcher;
+
+// What main()'s command loop does besides take and dispatch each command (see command_loop.h)
+const command_loop_hooks_t command_loop_hooks = {
+    .before_ready = before_ready,
+    .after_ready = after_ready,
+    .idle = wait_for_command,
+    .on_command = on_command,
+};
+command_loop_t command_loop;
+
+// The spinner main() shows while waiting for a command
+const char spinner[] = {'|', '/', '-', '\\'};
+uint spinner_pos;
+uint64_t spinner_last_us;
+
+// Commands accepted over USB
+const usb_console_command_t usb_commands[] = {
+    {"activity", on_usb_activity},
+    {"assets", on_usb_assets},
+    {"bench", on_usb_bench},
+    {"boot", on_usb_boot},
+    {"capture", on_usb_capture},
+    {"cart", on_usb_cart},
+    {"clock", on_usb_clock},
+    {"cmdstats", on_usb_cmdstats},
+    {"crc", on_usb_crc},
+    {"forget", on_usb_forget},
+    {"guard", on_usb_guard},
+    {"latency", on_usb_latency},
+    {"manifest", on_usb_manifest},
+    {"mount", on_usb_mount},
+    {"patch", on_usb_patch},
+    {"profile", on_usb_profile},
+    {"run", on_usb_run},
+    {"save", on_usb_save},
+    {"trace", on_usb_trace},
+};
+
 
 #pragma clang diagnostic push
 #pragma ide diagnostic ignored "EndlessLoop"
@@ -110,101 +447,88 @@ int main() {
     init_output_pin(PIN_OE, true);  // high = disabled
     init_output_pin(PIN_IE, true);  // high = disabled
 
-    stdio_usb_init();
-    printf("\n\n\n");
-    printf("C64 pico ram interface %s\n", PICO_PROGRAM_VERSION_STRING);
+    // Change the clock before anything runs from it, so the C64 never sees it change
+    start_clock_profile();
 
     // Data exposed by the ROM window must be aligned by 16 kbytes so we can use the least
     // significant bits of its address for A0-A13
-    const int rom_size = 16384;
-    char *rom_data = memalign(rom_size, rom_size);
-
-    // Initialize the ROM area with our loader ROM
-    memcpy(rom_data, loader_rom, sizeof(loader_rom));
+    rom_data = memalign(ROM_SIZE, ROM_SIZE);
 
-    // Initialize the NUFLI area of our ROM with the first 1KB
-    int raspi_offset = 0;
-    memcpy(rom_data + NUFLI_OFFSET, raspi, NUFLI_WINDOW_SIZE);
-
-    PIO pio = pio0;
-
-    // Address decoder: waits for ROMH/ROML line to be set low, and determines whether the address
-    // to read is a command or a normal ROM read.  Each state machine monitors one ROM line.
-    if(!pio_can_add_program(pio, &address_decoder_program)) {
-        errorblink(ERR_ADD_DECODER_PROGRAM);
-    }
-    uint address_decoder_offset = pio_add_program(pio, &address_decoder_program);
-    uint address_decoder_sm[2];
-    const uint rom_pins[2] = {PIN_ROMH, PIN_ROML};
-    for(int i = 0; i < 2; i++) {
-        address_decoder_sm[i] = pio_claim_unused_sm(pio, true);
-        if(address_decoder_sm[i] == -1) {
-            errorblink(ERR_DECODER_PROGRAM_SM + i);
-        }
-        address_decoder_program_init(
-                pio,
-                address_decoder_sm[i],
-                address_decoder_offset,
-                PIN_A8,
-                rom_pins[i],
-                PIN_OE);
-    }
-
-    // Read handler: send rom_data value over D0..D7 when the C64 reads from ROML or ROMH
-    if(!pio_can_add_program(pio, &read_program)) {
-        errorblink(ERR_ADD_READ_PROGRAM);
-    }
-    uint read_offset = pio_add_program(pio, &read_program);
-    uint read_sm = pio_claim_unused_sm(pio, true);
-    if(read_sm == -1) {
-        errorblink(ERR_READ_PROGRAM_SM);
-    }
-    read_program_init(
-            pio,
-            read_sm,
-            read_offset,
-            PIN_D0,
-            PIN_A0,
-            PIN_OE,
-            rom_data);
-    read_dma_init(pio, read_sm, rom_data);
-
-    // Command handler: put command NN on the FIFO when the CPU reads from address $BFNN
-    if(!pio_can_add_program(pio, &command_program)) {
-        errorblink(ERR_ADD_COMMAND_PROGRAM);
-    }
-    uint command_offset = pio_add_program(pio, &command_program);
-    uint command_sm = pio_claim_unused_sm(pio, true);
-    if(command_sm == -1) {
-        errorblink(ERR_COMMAND_PROGRAM_SM);
-    }
-    command_program_init(
-            pio,
-            command_sm,
-            command_offset,
-            PIN_A0,
-            PIN_D0,
-            PIN_OE);
+    // Copy images out of flash with the DMA sniffer checking them on the way
+    dma_crc_init();
 
     // Set up blinkenlight pin
     gpio_init(PICO_DEFAULT_LED_PIN);
     gpio_set_dir(PICO_DEFAULT_LED_PIN, GPIO_OUT);
     gpio_put(PICO_DEFAULT_LED_PIN, 0);
 
-    // Install IRQ handler for blinkenlights on read
-    // Per the RP2040 datasheet (PIO: IRQ0_INTE Register, p. 399)
-    // state machine enable flags start at bit 8
-    pio->inte0 = 1 << (8 + address_decoder_sm[0]);
-    irq_set_exclusive_handler(PIO0_IRQ_0, on_pio_irq);
-    irq_set_enabled(PIO0_IRQ_0, true);
+    // Initialize the ROM area with our loader ROM and start the address decoders, read handler
+    // and command handler serving it.  Everything else waits until the bus is being served: the
+    // loader polls the busy status before it reads any NUFLI data.
+    const hal_pico_pins_t pins = {
+        .d0 = PIN_D0,
+        .a0 = PIN_A0,
+        .a8 = PIN_A8,
+        .rom = {PIN_ROMH, PIN_ROML},
+        .oe = PIN_OE,
+        .ie = PIN_IE,
+    };
+    hal = hal_pico_backend(pio0, &pins);
+    cart_bus_error_t bus_error = cart_bus_boot(&bus, hal, rom_data, loader_rom,
+                                               sizeof(loader_rom), loader_rom_crc32,
+                                               before_bus_enabled);
+    if(bus_error != CART_BUS_OK) {
+        errorblink(bus_error);
+    }
+    boot_bus_enabled_us = time_us_64();
+
+    // Now that the C64 can boot, bring up everything else
+    stdio_usb_init();
+    printf("\n\n\n");
+    printf("C64 pico ram interface %s\n", PICO_PROGRAM_VERSION_STRING);
+    printf("Clock profile %s at %lu kHz, read margin %ld ps\n", clock_profile->name,
+           (unsigned long)clock_measured_khz,
+           (long)clock_profile_margin_ps(clock_measured_khz * 1000));
+    if(clock_fallback) {
+        printf("Clock profile %s not used: %s\n", C64_CLOCK_PROFILE, clock_fallback);
+    }
+
+    // Initialize the NUFLI area of our ROM with the first 1KB
+    uint32_t nufli_crc = dma_copy_crc32(nufli_image, raspi, sizeof(raspi));
+    if(nufli_crc != raspi_crc32) {
+        errorblink(ERR_NUFLI_CRC);
+    }
+
+    // Replace it with the image saved by CMD_SAVE_NUFLI, if there is one
+    volatile char *flash_busy = rom_data + MAILBOX_OFFSET + MAILBOX_FLASH_BUSY;
+    *flash_busy = 0x00;
+    rom_data[MAILBOX_OFFSET + MAILBOX_D64_DEVICE] = 0x00;
+    memcpy(rom_data + ROMH_SIGNATURE_OFFSET, ROMH_SIGNATURE, sizeof(ROMH_SIGNATURE));
+    flash_store_mount(&store, flash_store_pico_backend(flash_busy));
+    if(load_saved_nufli()) {
+        nufli_crc = dma_crc32(nufli_image, sizeof(nufli_image));
+    }
+    mailbox_put_u32(MAILBOX_NUFLI_CRC, nufli_crc);
+    nufli_layout = asset_find("raspi")->layout;
+    window.hal = hal;
+    window.window = (uint8_t *)rom_data + NUFLI_OFFSET;
+    window.routine = (uint8_t *)rom_data + COPY_ROUTINE_OFFSET;
+    build_copy_routine();
+    load_nufli_window();
+    load_carts();
+    command_dispatcher_init(&dispatcher, &command_handlers);
+    dispatcher.cart_count = cart_count;
+    command_stats_reset(&command_stats);
+    command_stats_mailbox(&command_stats, (uint8_t *)rom_data + COMMAND_STATS_OFFSET);
+    read_profile_reset(&read_profile, READ_PROFILE_WINDOW, 16);
+    benchmark_reset(&benchmark);
 
-    // READY!  Open the floodgates!
-    gpio_put(PIN_IE, false);  // low = enabled
+    print_boot_times();
 
-    printf("Address decoder ROMH sm: %d\n", address_decoder_sm[0]);
-    printf("Address decoder ROML sm: %d\n", address_decoder_sm[1]);
-    printf("Read sm: %d\n", read_sm);
-    printf("Command sm: %d\n", command_sm);
+    printf("Address decoder ROMH sm: %d\n", bus.decoder_sm[HAL_ROMH]);
+    printf("Address decoder ROML sm: %d\n", bus.decoder_sm[HAL_ROML]);
+    printf("Read sm: %d\n", bus.read_sm);
+    printf("Command sm: %d\n", bus.command_sm);
     printf("Pico RAM window start: 0x%08X\n", (uint)rom_data);
     printf("First 8 bytes of ROM: %02X %02X %02X %02X %02X %02X %02X %02X\n",
            rom_data[0], rom_data[1], rom_data[2], rom_data[3], rom_data[4], rom_data[5],
@@ -217,123 +541,1367 @@ int main() {
     printf("ROM address: $8000\n");
     printf("Command address prefix: $%04X\n", 0x8000 + (address_decoder_COMMAND_PREFIX << 8));
 
-    const char spinner[] = {'|', '/', '-', '\\'};
+    command_loop_init(&command_loop, hal, bus.command_sm, &dispatcher, &command_loop_hooks);
     while(true) {
-	    pio_sm_put(pio, command_sm, 1);  // tell the command program we're ready
-        printf("\nReady for command %c", spinner[0]);
-
-        uint64_t last_hb = time_us_64();
-        uint spinner_pos = 0;
-        do {
-            uint64_t now = time_us_64();
-            if(now - last_hb >= 1000000 / sizeof(spinner)) {
-                printf("\b%c", spinner[spinner_pos]);
-                spinner_pos++;
-                if(spinner_pos == sizeof(spinner)) {
-                    spinner_pos = 0;
-                }
-                last_hb = now;
+        command_loop_ready(&command_loop);
+        command_loop_wait(&command_loop);
+        command_loop_handle(&command_loop);
+    }
+}
+
+#pragma clang diagnostic pop
+
+
+// CMD_NEXT_PAGE: move the NUFLI window on a page, or to the restore routine at the end of a
+// snapshot
+void handle_next_page(void *context) {
+    if(run_is_snapshot && !snapshot_restoring && window_at_last_page(&window)) {
+        load_restore_routine();
+        return;
+    }
+    snapshot_restoring = false;
+    window_next(&window);
+    printf("NUFLI start is now %02X\n", (uint)window.offset);
+    load_nufli_window();
+    printf("First 8 bytes: %02X %02X %02X %02X %02X %02X %02X %02X\n", ((char *)(rom_data + NUFLI_OFFSET))[0], ((char *)(rom_data + NUFLI_OFFSET))[1], ((char *)(rom_data + NUFLI_OFFSET))[2], ((char *)(rom_data + NUFLI_OFFSET))[3], ((char *)(rom_data + NUFLI_OFFSET))[4], ((char *)(rom_data + NUFLI_OFFSET))[5], ((char *)(rom_data + NUFLI_OFFSET))[6], ((char *)(rom_data + NUFLI_OFFSET))[7]);
+}
+
+void handle_sleep(void *context) {
+    printf("Sleeping\n");
+    sleep_ms(5000);
+    printf("Done\n");
+}
+
+void handle_check_crc(void *context) {
+    uint32_t nufli_crc = dma_crc32(nufli_image, sizeof(nufli_image));
+    mailbox_put_u32(MAILBOX_NUFLI_CRC, nufli_crc);
+    mailbox_put_u32(MAILBOX_WINDOW_CRC, dma_crc32(rom_data + NUFLI_OFFSET, NUFLI_WINDOW_SIZE));
+    printf("NUFLI CRC %08X\n", (uint)nufli_crc);
+}
+
+void handle_save_nufli(void *context) {
+    // The C64 sees the busy status until this finishes, but keeps being served
+    printf(save_nufli(true) ? "Saved NUFLI image\n" : "Flash store is full\n");
+}
+
+void handle_open_load_file(void *context, const char *name, unsigned length) {
+    open_load_file(name, length);
+}
+
+void handle_select_cart(void *context, unsigned cart) {
+    select_cart(cart);
+}
+
+// CMD_PING: nothing to do, the benchmark only times the round trip
+void handle_ping(void *context) {
+}
+
+void handle_bench_result(void *context, unsigned index, uint32_t cycles) {
+    if(!benchmark_record(&benchmark, index, cycles)) {
+        printf("No benchmark result %u\n", index);
+        return;
+    }
+    printf("Benchmark %s: %lu cycles for %lu\n", benchmark_name(index), (unsigned long)cycles,
+           (unsigned long)benchmark_count(index));
+}
+
+// CMD_NO_ROMH: the loader found no ROMH signature, so the switch is in the 8K position and a
+// routine at $A000 can't run.  From then on, page the NUFLI image through the window for the
+// loader's own copy loop, even in place of a PRG or snapshot, which need the routine.
+void handle_no_romh(void *context) {
+    if(run_asset) {
+        printf("ROMH not mapped: %s needs the 16K position, loading the NUFLI image\n",
+               run_asset->name);
+    } else {
+        printf("ROMH not mapped: loading the NUFLI image without a copy routine\n");
+    }
+    run_asset = NULL;
+    run_is_snapshot = false;
+    nufli_layout = ASSET_LAYOUT_LINEAR;
+    window.offset = 0;
+    build_copy_routine();
+    load_nufli_window();
+}
+
+// command_loop hook: the guard goes back to answering commands before the ready token does
+void before_ready(void *context) {
+    guard_on_ready();
+}
+
+// command_loop hook: the last command has its timing, and the spinner starts again
+void after_ready(void *context) {
+    record_command_timing();
+    printf("\nReady for command %c", spinner[0]);
+    spinner_last_us = time_us_64();
+    spinner_pos = 0;
+}
+
+// command_loop hook: everything else the firmware does happens while it waits for a command
+void wait_for_command(void *context) {
+    uint64_t now = time_us_64();
+    if(now - spinner_last_us >= 1000000 / sizeof(spinner)) {
+        printf("\b%c", spinner[spinner_pos]);
+        spinner_pos++;
+        if(spinner_pos == sizeof(spinner)) {
+            spinner_pos = 0;
+        }
+        spinner_last_us = now;
+    }
+    usb_console_poll(usb_commands, count_of(usb_commands));
+    guard_poll();
+    sample_activity();
+    capture_poll();
+}
+
+// command_loop hook
+void on_command(void *context, uint32_t command) {
+    printf("\b \n");
+    command_arrival_us = take_command_arrival(command_loop.timing.received_us);
+    guard_on_command();
+    printf("Got command %08X\n", (uint)command);
+}
+
+// Put the current page of the NUFLI stream in the ROM, and its CRC in the mailbox.  For the
+// immediate layout that's the routine for the current chunk, otherwise it's the next 1K in
+// the window.
+void load_nufli_window() {
+    mailbox_put_u32(MAILBOX_WINDOW_CRC, window_load(&window));
+}
+
+// Put the routine that restores the rest of run_snapshot where the last chunk's stub jumps to
+void load_restore_routine() {
+    copy_gen_config_t config = get_copy_config();
+    size_t code_size = snapshot_restore_code(&run_snapshot, config.command_area, CMD_NEXT_PAGE,
+                                             (uint8_t *)rom_data + COPY_ROUTINE_OFFSET);
+    snapshot_restoring = true;
+    printf("Restore routine %u bytes, resuming at $%04X\n", (uint)code_size, run_snapshot.pc);
+}
+
+// Where the copy routine runs, and where it copies the NUFLI image or PRG to
+copy_gen_config_t get_copy_config() {
+    copy_gen_config_t config = {
+        .dest = run_asset ? run_prg.load : 0x2000,
+        .exec = run_asset ? run_prg.exec : 0x3000,
+        .origin = 0x8000 + COPY_ROUTINE_OFFSET,
+        .window = 0x8000 + NUFLI_OFFSET,
+        .window_size = NUFLI_WINDOW_SIZE,
+        .command_area = 0x8000 + (address_decoder_COMMAND_PREFIX << 8),
+        .next_page = CMD_NEXT_PAGE,
+        .stubs = 0x8000 + STUBS_OFFSET,
+    };
+    return config;
+}
+
+// Set up the copy routine for nufli_layout, and the stream that CMD_NEXT_PAGE pages through.
+// If the image can't have a routine, the loader's own copy loop pages through the whole image
+// instead.
+void build_copy_routine() {
+    copy_gen_config_t config = get_copy_config();
+    bool have_routine = false;
+    snapshot_restoring = false;
+    window.config = config;
+
+    if(run_asset) {
+        // A PRG always has the immediate layout, generated from flash a chunk at a time
+        copy_gen_stubs(&config, (uint8_t *)rom_data + STUBS_OFFSET);
+        window.stream = run_prg.data;
+        window.layout = ASSET_LAYOUT_IMMEDIATE;
+        window.size = run_prg.size;
+        window.page_size = COPY_GEN_CHUNK_SIZE;
+        rom_data[MAILBOX_OFFSET + MAILBOX_COPY_ROUTINE] = 0xff;
+        window.offset = 0;
+        printf("Serving %s: $%04X-$%04X, start $%04X%s\n", run_asset->name, run_prg.load,
+               (uint)run_prg.end - 1, run_prg.exec, run_prg.under_io ? ", under I/O" : "");
+        return;
+    }
+
+    window.stream = nufli_stream;
+    window.layout = nufli_layout;
+    window.page_size = NUFLI_WINDOW_SIZE;
+    memcpy(nufli_stream, nufli_image, sizeof(nufli_image));
+    window.size = sizeof(nufli_image);
+
+    switch(nufli_layout) {
+        case ASSET_LAYOUT_SECTIONS: {
+            size_t code_size = copy_gen_build(&config,
+                                              nufli_image,
+                                              sizeof(nufli_image),
+                                              (uint8_t *)rom_data + COPY_ROUTINE_OFFSET,
+                                              COPY_ROUTINE_MAX,
+                                              nufli_stream,
+                                              &window.size);
+            if(code_size == 0) {
+                // copy_gen_build may have started on the stream
+                memcpy(nufli_stream, nufli_image, sizeof(nufli_image));
+                window.size = sizeof(nufli_image);
+                printf("No copy routine for the NUFLI image\n");
+            } else {
+                printf("Copy routine %u bytes, stream %u bytes\n",
+                       (uint)code_size, (uint)window.size);
+                have_routine = true;
             }
-        } while(pio_sm_is_rx_fifo_empty(pio, command_sm));
-        printf("\b \n");
+            break;
+        }
+
+        case ASSET_LAYOUT_IMMEDIATE:
+            // The routine for each chunk is generated by load_nufli_window
+            copy_gen_stubs(&config, (uint8_t *)rom_data + STUBS_OFFSET);
+            window.page_size = COPY_GEN_CHUNK_SIZE;
+            printf("Immediate copy routine, %u byte chunks\n", COPY_GEN_CHUNK_SIZE);
+            have_routine = true;
+            break;
 
-        uint command = pio_sm_get_blocking(pio, command_sm);
-        printf("Got command %08X\n", command);
+        case ASSET_LAYOUT_LINEAR:
+            break;
+    }
 
-        switch(command) {
-            case CMD_NEXT_PAGE:
-                raspi_offset += NUFLI_WINDOW_SIZE;
-                if(raspi_offset >= sizeof(raspi)) {
-                    raspi_offset = 0;
+    rom_data[MAILBOX_OFFSET + MAILBOX_COPY_ROUTINE] = have_routine ? 0xff : 0x00;
+    if(window.offset >= window.size) {
+        window.offset = 0;
+    }
+    window.offset -= window.offset % window.page_size;
+}
+
+// Write a 32 bit value to the mailbox in 6502 byte order
+void mailbox_put_u32(uint offset, uint32_t value) {
+    char *dest = rom_data + MAILBOX_OFFSET + offset;
+    for(int i = 0; i < 4; i++) {
+        dest[i] = (char)(value >> (8 * i));
+    }
+}
+
+// Overwrite nufli_image with the chunks saved in flash.  Returns false if there's no saved
+// image.
+bool load_saved_nufli() {
+    bool loaded = false;
+    for(uint offset = 0; offset < sizeof(nufli_image); offset += NUFLI_WINDOW_SIZE) {
+        uint len = MIN(NUFLI_WINDOW_SIZE, sizeof(nufli_image) - offset);
+        size_t saved_len;
+        uint32_t key = STORE_KEY_NUFLI + offset / NUFLI_WINDOW_SIZE;
+        if(flash_store_get(&store, key, nufli_image + offset, len, &saved_len) == FLASH_STORE_OK) {
+            loaded = true;
+        }
+    }
+    return loaded;
+}
+
+// Save nufli_image to flash one chunk at a time, or delete the saved chunks if keep is false
+bool save_nufli(bool keep) {
+    for(uint offset = 0; offset < sizeof(nufli_image); offset += NUFLI_WINDOW_SIZE) {
+        uint len = keep ? MIN(NUFLI_WINDOW_SIZE, sizeof(nufli_image) - offset) : 0;
+        uint32_t key = STORE_KEY_NUFLI + offset / NUFLI_WINDOW_SIZE;
+        if(flash_store_put(&store, key, nufli_image + offset, len) != FLASH_STORE_OK) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Select a delta sync target by name: "rom" is the live 16K window, "nufli" is the image
+// that the C64 loads through the window
+static bool get_sync_target(const char *name, uint8_t **data, size_t *size) {
+    if(strcmp(name, "rom") == 0) {
+        *data = (uint8_t *)rom_data;
+        *size = ROM_SIZE;
+        return true;
+    }
+    if(strcmp(name, "nufli") == 0) {
+        *data = nufli_image;
+        *size = sizeof(nufli_image);
+        return true;
+    }
+    return false;
+}
+
+// Add the timing of the command that's just been handled, now the ready token is back, to
+// command_stats and the C64's copy
+void record_command_timing() {
+    if(!command_loop.timed) {
+        return;
+    }
+    command_loop.timed = false;
+    const command_timing_t *timing = &command_loop.timing;
+    command_stats_record(&command_stats, command_loop.opcode, timing);
+    command_stats_mailbox(&command_stats, (uint8_t *)rom_data + COMMAND_STATS_OFFSET);
+    if(trace_running) {
+        uint32_t handler_us = timing->finished_us - timing->started_us;
+        command_trace_entry_t entry = {
+            // One queued from before the trace started arrived at its start, as far as it knows
+            .arrival_us = command_arrival_us > trace_start_us
+                          ? command_arrival_us - trace_start_us : 0,
+            .handler_us = handler_us,
+            .overhead_us = timing->ready_us - timing->received_us - handler_us,
+            .value = command_loop.value,
+        };
+        command_trace_add(&command_trace, &entry);
+    }
+}
+
+// Count the command just taken from the RX FIFO, and return when it arrived: core 1's
+// timestamp if the trace is on and it's seen it, otherwise received_us
+uint64_t take_command_arrival(uint64_t received_us) {
+    uint32_t taken = commands_taken;
+    commands_taken = taken + 1;
+    if(trace_running && commands_arrived > taken) {
+        return command_arrivals_us[taken % TRACE_ARRIVALS];
+    }
+    return received_us;
+}
+
+// USB: "cmdstats" prints how long each command has taken in the format in command_stats.h, in
+// µs, and "cmdstats reset" empties them
+void on_usb_cmdstats(char *args) {
+    static char export[COMMAND_STATS_EXPORT_MAX];
+    if(strcmp(args, "reset") == 0) {
+        command_stats_reset(&command_stats);
+        command_stats_mailbox(&command_stats, (uint8_t *)rom_data + COMMAND_STATS_OFFSET);
+    } else if(!*args) {
+        command_stats_export(&command_stats, export, sizeof(export));
+        printf("%s", export);
+    } else {
+        printf("ERR usage: cmdstats [reset]\n");
+        return;
+    }
+    printf("OK\n");
+}
+
+// USB: "crc <target>" prints the CRC-32 of the target, as computed by tools/crc32.py
+void on_usb_crc(char *args) {
+    uint8_t *data;
+    size_t size;
+    if(!get_sync_target(args, &data, &size)) {
+        printf("ERR unknown target %s\n", args);
+        return;
+    }
+    printf("CRC %08X\n", (uint)dma_crc32(data, size));
+    printf("OK\n");
+}
+
+// USB: "save nufli" writes the NUFLI image to flash, to be loaded at the next boot
+void on_usb_save(char *args) {
+    if(strcmp(args, "nufli") != 0) {
+        printf("ERR usage: save nufli\n");
+        return;
+    }
+    printf(save_nufli(true) ? "OK\n" : "ERR flash store is full\n");
+}
+
+// USB: "forget nufli" deletes the saved NUFLI image, so the built-in one is used again
+void on_usb_forget(char *args) {
+    if(strcmp(args, "nufli") != 0) {
+        printf("ERR usage: forget nufli\n");
+        return;
+    }
+    printf(save_nufli(false) ? "OK\n" : "ERR flash store is full\n");
+}
+
+// USB: "manifest <target>" prints a checksum for each page of the target
+void on_usb_manifest(char *args) {
+    uint8_t *data;
+    size_t size;
+    if(!get_sync_target(args, &data, &size)) {
+        printf("ERR unknown target %s\n", args);
+        return;
+    }
+    page_sync_print_manifest(data, size);
+}
+
+// USB: "patch <target> <page> <hex>" replaces one page of the target
+void on_usb_patch(char *args) {
+    char *target = strtok(args, " ");
+    char *page_arg = strtok(NULL, " ");
+    char *hex = strtok(NULL, " ");
+    uint8_t *data;
+    size_t size;
+    if(!target || !page_arg || !hex || !get_sync_target(target, &data, &size)) {
+        printf("ERR usage: patch <rom|nufli> <page> <hex>\n");
+        return;
+    }
+
+    uint page = strtoul(page_arg, NULL, 10);
+    if(!page_sync_apply(data, size, page, hex)) {
+        printf("ERR bad page %u\n", page);
+        return;
+    }
+
+    // The patch can move sections in and out of the stream, so regenerate the copy routine,
+    // and the C64 should see the window's new contents now
+    if(data == nufli_image) {
+        build_copy_routine();
+        load_nufli_window();
+    }
+    printf("OK\n");
+}
+
+// Read the file the ILOAD hook named from the mounted D64, and serve it through the NUFLI
+// window for the hook's copy loop.  The mailbox has its load address and size, or the error
+// for the hook to return.
+void open_load_file(const char *name, unsigned length) {
+    d64_entry_t entry;
+    size_t size = 0;
+    d64_error_t error = D64_NOT_FOUND;
+    if(d64_asset) {
+        error = d64_find(d64_asset->data, d64_asset->size, name, length, &entry);
+    }
+    if(error == D64_OK) {
+        error = d64_read(d64_asset->data, d64_asset->size, &entry, load_file,
+                         sizeof(load_file), &size);
+    }
+    if(error == D64_OK && size < 2) {
+        error = D64_BAD_CHAIN;  // not even a load address
+    }
+    if(error != D64_OK) {
+        printf("LOAD \"%.*s\": %s\n", (int)length, name, d64_error_name(error));
+        rom_data[MAILBOX_OFFSET + MAILBOX_LOAD_ERROR] = KERNAL_FILE_NOT_FOUND;
+        return;
+    }
+
+    uint size_without_address = size - 2;
+    printf("LOAD \"%s\": $%02X%02X, %u bytes\n", entry.name, load_file[1], load_file[0],
+           size_without_address);
+    rom_data[MAILBOX_OFFSET + MAILBOX_LOAD_ERROR] = 0;
+    rom_data[MAILBOX_OFFSET + MAILBOX_LOAD_ADDRESS] = load_file[0];
+    rom_data[MAILBOX_OFFSET + MAILBOX_LOAD_ADDRESS + 1] = load_file[1];
+    rom_data[MAILBOX_OFFSET + MAILBOX_LOAD_SIZE] = size_without_address & 0xff;
+    rom_data[MAILBOX_OFFSET + MAILBOX_LOAD_SIZE + 1] = size_without_address >> 8;
+    window.stream = load_file + 2;
+    window.layout = ASSET_LAYOUT_LINEAR;
+    window.size = size_without_address;
+    window.page_size = NUFLI_WINDOW_SIZE;
+    window.offset = 0;
+    load_nufli_window();
+}
+
+// Copy the CRT assets into banks for the library, and show the menu if there are any.  Each is
+// checked in load_file first, which isn't used until the C64 LOADs from a D64, so only the ones
+// that can be served get a bank.
+void load_carts() {
+    const asset_t *passed[CART_MAX];
+    uint count = 0;
+    for(size_t i = 0; i < asset_count && count < CART_MAX; i++) {
+        const asset_t *asset = &assets[i];
+        if((asset->kind == ASSET_KIND_CRT_8K || asset->kind == ASSET_KIND_CRT_16K)
+           && check_cart(asset)) {
+            passed[count++] = asset;
+        }
+    }
+    char *banks = NULL;
+    while(count && !(banks = memalign(ROM_SIZE, count * ROM_SIZE))) {
+        count--;
+        printf("No RAM for cartridge %s\n", passed[count]->name);
+    }
+    for(uint i = 0; i < count; i++) {
+        char *bank = banks + i * ROM_SIZE;
+        if(passed[i]->packed_size) {
+            asset_unpack(passed[i], (uint8_t *)bank);
+        } else {
+            memcpy(bank, passed[i]->data, ROM_SIZE);
+        }
+        carts[i].asset = passed[i];
+        carts[i].bank = bank;
+    }
+    cart_count = count;
+    build_cart_menu();
+}
+
+// Whether a CRT asset can be in the library, copying it to load_file to check it
+bool check_cart(const asset_t *asset) {
+    uint32_t crc;
+    if(asset->packed_size) {
+        asset_unpack(asset, load_file);
+        crc = dma_crc32(load_file, ROM_SIZE);
+    } else {
+        crc = dma_copy_crc32(load_file, asset->data, ROM_SIZE);
+    }
+    if(crc != asset->crc32) {
+        printf("Cartridge %s is corrupt\n", asset->name);
+        return false;
+    }
+    if(memcmp(load_file, rom_data, sizeof(loader_rom)) == 0) {
+        printf("Cartridge %s starts like the loader, can't switch to it\n", asset->name);
+        return false;
+    }
+    return true;
+}
+
+// Write text to the menu screen in screen codes, upper case
+static void put_menu_text(uint row, uint column, const char *text) {
+    char *screen = rom_data + CART_MENU_OFFSET + row * 40 + column;
+    for(; *text; text++) {
+        char c = *text >= 'a' && *text <= 'z' ? *text - 'a' + 'A' : *text;
+        *screen++ = c >= '@' && c <= 'Z' ? c - '@' : c;
+    }
+}
+
+// Lay out the menu for the loader, and the switch table.  After sending CMD_SELECT_CART + n,
+// the loader resets the C64 from RAM as soon as the byte in the table reads as the cartridge's,
+// so it knows the switch has happened without another command.  The byte is in the loader's
+// code, which never changes, so it can't match until then.
+void build_cart_menu() {
+    memset(rom_data + CART_MENU_OFFSET, ' ', CART_MENU_SIZE);
+    put_menu_text(1, 9, "pico cartridge library");
+    for(uint i = 0; i < cart_count; i++) {
+        // check_cart() made sure there's a byte of the loader that differs
+        uint k = 0;
+        while(carts[i].bank[k] == rom_data[k]) {
+            k++;
+        }
+        char *entry = rom_data + CART_SWITCH_OFFSET + i * 3;
+        entry[0] = (char)((0x8000 + k) & 0xff);
+        entry[1] = (char)((0x8000 + k) >> 8);
+        entry[2] = carts[i].bank[k];
+
+        char line[41];
+        snprintf(line, sizeof(line), "%u  %-28.28s %s", i + 1, carts[i].asset->name,
+                 carts[i].asset->kind == ASSET_KIND_CRT_16K ? "16K" : "8K");
+        put_menu_text(4 + i, 2, line);
+    }
+    if(cart_count) {
+        char line[41];
+        snprintf(line, sizeof(line), "press 1-%u to start, space for nufli", cart_count);
+        put_menu_text(6 + cart_count, 2, line);
+        put_menu_text(7 + cart_count, 2, "set the 8k/16k switch to match first");
+    }
+    rom_data[MAILBOX_OFFSET + MAILBOX_CART_COUNT] = (char)cart_count;
+    printf("%u cartridges in the library\n", cart_count);
+}
+
+// Serve cartridge n from the library, or the loader again if n is -1.  The command area is
+// turned off while a cartridge is served, so all 16K is the cartridge's.  Either way it takes
+// effect between two reads, and the C64 needs resetting to start what's there.
+void select_cart(int n) {
+    if(n >= 0) {
+        cart_bus_serve(&bus, carts[n].bank, false);
+        printf("Serving cartridge %s\n", carts[n].asset->name);
+    } else {
+        cart_bus_serve(&bus, rom_data, true);
+        printf("Serving the loader\n");
+    }
+    active_cart = n;
+}
+
+// Put the benchmark cartridge where the loader is, or the loader back, for the C64 to reset
+// into.  The benchmark pages through the window, so either way the image starts again from the
+// beginning.  Returns false if the copy out of flash doesn't match its CRC.
+bool serve_benchmark(bool on) {
+    if(active_cart >= 0) {
+        select_cart(-1);
+    }
+    const uint8_t *rom = on ? benchmark_rom : loader_rom;
+    size_t size = on ? sizeof(benchmark_rom) : sizeof(loader_rom);
+    uint32_t crc = on ? benchmark_rom_crc32 : loader_rom_crc32;
+    memset(rom_data, 0, NUFLI_OFFSET);
+    if(dma_copy_crc32(rom_data, rom, size) != crc) {
+        return false;
+    }
+    window.offset = 0;
+    build_copy_routine();
+    load_nufli_window();
+    printf(on ? "Serving the benchmark\n" : "Serving the loader\n");
+    return true;
+}
+
+// Start measuring read latency, from an empty histogram
+void start_read_latency() {
+    if(latency_running) {
+        return;
+    }
+    stop_core1();
+    if(latency_offset < 0) {
+        latency_offset = pio_add_program(latency_pio, &read_latency_program);
+        for(int i = 0; i < 2; i++) {
+            latency_sm[i] = pio_claim_unused_sm(latency_pio, true);
+        }
+    }
+    const uint rom_pins[2] = {PIN_ROMH, PIN_ROML};
+    for(int i = 0; i < 2; i++) {
+        pio_sm_clear_fifos(latency_pio, latency_sm[i]);
+        read_latency_program_init(latency_pio, latency_sm[i], latency_offset, rom_pins[i], PIN_OE);
+    }
+    read_latency_reset(&read_latency);
+    latency_reset_requested = false;
+    latency_running = true;
+    restart_core1();
+}
+
+// Stop measuring read latency, keeping the histogram
+void stop_read_latency() {
+    if(!latency_running) {
+        return;
+    }
+    for(int i = 0; i < 2; i++) {
+        pio_sm_set_enabled(latency_pio, latency_sm[i], false);
+    }
+    latency_running = false;
+    restart_core1();
+}
+
+// Start profiling the C64's reads into an empty histogram of bucket_size byte buckets from
+// start.  Returns false if read_profile_reset won't take them.
+bool start_read_profile(uint start, uint bucket_size) {
+    stop_read_profile();
+    if(!read_profile_reset(&read_profile, start, bucket_size)) {
+        return false;
+    }
+    if(profile_dma_channel < 0) {
+        profile_dma_channel = dma_claim_unused_channel(true);
+    }
+
+    // Each time it's triggered, copy the read channel's read address to the next word of the
+    // ring.  The read channel doesn't increment it, so it's still the address just served.
+    dma_channel_config config = dma_channel_get_default_config(profile_dma_channel);
+    channel_config_set_read_increment(&config, false);
+    channel_config_set_write_increment(&config, true);
+    channel_config_set_ring(&config, true, PROFILE_RING_BITS);
+    channel_config_set_transfer_data_size(&config, DMA_SIZE_32);
+    dma_channel_configure(profile_dma_channel,
+                          &config,
+                          profile_ring,                                    // write to the ring
+                          &dma_channel_hw_addr(read_dma_channel)->read_addr, // read the address
+                          1,                                               // one per read
+                          false);                                          // start on a read
+
+    profile_reset_requested = false;
+    profile_running = true;
+    restart_core1();
+
+    // Chain the read channel to it, so it runs after each byte is on its way to the C64
+    hw_write_masked(&dma_channel_hw_addr(read_dma_channel)->al1_ctrl,
+                    profile_dma_channel << DMA_CH0_CTRL_TRIG_CHAIN_TO_LSB,
+                    DMA_CH0_CTRL_TRIG_CHAIN_TO_BITS);
+    return true;
+}
+
+// Stop profiling, keeping the histogram
+void stop_read_profile() {
+    if(!profile_running) {
+        return;
+    }
+    // Chaining a channel to itself is no chaining
+    hw_write_masked(&dma_channel_hw_addr(read_dma_channel)->al1_ctrl,
+                    read_dma_channel << DMA_CH0_CTRL_TRIG_CHAIN_TO_LSB,
+                    DMA_CH0_CTRL_TRIG_CHAIN_TO_BITS);
+    profile_running = false;
+    restart_core1();
+}
+
+// Start recording the commands, into an empty trace
+void start_trace() {
+    command_trace_reset(&command_trace);
+    trace_start_us = time_us_64();
+    // Any commands already queued are timestamped when core 1 starts
+    commands_arrived = commands_taken;
+    trace_running = true;
+    restart_core1();
+}
+
+// Stop recording the commands, keeping the trace
+void stop_trace() {
+    if(!trace_running) {
+        return;
+    }
+    trace_running = false;
+    restart_core1();
+}
+
+// Stop core 1, first telling flash writes not to wait for it
+void stop_core1() {
+    flash_store_pico_lockout_core1(false);
+    multicore_reset_core1();
+}
+
+// Run collect_instrumentation on core 1 if any instrumentation is on, from the start so it
+// picks up the change
+void restart_core1() {
+    stop_core1();
+    if(latency_running || profile_running || trace_running) {
+        core1_ready = false;
+        multicore_launch_core1(collect_instrumentation);
+        while(!core1_ready) {
+            tight_loop_contents();
+        }
+        flash_store_pico_lockout_core1(true);
+    }
+}
+
+// Core 1: add each count from the read_latency state machines to the latency histogram, and
+// each address in profile_ring to the profile, and timestamp each command the command program
+// pushes.  A read comes at most every microsecond, so this keeps up with all of them with time
+// to spare.
+void collect_instrumentation() {
+    // It runs from flash, so it has to stop in RAM while the flash store writes
+    multicore_lockout_victim_init();
+    core1_ready = true;
+    const uint32_t *ring_end = profile_ring + count_of(profile_ring);
+    const uint32_t *profile_tail = profile_running
+            ? (const uint32_t *)dma_channel_hw_addr(profile_dma_channel)->write_addr
+            : profile_ring;
+    while(true) {
+        if(latency_running) {
+            if(latency_reset_requested) {
+                read_latency_reset(&read_latency);
+                latency_reset_requested = false;
+            }
+            for(int i = 0; i < 2; i++) {
+                if(!pio_sm_is_rx_fifo_empty(latency_pio, latency_sm[i])) {
+                    read_latency_add(&read_latency, pio_sm_get(latency_pio, latency_sm[i]));
                 }
-                printf("NUFLI start is now %02X\n", (uint)raspi_offset);
-                memcpy(rom_data + NUFLI_OFFSET, raspi + raspi_offset, NUFLI_WINDOW_SIZE);
-                printf("First 8 bytes: %02X %02X %02X %02X %02X %02X %02X %02X\n", ((char *)(rom_data + NUFLI_OFFSET))[0], ((char *)(rom_data + NUFLI_OFFSET))[1], ((char *)(rom_data + NUFLI_OFFSET))[2], ((char *)(rom_data + NUFLI_OFFSET))[3], ((char *)(rom_data + NUFLI_OFFSET))[4], ((char *)(rom_data + NUFLI_OFFSET))[5], ((char *)(rom_data + NUFLI_OFFSET))[6], ((char *)(rom_data + NUFLI_OFFSET))[7]);
-                break;
+            }
+        }
+        if(profile_running) {
+            if(profile_reset_requested) {
+                read_profile_reset(&read_profile, read_profile.start, 1u << read_profile.shift);
+                profile_reset_requested = false;
+            }
+            const uint32_t *head =
+                    (const uint32_t *)dma_channel_hw_addr(profile_dma_channel)->write_addr;
+            while(profile_tail != head) {
+                read_profile_add(&read_profile, *profile_tail);
+                if(++profile_tail == ring_end) {
+                    profile_tail = profile_ring;
+                }
+            }
+        }
+        if(trace_running) {
+            // Every command pushed has been taken or is still in the FIFO.  If main() takes
+            // one between reading the two, they don't add up, so it waits for the next loop.
+            uint32_t taken = commands_taken;
+            uint32_t arrived = taken + pio_sm_get_rx_fifo_level(pio0, guard_sm);
+            if(taken == commands_taken && arrived > commands_arrived) {
+                uint64_t now = time_us_64();
+                for(uint32_t i = commands_arrived; i != arrived; i++) {
+                    command_arrivals_us[i % TRACE_ARRIVALS] = now;
+                }
+                commands_arrived = arrived;
+            }
+        }
+    }
+}
 
-        	case CMD_SLEEP:
-        		printf("Sleeping\n");
-		        sleep_ms(5000);
-		        printf("Done\n");
-		        break;
+// Arm a capture that stops post samples after the trigger, sampling every 2 * clkdiv system
+// clock cycles.  With small dividers the capture's DMA takes a good share of the bus from the
+// read channels, which can make the reads being watched slower.  Returns false if there's no
+// RAM for the ring, which can happen with the cartridge library taking most of it.
+bool start_capture(const capture_trigger_t *trigger, uint32_t post, uint clkdiv) {
+    stop_capture();
+    if(!capture_ring) {
+        capture_ring = memalign(1 << CAPTURE_RING_BITS, 1 << CAPTURE_RING_BITS);
+        if(!capture_ring) {
+            return false;
         }
+        capture_offset = pio_add_program(capture_pio, &capture_program);
+        capture_trigger_offset = pio_add_program(capture_pio, &capture_trigger_program);
+        capture_sm = pio_claim_unused_sm(capture_pio, true);
+        capture_trigger_sm = pio_claim_unused_sm(capture_pio, true);
+        capture_dma_channel = dma_claim_unused_channel(true);
     }
+    capture_armed_trigger = *trigger;
+    capture_post = post;
+
+    pio_interrupt_clear(capture_pio, CAPTURE_IRQ);
+    pio_sm_clear_fifos(capture_pio, capture_sm);
+    capture_program_init(capture_pio, capture_sm, capture_offset, clkdiv);
+    capture_trigger_program_init(capture_pio, capture_trigger_sm, capture_trigger_offset,
+                                 PIN_A0, capture_trigger_rom_pin(trigger),
+                                 trigger->address & (CAPTURE_WINDOW_SIZE - 1), post,
+                                 trigger->kind == CAPTURE_TRIGGER_NOW, clkdiv);
+
+    // Copy each sample to the next word of the ring, for as long as it takes
+    dma_channel_config config = dma_channel_get_default_config(capture_dma_channel);
+    channel_config_set_read_increment(&config, false);
+    channel_config_set_write_increment(&config, true);
+    channel_config_set_ring(&config, true, CAPTURE_RING_BITS);
+    channel_config_set_transfer_data_size(&config, DMA_SIZE_32);
+    channel_config_set_dreq(&config, pio_get_dreq(capture_pio, capture_sm, false));
+    dma_channel_configure(capture_dma_channel,
+                          &config,
+                          capture_ring,                     // write to the ring
+                          &capture_pio->rxf[capture_sm],    // read the samples
+                          0xffffffff,                       // until it's aborted
+                          true);                            // start now
+
+    bus_capture = (capture_t){
+        .ring = capture_ring,
+        .ring_size = CAPTURE_RING_SIZE,
+        .trigger = -1,
+        .period_ps = 2000000000000ull * clkdiv / clock_get_hz(clk_sys),
+    };
+    capture_armed = true;
+    // Together, so the trigger's count of samples lines up with capture's
+    pio_enable_sm_mask_in_sync(capture_pio, (1u << capture_sm) | (1u << capture_trigger_sm));
+    return true;
 }
 
-#pragma clang diagnostic pop
+// Stop capturing, keeping the samples in the ring, and find the trigger in them if it happened
+void stop_capture() {
+    if(!capture_armed) {
+        return;
+    }
+    pio_sm_set_enabled(capture_pio, capture_sm, false);
+    pio_sm_set_enabled(capture_pio, capture_trigger_sm, false);
+    dma_channel_abort(capture_dma_channel);
+    uint32_t samples = 0xffffffff - dma_channel_hw_addr(capture_dma_channel)->transfer_count;
+    if(samples > CAPTURE_RING_SIZE) {
+        bus_capture.first = samples & (CAPTURE_RING_SIZE - 1);
+        bus_capture.count = CAPTURE_RING_SIZE;
+    } else {
+        bus_capture.first = 0;
+        bus_capture.count = samples;
+    }
+    if(pio_interrupt_get(capture_pio, CAPTURE_IRQ)) {
+        capture_find_trigger(&bus_capture, &capture_armed_trigger, capture_post);
+    }
+    pio_interrupt_clear(capture_pio, CAPTURE_IRQ);
+    capture_armed = false;
+}
 
+// Finish the capture once the trigger has stopped it and the DMA has the last samples
+void capture_poll() {
+    if(capture_armed && pio_interrupt_get(capture_pio, CAPTURE_IRQ)
+            && pio_sm_is_rx_fifo_empty(capture_pio, capture_sm)) {
+        stop_capture();
+    }
+}
 
-// Set up DMA channels for handling reads
-void read_dma_init(PIO pio, uint sm, char *base_address) {
-    // Read channel: copy requested byte to TX fifo (source address set by write channel below)
-    uint read_channel = 0;
-    dma_channel_claim(read_channel);
-
-    dma_channel_config read_config = dma_channel_get_default_config(read_channel);
-    channel_config_set_read_increment(&read_config, false);
-    channel_config_set_write_increment(&read_config, false);
-    channel_config_set_dreq(&read_config, pio_get_dreq(pio, sm, true));
-    channel_config_set_transfer_data_size(&read_config, DMA_SIZE_8);
-
-    dma_channel_configure(read_channel,
-                          &read_config,
-                          &pio->txf[sm], // write to TX fifo
-                          base_address,  // read from base address (overwritten by write channel)
-                          1,             // transfer count
-                          false);        // start later
-
-    // Write channel: copy address from RX fifo to the read channel's READ_ADDR_TRIGGER
-    uint write_channel = 1;
-    dma_channel_claim(write_channel);
-    dma_channel_config write_config = dma_channel_get_default_config(write_channel);
-    channel_config_set_read_increment(&write_config, false);
-    channel_config_set_write_increment(&write_config, false);
-    channel_config_set_dreq(&write_config, pio_get_dreq(pio, sm, false));
-    channel_config_set_transfer_data_size(&write_config, DMA_SIZE_32);
-
-    volatile void *read_channel_addr = &dma_channel_hw_addr(read_channel)->al3_read_addr_trig;
-    dma_channel_configure(write_channel,
-                          &write_config,
-                          read_channel_addr, // write to read_channel READ_ADDR_TRIGGER
-                          &pio->rxf[sm],     // read from RX fifo
-                          0xffffffff,        // do many transfers
-                          true);             // start now
-}
-
-// Timer for on_clear
-alarm_id_t clear_read_alarm = -1;
-
-// Clear the LED after it's blunk
-int64_t on_clear_led(alarm_id_t alarm_id, void *user_data) {
-    gpio_put(PICO_DEFAULT_LED_PIN, 0);
-    clear_read_alarm = -1;
-    return 0;
+// True if the command program is past its locked loop, handling commands
+bool guard_unlocked() {
+    return pio_sm_get_pc(pio0, guard_sm) >= guard_offset + command_offset_start;
+}
+
+void guard_on_command() {
+    guard_on_unlocked();
+    guard_commands++;
+    guard_last_us = time_us_64();
+}
+
+// The first time it's seen unlocked since it was locked, whatever the C64 was sending before
+// is over: it unlocks before a LOAD name or a benchmark result, and a reset part way through
+// one mustn't leave the dispatcher taking the next commands as the rest of it
+void guard_on_unlocked() {
+    if(!guard_seen_unlocked) {
+        command_dispatch_reset(&dispatcher);
+        guard_seen_unlocked = true;
+    }
+}
+
+// Called just before telling the command program we're ready.  It's finished the last command
+// by now, so moving its wrap target takes effect after the next one.
+void guard_on_ready() {
+    guard_last_us = time_us_64();
+    if(guard_commands >= COMMAND_GUARD_COMMANDS) {
+        // It locked itself after that command, so put the wrap target back for the next unlock
+        pio_sm_set_wrap(pio0, guard_sm, guard_offset + command_wrap_target,
+                        guard_offset + command_wrap);
+        guard_commands = 0;
+        guard_relocks++;
+        guard_seen_unlocked = false;
+    } else if(guard_commands == COMMAND_GUARD_COMMANDS - 1) {
+        pio_sm_set_wrap(pio0, guard_sm, guard_offset + command_offset_locked,
+                        guard_offset + command_wrap);
+    }
+}
+
+// Lock the command program again if it's been unlocked for COMMAND_GUARD_TIMEOUT_MS without a
+// command.  The state machine is stopped for a few cycles so it can't start on a read between
+// checking that it's waiting and jumping to locked.  A read in those cycles isn't answered in
+// time, so the 6510 reads open bus: the loader unlocks twice where this can happen, so losing
+// a read of the first sequence doesn't leave it locked.
+void guard_poll() {
+    uint64_t now = time_us_64();
+    if(!guard_unlocked()) {
+        guard_last_us = now;
+        guard_seen_unlocked = false;
+        return;
+    }
+    guard_on_unlocked();
+    if(now - guard_last_us < COMMAND_GUARD_TIMEOUT_MS * 1000) {
+        return;
+    }
+    pio_sm_set_enabled(pio0, guard_sm, false);
+    if(pio_sm_get_pc(pio0, guard_sm) == guard_offset + command_offset_start) {
+        pio_sm_exec(pio0, guard_sm, pio_encode_jmp(guard_offset + command_offset_locked));
+        pio_sm_set_wrap(pio0, guard_sm, guard_offset + command_wrap_target,
+                        guard_offset + command_wrap);
+        guard_commands = 0;
+        guard_relocks++;
+        guard_seen_unlocked = false;
+        command_dispatch_reset(&dispatcher);
+    }
+    pio_sm_set_enabled(pio0, guard_sm, true);
+}
+
+// What a DMA channel counting for activity has counted since it was started
+uint32_t activity_dma_seen(uint channel) {
+    return ACTIVITY_DMA_COUNT - dma_channel_hw_addr(channel)->transfer_count;
+}
+
+// cart_bus_boot hook: with the state machines running and the C64 not yet let in, start
+// counting the reads and record the time of the first one
+void before_bus_enabled(cart_bus_t *bus) {
+    guard_sm = bus->command_sm;
+    guard_offset = bus->command_offset;
+
+    // Count the reads on each ROM line, and blink the LED from the counts
+    start_activity();
+
+    dma_channel_set_irq0_enabled(read_dma_channel, true);
+    irq_set_exclusive_handler(DMA_IRQ_0, on_first_read);
+    irq_set_enabled(DMA_IRQ_0, true);
+}
+
+// Start a DMA channel counting each address decoder's reads, and the LED timer.  They only move
+// when a read has finished, well before the read chain's next transfer.
+void start_activity() {
+    for(int line = HAL_ROMH; line <= HAL_ROML; line++) {
+        uint sm = bus.decoder_sm[line];
+        uint channel = dma_claim_unused_channel(true);
+        dma_channel_config config = dma_channel_get_default_config(channel);
+        channel_config_set_read_increment(&config, false);
+        channel_config_set_write_increment(&config, false);
+        channel_config_set_dreq(&config, pio_get_dreq(pio0, sm, false));
+        channel_config_set_transfer_data_size(&config, DMA_SIZE_32);
+        dma_channel_configure(channel,
+                              &config,
+                              &activity_sink,   // write to nowhere
+                              &pio0->rxf[sm],   // read from the decoder's RX FIFO
+                              ACTIVITY_DMA_COUNT,
+                              true);            // start now
+        activity_dma_channel[line] = channel;
+    }
+    uint32_t seen[ACTIVITY_SOURCES] = {
+        [ACTIVITY_ROMH] = activity_dma_seen(activity_dma_channel[HAL_ROMH]),
+        [ACTIVITY_ROML] = activity_dma_seen(activity_dma_channel[HAL_ROML]),
+        [ACTIVITY_WINDOW] = activity_dma_seen(HAL_PICO_ADDRESS_DMA_CHANNEL),
+        [ACTIVITY_COMMANDS] = commands_taken,
+    };
+    activity_reset(&activity, seen, guard_unlocked());
+    activity_led_reset(&activity_led, seen[ACTIVITY_ROMH] + seen[ACTIVITY_ROML]);
+    add_repeating_timer_ms(ACTIVITY_LED_TICK_MS, on_activity_led_tick, NULL, &activity_led_timer);
 }
 
-// On IRQ0 (command received), blink the LED
-void on_pio_irq() {
-    PIO pio = pio0;
-    if(pio->irq & PIO_IRQ_ON_READ) {
-        hw_clear_bits(&pio->irq, PIO_IRQ_ON_READ);
-        do_a_blink();
+// Bring the activity counters up to date.  A channel that's run out is started again, which for
+// the read chain's address channel also keeps the C64's reads answered after 2^32 of them.
+void sample_activity() {
+    const uint channels[] = {
+        [ACTIVITY_ROMH] = activity_dma_channel[HAL_ROMH],
+        [ACTIVITY_ROML] = activity_dma_channel[HAL_ROML],
+        [ACTIVITY_WINDOW] = HAL_PICO_ADDRESS_DMA_CHANNEL,
+    };
+    for(int source = ACTIVITY_ROMH; source <= ACTIVITY_WINDOW; source++) {
+        // Checked first, so a channel that stops now is restarted next time, not miscounted
+        bool stopped = !dma_channel_is_busy(channels[source]);
+        activity_sample(&activity, source, activity_dma_seen(channels[source]));
+        if(stopped) {
+            dma_channel_set_trans_count(channels[source], ACTIVITY_DMA_COUNT, true);
+            activity_rebase(&activity, source, 0);
+        }
     }
+    activity_sample(&activity, ACTIVITY_COMMANDS, commands_taken);
+    activity_guard(&activity, guard_unlocked());
+}
+
+// LED timer: on while the C64 is reading from either ROM line
+bool on_activity_led_tick(repeating_timer_t *timer) {
+    uint32_t reads = activity_dma_seen(activity_dma_channel[HAL_ROMH])
+                     + activity_dma_seen(activity_dma_channel[HAL_ROML]);
+    gpio_put(PICO_DEFAULT_LED_PIN, activity_led_tick(&activity_led, reads));
+    return true;
 }
 
-void do_a_blink() {
-    // Turn on the LED
-    gpio_put(PICO_DEFAULT_LED_PIN, 1);
+// USB: "activity" prints the activity counters in the format in activity.h, and "activity
+// reset" starts them again from zero
+void on_usb_activity(char *args) {
+    static char export[ACTIVITY_EXPORT_MAX];
+    sample_activity();
+    if(strcmp(args, "reset") == 0) {
+        activity_reset(&activity, activity.seen, guard_unlocked());
+    } else if(!*args) {
+        activity_export(&activity, export, sizeof(export));
+        printf("%s", export);
+    } else {
+        printf("ERR usage: activity [reset]\n");
+        return;
+    }
+    printf("OK\n");
+}
 
-    // If we already had a timer to turn it off, cancel it
-    if(clear_read_alarm > 0) {
-        cancel_alarm(clear_read_alarm);
+// USB: "guard" prints whether the command area is unlocked, and how many reads it's dropped
+void on_usb_guard(char *args) {
+    sample_activity();
+    printf("GUARD %s commands %u/%u filtered %llu relocks %u\n",
+           guard_unlocked() ? "unlocked" : "locked", guard_commands, COMMAND_GUARD_COMMANDS,
+           (unsigned long long)activity_counts(&activity).filtered_reads, guard_relocks);
+    printf("OK\n");
+}
+
+// USB: "capture now|address <hex>|command <hex> [post] [clkdiv]" arms a logic analyser capture
+// of the port, triggered straight away, by a read of a C64 address, or by a command, that stops
+// post samples after the trigger (default a quarter of the ring).  It samples every 2 * clkdiv
+// system clock cycles (default 2).  "capture off" stops it early, and "capture" prints the
+// last capture in the format in capture.h.
+void on_usb_capture(char *args) {
+    static char export[1024];
+    if(!*args) {
+        if(capture_armed) {
+            printf("ERR waiting for the trigger\n");
+            return;
+        }
+        capture_summary(&bus_capture, export, sizeof(export));
+        printf("%s", export);
+        uint32_t sample = 0;
+        while(sample < bus_capture.count) {
+            capture_export(&bus_capture, &sample, export, sizeof(export));
+            printf("%s", export);
+        }
+    } else if(strcmp(args, "off") == 0) {
+        stop_capture();
+    } else {
+        capture_trigger_t trigger;
+        char *rest;
+        if(!capture_parse_trigger(args, 0x8000 + (address_decoder_COMMAND_PREFIX << 8), &trigger,
+                                  &rest)) {
+            printf("ERR usage: capture [now|address <hex>|command <hex> [post] [clkdiv]|off]\n");
+            return;
+        }
+        char *post = strtok(rest, " ");
+        char *clkdiv = strtok(NULL, " ");
+        uint32_t post_samples = post ? strtoul(post, NULL, 10) : CAPTURE_RING_SIZE / 4;
+        uint divider = clkdiv ? strtoul(clkdiv, NULL, 10) : 2;
+        if(post_samples > CAPTURE_RING_SIZE - CAPTURE_TRIGGER_SLACK || divider < 1
+                || divider > 0xffff) {
+            printf("ERR post must be up to %u, clkdiv from 1 to 65535\n",
+                   CAPTURE_RING_SIZE - CAPTURE_TRIGGER_SLACK);
+            return;
+        }
+        if(!start_capture(&trigger, post_samples, divider)) {
+            printf("ERR no RAM for the capture ring\n");
+            return;
+        }
+    }
+    printf("OK\n");
+}
+
+// USB: "bench on" serves the benchmark cartridge instead of the loader from the next C64 reset,
+// and "bench off" puts the loader back.  "bench" prints the results the benchmark sent, in the
+// format in benchmark.h.
+void on_usb_bench(char *args) {
+    static char export[BENCHMARK_EXPORT_MAX];
+    if(strcmp(args, "on") == 0 || strcmp(args, "off") == 0) {
+        bool on = strcmp(args, "on") == 0;
+        if(!serve_benchmark(on)) {
+            printf("ERR %s doesn't match its CRC\n", on ? "benchmark_rom" : "loader_rom");
+            return;
+        }
+        if(on) {
+            benchmark_reset(&benchmark);
+        }
+    } else if(!*args) {
+        benchmark_export(&benchmark, export, sizeof(export));
+        printf("%s", export);
+    } else {
+        printf("ERR usage: bench [on|off]\n");
+        return;
+    }
+    printf("OK\n");
+}
+
+// USB: "latency on" starts measuring how long each C64 read takes to answer, and "latency off"
+// stops.  "latency reset" empties the histogram, and "latency" prints it in the format in
+// read_latency.h, in PIO cycles.
+void on_usb_latency(char *args) {
+    static char export[READ_LATENCY_EXPORT_MAX];
+    if(strcmp(args, "on") == 0) {
+        start_read_latency();
+    } else if(strcmp(args, "off") == 0) {
+        stop_read_latency();
+    } else if(strcmp(args, "reset") == 0) {
+        if(latency_running) {
+            latency_reset_requested = true;
+        } else {
+            read_latency_reset(&read_latency);
+        }
+    } else if(!*args) {
+        // Core 1 keeps adding to it, so export a copy
+        static read_latency_t copy;
+        memcpy(&copy, &read_latency, sizeof(copy));
+        read_latency_export(&copy, export, sizeof(export));
+        printf("%s", export);
+    } else {
+        printf("ERR usage: latency [on|off|reset]\n");
+        return;
+    }
+    printf("OK\n");
+}
+
+// USB: "profile on [bytes] [start]" starts profiling the addresses the C64 reads from the ROM
+// window, in buckets of bytes (default 16) from the hex C64 address start (default 8000), and
+// "profile off" stops.  "profile reset" empties the histogram, and "profile" prints it in the
+// format in read_profile.h.
+void on_usb_profile(char *args) {
+    static char export[1024];
+    char *command = strtok(args, " ");
+    if(command && strcmp(command, "on") == 0) {
+        char *bytes = strtok(NULL, " ");
+        char *start = strtok(NULL, " ");
+        if(!start_read_profile(start ? strtoul(start, NULL, 16) : READ_PROFILE_WINDOW,
+                               bytes ? strtoul(bytes, NULL, 10) : 16)) {
+            printf("ERR bucket must be a power of two up to %u, start in %04X-%04X\n",
+                   READ_PROFILE_BUCKET_MAX, READ_PROFILE_WINDOW,
+                   READ_PROFILE_WINDOW + READ_PROFILE_WINDOW_SIZE - 1);
+            return;
+        }
+    } else if(command && strcmp(command, "off") == 0) {
+        stop_read_profile();
+    } else if(command && strcmp(command, "reset") == 0) {
+        if(profile_running) {
+            profile_reset_requested = true;
+        } else {
+            read_profile_reset(&read_profile, read_profile.start, 1u << read_profile.shift);
+        }
+    } else if(!command) {
+        // Core 1 keeps adding to it while it's on, so the summary is only about right
+        read_profile_summary(&read_profile, export, sizeof(export));
+        printf("%s", export);
+        unsigned bucket = 0;
+        while(bucket < READ_PROFILE_BUCKETS) {
+            read_profile_export(&read_profile, &bucket, export, sizeof(export));
+            printf("%s", export);
+        }
+    } else {
+        printf("ERR usage: profile [on [bytes] [start]|off|reset]\n");
+        return;
+    }
+    printf("OK\n");
+}
+
+// USB: "trace on" starts recording the commands from the C64 with when they arrived, and "trace
+// off" stops.  "trace reset" empties the trace, and "trace" prints it in the format in
+// command_trace.h, for tools/command_replay.py.
+void on_usb_trace(char *args) {
+    static char export[1024];
+    if(strcmp(args, "on") == 0) {
+        start_trace();
+    } else if(strcmp(args, "off") == 0) {
+        stop_trace();
+    } else if(strcmp(args, "reset") == 0) {
+        command_trace_reset(&command_trace);
+        trace_start_us = time_us_64();
+    } else if(!*args) {
+        // Commands are only recorded by the command loop, so it can't change while this runs
+        command_trace_summary(&command_trace, export, sizeof(export));
+        printf("%s", export);
+        unsigned entry = 0;
+        while(entry < command_trace.count) {
+            command_trace_export(&command_trace, &entry, export, sizeof(export));
+            printf("%s", export);
+        }
+    } else {
+        printf("ERR usage: trace [on|off|reset]\n");
+        return;
     }
+    printf("OK\n");
+}
+
+// USB: "run <asset>" makes the loader load and start a PRG from the catalog, or resume a
+// snapshot, at the next C64 reset, and "run nufli" goes back to the NUFLI image
+void on_usb_run(char *args) {
+    if(strcmp(args, "nufli") == 0) {
+        run_asset = NULL;
+        run_is_snapshot = false;
+    } else {
+        const asset_t *asset = asset_find(args);
+        if(asset && asset->kind == ASSET_KIND_SNAPSHOT) {
+            snapshot_error_t error = snapshot_parse(asset->data, asset->size, &run_snapshot);
+            if(error != SNAPSHOT_OK) {
+                printf("ERR %s: %s\n", asset->name, snapshot_error_name(error));
+                return;
+            }
+            // RAM under I/O is written with I/O banked out, like a PRG's
+            run_prg = (prg_t){
+                .load = SNAPSHOT_LOAD,
+                .end = 0x10000,
+                .exec = 0x8000 + COPY_ROUTINE_OFFSET,
+                .data = asset->data + SNAPSHOT_RAM + SNAPSHOT_LOAD,
+                .size = 0x10000 - SNAPSHOT_LOAD,
+                .under_io = true,
+            };
+            run_is_snapshot = true;
+        } else if(!asset || asset->kind != ASSET_KIND_PRG) {
+            printf("ERR no PRG or snapshot asset %s\n", args);
+            return;
+        } else {
+            prg_error_t error = prg_parse(asset->data, asset->size, asset->exec, &run_prg);
+            if(error != PRG_OK) {
+                printf("ERR %s: %s\n", asset->name, prg_error_name(error));
+                return;
+            }
+            run_is_snapshot = false;
+        }
+        run_asset = asset;
+    }
+    window.offset = 0;
+    build_copy_routine();
+    load_nufli_window();
+    printf("OK\n");
+}
+
+// USB: "mount <asset> [device]" makes the loader boot to BASIC with LOAD for the device
+// (default 8) reading from a D64 in the catalog, at the next C64 reset.  "mount none" goes back
+// to loading the NUFLI image or the PRG picked with "run".
+void on_usb_mount(char *args) {
+    char *name = strtok(args, " ");
+    char *device_arg = strtok(NULL, " ");
+    if(!name) {
+        printf("ERR usage: mount <asset|none> [device]\n");
+        return;
+    }
+    if(strcmp(name, "none") == 0) {
+        d64_asset = NULL;
+        rom_data[MAILBOX_OFFSET + MAILBOX_D64_DEVICE] = 0x00;
+        printf("OK\n");
+        return;
+    }
+
+    const asset_t *asset = asset_find(name);
+    if(!asset || asset->kind != ASSET_KIND_D64) {
+        printf("ERR no D64 asset %s\n", name);
+        return;
+    }
+    uint device = device_arg ? strtoul(device_arg, NULL, 10) : 8;
+    if(device < 8 || device > 30) {
+        printf("ERR device must be 8-30\n");
+        return;
+    }
+    if(d64_sector_offset(asset->size, 18, 0) < 0) {
+        printf("ERR %s: %s\n", asset->name, d64_error_name(D64_BAD_IMAGE));
+        return;
+    }
+    d64_asset = asset;
+    rom_data[MAILBOX_OFFSET + MAILBOX_D64_DEVICE] = (char)device;
+    printf("OK\n");
+}
+
+// On the first DMA read, record the time and stop listening
+void on_first_read() {
+    boot_first_read_us = time_us_64();
+    dma_channel_set_irq0_enabled(read_dma_channel, false);
+    dma_channel_acknowledge_irq0(read_dma_channel);
+}
+
+// Run at C64_CLOCK_PROFILE's clock and core voltage, and check the read path's margin at the
+// clock we measure.  Falls back to the default profile if the profile isn't known, the PLL
+// can't make its clock, it doesn't run at that speed, or it leaves less than
+// CLOCK_PROFILE_MIN_MARGIN_PS.  This runs before the state machines start, so a slow voltage
+// change only delays the C64's first read.
+void start_clock_profile() {
+    const clock_profile_t *profile = clock_profile_find(C64_CLOCK_PROFILE);
+    clock_profile = &clock_profiles[0];
+    if(profile == NULL) {
+        clock_fallback = "unknown profile";
+    } else if(profile != clock_profile) {
+        set_core_voltage(profile->vreg_mv);
+        if(!set_sys_clock_khz(profile->sys_khz, false)) {
+            clock_fallback = "no PLL setting for its clock";
+        } else {
+            uint32_t measured = frequency_count_khz(CLOCKS_FC0_SRC_VALUE_CLK_SYS);
+            if(!clock_profile_clock_ok(profile, measured)) {
+                clock_fallback = "clock measured too far off";
+            } else if(clock_profile_margin_ps(measured * 1000) < CLOCK_PROFILE_MIN_MARGIN_PS) {
+                clock_fallback = "read margin too small";
+            } else {
+                clock_profile = profile;
+            }
+        }
+        if(clock_profile != profile) {
+            set_sys_clock_khz(clock_profile->sys_khz, true);
+            set_core_voltage(clock_profile->vreg_mv);
+        }
+    }
+    clock_measured_khz = frequency_count_khz(CLOCKS_FC0_SRC_VALUE_CLK_SYS);
+}
+
+// Set the core voltage, and give the regulator time to settle before the clock goes up
+void set_core_voltage(uint32_t mv) {
+    // VREG_VOLTAGE_0_85 up to VREG_VOLTAGE_1_30 are 50 mV apart
+    vreg_set_voltage(VREG_VOLTAGE_0_85 + (mv - 850) / 50);
+    sleep_ms(10);
+}
+
+void print_boot_times() {
+    printf("Bus enabled %llu us after reset\n", boot_bus_enabled_us);
+    if(boot_first_read_us) {
+        printf("First read %llu us after reset (%llu us after bus enabled)\n",
+               boot_first_read_us, boot_first_read_us - boot_bus_enabled_us);
+    } else {
+        printf("No reads yet\n");
+    }
+}
+
+// USB: "assets" lists the assets embedded in the firmware
+void on_usb_assets(char *args) {
+    for(size_t i = 0; i < asset_count; i++) {
+        const asset_t *asset = &assets[i];
+        printf("ASSET %s %08X size %u packed %u align %u crc %08X\n",
+               asset->name, (uint)asset->data, (uint)asset->size, (uint)asset->packed_size,
+               (uint)asset->align, (uint)asset->crc32);
+    }
+    printf("OK %u\n", (uint)asset_count);
+}
+
+// USB: "clock" prints the clock profile running, with the clock measured at start-up and the
+// read path's worst case latency and margin at it, why the build's profile isn't running if it
+// isn't, and the profiles a build can choose with C64_CLOCK_PROFILE
+void on_usb_clock(char *args) {
+    char line[CLOCK_PROFILE_LINE_MAX];
+    clock_profile_describe(clock_profile, clock_measured_khz, line, sizeof(line));
+    printf("%s", line);
+    if(clock_fallback) {
+        printf("FALLBACK %s %s\n", C64_CLOCK_PROFILE, clock_fallback);
+    }
+    printf("PROFILES");
+    for(uint i = 0; i < clock_profile_count; i++) {
+        printf(" %s", clock_profiles[i].name);
+    }
+    printf("\nOK\n");
+}
+
+// USB: "cart" lists the cartridges in the library, "cart <name>" serves one until "cart menu"
+// goes back to the loader.  Reset the C64 after either to start what's being served.
+void on_usb_cart(char *args) {
+    if(!*args) {
+        for(uint i = 0; i < cart_count; i++) {
+            printf("CART %u %s %s%s\n", i + 1, carts[i].asset->name,
+                   carts[i].asset->kind == ASSET_KIND_CRT_16K ? "16K" : "8K",
+                   active_cart == (int)i ? " active" : "");
+        }
+        printf("OK %u\n", cart_count);
+        return;
+    }
+    if(strcmp(args, "menu") == 0) {
+        select_cart(-1);
+        printf("OK\n");
+        return;
+    }
+    for(uint i = 0; i < cart_count; i++) {
+        if(strcmp(args, carts[i].asset->name) == 0) {
+            select_cart(i);
+            printf("OK\n");
+            return;
+        }
+    }
+    printf("ERR no cartridge %s\n", args);
+}
 
-    // Turn off the LED later
-    clear_read_alarm = add_alarm_in_ms(BLINK_MS, on_clear_led, NULL, true);
+// USB: "boot" prints the time to the first served read
+void on_usb_boot(char *args) {
+    print_boot_times();
+    printf("OK\n");
 }
 
 // Repeat a series of blinks forever
 void errorblink(int code) {
+    // The activity LED timer would fight over it
+    cancel_repeating_timer(&activity_led_timer);
     gpio_init(PICO_DEFAULT_LED_PIN);
     gpio_set_dir(PICO_DEFAULT_LED_PIN, GPIO_OUT);
     while(true) {
@@ -0,0 +1,121 @@
+// vim: ts=4:sw=4:sts=4:et
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "capture.h"
+
+bool capture_parse_trigger(char *args, unsigned command_area, capture_trigger_t *trigger,
+                           char **rest) {
+    char *end;
+    char *kind = strtok_r(args, " ", &end);
+    if(!kind) {
+        return false;
+    }
+    if(strcmp(kind, "now") == 0) {
+        trigger->kind = CAPTURE_TRIGGER_NOW;
+        trigger->address = 0;
+        *rest = end;
+        return true;
+    }
+    char *word = strtok_r(NULL, " ", &end);
+    if(!word) {
+        return false;
+    }
+    char *after;
+    unsigned long value = strtoul(word, &after, 16);
+    if(*after) {
+        return false;
+    }
+    if(strcmp(kind, "address") == 0) {
+        if(value < CAPTURE_WINDOW || value >= CAPTURE_WINDOW + CAPTURE_WINDOW_SIZE) {
+            return false;
+        }
+    } else if(strcmp(kind, "command") == 0) {
+        if(value > 0xff) {
+            return false;
+        }
+        value += command_area;
+    } else {
+        return false;
+    }
+    trigger->kind = CAPTURE_TRIGGER_ADDRESS;
+    trigger->address = value;
+    *rest = end;
+    return true;
+}
+
+unsigned capture_trigger_rom_pin(const capture_trigger_t *trigger) {
+    return trigger->address < CAPTURE_ROMH ? CAPTURE_PIN_ROML : CAPTURE_PIN_ROMH;
+}
+
+bool capture_trigger_matches(const capture_trigger_t *trigger, uint32_t pins) {
+    if(trigger->kind == CAPTURE_TRIGGER_NOW) {
+        return true;
+    }
+    uint32_t address = (pins >> CAPTURE_PIN_A0) & (CAPTURE_WINDOW_SIZE - 1);
+    return !(pins & (1u << capture_trigger_rom_pin(trigger)))
+           && address == (trigger->address & (CAPTURE_WINDOW_SIZE - 1));
+}
+
+uint32_t capture_sample(const capture_t *capture, uint32_t n) {
+    return capture->ring[(capture->first + n) & (capture->ring_size - 1)] & CAPTURE_PIN_MASK;
+}
+
+void capture_find_trigger(capture_t *capture, const capture_trigger_t *trigger, uint32_t post) {
+    if(capture->count <= post) {
+        // Stopped before it got that far, so it never triggered
+        capture->trigger = -1;
+        return;
+    }
+    int32_t expected = capture->count - 1 - post;
+    capture->trigger = expected;
+    if(trigger->kind == CAPTURE_TRIGGER_NOW) {
+        return;
+    }
+    for(int32_t n = expected; n >= 0 && n >= expected - CAPTURE_TRIGGER_SLACK; n--) {
+        if(capture_trigger_matches(trigger, capture_sample(capture, n))) {
+            // Back to the start of the read
+            while(n > 0 && capture_trigger_matches(trigger, capture_sample(capture, n - 1))) {
+                n--;
+            }
+            capture->trigger = n;
+            return;
+        }
+    }
+}
+
+size_t capture_summary(const capture_t *capture, char *out, size_t size) {
+    char trigger[12] = "none";
+    if(capture->trigger >= 0) {
+        snprintf(trigger, sizeof(trigger), "%ld", (long)capture->trigger);
+    }
+    int n = snprintf(out, size, "CAPTURE samples %lu trigger %s period_ps %lu pins %08lX\n",
+                     (unsigned long)capture->count, trigger, (unsigned long)capture->period_ps,
+                     (unsigned long)CAPTURE_PIN_MASK);
+    return n > 0 ? n : 0;
+}
+
+size_t capture_export(const capture_t *capture, uint32_t *sample, char *out, size_t size) {
+    char line[CAPTURE_LINE_MAX];
+    size_t len = 0;
+    if(size) {
+        out[0] = '\0';
+    }
+    while(*sample < capture->count) {
+        uint32_t pins = capture_sample(capture, *sample);
+        uint32_t run = 1;
+        while(*sample + run < capture->count && capture_sample(capture, *sample + run) == pins) {
+            run++;
+        }
+        int n = snprintf(line, sizeof(line), "RUN %08lX %lu\n", (unsigned long)pins,
+                         (unsigned long)run);
+        if(len + n >= size) {
+            break;
+        }
+        memcpy(out + len, line, n + 1);
+        len += n;
+        *sample += run;
+    }
+    return len;
+}
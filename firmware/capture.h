@@ -0,0 +1,99 @@
+// vim: ts=4:sw=4:sts=4:et
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Logic analyser capture of the cartridge port, for the "capture" USB command.
+//
+// The capture program (see capture.pio) samples all the GPIOs every 2 PIO cycles into a ring
+// buffer, and capture_trigger stops it a number of samples after the trigger: straight away, or
+// when the C64 reads an address.  The ring then holds the samples around the trigger, oldest
+// first from capture_t.first.
+//
+// The export is run-length encoded, one line for each run of samples where the port's pins
+// don't change, so a capture of a C64 running slower than the PIO is short.  Only the pins in
+// CAPTURE_PIN_MASK are kept.
+//
+// tools/capture_vcd.py reads the export format and writes a VCD file for a waveform viewer,
+// and tools/capture_test.py checks the trigger logic and the format against it.
+
+// Pin assignments from c64_pico_ram_interface.c
+#define CAPTURE_PIN_D0 0
+#define CAPTURE_PIN_A0 8
+#define CAPTURE_PIN_ROML 22
+#define CAPTURE_PIN_ROMH 26
+#define CAPTURE_PIN_IE 27
+#define CAPTURE_PIN_OE 28
+
+// D0..D7, A0..A13, ROML, ROMH, IE and OE
+#define CAPTURE_PIN_MASK 0x1c7fffff
+
+// Where the C64 sees the ROM window, in 16K cartridge mode, and where ROMH starts
+#define CAPTURE_WINDOW 0x8000
+#define CAPTURE_WINDOW_SIZE 0x4000
+#define CAPTURE_ROMH 0xa000
+
+// capture_trigger sees a read a few PIO cycles after the ROM line goes low, so capture stops
+// a few samples later than asked.  capture_find_trigger looks this far back for the read.
+#define CAPTURE_TRIGGER_SLACK 16
+
+// Longest export line, and so the smallest buffer capture_export can fill
+#define CAPTURE_LINE_MAX 32
+
+// Longest summary line
+#define CAPTURE_SUMMARY_MAX 80
+
+typedef enum {
+    CAPTURE_TRIGGER_NOW,        // trigger as soon as it's armed
+    CAPTURE_TRIGGER_ADDRESS,    // trigger on a read of an address
+} capture_trigger_kind_t;
+
+typedef struct {
+    capture_trigger_kind_t kind;
+    uint16_t address;           // C64 address, for CAPTURE_TRIGGER_ADDRESS
+} capture_trigger_t;
+
+typedef struct {
+    const uint32_t *ring;       // samples of GPIO 0..31
+    uint32_t ring_size;         // samples in the ring, a power of two
+    uint32_t first;             // index of the oldest sample in the ring
+    uint32_t count;             // samples captured, up to ring_size
+    int32_t trigger;            // samples before the trigger, or -1 if it didn't trigger
+    uint32_t period_ps;         // time between samples
+} capture_t;
+
+// Parse a trigger from the "capture" USB command's arguments: "now", "address <hex>" for a
+// read of a C64 address in the ROM window, or "command <hex>" for the command with that value,
+// read from command_area + value.  Returns false, leaving trigger alone, if it's none of those.
+// On success *rest points past the words used.
+bool capture_parse_trigger(char *args, unsigned command_area, capture_trigger_t *trigger,
+                           char **rest);
+
+// The ROM line a trigger's address is read with
+unsigned capture_trigger_rom_pin(const capture_trigger_t *trigger);
+
+// True if a sample of the pins is a read of the trigger's address.  Anything matches "now".
+bool capture_trigger_matches(const capture_trigger_t *trigger, uint32_t pins);
+
+// The nth oldest sample, with only the pins in CAPTURE_PIN_MASK
+uint32_t capture_sample(const capture_t *capture, uint32_t n);
+
+// Set capture->trigger to the sample the trigger happened at, given that capture_trigger
+// counted post samples after it before stopping.  For an address, that's the first sample of
+// the latest read of it within CAPTURE_TRIGGER_SLACK samples before count - 1 - post, or that
+// sample if there's none; for "now" it's count - 1 - post.
+void capture_find_trigger(capture_t *capture, const capture_trigger_t *trigger, uint32_t post);
+
+// Write the summary line to out, and return its length like snprintf:
+//
+//     CAPTURE samples <n> trigger <sample, or none> period_ps <ps> pins <hex mask>
+size_t capture_summary(const capture_t *capture, char *out, size_t size);
+
+// Write a line for each run of samples with the same pins, from the nth oldest sample on, for
+// as many as fit in out (at least CAPTURE_LINE_MAX bytes), and move *sample past them.  Returns
+// the length written; call it again until *sample is capture->count.  Each line is
+//
+//     RUN <hex pins> <samples>
+size_t capture_export(const capture_t *capture, uint32_t *sample, char *out, size_t size);
@@ -0,0 +1,85 @@
+// vim: ts=4:sw=4:sts=4:et
+#include "cart_bus.h"
+
+cart_bus_error_t cart_bus_start(cart_bus_t *bus, const hal_t *hal, const char *rom) {
+    bus->hal = hal;
+
+    // Address decoder: waits for ROMH/ROML line to be set low, and determines whether the address
+    // to read is a command or a normal ROM read.  Each state machine monitors one ROM line.
+    int offset = hal->add_program(hal->context, HAL_PROGRAM_ADDRESS_DECODER);
+    if(offset < 0) {
+        return CART_BUS_ERR_ADD_DECODER_PROGRAM;
+    }
+    bus->decoder_offset = offset;
+    for(int line = HAL_ROMH; line <= HAL_ROML; line++) {
+        int sm = hal->claim_sm(hal->context);
+        if(sm < 0) {
+            return CART_BUS_ERR_DECODER_PROGRAM_SM + line;
+        }
+        bus->decoder_sm[line] = sm;
+        hal->start_sm(hal->context, HAL_PROGRAM_ADDRESS_DECODER, sm, offset, line, rom);
+    }
+
+    // Read handler: send the rom byte over D0..D7 when the C64 reads from ROML or ROMH
+    offset = hal->add_program(hal->context, HAL_PROGRAM_READ);
+    if(offset < 0) {
+        return CART_BUS_ERR_ADD_READ_PROGRAM;
+    }
+    int sm = hal->claim_sm(hal->context);
+    if(sm < 0) {
+        return CART_BUS_ERR_READ_PROGRAM_SM;
+    }
+    bus->read_offset = offset;
+    bus->read_sm = sm;
+    hal->start_sm(hal->context, HAL_PROGRAM_READ, sm, offset, HAL_ROMH, rom);
+    hal->start_read_chain(hal->context, sm);
+
+    // Command handler: put command NN on the FIFO when the CPU reads from the command area
+    offset = hal->add_program(hal->context, HAL_PROGRAM_COMMAND);
+    if(offset < 0) {
+        return CART_BUS_ERR_ADD_COMMAND_PROGRAM;
+    }
+    sm = hal->claim_sm(hal->context);
+    if(sm < 0) {
+        return CART_BUS_ERR_COMMAND_PROGRAM_SM;
+    }
+    bus->command_offset = offset;
+    bus->command_sm = sm;
+    hal->start_sm(hal->context, HAL_PROGRAM_COMMAND, sm, offset, HAL_ROMH, rom);
+    return CART_BUS_OK;
+}
+
+cart_bus_error_t cart_bus_boot(cart_bus_t *bus, const hal_t *hal, char *rom, const void *loader,
+                               size_t loader_size, uint32_t loader_crc,
+                               void (*before_enable)(cart_bus_t *bus)) {
+    if(hal->copy_crc32(hal->context, rom, loader, loader_size) != loader_crc) {
+        return CART_BUS_ERR_LOADER_CRC;
+    }
+    cart_bus_error_t error = cart_bus_start(bus, hal, rom);
+    if(error != CART_BUS_OK) {
+        return error;
+    }
+    if(before_enable) {
+        before_enable(bus);
+    }
+    // READY!  Open the floodgates!
+    hal->enable_bus(hal->context, true);
+    return CART_BUS_OK;
+}
+
+void cart_bus_serve(cart_bus_t *bus, const char *rom, bool command_area) {
+    const hal_t *hal = bus->hal;
+    // The command area goes off before a cartridge is served and back on after it isn't, so
+    // it's never answered in the middle of one
+    if(!command_area) {
+        for(int line = HAL_ROMH; line <= HAL_ROML; line++) {
+            hal->set_command_area(hal->context, bus->decoder_sm[line], false);
+        }
+    }
+    hal->set_read_base(hal->context, bus->read_sm, bus->read_offset, rom);
+    if(command_area) {
+        for(int line = HAL_ROMH; line <= HAL_ROML; line++) {
+            hal->set_command_area(hal->context, bus->decoder_sm[line], true);
+        }
+    }
+}
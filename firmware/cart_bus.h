@@ -0,0 +1,49 @@
+// vim: ts=4:sw=4:sts=4:et
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hal.h"
+
+// The state machines that serve the C64's reads from the ROM window: an address decoder for each
+// ROM line, which hands each read to the read program or, in the command area, to the command
+// program, and the DMA chain that feeds the read program.
+
+// What cart_bus_start and cart_bus_boot can fail at, which main() blinks as the error code
+typedef enum {
+    CART_BUS_OK = 0,
+    CART_BUS_ERR_ADD_DECODER_PROGRAM = 1,
+    CART_BUS_ERR_DECODER_PROGRAM_SM = 2,    // + the ROM line
+    CART_BUS_ERR_ADD_READ_PROGRAM = 3,
+    CART_BUS_ERR_READ_PROGRAM_SM = 4,
+    CART_BUS_ERR_ADD_COMMAND_PROGRAM = 5,
+    CART_BUS_ERR_COMMAND_PROGRAM_SM = 6,
+    CART_BUS_ERR_LOADER_CRC = 7,
+} cart_bus_error_t;
+
+typedef struct {
+    const hal_t *hal;
+    unsigned decoder_sm[2];     // by hal_rom_line_t
+    unsigned decoder_offset;
+    unsigned read_sm;
+    unsigned read_offset;
+    unsigned command_sm;
+    unsigned command_offset;
+} cart_bus_t;
+
+// Load the programs and start serving reads from rom, which must be 16K aligned
+cart_bus_error_t cart_bus_start(cart_bus_t *bus, const hal_t *hal, const char *rom);
+
+// Bring the bus up for a C64 that may already be reading it: copy the loader into rom and check
+// its CRC-32, start serving rom, call before_enable (unless NULL) with the state machines
+// running, and only then enable the bus.  The loader is all the C64 needs to find the CBM80
+// signature, so anything slower, like USB, waits until this returns.
+cart_bus_error_t cart_bus_boot(cart_bus_t *bus, const hal_t *hal, char *rom, const void *loader,
+                               size_t loader_size, uint32_t loader_crc,
+                               void (*before_enable)(cart_bus_t *bus));
+
+// Serve reads from another 16K aligned rom, with or without the command area.  Takes effect
+// between two reads.
+void cart_bus_serve(cart_bus_t *bus, const char *rom, bool command_area);
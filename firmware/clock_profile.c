@@ -0,0 +1,63 @@
+// vim: ts=4:sw=4:sts=4:et
+#include <stdio.h>
+#include <string.h>
+
+#include "clock_profile.h"
+
+// The flash runs at half the system clock, so none go over its 133 MHz
+const clock_profile_t clock_profiles[] = {
+    {"default", 125000, 1100},
+    {"fast", 200000, 1150},
+    {"turbo", 250000, 1200},
+    {"extreme", 266000, 1250},
+};
+const unsigned clock_profile_count = sizeof(clock_profiles) / sizeof(clock_profiles[0]);
+
+const clock_profile_t *clock_profile_find(const char *name) {
+    for(unsigned i = 0; i < clock_profile_count; i++) {
+        if(strcmp(clock_profiles[i].name, name) == 0) {
+            return &clock_profiles[i];
+        }
+    }
+    return NULL;
+}
+
+uint32_t clock_profile_deadline_ps(void) {
+    return 1000000000000ull / CLOCK_PROFILE_PHI2_HZ / 2 - CLOCK_PROFILE_ROML_DELAY_PS
+           - CLOCK_PROFILE_SETUP_PS - CLOCK_PROFILE_BUFFER_DELAY_PS;
+}
+
+uint32_t clock_profile_latency_ps(uint32_t sys_hz) {
+    uint32_t cycles = CLOCK_PROFILE_READ_CYCLES + 2 * CLOCK_PROFILE_DMA_CYCLES;
+    if(cycles < CLOCK_PROFILE_COMMAND_CYCLES) {
+        cycles = CLOCK_PROFILE_COMMAND_CYCLES;
+    }
+    if(sys_hz == 0) {
+        return UINT32_MAX;
+    }
+    // Rounded up, so the margin is never more than it should be
+    uint64_t latency = (cycles * 1000000000000ull + sys_hz - 1) / sys_hz;
+    return latency < UINT32_MAX ? latency : UINT32_MAX;
+}
+
+int32_t clock_profile_margin_ps(uint32_t sys_hz) {
+    int64_t margin = (int64_t)clock_profile_deadline_ps() - clock_profile_latency_ps(sys_hz);
+    return margin > INT32_MIN ? margin : INT32_MIN;
+}
+
+bool clock_profile_clock_ok(const clock_profile_t *profile, uint32_t measured_khz) {
+    uint32_t tolerance = profile->sys_khz / 1000 * CLOCK_PROFILE_TOLERANCE_PERMILLE;
+    return measured_khz + tolerance >= profile->sys_khz
+           && measured_khz <= profile->sys_khz + tolerance;
+}
+
+size_t clock_profile_describe(const clock_profile_t *profile, uint32_t measured_khz, char *out,
+                              size_t size) {
+    uint32_t sys_hz = measured_khz * 1000;
+    int n = snprintf(out, size, "CLOCK profile %s sys_khz %lu vreg_mv %lu latency_ps %lu "
+                     "margin_ps %ld\n", profile->name, (unsigned long)measured_khz,
+                     (unsigned long)profile->vreg_mv,
+                     (unsigned long)clock_profile_latency_ps(sys_hz),
+                     (long)clock_profile_margin_ps(sys_hz));
+    return n > 0 ? n : 0;
+}
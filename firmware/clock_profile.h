@@ -0,0 +1,79 @@
+// vim: ts=4:sw=4:sts=4:et
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// System clock profiles, and the read path's margin against the C64's deadline at each.
+//
+// The read path is all PIO and DMA, so a faster system clock answers reads sooner.  The build
+// picks a profile with C64_CLOCK_PROFILE, and main() sets its clock and core voltage before the
+// state machines start, measures the clock it got, and checks the margin at that speed with
+// clock_profile_margin_ps.  A profile that doesn't run at its speed or leaves less than
+// CLOCK_PROFILE_MIN_MARGIN_PS to spare falls back to the first one, the SDK's default.
+//
+// The margin comes from the worst case PIO cycles tools/pio_timing.py works out from the .pio
+// sources, with the DMA's time in system clock cycles, against NTSC's deadline, the shorter
+// one.  tools/clock_profile_test.py checks these figures against pio_timing.py and pio_sim.py,
+// so they can't drift from the programs.
+//
+// This file doesn't touch the hardware, so it can be tested on the host.
+
+// Worst case PIO cycles from ROML/ROMH falling to OE low, without the read DMA, for reads of
+// the window (address_decoder, then read) and of the command area (address_decoder, then
+// command)
+#define CLOCK_PROFILE_READ_CYCLES 13
+#define CLOCK_PROFILE_COMMAND_CYCLES 13
+
+// System clock cycles for each of the read DMA's two transfers, as pio_sim.py's --dma-cycles
+#define CLOCK_PROFILE_DMA_CYCLES 4
+
+// NTSC phi2, and the time from phi2 rising to when the data must be on the bus: ROML/ROMH
+// going low, the 6510's data setup time and the bus buffer, as pio_sim.py's defaults
+#define CLOCK_PROFILE_PHI2_HZ 1022727
+#define CLOCK_PROFILE_ROML_DELAY_PS 60000
+#define CLOCK_PROFILE_SETUP_PS 100000
+#define CLOCK_PROFILE_BUFFER_DELAY_PS 10000
+
+// Least margin a profile must leave, as the build's check with tools/pio_timing.py
+#define CLOCK_PROFILE_MIN_MARGIN_PS 50000
+
+// How far the measured clock may be from the profile's, in thousandths
+#define CLOCK_PROFILE_TOLERANCE_PERMILLE 10
+
+// Longest line clock_profile_describe writes
+#define CLOCK_PROFILE_LINE_MAX 96
+
+typedef struct {
+    const char *name;
+    uint32_t sys_khz;
+    uint32_t vreg_mv;       // core voltage, set before the clock is raised
+} clock_profile_t;
+
+// From the SDK's default clock to the fastest, each with the core voltage it needs
+extern const clock_profile_t clock_profiles[];
+extern const unsigned clock_profile_count;
+
+// The profile called name, or NULL
+const clock_profile_t *clock_profile_find(const char *name);
+
+// Time after ROML/ROMH falls that the data must be on the bus
+uint32_t clock_profile_deadline_ps(void);
+
+// Worst case time from ROML/ROMH falling to OE low, for the slower of a window read and a
+// command, at a system clock of sys_hz
+uint32_t clock_profile_latency_ps(uint32_t sys_hz);
+
+// Time to spare before the deadline at sys_hz, negative if it's missed
+int32_t clock_profile_margin_ps(uint32_t sys_hz);
+
+// Whether a clock measured at measured_khz is close enough to the profile's
+bool clock_profile_clock_ok(const clock_profile_t *profile, uint32_t measured_khz);
+
+// Write a line describing the profile running at measured_khz, and return its length like
+// snprintf:
+//
+//     CLOCK profile <name> sys_khz <measured> vreg_mv <mV> latency_ps <ps> margin_ps <ps>
+size_t clock_profile_describe(const clock_profile_t *profile, uint32_t measured_khz, char *out,
+                              size_t size);
@@ -0,0 +1,111 @@
+// vim: ts=4:sw=4:sts=4:et
+#include <string.h>
+
+#include "command_dispatch.h"
+
+void command_dispatcher_init(command_dispatcher_t *dispatcher,
+                             const command_handlers_t *handlers) {
+    memset(dispatcher, 0, sizeof(*dispatcher));
+    dispatcher->handlers = handlers;
+    command_dispatch_reset(dispatcher);
+}
+
+void command_dispatch_reset(command_dispatcher_t *dispatcher) {
+    dispatcher->load_name_state = COMMAND_LOAD_NAME_NONE;
+    dispatcher->bench_state = COMMAND_BENCH_NONE;
+}
+
+uint8_t command_dispatch_opcode(const command_dispatcher_t *dispatcher, uint32_t command) {
+    if(dispatcher->load_name_state != COMMAND_LOAD_NAME_NONE) {
+        return CMD_LOAD_OPEN;
+    }
+    return dispatcher->bench_state != COMMAND_BENCH_NONE ? CMD_BENCH_RESULT : command;
+}
+
+// Take the next part of the name after CMD_LOAD_OPEN: its length + 1, then each character
+static void receive_load_name(command_dispatcher_t *dispatcher, uint32_t command) {
+    if(dispatcher->load_name_state == COMMAND_LOAD_NAME_LENGTH) {
+        dispatcher->load_name_left = command - 1;
+        dispatcher->load_name_len = 0;
+        dispatcher->load_name_state = COMMAND_LOAD_NAME_CHARS;
+    } else {
+        if(dispatcher->load_name_len < sizeof(dispatcher->load_name)) {
+            dispatcher->load_name[dispatcher->load_name_len++] = (char)command;
+        }
+        dispatcher->load_name_left--;
+    }
+    if(dispatcher->load_name_left == 0) {
+        dispatcher->load_name_state = COMMAND_LOAD_NAME_NONE;
+        dispatcher->handlers->open_load_file(dispatcher->handlers->context,
+                                             dispatcher->load_name, dispatcher->load_name_len);
+    }
+}
+
+// Take the next part of a result after CMD_BENCH_RESULT: its number + 1, then each nibble + 1
+static void receive_bench_result(command_dispatcher_t *dispatcher, uint32_t command) {
+    if(dispatcher->bench_state == COMMAND_BENCH_INDEX) {
+        dispatcher->bench_index = command - 1;
+        dispatcher->bench_cycles = 0;
+        dispatcher->bench_nibbles_left = 8;
+        dispatcher->bench_state = COMMAND_BENCH_NIBBLES;
+        return;
+    }
+    dispatcher->bench_cycles = dispatcher->bench_cycles << 4 | ((command - 1) & 0xf);
+    if(--dispatcher->bench_nibbles_left == 0) {
+        dispatcher->bench_state = COMMAND_BENCH_NONE;
+        dispatcher->handlers->bench_result(dispatcher->handlers->context, dispatcher->bench_index,
+                                           dispatcher->bench_cycles);
+    }
+}
+
+void command_dispatch(command_dispatcher_t *dispatcher, uint32_t command) {
+    const command_handlers_t *handlers = dispatcher->handlers;
+    if(dispatcher->load_name_state != COMMAND_LOAD_NAME_NONE) {
+        receive_load_name(dispatcher, command);
+        return;
+    }
+    if(dispatcher->bench_state != COMMAND_BENCH_NONE) {
+        receive_bench_result(dispatcher, command);
+        return;
+    }
+
+    switch(command) {
+        case CMD_NEXT_PAGE:
+            handlers->next_page(handlers->context);
+            break;
+
+        case CMD_SLEEP:
+            handlers->sleep(handlers->context);
+            break;
+
+        case CMD_LOAD_OPEN:
+            dispatcher->load_name_state = COMMAND_LOAD_NAME_LENGTH;
+            break;
+
+        case CMD_SAVE_NUFLI:
+            handlers->save_nufli(handlers->context);
+            break;
+
+        case CMD_CHECK_CRC:
+            handlers->check_crc(handlers->context);
+            break;
+
+        case CMD_PING:
+            handlers->ping(handlers->context);
+            break;
+
+        case CMD_BENCH_RESULT:
+            dispatcher->bench_state = COMMAND_BENCH_INDEX;
+            break;
+
+        case CMD_NO_ROMH:
+            handlers->no_romh(handlers->context);
+            break;
+
+        default:
+            if(command >= CMD_SELECT_CART && command < CMD_SELECT_CART + dispatcher->cart_count) {
+                handlers->select_cart(handlers->context, command - CMD_SELECT_CART);
+            }
+            break;
+    }
+}
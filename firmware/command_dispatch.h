@@ -0,0 +1,86 @@
+// vim: ts=4:sw=4:sts=4:et
+#pragma once
+
+#include <stdint.h>
+
+#include "d64.h"
+
+// Decoding the commands the C64 sends through the command area, and calling a handler for each.
+//
+// This is the switch in main()'s command loop, with the hardware behind a table of handlers,
+// so tools/command_replay.py can build it for the host and replay a recorded command stream
+// (see command_trace.h) through it.
+//
+// Most commands are an opcode on their own.  CMD_LOAD_OPEN is followed by the length of a file
+// name + 1 (so it's never the status read), then each character of the name as a command, and
+// the handler gets the whole name after the last one.  CMD_BENCH_RESULT is followed by the
+// result's number + 1, then its 32 bit value as 8 nibbles + 1, most significant first (see
+// benchmark.h).
+
+typedef enum {
+    CMD_NEXT_PAGE = 0x01,   // Advance the NUFLI window to the next 1K
+    CMD_SLEEP = 0x02,       // Test a slow command that sleeps for 5 seconds
+    CMD_CHECK_CRC = 0x03,   // Recompute the CRCs in the mailbox
+    CMD_SAVE_NUFLI = 0x04,  // Save the NUFLI image to flash so it's used at the next boot
+    CMD_LOAD_OPEN = 0x05,   // Open a file on the mounted D64, named by the next commands
+    CMD_PING = 0x06,        // Do nothing, for the benchmark to time a round trip
+    CMD_BENCH_RESULT = 0x07, // Report a benchmark result, in the next 9 commands
+    CMD_NO_ROMH = 0x08,     // ROMH isn't mapped: send the image without a routine at $A000
+    CMD_SELECT_CART = 0x10, // + n: serve cartridge n from the library, for the C64 to reset into
+} command_t;
+
+typedef struct {
+    void (*next_page)(void *context);
+    void (*sleep)(void *context);
+    void (*check_crc)(void *context);
+    void (*save_nufli)(void *context);
+    // The name after CMD_LOAD_OPEN, up to D64_NAME_MAX characters (the rest are dropped)
+    void (*open_load_file)(void *context, const char *name, unsigned length);
+    void (*select_cart)(void *context, unsigned cart);
+    void (*ping)(void *context);
+    // The result after CMD_BENCH_RESULT, numbered from 0
+    void (*bench_result)(void *context, unsigned index, uint32_t cycles);
+    void (*no_romh)(void *context);
+    void *context;
+} command_handlers_t;
+
+typedef enum {
+    COMMAND_LOAD_NAME_NONE,     // not receiving a name
+    COMMAND_LOAD_NAME_LENGTH,   // CMD_LOAD_OPEN came, the length is next
+    COMMAND_LOAD_NAME_CHARS,    // receiving the characters
+} command_load_name_state_t;
+
+typedef enum {
+    COMMAND_BENCH_NONE,         // not receiving a result
+    COMMAND_BENCH_INDEX,        // CMD_BENCH_RESULT came, the result's number + 1 is next
+    COMMAND_BENCH_NIBBLES,      // receiving the value's nibbles
+} command_bench_state_t;
+
+typedef struct {
+    const command_handlers_t *handlers;
+    unsigned cart_count;        // CMD_SELECT_CART + n is only a command for n below this
+    command_load_name_state_t load_name_state;
+    char load_name[D64_NAME_MAX];
+    unsigned load_name_len;
+    unsigned load_name_left;
+    command_bench_state_t bench_state;
+    unsigned bench_index;
+    uint32_t bench_cycles;
+    unsigned bench_nibbles_left;
+} command_dispatcher_t;
+
+// Start with no name being received and no cartridges
+void command_dispatcher_init(command_dispatcher_t *dispatcher, const command_handlers_t *handlers);
+
+// The opcode a command counts as, for timing: the characters of a LOAD name count as
+// CMD_LOAD_OPEN, and the parts of a benchmark result as CMD_BENCH_RESULT, rather than an opcode
+// each
+uint8_t command_dispatch_opcode(const command_dispatcher_t *dispatcher, uint32_t command);
+
+// Drop a LOAD name or benchmark result part way through.  The C64 unlocks the command area
+// before it sends one, so main() calls this when the guard locks or unlocks, and a C64 reset
+// part way through can't leave the next commands taken for the rest of it.
+void command_dispatch_reset(command_dispatcher_t *dispatcher);
+
+// Handle a command from the C64.  Values that aren't a command are ignored.
+void command_dispatch(command_dispatcher_t *dispatcher, uint32_t command);
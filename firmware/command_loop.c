@@ -0,0 +1,59 @@
+// vim: ts=4:sw=4:sts=4:et
+#include <string.h>
+
+#include "command_loop.h"
+
+void command_loop_init(command_loop_t *loop, const hal_t *hal, unsigned command_sm,
+                       command_dispatcher_t *dispatcher, const command_loop_hooks_t *hooks) {
+    memset(loop, 0, sizeof(*loop));
+    loop->hal = hal;
+    loop->command_sm = command_sm;
+    loop->dispatcher = dispatcher;
+    loop->hooks = hooks;
+}
+
+void command_loop_ready(command_loop_t *loop) {
+    const hal_t *hal = loop->hal;
+    const command_loop_hooks_t *hooks = loop->hooks;
+    if(hooks && hooks->before_ready) {
+        hooks->before_ready(hooks->context);
+    }
+    if(hal->rx_empty(hal->context, loop->command_sm)) {
+        hal->tx_put(hal->context, loop->command_sm, 1);
+    }
+    loop->timing.ready_us = hal->time_us(hal->context);
+    if(hooks && hooks->after_ready) {
+        hooks->after_ready(hooks->context);
+    }
+}
+
+void command_loop_wait(command_loop_t *loop) {
+    const hal_t *hal = loop->hal;
+    const command_loop_hooks_t *hooks = loop->hooks;
+    while(hal->rx_empty(hal->context, loop->command_sm)) {
+        if(hooks && hooks->idle) {
+            hooks->idle(hooks->context);
+        }
+    }
+}
+
+bool command_loop_handle(command_loop_t *loop) {
+    const hal_t *hal = loop->hal;
+    const command_loop_hooks_t *hooks = loop->hooks;
+    if(hal->rx_empty(hal->context, loop->command_sm)) {
+        return false;
+    }
+    loop->timing.received_us = hal->time_us(hal->context);
+    uint32_t command = hal->rx_get(hal->context, loop->command_sm);
+    if(hooks && hooks->on_command) {
+        hooks->on_command(hooks->context, command);
+    }
+
+    loop->opcode = command_dispatch_opcode(loop->dispatcher, command);
+    loop->value = command;
+    loop->timed = true;
+    loop->timing.started_us = hal->time_us(hal->context);
+    command_dispatch(loop->dispatcher, command);
+    loop->timing.finished_us = hal->time_us(hal->context);
+    return true;
+}
@@ -0,0 +1,60 @@
+// vim: ts=4:sw=4:sts=4:et
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "command_dispatch.h"
+#include "command_stats.h"
+#include "hal.h"
+
+// main()'s command loop: tell the command program we're ready, wait for a command from the C64,
+// and dispatch it, timing each step for command_stats.h.
+//
+// What main() does around the loop, like logging, USB and the guard, is in hooks, so the loop
+// itself can run against hal_host.c.  On the Pico it's only
+//
+//     while(true) {
+//         command_loop_ready(&loop);
+//         command_loop_wait(&loop);
+//         command_loop_handle(&loop);
+//     }
+
+typedef struct {
+    // Just before the ready token goes back, with the last command handled
+    void (*before_ready)(void *context);
+    // Just after, so the last command's timing has its ready_us
+    void (*after_ready)(void *context);
+    // Over and over while there's no command
+    void (*idle)(void *context);
+    // A command has been taken from the RX FIFO, and is about to be dispatched
+    void (*on_command)(void *context, uint32_t command);
+    void *context;
+} command_loop_hooks_t;
+
+typedef struct {
+    const hal_t *hal;
+    unsigned command_sm;
+    command_dispatcher_t *dispatcher;
+    const command_loop_hooks_t *hooks;  // any can be NULL
+
+    // The last command taken, and its timing up to when it was handled.  timed is set until
+    // the timing has been recorded, which after_ready is for.
+    uint32_t value;
+    uint8_t opcode;
+    command_timing_t timing;
+    bool timed;
+} command_loop_t;
+
+void command_loop_init(command_loop_t *loop, const hal_t *hal, unsigned command_sm,
+                       command_dispatcher_t *dispatcher, const command_loop_hooks_t *hooks);
+
+// Put the ready token back, unless more commands are queued: the C64 polls the status to know
+// every command it's sent has been handled.  Sets the last command's ready_us.
+void command_loop_ready(command_loop_t *loop);
+
+// Call idle until there's a command in the RX FIFO
+void command_loop_wait(command_loop_t *loop);
+
+// Take the command and dispatch it.  Returns false if there wasn't one.
+bool command_loop_handle(command_loop_t *loop);
@@ -0,0 +1,145 @@
+// vim: ts=4:sw=4:sts=4:et
+#include <stdio.h>
+#include <string.h>
+
+#include "command_stats.h"
+
+void command_stats_reset(command_stats_t *stats) {
+    memset(stats, 0, sizeof(*stats));
+}
+
+// Histogram bucket for a round trip of us µs
+static unsigned bucket_of(uint32_t us) {
+    if(us < 4) {
+        return us;
+    }
+    unsigned e = 2;
+    while(e < 31 && us >> (e + 1)) {
+        e++;
+    }
+    return 4 + (e - 2) * 2 + ((us >> (e - 1)) & 1);
+}
+
+// Largest round trip in a bucket
+static uint32_t bucket_top(unsigned bucket) {
+    if(bucket < 4) {
+        return bucket;
+    }
+    unsigned e = (bucket - 4) / 2 + 2;
+    uint64_t bottom = ((uint64_t)1 << e) + ((uint64_t)((bucket - 4) % 2) << (e - 1));
+    return (uint32_t)(bottom + ((uint64_t)1 << (e - 1)) - 1);
+}
+
+// Time from start to end in µs, 0 if they're the wrong way round and clamped to 32 bits
+static uint32_t elapsed(uint64_t start, uint64_t end) {
+    if(end < start) {
+        return 0;
+    }
+    return end - start > UINT32_MAX ? UINT32_MAX : (uint32_t)(end - start);
+}
+
+static void add_interval(command_interval_t *interval, uint32_t us) {
+    if(!interval->count || us < interval->min) {
+        interval->min = us;
+    }
+    if(us > interval->max) {
+        interval->max = us;
+    }
+    interval->count++;
+    interval->sum += us;
+}
+
+bool command_stats_record(command_stats_t *stats, uint8_t opcode, const command_timing_t *timing) {
+    command_stats_slot_t *slot = (command_stats_slot_t *)command_stats_find(stats, opcode);
+    if(!slot) {
+        // Slots are taken in order, so the first empty one is after all those in use
+        for(int i = 0; i < COMMAND_STATS_SLOTS && !slot; i++) {
+            if(!stats->slots[i].round_trip.count) {
+                slot = &stats->slots[i];
+                slot->opcode = opcode;
+            }
+        }
+        if(!slot) {
+            stats->dropped++;
+            return false;
+        }
+    }
+    uint32_t round_trip = elapsed(timing->received_us, timing->ready_us);
+    add_interval(&slot->round_trip, round_trip);
+    add_interval(&slot->handler, elapsed(timing->started_us, timing->finished_us));
+    slot->buckets[bucket_of(round_trip)]++;
+    return true;
+}
+
+const command_stats_slot_t *command_stats_find(const command_stats_t *stats, uint8_t opcode) {
+    for(int i = 0; i < COMMAND_STATS_SLOTS && stats->slots[i].round_trip.count; i++) {
+        if(stats->slots[i].opcode == opcode) {
+            return &stats->slots[i];
+        }
+    }
+    return NULL;
+}
+
+uint32_t command_stats_mean(const command_interval_t *interval) {
+    return interval->count ? (uint32_t)(interval->sum / interval->count) : 0;
+}
+
+uint32_t command_stats_percentile(const command_stats_slot_t *slot, unsigned permille) {
+    uint64_t needed = ((uint64_t)slot->round_trip.count * permille + 999) / 1000;
+    uint64_t seen = 0;
+    for(int bucket = 0; bucket < COMMAND_STATS_BUCKETS; bucket++) {
+        seen += slot->buckets[bucket];
+        if(seen && seen >= needed) {
+            uint32_t top = bucket_top(bucket);
+            return top < slot->round_trip.max ? top : slot->round_trip.max;
+        }
+    }
+    return 0;
+}
+
+static void put_u32(uint8_t *out, uint32_t value) {
+    for(int i = 0; i < 4; i++) {
+        out[i] = value >> (8 * i);
+    }
+}
+
+void command_stats_mailbox(const command_stats_t *stats, uint8_t *out) {
+    memset(out, 0, COMMAND_STATS_MAILBOX_SIZE);
+    for(int i = 0; i < COMMAND_STATS_SLOTS && stats->slots[i].round_trip.count; i++) {
+        const command_stats_slot_t *slot = &stats->slots[i];
+        uint8_t *record = out + i * COMMAND_STATS_RECORD_SIZE;
+        record[0] = slot->opcode;
+        put_u32(record + 4, slot->round_trip.count);
+        put_u32(record + 8, slot->round_trip.min);
+        put_u32(record + 12, command_stats_mean(&slot->round_trip));
+        put_u32(record + 16, command_stats_percentile(slot, 990));
+        put_u32(record + 20, slot->round_trip.max);
+    }
+}
+
+size_t command_stats_export(const command_stats_t *stats, char *out, size_t size) {
+    int used = 0;
+    while(used < COMMAND_STATS_SLOTS && stats->slots[used].round_trip.count) {
+        used++;
+    }
+    size_t len = 0;
+    int n = snprintf(out, size, "CMDSTATS slots %d dropped %lu\n", used,
+                     (unsigned long)stats->dropped);
+    len += n > 0 ? n : 0;
+    for(int i = 0; i < used; i++) {
+        const command_stats_slot_t *slot = &stats->slots[i];
+        n = snprintf(len < size ? out + len : NULL, len < size ? size - len : 0,
+                     "CMDSTAT %02X count %lu min %lu mean %lu p99 %lu max %lu "
+                     "handler_min %lu handler_mean %lu handler_max %lu\n",
+                     slot->opcode, (unsigned long)slot->round_trip.count,
+                     (unsigned long)slot->round_trip.min,
+                     (unsigned long)command_stats_mean(&slot->round_trip),
+                     (unsigned long)command_stats_percentile(slot, 990),
+                     (unsigned long)slot->round_trip.max,
+                     (unsigned long)slot->handler.min,
+                     (unsigned long)command_stats_mean(&slot->handler),
+                     (unsigned long)slot->handler.max);
+        len += n > 0 ? n : 0;
+    }
+    return len;
+}
@@ -0,0 +1,88 @@
+// vim: ts=4:sw=4:sts=4:et
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// How long each command from the C64 takes, per opcode, to find the ones that leave it spinning
+// on the status read.
+//
+// Each command is timed at four points: when it's taken from the command program, when its
+// handler starts and finishes, and when the ready token is put back.  The round trip, from
+// receiving it to being ready, is what the C64 waits for, and gets a histogram for its p99; the
+// handler time only gets min, mean and max, since the difference is mostly printf.
+//
+// Everything is in fixed arrays, a slot per opcode taken on first use.  tools/command_stats.py
+// reads the export format, and tools/command_stats_test.py checks the aggregation against it.
+
+#define COMMAND_STATS_SLOTS 16
+
+// Round trip histogram in µs: exact below 4, then 2 buckets for each power of two, so a p99 is
+// within 50% over the real one (and never over the max)
+#define COMMAND_STATS_BUCKETS 64
+
+// Mailbox for the C64, at COMMAND_STATS_OFFSET in the ROM window: a record for each slot in the
+// order they were taken, the rest zero.  Each record is the opcode, 3 zero bytes, then the
+// count, min, mean, p99 and max of the round trip in µs, all 32 bit little endian.  A count of
+// 0 ends the list.
+#define COMMAND_STATS_RECORD_SIZE 24
+#define COMMAND_STATS_MAILBOX_SIZE (COMMAND_STATS_SLOTS * COMMAND_STATS_RECORD_SIZE)
+
+// Longest export: the summary line, and a CMDSTAT line for every slot
+#define COMMAND_STATS_EXPORT_MAX (32 + COMMAND_STATS_SLOTS * 160)
+
+typedef struct {
+    uint64_t received_us;  // taken from the command program's RX FIFO
+    uint64_t started_us;   // handler started
+    uint64_t finished_us;  // handler finished
+    uint64_t ready_us;     // ready token put back
+} command_timing_t;
+
+typedef struct {
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum;
+} command_interval_t;
+
+typedef struct {
+    uint8_t opcode;
+    command_interval_t round_trip;
+    command_interval_t handler;
+    uint32_t buckets[COMMAND_STATS_BUCKETS];
+} command_stats_slot_t;
+
+typedef struct {
+    command_stats_slot_t slots[COMMAND_STATS_SLOTS];
+    uint32_t dropped;  // commands with no slot left for their opcode
+} command_stats_t;
+
+// Empty all the slots
+void command_stats_reset(command_stats_t *stats);
+
+// Add a command's timing to its opcode's slot.  Returns false, and counts it as dropped, if
+// every slot is taken by other opcodes.
+bool command_stats_record(command_stats_t *stats, uint8_t opcode, const command_timing_t *timing);
+
+// The opcode's slot, or NULL if it hasn't been recorded
+const command_stats_slot_t *command_stats_find(const command_stats_t *stats, uint8_t opcode);
+
+// Mean of an interval in µs, rounded down, or 0 if it's empty
+uint32_t command_stats_mean(const command_interval_t *interval);
+
+// The round trip in µs that permille thousandths of the slot's commands are within, as the top
+// of its histogram bucket but no more than the max, or 0 if it's empty
+uint32_t command_stats_percentile(const command_stats_slot_t *slot, unsigned permille);
+
+// Write COMMAND_STATS_MAILBOX_SIZE bytes of mailbox records to out
+void command_stats_mailbox(const command_stats_t *stats, uint8_t *out);
+
+// Write the export format to out, and return its length like snprintf:
+//
+//     CMDSTATS slots <used> dropped <n>
+//     CMDSTAT <opcode> count <n> min <µs> mean <µs> p99 <µs> max <µs> handler_min <µs>
+//         handler_mean <µs> handler_max <µs>
+//
+// all on one line for each slot in use, the opcode in 2 hex digits.
+size_t command_stats_export(const command_stats_t *stats, char *out, size_t size);
@@ -0,0 +1,46 @@
+// vim: ts=4:sw=4:sts=4:et
+#include <stdio.h>
+#include <string.h>
+
+#include "command_trace.h"
+
+void command_trace_reset(command_trace_t *trace) {
+    trace->count = 0;
+    trace->dropped = 0;
+}
+
+bool command_trace_add(command_trace_t *trace, const command_trace_entry_t *entry) {
+    if(trace->count == COMMAND_TRACE_ENTRIES) {
+        trace->dropped++;
+        return false;
+    }
+    trace->entries[trace->count++] = *entry;
+    return true;
+}
+
+size_t command_trace_summary(const command_trace_t *trace, char *out, size_t size) {
+    int n = snprintf(out, size, "TRACE commands %lu dropped %lu\n", (unsigned long)trace->count,
+                     (unsigned long)trace->dropped);
+    return n > 0 ? n : 0;
+}
+
+size_t command_trace_export(const command_trace_t *trace, unsigned *entry, char *out,
+                            size_t size) {
+    char line[COMMAND_TRACE_LINE_MAX];
+    size_t len = 0;
+    if(size) {
+        out[0] = '\0';
+    }
+    for(; *entry < trace->count; (*entry)++) {
+        const command_trace_entry_t *e = &trace->entries[*entry];
+        int n = snprintf(line, sizeof(line), "CMD %lu %02X %lu %lu\n",
+                         (unsigned long)e->arrival_us, e->value, (unsigned long)e->handler_us,
+                         (unsigned long)e->overhead_us);
+        if(len + n >= size) {
+            break;
+        }
+        memcpy(out + len, line, n + 1);
+        len += n;
+    }
+    return len;
+}
@@ -0,0 +1,58 @@
+// vim: ts=4:sw=4:sts=4:et
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Recording of the commands the C64 sends, with when each arrived, to replay them on the host.
+//
+// Performance problems in the command loop depend on the C64's timing, so the "trace on" USB
+// command records each command value with the time the command program pushed it, and the
+// time its handler and the rest of the loop took.  tools/command_replay.py replays a trace
+// through a host build of the dispatcher (see command_dispatch.h), at the recorded speed or
+// faster or slower, and reports how long each command queued and was handled.
+//
+// The trace stops recording when it's full, counting the commands it missed, so it's always
+// the start of a run.  tools/command_replay_test.py checks the export format against
+// command_replay.py.
+
+#define COMMAND_TRACE_ENTRIES 1024
+
+// Longest export line, and so the smallest buffer command_trace_export can fill
+#define COMMAND_TRACE_LINE_MAX 48
+
+// Longest summary line
+#define COMMAND_TRACE_SUMMARY_MAX 64
+
+typedef struct {
+    uint32_t arrival_us;    // since the trace started
+    uint32_t handler_us;    // in the handler
+    uint32_t overhead_us;   // the rest of the time from taking it to being ready
+    uint8_t value;
+} command_trace_entry_t;
+
+typedef struct {
+    command_trace_entry_t entries[COMMAND_TRACE_ENTRIES];
+    uint32_t count;
+    uint32_t dropped;       // commands after it was full
+} command_trace_t;
+
+// Empty the trace
+void command_trace_reset(command_trace_t *trace);
+
+// Record a command, or count it as dropped and return false if the trace is full
+bool command_trace_add(command_trace_t *trace, const command_trace_entry_t *entry);
+
+// Write the summary line to out, and return its length like snprintf:
+//
+//     TRACE commands <n> dropped <n>
+size_t command_trace_summary(const command_trace_t *trace, char *out, size_t size);
+
+// Write a line for each entry from *entry on, for as many as fit in out (at least
+// COMMAND_TRACE_LINE_MAX bytes), and move *entry past them.  Returns the length written; call
+// it again until *entry is trace->count.  Each line is
+//
+//     CMD <arrival µs> <hex value> <handler µs> <overhead µs>
+size_t command_trace_export(const command_trace_t *trace, unsigned *entry, char *out,
+                            size_t size);
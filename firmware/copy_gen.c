@@ -0,0 +1,217 @@
+// vim: ts=4:sw=4:sts=4:et
+#include <stdbool.h>
+#include <string.h>
+
+#include "copy_gen.h"
+
+// 6502 opcodes
+static const uint8_t LDA_IMM = 0xa9;
+static const uint8_t LDA_ABS = 0xad;
+static const uint8_t LDA_ABX = 0xbd;
+static const uint8_t STA_ABS = 0x8d;
+static const uint8_t STA_ABX = 0x9d;
+static const uint8_t STA_ZP = 0x85;
+static const uint8_t LDX_IMM = 0xa2;
+static const uint8_t DEX = 0xca;
+static const uint8_t BNE = 0xd0;
+static const uint8_t BPL = 0x10;
+static const uint8_t BMI = 0x30;
+static const uint8_t JMP = 0x4c;
+
+static const uint16_t BORDER_COLOR = 0xd020;
+
+// The CPU port banks I/O out with $33 (the cartridge and KERNAL stay in), so stores to
+// $D000-$DFFF go to the RAM underneath
+static const uint8_t CPU_PORT = 0x01;
+static const uint8_t CPU_PORT_NO_IO = 0x33;
+static const uint8_t CPU_PORT_DEFAULT = 0x37;
+static const uint32_t IO_START = 0xd000;
+static const uint32_t IO_END = 0xe000;
+
+// Chunk offsets sorted by value, for copy_gen_chunk
+static uint16_t chunk_order[COPY_GEN_CHUNK_SIZE];
+
+typedef struct {
+    uint8_t *code;
+    size_t len;
+    size_t max;
+    uint16_t origin;
+} emitter_t;
+
+
+static uint16_t emit_pc(const emitter_t *e) {
+    return e->origin + e->len;
+}
+
+// Append an instruction with a 0, 1 or 2 byte operand.  Anything past max is counted but not
+// written, so the caller only has to check the length at the end.
+static void emit(emitter_t *e, uint8_t opcode, uint16_t operand, int operand_size) {
+    uint8_t bytes[3] = {opcode, operand & 0xff, operand >> 8};
+    for(int i = 0; i <= operand_size; i++) {
+        if(e->len < e->max) {
+            e->code[e->len] = bytes[i];
+        }
+        e->len++;
+    }
+}
+
+// Decrement x and loop while it's >= 0: bpl if the loop is short enough, otherwise bmi over a jmp
+static void emit_loop_end(emitter_t *e, uint16_t loop) {
+    emit(e, DEX, 0, 0);
+    int offset = loop - (emit_pc(e) + 2);
+    if(offset >= -128) {
+        emit(e, BPL, offset, 1);
+    } else {
+        emit(e, BMI, 3, 1);
+        emit(e, JMP, loop, 2);
+    }
+}
+
+// True if the section is one byte repeated
+static bool is_fill(const uint8_t *section) {
+    for(int i = 1; i < COPY_GEN_SECTION_SIZE; i++) {
+        if(section[i] != section[0]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t copy_gen_build(const copy_gen_config_t *config,
+                      const uint8_t *image,
+                      size_t size,
+                      uint8_t *code,
+                      size_t code_max,
+                      uint8_t *stream,
+                      size_t *stream_size) {
+    if(size % COPY_GEN_SECTION_SIZE != 0) {
+        return 0;
+    }
+
+    emitter_t e = {code, 0, code_max, config->origin};
+    unsigned sections_per_window = config->window_size / COPY_GEN_SECTION_SIZE;
+    unsigned window_sections = 0;
+    uint16_t loop = 0;
+    uint8_t fill_values[256 / 8] = {0};
+
+    // Copy the sections that aren't fills, a window at a time
+    *stream_size = 0;
+    for(size_t offset = 0; offset < size; offset += COPY_GEN_SECTION_SIZE) {
+        if(is_fill(image + offset)) {
+            fill_values[image[offset] / 8] |= 1 << (image[offset] % 8);
+            continue;
+        }
+        if(window_sections == 0) {
+            uint16_t wait = emit_pc(&e);
+            emit(&e, LDA_ABS, config->command_area, 2);
+            emit(&e, STA_ABS, BORDER_COLOR, 2);  // flash border if the pico's cpu is busy
+            emit(&e, BNE, wait - (emit_pc(&e) + 2), 1);
+            emit(&e, LDX_IMM, COPY_GEN_SECTION_SIZE - 1, 1);
+            loop = emit_pc(&e);
+        }
+        emit(&e, LDA_ABX, config->window + window_sections * COPY_GEN_SECTION_SIZE, 2);
+        emit(&e, STA_ABX, config->dest + offset, 2);
+        memcpy(stream + *stream_size, image + offset, COPY_GEN_SECTION_SIZE);
+        *stream_size += COPY_GEN_SECTION_SIZE;
+
+        window_sections++;
+        if(window_sections == sections_per_window) {
+            emit_loop_end(&e, loop);
+            emit(&e, LDA_ABS, config->command_area + config->next_page, 2);
+            window_sections = 0;
+        }
+    }
+    if(window_sections != 0) {
+        emit_loop_end(&e, loop);
+        emit(&e, LDA_ABS, config->command_area + config->next_page, 2);
+    }
+
+    // Fill the rest, one value at a time
+    bool filling = false;
+    for(unsigned value = 0; value < 256; value++) {
+        if(!(fill_values[value / 8] & (1 << (value % 8)))) {
+            continue;
+        }
+        if(!filling) {
+            emit(&e, LDX_IMM, COPY_GEN_SECTION_SIZE - 1, 1);
+            loop = emit_pc(&e);
+            filling = true;
+        }
+        emit(&e, LDA_IMM, value, 1);
+        for(size_t offset = 0; offset < size; offset += COPY_GEN_SECTION_SIZE) {
+            if(image[offset] == value && is_fill(image + offset)) {
+                emit(&e, STA_ABX, config->dest + offset, 2);
+            }
+        }
+    }
+    if(filling) {
+        emit_loop_end(&e, loop);
+    }
+
+    emit(&e, JMP, config->exec, 2);
+    return e.len <= code_max ? e.len : 0;
+}
+
+size_t copy_gen_chunk(const copy_gen_config_t *config,
+                      const uint8_t *image,
+                      size_t size,
+                      size_t offset,
+                      uint8_t *code) {
+    const uint8_t *chunk = image + offset;
+    size_t len = size - offset;
+    if(len > COPY_GEN_CHUNK_SIZE) {
+        len = COPY_GEN_CHUNK_SIZE;
+    }
+
+    // Counting sort of the chunk's offsets by value, keeping them in order within each value
+    uint16_t starts[256] = {0};
+    for(size_t i = 0; i < len; i++) {
+        starts[chunk[i]]++;
+    }
+    uint16_t total = 0;
+    for(unsigned value = 0; value < 256; value++) {
+        uint16_t count = starts[value];
+        starts[value] = total;
+        total += count;
+    }
+    for(size_t i = 0; i < len; i++) {
+        chunk_order[starts[chunk[i]]++] = i;
+    }
+
+    emitter_t e = {code, 0, COPY_GEN_CHUNK_CODE_MAX, config->origin};
+    uint32_t start = config->dest + offset;
+    bool under_io = start < IO_END && IO_START < start + len;
+    if(under_io) {
+        emit(&e, LDA_IMM, CPU_PORT_NO_IO, 1);
+        emit(&e, STA_ZP, CPU_PORT, 1);
+    }
+    for(size_t i = 0; i < len; i++) {
+        if(i == 0 || chunk[chunk_order[i]] != chunk[chunk_order[i - 1]]) {
+            emit(&e, LDA_IMM, chunk[chunk_order[i]], 1);
+        }
+        emit(&e, STA_ABS, config->dest + offset + chunk_order[i], 2);
+    }
+    if(under_io) {
+        // The stubs flash the border, so bank I/O back in first
+        emit(&e, LDA_IMM, CPU_PORT_DEFAULT, 1);
+        emit(&e, STA_ZP, CPU_PORT, 1);
+    }
+
+    // The first stub moves on to the next chunk, the second finishes
+    bool last = offset + len >= size;
+    emit(&e, JMP, config->stubs + (last ? COPY_GEN_STUBS_SIZE / 2 : 0), 2);
+    return e.len;
+}
+
+void copy_gen_stubs(const copy_gen_config_t *config, uint8_t *code) {
+    emitter_t e = {code, 0, COPY_GEN_STUBS_SIZE, config->stubs};
+    const uint16_t targets[2] = {config->origin, config->exec};
+    for(int i = 0; i < 2; i++) {
+        emit(&e, LDA_ABS, config->command_area + config->next_page, 2);
+        uint16_t wait = emit_pc(&e);
+        emit(&e, LDA_ABS, config->command_area, 2);
+        emit(&e, STA_ABS, BORDER_COLOR, 2);  // flash border if the pico's cpu is busy
+        emit(&e, BNE, wait - (emit_pc(&e) + 2), 1);
+        emit(&e, JMP, targets[i], 2);
+    }
+}
@@ -0,0 +1,67 @@
+// vim: ts=4:sw=4:sts=4:et
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Generates a 6502 routine that copies one particular image into C64 RAM, so the C64 can run
+// it straight from the ROM window instead of a generic copy loop.
+//
+// The image is split into COPY_GEN_SECTION_SIZE byte sections.  Sections that are one byte
+// repeated are filled from a register, and never go through the window.  The rest are packed
+// into a stream of windows, and each window is copied with lda abs,x / sta abs,x straight to
+// the sections' final addresses.  The routine waits for the Pico to be ready before each
+// window and sends next_page after it, so the stream wraps back to the start at the end.
+//
+// The immediate layout goes further: the data is sent as the operands of the routine itself.
+// Each COPY_GEN_CHUNK_SIZE byte chunk of the image becomes an lda # for each value in it,
+// followed by a sta abs for each byte with that value, so most bytes cost 4 cycles.  The Pico
+// generates one chunk at a time into the same place, and the C64 waits in one of the stubs
+// (see copy_gen_stubs) while it does.  A chunk that goes under the I/O area at $D000-$DFFF
+// banks I/O out with the CPU port while it stores, so the data goes to the RAM underneath.
+//
+// tools/copy_gen.py emits byte-identical code for the loader simulator.
+
+#define COPY_GEN_SECTION_SIZE 32
+#define COPY_GEN_CHUNK_SIZE 2048
+
+// Largest routine for one chunk: a sta abs for every byte, an lda # for every value, banking
+// I/O out and in, and a jmp
+#define COPY_GEN_CHUNK_CODE_MAX (COPY_GEN_CHUNK_SIZE * 3 + 256 * 2 + 8 + 3)
+
+// Two stubs that send next_page, wait for the Pico, and jump to the next chunk or exec
+#define COPY_GEN_STUBS_SIZE 28
+
+typedef struct {
+    uint16_t dest;          // C64 address to copy the image to
+    uint16_t exec;          // C64 address to jump to when it's copied
+    uint16_t origin;        // C64 address the routine runs from
+    uint16_t window;        // C64 address of the window the stream is paged through
+    uint16_t window_size;
+    uint16_t command_area;  // C64 address of the command area (status at offset 0)
+    uint8_t next_page;      // command that moves the window on to the next part of the stream
+    uint16_t stubs;         // C64 address of the stubs (immediate layout only)
+} copy_gen_config_t;
+
+// Generate the routine for an image into code, and the data it reads through the window into
+// stream (which must be as big as the image).  Returns the size of the routine, or 0 if the
+// image size isn't a multiple of COPY_GEN_SECTION_SIZE or the routine is bigger than code_max.
+size_t copy_gen_build(const copy_gen_config_t *config,
+                      const uint8_t *image,
+                      size_t size,
+                      uint8_t *code,
+                      size_t code_max,
+                      uint8_t *stream,
+                      size_t *stream_size);
+
+// Generate the immediate layout's routine for the chunk of the image starting at offset into
+// code, which must hold COPY_GEN_CHUNK_CODE_MAX bytes.  Returns the size of the routine.
+size_t copy_gen_chunk(const copy_gen_config_t *config,
+                      const uint8_t *image,
+                      size_t size,
+                      size_t offset,
+                      uint8_t *code);
+
+// Generate the stubs that the immediate layout's chunks end in.  code must hold
+// COPY_GEN_STUBS_SIZE bytes, and not be rewritten while the C64 is loading.
+void copy_gen_stubs(const copy_gen_config_t *config, uint8_t *code);
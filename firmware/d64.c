@@ -0,0 +1,154 @@
+// vim: ts=4:sw=4:sts=4:et
+#include <stdbool.h>
+
+#include "d64.h"
+
+// Image sizes: 35 or 40 tracks, with or without an error byte per sector
+static const size_t D64_35_TRACKS = 174848;
+static const size_t D64_35_TRACKS_ERRORS = 175531;
+static const size_t D64_40_TRACKS = 196608;
+static const size_t D64_40_TRACKS_ERRORS = 197376;
+static const unsigned MAX_SECTORS = 768;  // in a 40 track image, to stop chains that loop
+
+static const unsigned DIRECTORY_TRACK = 18;
+static const unsigned ENTRIES_PER_SECTOR = 8;
+static const unsigned ENTRY_SIZE = 32;
+static const uint8_t TYPE_CLOSED_PRG = 0x82;
+static const uint8_t NAME_PADDING = 0xa0;
+
+
+static unsigned sectors_in_track(unsigned track) {
+    if(track <= 17) {
+        return 21;
+    } else if(track <= 24) {
+        return 19;
+    } else if(track <= 30) {
+        return 18;
+    }
+    return 17;
+}
+
+static unsigned image_tracks(size_t image_size) {
+    if(image_size == D64_35_TRACKS || image_size == D64_35_TRACKS_ERRORS) {
+        return 35;
+    } else if(image_size == D64_40_TRACKS || image_size == D64_40_TRACKS_ERRORS) {
+        return 40;
+    }
+    return 0;
+}
+
+long d64_sector_offset(size_t image_size, unsigned track, unsigned sector) {
+    if(track < 1 || track > image_tracks(image_size) || sector >= sectors_in_track(track)) {
+        return -1;
+    }
+    long offset = 0;
+    for(unsigned t = 1; t < track; t++) {
+        offset += sectors_in_track(t) * D64_SECTOR_SIZE;
+    }
+    return offset + sector * D64_SECTOR_SIZE;
+}
+
+// True if a directory entry's name (padded with $A0) matches the pattern
+static bool name_matches(const uint8_t *name, const char *pattern, size_t pattern_len) {
+    size_t i = 0;
+    for(; i < pattern_len; i++) {
+        uint8_t c = pattern[i];
+        if(c == '*') {
+            return true;
+        }
+        if(i == D64_NAME_MAX || name[i] == NAME_PADDING || (c != '?' && c != name[i])) {
+            return false;
+        }
+    }
+    return i == D64_NAME_MAX || name[i] == NAME_PADDING;
+}
+
+d64_error_t d64_find(const uint8_t *image,
+                     size_t image_size,
+                     const char *pattern,
+                     size_t pattern_len,
+                     d64_entry_t *entry) {
+    long bam = d64_sector_offset(image_size, DIRECTORY_TRACK, 0);
+    if(bam < 0) {
+        return D64_BAD_IMAGE;
+    }
+
+    // The BAM points to the first directory sector
+    unsigned track = image[bam];
+    unsigned sector = image[bam + 1];
+    for(unsigned visited = 0; track != 0; visited++) {
+        long offset = d64_sector_offset(image_size, track, sector);
+        if(offset < 0 || visited == MAX_SECTORS) {
+            return D64_BAD_CHAIN;
+        }
+        for(unsigned i = 0; i < ENTRIES_PER_SECTOR; i++) {
+            const uint8_t *e = image + offset + i * ENTRY_SIZE;
+            if(e[2] != TYPE_CLOSED_PRG || !name_matches(e + 5, pattern, pattern_len)) {
+                continue;
+            }
+            entry->type = e[2];
+            entry->track = e[3];
+            entry->sector = e[4];
+            entry->blocks = e[30] | (e[31] << 8);
+            unsigned n = 0;
+            for(; n < D64_NAME_MAX && e[5 + n] != NAME_PADDING; n++) {
+                entry->name[n] = e[5 + n];
+            }
+            entry->name[n] = '\0';
+            return D64_OK;
+        }
+        track = image[offset];
+        sector = image[offset + 1];
+    }
+    return D64_NOT_FOUND;
+}
+
+d64_error_t d64_read(const uint8_t *image,
+                     size_t image_size,
+                     const d64_entry_t *entry,
+                     uint8_t *out,
+                     size_t out_max,
+                     size_t *out_size) {
+    unsigned track = entry->track;
+    unsigned sector = entry->sector;
+    *out_size = 0;
+    for(unsigned visited = 0; ; visited++) {
+        long offset = d64_sector_offset(image_size, track, sector);
+        if(offset < 0 || visited == MAX_SECTORS) {
+            return D64_BAD_CHAIN;
+        }
+        const uint8_t *s = image + offset;
+
+        // The last sector has track 0, and the index of its last byte instead of a sector
+        size_t len = s[0] ? D64_SECTOR_SIZE - 2 : (s[1] >= 1 ? s[1] - 1 : 0);
+        if(*out_size + len > out_max) {
+            return D64_TOO_BIG;
+        }
+        for(size_t i = 0; i < len; i++) {
+            out[*out_size + i] = s[2 + i];
+        }
+        *out_size += len;
+
+        if(s[0] == 0) {
+            return D64_OK;
+        }
+        track = s[0];
+        sector = s[1];
+    }
+}
+
+const char *d64_error_name(d64_error_t error) {
+    switch(error) {
+        case D64_OK:
+            return "ok";
+        case D64_BAD_IMAGE:
+            return "not a .d64 image";
+        case D64_NOT_FOUND:
+            return "file not found";
+        case D64_BAD_CHAIN:
+            return "broken sector chain";
+        case D64_TOO_BIG:
+            return "file too big";
+    }
+    return "unknown error";
+}
@@ -0,0 +1,57 @@
+// vim: ts=4:sw=4:sts=4:et
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Reading files from .d64 disk images, for LOAD through the ILOAD hook.
+//
+// A .d64 is the 1541's sectors in order: tracks 1-17 have 21 sectors, 18-24 have 19, 25-30
+// have 18 and 31-40 have 17, 256 bytes each.  35 and 40 track images are accepted, with or
+// without the error bytes on the end.  The directory is a chain of sectors on track 18, each
+// with 8 entries.  Each file is a chain of sectors where the first two bytes are the track and
+// sector of the next, or 0 and the index of the last byte in the last sector.
+//
+// tools/d64.py builds images and walks them with the same rules, and tools/d64_test.py runs
+// this file on the host against it.
+
+#define D64_SECTOR_SIZE 256
+#define D64_NAME_MAX 16
+
+typedef enum {
+    D64_OK = 0,
+    D64_BAD_IMAGE,      // not the size of a .d64
+    D64_NOT_FOUND,      // no PRG matches the name
+    D64_BAD_CHAIN,      // a sector chain goes off the disk or loops
+    D64_TOO_BIG,        // the file doesn't fit the buffer
+} d64_error_t;
+
+typedef struct {
+    uint8_t track;      // first sector of the file
+    uint8_t sector;
+    uint8_t type;       // file type byte: 0x82 for a closed PRG
+    uint16_t blocks;    // size in sectors, from the directory
+    char name[D64_NAME_MAX + 1];  // PETSCII, without the $A0 padding
+} d64_entry_t;
+
+// Byte offset of a sector in an image of image_size bytes, or -1 if there's no such sector
+long d64_sector_offset(size_t image_size, unsigned track, unsigned sector);
+
+// Find the first PRG whose name matches pattern, like the 1541 does for LOAD: "?" matches any
+// character, and "*" matches the rest of the name.
+d64_error_t d64_find(const uint8_t *image,
+                     size_t image_size,
+                     const char *pattern,
+                     size_t pattern_len,
+                     d64_entry_t *entry);
+
+// Read a file's data, including its load address, into out.
+d64_error_t d64_read(const uint8_t *image,
+                     size_t image_size,
+                     const d64_entry_t *entry,
+                     uint8_t *out,
+                     size_t out_max,
+                     size_t *out_size);
+
+// What went wrong, in the lower case text tools/d64.py uses too
+const char *d64_error_name(d64_error_t error);
@@ -0,0 +1,53 @@
+// vim: ts=4:sw=4:sts=4:et
+#include <stdbool.h>
+
+#include "hardware/dma.h"
+
+#include "dma_crc.h"
+
+static const uint32_t CRC32_SEED = 0xffffffff;
+
+// Channels 0 and 1 are the read chain (see hal_pico.h)
+static const uint crc_channel = 2;
+
+// Write target for dma_crc32(), which only needs the sniffer to see the data
+static uint8_t crc_sink;
+
+
+void dma_crc_init() {
+    dma_channel_claim(crc_channel);
+}
+
+static uint32_t run_crc_transfer(void *dst, bool write_increment, const void *src, size_t len) {
+    dma_channel_config config = dma_channel_get_default_config(crc_channel);
+    channel_config_set_read_increment(&config, true);
+    channel_config_set_write_increment(&config, write_increment);
+    channel_config_set_transfer_data_size(&config, DMA_SIZE_8);
+    channel_config_set_sniff_enable(&config, true);
+
+    // CRC-32 with bit-reversed input, then reverse and invert the result to match zlib
+    dma_hw->sniff_data = CRC32_SEED;
+    dma_sniffer_enable(crc_channel, DMA_SNIFF_CTRL_CALC_VALUE_CRC32R, false);
+    hw_set_bits(&dma_hw->sniff_ctrl, DMA_SNIFF_CTRL_OUT_REV_BITS | DMA_SNIFF_CTRL_OUT_INV_BITS);
+
+    dma_channel_configure(crc_channel,
+                          &config,
+                          dst,
+                          src,
+                          len,
+                          true);  // start now
+    dma_channel_wait_for_finish_blocking(crc_channel);
+
+    // OUT_REV and OUT_INV only apply when reading the result back
+    uint32_t crc = dma_hw->sniff_data;
+    dma_sniffer_disable();
+    return crc;
+}
+
+uint32_t dma_copy_crc32(void *dst, const void *src, size_t len) {
+    return run_crc_transfer(dst, true, src, len);
+}
+
+uint32_t dma_crc32(const void *src, size_t len) {
+    return run_crc_transfer(&crc_sink, false, src, len);
+}
@@ -0,0 +1,21 @@
+// vim: ts=4:sw=4:sts=4:et
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// CRC-32 using the DMA sniffer, so data can be checked while it's copied instead of in a
+// separate CPU pass.
+//
+// The sniffer is configured to give the same result as zlib's crc32(): polynomial 0x04C11DB7,
+// bit-reversed input and output, seed 0xffffffff and inverted output.
+// tools/crc32.py works the same sums out in software.
+
+// Claim the DMA channel used for CRC transfers
+void dma_crc_init();
+
+// Copy len bytes from src to dst with DMA, returning the CRC-32 of the data
+uint32_t dma_copy_crc32(void *dst, const void *src, size_t len);
+
+// Compute the CRC-32 of len bytes at src with DMA, without copying them anywhere
+uint32_t dma_crc32(const void *src, size_t len);
@@ -0,0 +1,324 @@
+// vim: ts=4:sw=4:sts=4:et
+#include <string.h>
+
+#include "flash_store.h"
+
+static const uint32_t SECTOR_MAGIC = 0x31535346;  // "FSS1"
+static const uint32_t RECORD_MAGIC = 0x31525346;  // "FSR1"
+
+// First page of each sector
+typedef struct {
+    uint32_t magic;
+    uint32_t sequence;
+} sector_header_t;
+
+// Start of each record, followed by the data.  Records always start on a page boundary.
+typedef struct {
+    uint32_t magic;
+    uint32_t key;
+    uint32_t length;
+    uint32_t crc;
+} record_header_t;
+
+// Where a record was found
+typedef struct {
+    uint32_t sector;
+    uint32_t offset;
+    record_header_t header;
+} record_location_t;
+
+// Staging buffer for programming one page at a time
+static uint8_t page_buffer[FLASH_STORE_PAGE_SIZE];
+
+
+// CRC-32 (same as zlib) so a record that was cut off by a power loss can be ignored
+static uint32_t crc32_update(uint32_t crc, const uint8_t *data, size_t len) {
+    crc = ~crc;
+    for(size_t i = 0; i < len; i++) {
+        crc ^= data[i];
+        for(int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xedb88320 & -(crc & 1));
+        }
+    }
+    return ~crc;
+}
+
+static uint32_t record_pages(uint32_t length) {
+    return (sizeof(record_header_t) + length + FLASH_STORE_PAGE_SIZE - 1) / FLASH_STORE_PAGE_SIZE;
+}
+
+static uint32_t sector_base(uint32_t sector) {
+    return sector * FLASH_STORE_SECTOR_SIZE;
+}
+
+static void store_read(flash_store_t *store, uint32_t offset, void *data, size_t len) {
+    store->backend->read(store->backend->context, offset, data, len);
+}
+
+static void program_page(flash_store_t *store, uint32_t offset) {
+    store->backend->program(store->backend->context, offset, page_buffer, FLASH_STORE_PAGE_SIZE);
+}
+
+// Read a sector's sequence number, returning false if it has no valid header
+static bool sector_sequence(flash_store_t *store, uint32_t sector, uint32_t *sequence) {
+    sector_header_t header;
+    store_read(store, sector_base(sector), &header, sizeof(header));
+    *sequence = header.sequence;
+    return header.magic == SECTOR_MAGIC;
+}
+
+static bool page_is_erased(flash_store_t *store, uint32_t offset) {
+    store_read(store, offset, page_buffer, FLASH_STORE_PAGE_SIZE);
+    for(int i = 0; i < FLASH_STORE_PAGE_SIZE; i++) {
+        if(page_buffer[i] != 0xff) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool sector_is_erased(flash_store_t *store, uint32_t sector) {
+    for(uint32_t offset = 0; offset < FLASH_STORE_SECTOR_SIZE; offset += FLASH_STORE_PAGE_SIZE) {
+        if(!page_is_erased(store, sector_base(sector) + offset)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Read the record header at offset into a sector.  Returns false at the end of the records.
+static bool read_record_header(flash_store_t *store,
+                               uint32_t sector,
+                               uint32_t offset,
+                               record_header_t *header) {
+    if(offset + FLASH_STORE_PAGE_SIZE > FLASH_STORE_SECTOR_SIZE) {
+        return false;
+    }
+    store_read(store, sector_base(sector) + offset, header, sizeof(*header));
+    // Anything other than a record is either erased flash or a partly written header
+    return header->magic == RECORD_MAGIC && header->length <= FLASH_STORE_MAX_RECORD;
+}
+
+static bool record_crc_ok(flash_store_t *store,
+                          uint32_t sector,
+                          uint32_t offset,
+                          const record_header_t *header) {
+    uint32_t crc = 0;
+    uint32_t data_offset = sector_base(sector) + offset + sizeof(record_header_t);
+    for(uint32_t done = 0; done < header->length; done += FLASH_STORE_PAGE_SIZE) {
+        uint32_t len = header->length - done;
+        if(len > FLASH_STORE_PAGE_SIZE) {
+            len = FLASH_STORE_PAGE_SIZE;
+        }
+        store_read(store, data_offset + done, page_buffer, len);
+        crc = crc32_update(crc, page_buffer, len);
+    }
+    return crc == header->crc;
+}
+
+// Find the newest intact record for a key, searching sectors from oldest to newest
+static bool find_latest(flash_store_t *store, uint32_t key, record_location_t *found) {
+    uint32_t sector_count = store->backend->sector_count;
+    bool any = false;
+    for(uint32_t i = 1; i <= sector_count; i++) {
+        uint32_t sector = (store->head_sector + i) % sector_count;
+        uint32_t sequence;
+        if(!sector_sequence(store, sector, &sequence)) {
+            continue;
+        }
+        record_header_t header;
+        uint32_t offset = FLASH_STORE_PAGE_SIZE;
+        while(read_record_header(store, sector, offset, &header)) {
+            if(header.key == key && record_crc_ok(store, sector, offset, &header)) {
+                found->sector = sector;
+                found->offset = offset;
+                found->header = header;
+                any = true;
+            }
+            offset += record_pages(header.length) * FLASH_STORE_PAGE_SIZE;
+        }
+    }
+    return any;
+}
+
+static void write_sector_header(flash_store_t *store, uint32_t sector, uint32_t sequence) {
+    memset(page_buffer, 0xff, sizeof(page_buffer));
+    sector_header_t header = {SECTOR_MAGIC, sequence};
+    memcpy(page_buffer, &header, sizeof(header));
+    program_page(store, sector_base(sector));
+}
+
+// Copy a record's pages verbatim to the end of the head sector
+static void copy_record(flash_store_t *store, const record_location_t *record) {
+    uint32_t pages = record_pages(record->header.length);
+    for(uint32_t page = 0; page < pages; page++) {
+        store_read(store,
+                   sector_base(record->sector) + record->offset + page * FLASH_STORE_PAGE_SIZE,
+                   page_buffer,
+                   FLASH_STORE_PAGE_SIZE);
+        program_page(store, sector_base(store->head_sector) + store->head_offset);
+        store->head_offset += FLASH_STORE_PAGE_SIZE;
+    }
+}
+
+// Go through the live records in a sector, copying them to the end of the head sector if copy
+// is set, and return the space they take up.  Deletions aren't live, since the sector is the
+// oldest and there's nothing older left for them to hide.
+static uint32_t live_records(flash_store_t *store, uint32_t sector, bool copy) {
+    uint32_t sequence;
+    if(!sector_sequence(store, sector, &sequence)) {
+        return 0;
+    }
+    uint32_t live = 0;
+    record_header_t header;
+    uint32_t offset = FLASH_STORE_PAGE_SIZE;
+    while(read_record_header(store, sector, offset, &header)) {
+        record_location_t latest;
+        uint32_t size = record_pages(header.length) * FLASH_STORE_PAGE_SIZE;
+        if(header.length > 0 &&
+           find_latest(store, header.key, &latest) &&
+           latest.sector == sector &&
+           latest.offset == offset) {
+            if(copy) {
+                copy_record(store, &latest);
+            }
+            live += size;
+        }
+        offset += size;
+    }
+    return live;
+}
+
+// Move the live records out of the spare, the oldest sector, into the head sector, then erase
+// it.
+//
+// Until the spare is erased the head holds nothing but copies of its records, which fit in a
+// sector since they came from one.  If power is lost part way through, flash_store_mount()
+// collects the spare again, skipping the records already copied since the copies are newer.
+// A copy that was cut off can leave too little room for the rest, and then the head is erased
+// and the collection starts over, as the spare still has everything.
+static void collect_spare(flash_store_t *store) {
+    uint32_t spare = (store->head_sector + 1) % store->backend->sector_count;
+    if(live_records(store, spare, false) > FLASH_STORE_SECTOR_SIZE - store->head_offset) {
+        store->backend->erase(store->backend->context, store->head_sector);
+        write_sector_header(store, store->head_sector, store->sequence);
+        store->head_offset = FLASH_STORE_PAGE_SIZE;
+    }
+    live_records(store, spare, true);
+    store->backend->erase(store->backend->context, spare);
+}
+
+// Start appending to the spare sector, and collect the oldest sector to be the new spare
+static void advance(flash_store_t *store) {
+    uint32_t sector_count = store->backend->sector_count;
+    store->head_sector = (store->head_sector + 1) % sector_count;
+    store->head_offset = FLASH_STORE_PAGE_SIZE;
+    store->sequence++;
+    write_sector_header(store, store->head_sector, store->sequence);
+
+    collect_spare(store);
+}
+
+void flash_store_mount(flash_store_t *store, const flash_store_backend_t *backend) {
+    store->backend = backend;
+    uint32_t sector_count = backend->sector_count;
+
+    // The head is the sector with the highest sequence number
+    bool found = false;
+    for(uint32_t sector = 0; sector < sector_count; sector++) {
+        uint32_t sequence;
+        if(sector_sequence(store, sector, &sequence) && (!found || sequence > store->sequence)) {
+            store->head_sector = sector;
+            store->sequence = sequence;
+            found = true;
+        }
+    }
+
+    if(!found) {
+        // Empty store: start at sector 0, with sector 1 as the spare
+        store->head_sector = 0;
+        store->sequence = 1;
+        backend->erase(backend->context, 0);
+        write_sector_header(store, 0, store->sequence);
+        if(!sector_is_erased(store, 1)) {
+            backend->erase(backend->context, 1);
+        }
+        store->head_offset = FLASH_STORE_PAGE_SIZE;
+        return;
+    }
+
+    record_header_t header;
+    store->head_offset = FLASH_STORE_PAGE_SIZE;
+    while(read_record_header(store, store->head_sector, store->head_offset, &header)) {
+        store->head_offset += record_pages(header.length) * FLASH_STORE_PAGE_SIZE;
+    }
+    // A partly written record header would leave a page that isn't erased, even if its magic
+    // is; skip past it
+    if(store->head_offset < FLASH_STORE_SECTOR_SIZE &&
+       !page_is_erased(store, sector_base(store->head_sector) + store->head_offset)) {
+        store->head_offset = FLASH_STORE_SECTOR_SIZE;
+    }
+
+    // Finish collecting the spare if we lost power while doing it
+    if(!sector_is_erased(store, (store->head_sector + 1) % sector_count)) {
+        collect_spare(store);
+    }
+}
+
+flash_store_result_t flash_store_put(flash_store_t *store,
+                                     uint32_t key,
+                                     const void *data,
+                                     size_t len) {
+    if(len > FLASH_STORE_MAX_RECORD) {
+        return FLASH_STORE_TOO_BIG;
+    }
+
+    uint32_t size = record_pages(len) * FLASH_STORE_PAGE_SIZE;
+    uint32_t sector_count = store->backend->sector_count;
+    for(uint32_t tries = 0; store->head_offset + size > FLASH_STORE_SECTOR_SIZE; tries++) {
+        // If we've been around the whole ring without making room, the live data fills it
+        if(tries == sector_count) {
+            return FLASH_STORE_FULL;
+        }
+        advance(store);
+    }
+
+    record_header_t header = {RECORD_MAGIC, key, len, crc32_update(0, data, len)};
+    const uint8_t *src = data;
+    size_t header_len = sizeof(header);
+    for(uint32_t done = 0; done < size; done += FLASH_STORE_PAGE_SIZE) {
+        memset(page_buffer, 0xff, sizeof(page_buffer));
+        memcpy(page_buffer, &header, header_len);
+        size_t chunk = FLASH_STORE_PAGE_SIZE - header_len;
+        if(chunk > len) {
+            chunk = len;
+        }
+        memcpy(page_buffer + header_len, src, chunk);
+        src += chunk;
+        len -= chunk;
+        header_len = 0;
+        program_page(store, sector_base(store->head_sector) + store->head_offset);
+        store->head_offset += FLASH_STORE_PAGE_SIZE;
+    }
+    return FLASH_STORE_OK;
+}
+
+flash_store_result_t flash_store_get(flash_store_t *store,
+                                     uint32_t key,
+                                     void *data,
+                                     size_t max_len,
+                                     size_t *len) {
+    record_location_t record;
+    if(!find_latest(store, key, &record) || record.header.length == 0) {
+        return FLASH_STORE_NOT_FOUND;
+    }
+    if(record.header.length > max_len) {
+        return FLASH_STORE_TOO_BIG;
+    }
+    store_read(store,
+         sector_base(record.sector) + record.offset + sizeof(record_header_t),
+         data,
+         record.header.length);
+    *len = record.header.length;
+    return FLASH_STORE_OK;
+}
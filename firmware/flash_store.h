@@ -0,0 +1,67 @@
+// vim: ts=4:sw=4:sts=4:et
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Append-only key/value store in flash.
+//
+// The store is a ring of erase sectors.  Records are appended to the head sector, and a newer
+// record for a key replaces any older ones.  When the head is full, the store moves on to the
+// next sector, and copies the live records out of the oldest sector so it can be erased.
+// Every sector gets erased in turn, which spreads the wear evenly.
+//
+// One erased sector is always kept spare, so at most (sector_count - 2) sectors of live data
+// can be stored.
+//
+// This file doesn't touch the hardware: all flash access goes through a backend, so the store
+// can run against the real flash (flash_store_pico.c) or a RAM buffer.
+
+#define FLASH_STORE_SECTOR_SIZE 4096
+#define FLASH_STORE_PAGE_SIZE 256
+
+// Largest record that fits in a sector, after the sector header page and the record header
+#define FLASH_STORE_MAX_RECORD (FLASH_STORE_SECTOR_SIZE - FLASH_STORE_PAGE_SIZE - 16)
+
+typedef struct {
+    uint32_t sector_count;
+    void *context;
+
+    // Erase one sector to 0xff
+    void (*erase)(void *context, uint32_t sector);
+    // Program whole pages.  offset and len are multiples of FLASH_STORE_PAGE_SIZE.
+    void (*program)(void *context, uint32_t offset, const uint8_t *data, size_t len);
+    // Read any range
+    void (*read)(void *context, uint32_t offset, uint8_t *data, size_t len);
+} flash_store_backend_t;
+
+typedef struct {
+    const flash_store_backend_t *backend;
+    uint32_t head_sector;  // sector being appended to
+    uint32_t head_offset;  // offset of the next free page in the head sector
+    uint32_t sequence;     // sequence number of the head sector
+} flash_store_t;
+
+typedef enum {
+    FLASH_STORE_OK = 0,
+    FLASH_STORE_NOT_FOUND,
+    FLASH_STORE_TOO_BIG,  // record is bigger than FLASH_STORE_MAX_RECORD or the caller's buffer
+    FLASH_STORE_FULL,     // live records don't leave enough room to free a sector
+} flash_store_result_t;
+
+// Find the head of the log, formatting the store if it's empty
+void flash_store_mount(flash_store_t *store, const flash_store_backend_t *backend);
+
+// Append a record.  Writing a zero length record deletes the key.
+flash_store_result_t flash_store_put(flash_store_t *store,
+                                     uint32_t key,
+                                     const void *data,
+                                     size_t len);
+
+// Read the newest record for a key into data, setting *len to its length
+flash_store_result_t flash_store_get(flash_store_t *store,
+                                     uint32_t key,
+                                     void *data,
+                                     size_t max_len,
+                                     size_t *len);
@@ -0,0 +1,77 @@
+// vim: ts=4:sw=4:sts=4:et
+#include <assert.h>
+#include <string.h>
+
+#include "hardware/flash.h"
+#include "hardware/sync.h"
+#include "pico/multicore.h"
+#include "pico/stdlib.h"
+
+#include "flash_store_pico.h"
+
+static_assert(FLASH_STORE_SECTOR_SIZE == FLASH_SECTOR_SIZE, "store sectors must be erase sectors");
+static_assert(FLASH_STORE_PAGE_SIZE == FLASH_PAGE_SIZE, "store pages must be program pages");
+
+// Offset of the store from the start of flash
+#define STORE_OFFSET (PICO_FLASH_SIZE_BYTES - FLASH_STORE_PICO_SECTORS * FLASH_SECTOR_SIZE)
+
+static volatile char *busy;
+static volatile bool lockout_core1;
+
+
+// The SDK's flash_range_* functions run from RAM, but any interrupt handler would be fetched
+// from flash, and so would whatever core 1 is running, so core 1 is parked in a RAM handler and
+// nothing else runs on this core until they return
+static uint32_t begin_write() {
+    if(busy) {
+        *busy = 0xff;
+    }
+    if(lockout_core1) {
+        multicore_lockout_start_blocking();
+    }
+    return save_and_disable_interrupts();
+}
+
+static void end_write(uint32_t interrupts) {
+    restore_interrupts(interrupts);
+    if(lockout_core1) {
+        multicore_lockout_end_blocking();
+    }
+    if(busy) {
+        *busy = 0x00;
+    }
+}
+
+static void pico_erase(void *context, uint32_t sector) {
+    uint32_t interrupts = begin_write();
+    flash_range_erase(STORE_OFFSET + sector * FLASH_SECTOR_SIZE, FLASH_SECTOR_SIZE);
+    end_write(interrupts);
+}
+
+static void pico_program(void *context, uint32_t offset, const uint8_t *data, size_t len) {
+    uint32_t interrupts = begin_write();
+    flash_range_program(STORE_OFFSET + offset, data, len);
+    end_write(interrupts);
+}
+
+// Reads go through XIP, which is flushed by flash_range_erase/program
+static void pico_read(void *context, uint32_t offset, uint8_t *data, size_t len) {
+    memcpy(data, (const uint8_t *)(XIP_BASE + STORE_OFFSET + offset), len);
+}
+
+static const flash_store_backend_t pico_backend = {
+    .sector_count = FLASH_STORE_PICO_SECTORS,
+    .context = NULL,
+    .erase = pico_erase,
+    .program = pico_program,
+    .read = pico_read,
+};
+
+const flash_store_backend_t *flash_store_pico_backend(volatile char *busy_flag) {
+    busy = busy_flag;
+    return &pico_backend;
+}
+
+void flash_store_pico_lockout_core1(bool lockout) {
+    lockout_core1 = lockout;
+}
@@ -0,0 +1,27 @@
+// vim: ts=4:sw=4:sts=4:et
+#pragma once
+
+#include <stdbool.h>
+
+#include "flash_store.h"
+
+// Flash store backend for the Pico's own flash, using the last FLASH_STORE_PICO_SECTORS
+// sectors.
+//
+// While a sector is erased or a page is programmed, XIP is unavailable, so interrupts are
+// disabled and the CPU runs only the SDK's RAM-resident flash routines.  If core 1 is running
+// code from flash, it has to be told with flash_store_pico_lockout_core1(), and must have
+// called multicore_lockout_victim_init() so it can be held in RAM while the write goes on.
+// The PIO state machines and DMA keep serving the C64 from SRAM the whole time.
+//
+// busy_flag (if not NULL) is set to 0xff for the duration of each write and back to 0x00
+// afterwards.  Pointing it into the ROM window lets the C64 poll it without touching the
+// command area.
+
+#define FLASH_STORE_PICO_SECTORS 32
+
+const flash_store_backend_t *flash_store_pico_backend(volatile char *busy_flag);
+
+// Whether writes must hold core 1 with multicore_lockout_start_blocking() first.  Set it after
+// launching core 1, and clear it before resetting it.
+void flash_store_pico_lockout_core1(bool lockout);
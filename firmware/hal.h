@@ -0,0 +1,62 @@
+// vim: ts=4:sw=4:sts=4:et
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// The hardware that serving the C64 needs: the PIO programs that answer the bus, their state
+// machines' FIFOs, the DMA chain that feeds the read program, DMA copies, and the clock.
+//
+// Like the flash store's backend, this is a table of functions, so the state machine setup
+// (cart_bus.c), the command loop (command_loop.c) and the paging of the window (window.c) can
+// run against the Pico (hal_pico.c) or a simulation of it on the host (hal_host.c).
+// tools/host_bench.py builds them with the host backend into a Linux test and benchmark binary.
+
+// The programs that serve the bus, each from its .pio
+typedef enum {
+    HAL_PROGRAM_ADDRESS_DECODER,    // one state machine for each ROM line
+    HAL_PROGRAM_READ,
+    HAL_PROGRAM_COMMAND,
+    HAL_PROGRAMS,
+} hal_program_t;
+
+// The ROM line an address decoder watches
+typedef enum {
+    HAL_ROMH,
+    HAL_ROML,
+} hal_rom_line_t;
+
+typedef struct {
+    void *context;
+
+    // µs since boot
+    uint64_t (*time_us)(void *context);
+
+    // Load a program into instruction memory, returning its offset, or -1 if there's no room
+    int (*add_program)(void *context, hal_program_t program);
+    // Claim a free state machine, returning it, or -1 if there are none
+    int (*claim_sm)(void *context);
+    // Start a program at offset on a state machine.  An address decoder watches rom_line, and
+    // the read program serves from rom, which must be 16K aligned.
+    void (*start_sm)(void *context, hal_program_t program, unsigned sm, unsigned offset,
+                     hal_rom_line_t rom_line, const char *rom);
+    // Serve reads from another 16K aligned rom from now on.  Takes effect between two reads.
+    void (*set_read_base)(void *context, unsigned sm, unsigned offset, const char *rom);
+    // Turn an address decoder's command area on or off.  Off, reads there are served from rom.
+    void (*set_command_area)(void *context, unsigned sm, bool enabled);
+
+    bool (*rx_empty)(void *context, unsigned sm);
+    // Take a word from a state machine's RX FIFO, waiting for one
+    uint32_t (*rx_get)(void *context, unsigned sm);
+    void (*tx_put)(void *context, unsigned sm, uint32_t value);
+
+    // Start the DMA chain that answers each address the read program pushes with the byte there
+    void (*start_read_chain)(void *context, unsigned sm);
+    // Let the C64 see the programs' answers, or not.  Until then it reads open bus.
+    void (*enable_bus)(void *context, bool enabled);
+
+    // Copy len bytes, returning their CRC-32, or only return it (see dma_crc.h)
+    uint32_t (*copy_crc32)(void *context, void *dst, const void *src, size_t len);
+    uint32_t (*crc32)(void *context, const void *src, size_t len);
+} hal_t;
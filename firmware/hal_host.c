@@ -0,0 +1,253 @@
+// vim: ts=4:sw=4:sts=4:et
+#include <string.h>
+
+#include "hal_host.h"
+
+static const unsigned program_lengths[HAL_PROGRAMS] = {
+    [HAL_PROGRAM_ADDRESS_DECODER] = HAL_HOST_ADDRESS_DECODER_LENGTH,
+    [HAL_PROGRAM_READ] = HAL_HOST_READ_LENGTH,
+    [HAL_PROGRAM_COMMAND] = HAL_HOST_COMMAND_LENGTH,
+};
+
+// zlib's CRC-32, a byte at a time from a table built on first use
+static uint32_t crc_table[256];
+
+
+static bool fifo_push(hal_host_fifo_t *fifo, uint32_t value) {
+    if(fifo->count == HAL_HOST_FIFO_DEPTH) {
+        return false;
+    }
+    fifo->data[(fifo->head + fifo->count++) % HAL_HOST_FIFO_DEPTH] = value;
+    return true;
+}
+
+static bool fifo_pop(hal_host_fifo_t *fifo, uint32_t *value) {
+    if(fifo->count == 0) {
+        return false;
+    }
+    *value = fifo->data[fifo->head];
+    fifo->head = (fifo->head + 1) % HAL_HOST_FIFO_DEPTH;
+    fifo->count--;
+    return true;
+}
+
+static uint32_t crc32_update(uint32_t crc, const uint8_t *data, size_t len) {
+    if(!crc_table[1]) {
+        for(uint32_t i = 0; i < 256; i++) {
+            uint32_t c = i;
+            for(int bit = 0; bit < 8; bit++) {
+                c = c & 1 ? 0xedb88320 ^ (c >> 1) : c >> 1;
+            }
+            crc_table[i] = c;
+        }
+    }
+    crc = ~crc;
+    for(size_t i = 0; i < len; i++) {
+        crc = crc_table[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+// After each call through the HAL that changes what the state machines do
+static void called(void *context) {
+    hal_host_t *host = context;
+    if(host->on_call) {
+        host->on_call(host);
+    }
+}
+
+static uint64_t host_time_us(void *context) {
+    return ((hal_host_t *)context)->now_us;
+}
+
+static int host_add_program(void *context, hal_program_t program) {
+    hal_host_t *host = context;
+    if(program >= HAL_PROGRAMS
+            || host->instructions + program_lengths[program] > HAL_HOST_INSTRUCTIONS) {
+        return -1;
+    }
+    int offset = host->instructions;
+    host->instructions += program_lengths[program];
+    called(host);
+    return offset;
+}
+
+static int host_claim_sm(void *context) {
+    hal_host_t *host = context;
+    for(int sm = 0; sm < HAL_HOST_SMS; sm++) {
+        if(!host->sms[sm].claimed) {
+            host->sms[sm].claimed = true;
+            called(host);
+            return sm;
+        }
+    }
+    return -1;
+}
+
+static void host_start_sm(void *context, hal_program_t program, unsigned sm, unsigned offset,
+                          hal_rom_line_t rom_line, const char *rom) {
+    hal_host_sm_t *s = &((hal_host_t *)context)->sms[sm];
+    s->running = true;
+    s->program = program;
+    s->rom_line = rom_line;
+    s->command_area = true;
+    s->rom = rom;
+    called(context);
+}
+
+static void host_set_read_base(void *context, unsigned sm, unsigned offset, const char *rom) {
+    ((hal_host_t *)context)->sms[sm].rom = rom;
+    called(context);
+}
+
+static void host_set_command_area(void *context, unsigned sm, bool enabled) {
+    ((hal_host_t *)context)->sms[sm].command_area = enabled;
+    called(context);
+}
+
+static bool host_rx_empty(void *context, unsigned sm) {
+    return ((hal_host_t *)context)->sms[sm].rx.count == 0;
+}
+
+// Nothing else runs on the host to push one, so this returns 0 rather than wait forever
+static uint32_t host_rx_get(void *context, unsigned sm) {
+    uint32_t value = 0;
+    fifo_pop(&((hal_host_t *)context)->sms[sm].rx, &value);
+    return value;
+}
+
+static void host_tx_put(void *context, unsigned sm, uint32_t value) {
+    fifo_push(&((hal_host_t *)context)->sms[sm].tx, value);
+    called(context);
+}
+
+static void host_start_read_chain(void *context, unsigned sm) {
+    ((hal_host_t *)context)->read_chain_sm = sm;
+    called(context);
+}
+
+static void host_enable_bus(void *context, bool enabled) {
+    ((hal_host_t *)context)->bus_enabled = enabled;
+    called(context);
+}
+
+static uint32_t host_copy_crc32(void *context, void *dst, const void *src, size_t len) {
+    memcpy(dst, src, len);
+    called(context);
+    return crc32_update(0, dst, len);
+}
+
+static uint32_t host_crc32(void *context, const void *src, size_t len) {
+    return crc32_update(0, src, len);
+}
+
+void hal_host_init(hal_host_t *host) {
+    memset(host, 0, sizeof(*host));
+    host->read_chain_sm = -1;
+    host->hal = (hal_t){
+        .context = host,
+        .time_us = host_time_us,
+        .add_program = host_add_program,
+        .claim_sm = host_claim_sm,
+        .start_sm = host_start_sm,
+        .set_read_base = host_set_read_base,
+        .set_command_area = host_set_command_area,
+        .rx_empty = host_rx_empty,
+        .rx_get = host_rx_get,
+        .tx_put = host_tx_put,
+        .start_read_chain = host_start_read_chain,
+        .enable_bus = host_enable_bus,
+        .copy_crc32 = host_copy_crc32,
+        .crc32 = host_crc32,
+    };
+}
+
+static hal_host_sm_t *find_sm(hal_host_t *host, hal_program_t program) {
+    for(int sm = 0; sm < HAL_HOST_SMS; sm++) {
+        if(host->sms[sm].running && host->sms[sm].program == program) {
+            return &host->sms[sm];
+        }
+    }
+    return NULL;
+}
+
+// command.pio: locked, compare the last four commands with UNLOCK_MAGIC and drop the read.
+// Unlocked, queue the command unless it's 0, answer with the status, and take the ready token.
+static uint8_t command_read(hal_host_t *host, uint8_t command) {
+    hal_host_sm_t *sm = find_sm(host, HAL_PROGRAM_COMMAND);
+    if(!sm) {
+        host->unanswered_reads++;
+        return HAL_HOST_OPEN_BUS;
+    }
+    if(!host->unlocked) {
+        host->unlock_sequence = host->unlock_sequence << 8 | command;
+        if(host->unlock_sequence == HAL_HOST_UNLOCK_MAGIC) {
+            host->unlocked = true;
+        } else {
+            host->filtered_reads++;
+        }
+        return HAL_HOST_OPEN_BUS;
+    }
+    if(command && !fifo_push(&sm->rx, command)) {
+        host->dropped_commands++;
+    }
+    uint8_t status = sm->tx.count ? 0x00 : 0xff;
+    host->command_reads++;
+    if(status) {
+        host->busy_reads++;
+    }
+    if(command) {
+        uint32_t token;
+        fifo_pop(&sm->tx, &token);
+    }
+    return status;
+}
+
+// read.pio and the DMA chain: the address goes in the RX FIFO, the address channel takes it,
+// the read channel puts the byte there in the TX FIFO, and the program puts it on the bus
+static uint8_t rom_read(hal_host_t *host, uint16_t address) {
+    hal_host_sm_t *sm = find_sm(host, HAL_PROGRAM_READ);
+    if(!sm) {
+        host->unanswered_reads++;
+        return HAL_HOST_OPEN_BUS;
+    }
+    fifo_push(&sm->rx, address);
+    if(host->read_chain_sm == sm - host->sms) {
+        uint32_t queued = 0;
+        fifo_pop(&sm->rx, &queued);
+        fifo_push(&sm->tx, (uint8_t)sm->rom[queued & 0x3fff]);
+    }
+    uint32_t data;
+    if(!fifo_pop(&sm->tx, &data)) {
+        // The read program waits for the data that never comes, and the C64 moves on
+        sm->rx.count = 0;
+        host->unanswered_reads++;
+        return HAL_HOST_OPEN_BUS;
+    }
+    return data;
+}
+
+uint8_t hal_host_c64_read(hal_host_t *host, hal_rom_line_t rom_line, uint16_t address) {
+    host->reads++;
+    if(!host->bus_enabled) {
+        host->disabled_reads++;
+        return HAL_HOST_OPEN_BUS;
+    }
+    for(int i = 0; i < HAL_HOST_SMS; i++) {
+        hal_host_sm_t *decoder = &host->sms[i];
+        if(!decoder->running || decoder->program != HAL_PROGRAM_ADDRESS_DECODER
+                || decoder->rom_line != rom_line) {
+            continue;
+        }
+        if(decoder->command_area && (address >> 8 & 0x3f) == HAL_HOST_COMMAND_PREFIX) {
+            return command_read(host, address & 0xff);
+        }
+        return rom_read(host, address & 0x3fff);
+    }
+    host->unanswered_reads++;
+    return HAL_HOST_OPEN_BUS;
+}
+
+void hal_host_advance_us(hal_host_t *host, uint64_t us) {
+    host->now_us += us;
+}
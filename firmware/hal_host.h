@@ -0,0 +1,87 @@
+// vim: ts=4:sw=4:sts=4:et
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "hal.h"
+
+// Backend that simulates the Pico on the host, for tools/host_bench.py's test and benchmark
+// binary.
+//
+// The state machines are modelled by what the programs do, not instruction by instruction: a
+// read the C64 makes goes to the address decoder watching its ROM line, then either through the
+// read program's FIFOs and the DMA chain to the byte in its rom, or to the command program,
+// which starts locked like command.pio, answers with the status and queues commands in its RX
+// FIFO.  Until the bus is enabled the C64 reads open bus, like before PIN_IE goes low.  The
+// clock only moves when hal_host_advance_us moves it, so runs are repeatable.
+// Copies are memcpy with a software CRC-32 like dma_crc.c's.
+//
+// Only one PIO block is modelled, with its 4 state machines and 32 instructions.  The command
+// program isn't locked again after unlocking, since the guard that does that isn't behind the
+// HAL.
+//
+// on_call, if set, runs after each call through the HAL that changes what the state machines
+// do, so a simulated C64 can read between the steps of a start-up.
+
+#define HAL_HOST_SMS 4
+#define HAL_HOST_FIFO_DEPTH 4
+#define HAL_HOST_INSTRUCTIONS 32
+
+// From the .pio sources, checked against them by tools/host_bench_test.py
+#define HAL_HOST_ADDRESS_DECODER_LENGTH 10
+#define HAL_HOST_READ_LENGTH 6
+#define HAL_HOST_COMMAND_LENGTH 13
+#define HAL_HOST_COMMAND_PREFIX 0x1e        // COMMAND_PREFIX in address_decoder.pio
+#define HAL_HOST_UNLOCK_MAGIC 0x43363421    // UNLOCK_MAGIC in command.pio
+
+// What the C64 sees when nothing drives the bus
+#define HAL_HOST_OPEN_BUS 0xff
+
+typedef struct {
+    uint32_t data[HAL_HOST_FIFO_DEPTH];
+    unsigned head;
+    unsigned count;
+} hal_host_fifo_t;
+
+typedef struct {
+    bool claimed;
+    bool running;
+    hal_program_t program;
+    hal_rom_line_t rom_line;    // an address decoder's
+    bool command_area;          // an address decoder's: reads with the prefix are commands
+    const char *rom;            // the read program's
+    hal_host_fifo_t rx;
+    hal_host_fifo_t tx;
+} hal_host_sm_t;
+
+typedef struct hal_host hal_host_t;
+
+struct hal_host {
+    hal_t hal;                  // backed by this, for the code under test
+    hal_host_sm_t sms[HAL_HOST_SMS];
+    unsigned instructions;      // used by the programs added
+    int read_chain_sm;          // fed by the DMA chain, or -1 before it's started
+    uint64_t now_us;
+    uint32_t unlock_sequence;   // the last four commands read while locked
+    bool unlocked;
+    bool bus_enabled;
+    void (*on_call)(hal_host_t *host);
+
+    // What the C64 has seen
+    uint32_t reads;
+    uint32_t command_reads;     // answered, including status reads
+    uint32_t busy_reads;        // answered with the busy status
+    uint32_t filtered_reads;    // dropped while locked
+    uint32_t dropped_commands;  // with the RX FIFO full
+    uint32_t unanswered_reads;  // with nothing to answer them
+    uint32_t disabled_reads;    // before the bus was enabled
+};
+
+// A Pico with no programs loaded, at time 0
+void hal_host_init(hal_host_t *host);
+
+// The C64 reading address ($0000-$3FFF in the window) with rom_line low: the byte it gets
+uint8_t hal_host_c64_read(hal_host_t *host, hal_rom_line_t rom_line, uint16_t address);
+
+void hal_host_advance_us(hal_host_t *host, uint64_t us);
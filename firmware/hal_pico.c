@@ -0,0 +1,148 @@
+// vim: ts=4:sw=4:sts=4:et
+#include "hardware/dma.h"
+#include "pico/stdlib.h"
+
+#include "address_decoder.pio.h"
+#include "command.pio.h"
+#include "dma_crc.h"
+#include "hal_pico.h"
+#include "read.pio.h"
+
+static PIO pio;
+static hal_pico_pins_t pins;
+static const char *read_base;   // the read program's rom, for the read chain's first address
+
+
+static const pio_program_t *const programs[HAL_PROGRAMS] = {
+    [HAL_PROGRAM_ADDRESS_DECODER] = &address_decoder_program,
+    [HAL_PROGRAM_READ] = &read_program,
+    [HAL_PROGRAM_COMMAND] = &command_program,
+};
+
+static uint64_t pico_time_us(void *context) {
+    return time_us_64();
+}
+
+static int pico_add_program(void *context, hal_program_t program) {
+    if(!pio_can_add_program(pio, programs[program])) {
+        return -1;
+    }
+    return pio_add_program(pio, programs[program]);
+}
+
+static int pico_claim_sm(void *context) {
+    return pio_claim_unused_sm(pio, false);
+}
+
+static void pico_start_sm(void *context, hal_program_t program, unsigned sm, unsigned offset,
+                          hal_rom_line_t rom_line, const char *rom) {
+    switch(program) {
+        case HAL_PROGRAM_ADDRESS_DECODER:
+            address_decoder_program_init(pio, sm, offset, pins.a8, pins.rom[rom_line], pins.oe);
+            break;
+
+        case HAL_PROGRAM_READ:
+            read_base = rom;
+            read_program_init(pio, sm, offset, pins.d0, pins.a0, pins.oe, (char *)rom);
+            break;
+
+        case HAL_PROGRAM_COMMAND:
+            command_program_init(pio, sm, offset, pins.a0, pins.d0, pins.oe);
+            break;
+
+        default:
+            break;
+    }
+}
+
+static void pico_set_read_base(void *context, unsigned sm, unsigned offset, const char *rom) {
+    read_program_set_base(pio, sm, offset, rom);
+}
+
+static void pico_set_command_area(void *context, unsigned sm, bool enabled) {
+    address_decoder_set_command_area(pio, sm, enabled);
+}
+
+static bool pico_rx_empty(void *context, unsigned sm) {
+    return pio_sm_is_rx_fifo_empty(pio, sm);
+}
+
+static uint32_t pico_rx_get(void *context, unsigned sm) {
+    return pio_sm_get_blocking(pio, sm);
+}
+
+static void pico_tx_put(void *context, unsigned sm, uint32_t value) {
+    pio_sm_put(pio, sm, value);
+}
+
+// The read program pushes the full address of each byte read, and the address channel writes it
+// to the read channel's READ_ADDR_TRIGGER, which copies the byte there to the TX FIFO
+static void pico_start_read_chain(void *context, unsigned sm) {
+    uint read_channel = HAL_PICO_READ_DMA_CHANNEL;
+    dma_channel_claim(read_channel);
+
+    dma_channel_config read_config = dma_channel_get_default_config(read_channel);
+    channel_config_set_read_increment(&read_config, false);
+    channel_config_set_write_increment(&read_config, false);
+    channel_config_set_dreq(&read_config, pio_get_dreq(pio, sm, true));
+    channel_config_set_transfer_data_size(&read_config, DMA_SIZE_8);
+
+    dma_channel_configure(read_channel,
+                          &read_config,
+                          &pio->txf[sm], // write to TX fifo
+                          read_base,     // read from base address (overwritten by write channel)
+                          1,             // transfer count
+                          false);        // start later
+
+    // Address channel: copy address from RX fifo to the read channel's READ_ADDR_TRIGGER
+    uint address_channel = HAL_PICO_ADDRESS_DMA_CHANNEL;
+    dma_channel_claim(address_channel);
+    dma_channel_config address_config = dma_channel_get_default_config(address_channel);
+    channel_config_set_read_increment(&address_config, false);
+    channel_config_set_write_increment(&address_config, false);
+    channel_config_set_dreq(&address_config, pio_get_dreq(pio, sm, false));
+    channel_config_set_transfer_data_size(&address_config, DMA_SIZE_32);
+
+    volatile void *read_channel_addr = &dma_channel_hw_addr(read_channel)->al3_read_addr_trig;
+    dma_channel_configure(address_channel,
+                          &address_config,
+                          read_channel_addr, // write to read_channel READ_ADDR_TRIGGER
+                          &pio->rxf[sm],     // read from RX fifo
+                          0xffffffff,        // do many transfers
+                          true);             // start now
+}
+
+static void pico_enable_bus(void *context, bool enabled) {
+    gpio_put(pins.ie, !enabled);    // low = enabled
+}
+
+static uint32_t pico_copy_crc32(void *context, void *dst, const void *src, size_t len) {
+    return dma_copy_crc32(dst, src, len);
+}
+
+static uint32_t pico_crc32(void *context, const void *src, size_t len) {
+    return dma_crc32(src, len);
+}
+
+static const hal_t pico_hal = {
+    .context = NULL,
+    .time_us = pico_time_us,
+    .add_program = pico_add_program,
+    .claim_sm = pico_claim_sm,
+    .start_sm = pico_start_sm,
+    .set_read_base = pico_set_read_base,
+    .set_command_area = pico_set_command_area,
+    .rx_empty = pico_rx_empty,
+    .rx_get = pico_rx_get,
+    .tx_put = pico_tx_put,
+    .start_read_chain = pico_start_read_chain,
+    .enable_bus = pico_enable_bus,
+    .copy_crc32 = pico_copy_crc32,
+    .crc32 = pico_crc32,
+};
+
+const hal_t *hal_pico_backend(PIO pico_pio, const hal_pico_pins_t *pico_pins) {
+    pio = pico_pio;
+    pins = *pico_pins;
+    return &pico_hal;
+}
@@ -0,0 +1,24 @@
+// vim: ts=4:sw=4:sts=4:et
+#pragma once
+
+#include "hardware/pio.h"
+
+#include "hal.h"
+
+// Backend for the Pico itself: the programs on one PIO block, DMA channels 0 and 1 for the read
+// chain, the DMA sniffer for CRCs (dma_crc.h) and the SDK's timer.
+
+#define HAL_PICO_READ_DMA_CHANNEL 0     // copies each byte read to the read program's TX FIFO
+#define HAL_PICO_ADDRESS_DMA_CHANNEL 1  // sets its address from the read program's RX FIFO
+
+// The pins the programs use.  They assume D0..D7 and A0..A13 are consecutive.
+typedef struct {
+    uint d0;
+    uint a0;
+    uint a8;
+    uint rom[2];    // by hal_rom_line_t
+    uint oe;
+    uint ie;        // the address buffers' enable, high until enable_bus
+} hal_pico_pins_t;
+
+const hal_t *hal_pico_backend(PIO pio, const hal_pico_pins_t *pins);
@@ -0,0 +1,399 @@
+// vim: ts=4:sw=4:sts=4:et
+//
+// Host test and benchmark of the firmware logic behind the HAL (see hal.h): the state machine
+// setup, the command loop and the paging of the window, run against hal_host.c with a simulated
+// C64 paging through a stream with CMD_NEXT_PAGE like the loader does.  Built by
+// tools/host_bench.py, not by CMakeLists.txt.
+//
+//     host_bench [--layout linear|immediate] [--size N] [--pages N] [--crcs]
+//     host_bench --boot LOADER [--loader-crc N]
+//
+// Every byte the C64 reads is checked against the stream, or for the immediate layout against
+// the routine copy_gen_chunk makes for the chunk, so a run that finishes is also a test.  It
+// prints the wall clock time per page, and how much of it the firmware took from taking each
+// command to being ready again, for profiling with perf or gprof.  --crcs prints each page's
+// offset and the CRC-32 window_load gave for it, for tools/host_bench_test.py.
+//
+// --boot runs cart_bus_boot on the loader image instead, as main() does at reset, with a C64
+// that was powered on at the same time reading the reset vectors and CBM80 signature at $8000
+// between each of its calls.  It fails if the C64 is answered before the bus is enabled or
+// reads anything but the loader's bytes, and prints how many calls it took to be answered.
+
+#include <inttypes.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "cart_bus.h"
+#include "command_dispatch.h"
+#include "command_loop.h"
+#include "copy_gen.h"
+#include "hal_host.h"
+#include "window.h"
+
+// The ROM area as c64_pico_ram_interface.c lays it out
+#define ROM_SIZE 16384
+#define NUFLI_OFFSET 0x400
+#define NUFLI_WINDOW_SIZE 0x400
+#define COPY_ROUTINE_OFFSET 0x2000
+#define STUBS_OFFSET 0x3f00
+#define COMMAND_AREA (0x8000 + (HAL_HOST_COMMAND_PREFIX << 8))
+
+typedef enum {
+    C64_POLL,   // reading the status until the Pico is ready
+    C64_READ,   // reading the page
+} c64_state_t;
+
+// The C64's side, run while the command loop waits
+typedef struct {
+    c64_state_t state;
+    size_t offset;              // of the page it expects, worked out on its own
+    unsigned pages_left;
+    bool done;
+    uint8_t expected[COPY_GEN_CHUNK_CODE_MAX];
+} c64_t;
+
+hal_host_t host;
+char rom[ROM_SIZE];
+uint8_t *stream;
+window_t window;
+cart_bus_t bus;
+command_dispatcher_t dispatcher;
+command_loop_t loop;
+c64_t c64;
+bool print_crcs;
+
+// Wall clock time the firmware spent on commands
+uint64_t command_start_ns;
+uint64_t command_ns;
+unsigned commands;
+
+uint64_t now_ns() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+uint8_t c64_read(uint16_t address) {
+    hal_rom_line_t line = address < 0xa000 ? HAL_ROML : HAL_ROMH;
+    hal_host_advance_us(&host, 1);
+    return hal_host_c64_read(&host, line, address - 0x8000);
+}
+
+void fail(const char *format, ...) {
+    va_list args;
+    va_start(args, format);
+    printf("FAIL ");
+    vprintf(format, args);
+    printf("\n");
+    va_end(args);
+    exit(1);
+}
+
+// Read the page, and check it's the one at c64.offset
+void c64_read_page() {
+    size_t len;
+    uint16_t address;
+    if(window.layout == ASSET_LAYOUT_IMMEDIATE) {
+        len = copy_gen_chunk(&window.config, stream, window.size, c64.offset, c64.expected);
+        address = window.config.origin;
+    } else {
+        len = window.size - c64.offset;
+        if(len > window.page_size) {
+            len = window.page_size;
+        }
+        memcpy(c64.expected, stream + c64.offset, len);
+        address = window.config.window;
+    }
+    for(size_t i = 0; i < len; i++) {
+        uint8_t byte = c64_read(address + i);
+        if(byte != c64.expected[i]) {
+            fail("page at %zu: byte %u is $%02X", c64.offset, (unsigned)i, byte);
+        }
+    }
+}
+
+void c64_poll() {
+    uint8_t status = c64_read(COMMAND_AREA);
+    if(status == 0x00) {
+        c64.state = C64_READ;
+    } else if(status != 0xff) {
+        fail("page at %zu: status $%02X", c64.offset, status);
+    }
+}
+
+// command_loop hook: one step of the C64, a status read or a whole page and the next command
+void c64_step(void *context) {
+    if(c64.state == C64_POLL) {
+        c64_poll();
+        return;
+    }
+    c64_read_page();
+    if(--c64.pages_left == 0) {
+        c64_read(COMMAND_AREA + CMD_PING);
+        c64.done = true;
+    } else {
+        c64_read(COMMAND_AREA + CMD_NEXT_PAGE);
+        c64.offset += window.page_size;
+        if(c64.offset >= window.size) {
+            c64.offset = 0;
+        }
+    }
+    // The status goes busy as soon as the command is taken, before the firmware sees it
+    c64.state = C64_POLL;
+    c64_poll();
+}
+
+// command_loop hooks: time each command like record_command_timing does on the Pico
+void start_timing(void *context, uint32_t command) {
+    command_start_ns = now_ns();
+}
+
+void record_timing(void *context) {
+    if(loop.timed) {
+        loop.timed = false;
+        command_ns += now_ns() - command_start_ns;
+        commands++;
+    }
+}
+
+void load_page() {
+    uint32_t crc = window_load(&window);
+    if(print_crcs) {
+        printf("page %zu %08" PRIX32 "\n", window.offset, crc);
+    }
+}
+
+void handle_next_page(void *context) {
+    window_next(&window);
+    load_page();
+}
+
+void handle_nothing(void *context) {
+}
+
+void handle_open_load_file(void *context, const char *name, unsigned length) {
+}
+
+void handle_select_cart(void *context, unsigned cart) {
+}
+
+void handle_bench_result(void *context, unsigned index, uint32_t cycles) {
+}
+
+const command_handlers_t handlers = {
+    .next_page = handle_next_page,
+    .sleep = handle_nothing,
+    .check_crc = handle_nothing,
+    .save_nufli = handle_nothing,
+    .open_load_file = handle_open_load_file,
+    .select_cart = handle_select_cart,
+    .ping = handle_nothing,
+    .bench_result = handle_bench_result,
+    .no_romh = handle_nothing,
+};
+
+const command_loop_hooks_t hooks = {
+    .after_ready = record_timing,
+    .idle = c64_step,
+    .on_command = start_timing,
+};
+
+// --boot's C64, reading the reset vectors and the CBM80 signature the KERNAL checks
+typedef struct {
+    const uint8_t *loader;
+    unsigned calls;             // through the HAL so far
+    unsigned enable_call;       // the call before_enable came after
+    unsigned answered_call;     // the first call after which the C64 read the loader, or 0
+} boot_t;
+
+#define BOOT_READS 9
+
+boot_t boot;
+
+// hal_host on_call hook: one look at $8000-$8008
+void boot_c64_step(hal_host_t *host) {
+    boot.calls++;
+    uint8_t bytes[BOOT_READS];
+    bool open_bus = true;
+    bool loader = true;
+    for(int i = 0; i < BOOT_READS; i++) {
+        bytes[i] = c64_read(0x8000 + i);
+        open_bus = open_bus && bytes[i] == HAL_HOST_OPEN_BUS;
+        loader = loader && bytes[i] == boot.loader[i];
+    }
+    if(loader && !boot.answered_call) {
+        boot.answered_call = boot.calls;
+    } else if(!loader && (boot.answered_call || !open_bus)) {
+        fail("call %u: C64 reads $%02X%02X %02X %02X %02X %02X %02X %02X %02X at $8000",
+             boot.calls, bytes[1], bytes[0], bytes[2], bytes[3], bytes[4], bytes[5], bytes[6],
+             bytes[7], bytes[8]);
+    }
+}
+
+// cart_bus_boot hook: main() starts its counters here, so they must see the first read
+void boot_before_enable(cart_bus_t *boot_bus) {
+    boot.enable_call = boot.calls;
+    if(boot.answered_call) {
+        fail("C64 answered at call %u, before the bus was enabled", boot.answered_call);
+    }
+}
+
+int run_boot(const char *path, bool have_crc, uint32_t crc) {
+    static uint8_t loader[ROM_SIZE + 1];
+    FILE *f = fopen(path, "rb");
+    if(!f) {
+        fail("can't open %s", path);
+    }
+    size_t size = fread(loader, 1, sizeof(loader), f);
+    fclose(f);
+    const uint8_t cbm80[] = {0xc3, 0xc2, 0xcd, 0x38, 0x30};
+    if(size > ROM_SIZE || size < BOOT_READS || memcmp(loader + 4, cbm80, sizeof(cbm80))) {
+        fail("%s isn't a loader with the CBM80 signature", path);
+    }
+
+    hal_host_init(&host);
+    if(!have_crc) {
+        crc = host.hal.crc32(host.hal.context, loader, size);
+    }
+    boot.loader = loader;
+    host.on_call = boot_c64_step;
+    cart_bus_error_t error = cart_bus_boot(&bus, &host.hal, rom, loader, size, crc,
+                                           boot_before_enable);
+    host.on_call = NULL;
+    if(error != CART_BUS_OK) {
+        fail("cart_bus_boot: error %d after %u calls, C64 %s", error, boot.calls,
+             boot.answered_call ? "answered" : "never answered");
+    }
+    if(!boot.answered_call) {
+        fail("C64 not answered after %u calls", boot.calls);
+    }
+    printf("loader %zu bytes, C64 answered after call %u of %u, %" PRIu64 " us after power on\n",
+           size, boot.answered_call, boot.calls, host.now_us);
+    printf("C64: %" PRIu32 " reads, %" PRIu32 " before the bus was enabled\n", host.reads,
+           host.disabled_reads);
+    printf("OK\n");
+    return 0;
+}
+
+int usage(const char *name) {
+    fprintf(stderr, "usage: %s [--layout linear|immediate] [--size N] [--pages N] [--crcs]\n"
+            "       %s --boot LOADER [--loader-crc N]\n", name, name);
+    return 2;
+}
+
+int main(int argc, char **argv) {
+    asset_layout_t layout = ASSET_LAYOUT_LINEAR;
+    size_t size = 17 * 1024;
+    unsigned pages = 1000;
+    const char *boot_loader = NULL;
+    bool have_crc = false;
+    uint32_t loader_crc = 0;
+    for(int i = 1; i < argc; i++) {
+        if(!strcmp(argv[i], "--crcs")) {
+            print_crcs = true;
+        } else if(i + 1 == argc) {
+            return usage(argv[0]);
+        } else if(!strcmp(argv[i], "--layout")) {
+            i++;
+            if(!strcmp(argv[i], "linear")) {
+                layout = ASSET_LAYOUT_LINEAR;
+            } else if(!strcmp(argv[i], "immediate")) {
+                layout = ASSET_LAYOUT_IMMEDIATE;
+            } else {
+                return usage(argv[0]);
+            }
+        } else if(!strcmp(argv[i], "--size")) {
+            size = strtoul(argv[++i], NULL, 0);
+        } else if(!strcmp(argv[i], "--pages")) {
+            pages = strtoul(argv[++i], NULL, 0);
+        } else if(!strcmp(argv[i], "--boot")) {
+            boot_loader = argv[++i];
+        } else if(!strcmp(argv[i], "--loader-crc")) {
+            have_crc = true;
+            loader_crc = strtoul(argv[++i], NULL, 0);
+        } else {
+            return usage(argv[0]);
+        }
+    }
+    if(size == 0 || size > 0x10000 || pages == 0) {
+        return usage(argv[0]);
+    }
+    if(boot_loader) {
+        return run_boot(boot_loader, have_crc, loader_crc);
+    }
+
+    // The same stream every run
+    stream = malloc(size);
+    uint32_t seed = 0x12345678;
+    for(size_t i = 0; i < size; i++) {
+        seed = seed * 1103515245 + 12345;
+        stream[i] = seed >> 16;
+    }
+
+    hal_host_init(&host);
+    cart_bus_error_t error = cart_bus_start(&bus, &host.hal, rom);
+    if(error != CART_BUS_OK) {
+        fail("cart_bus_start: error %d", error);
+    }
+    host.hal.enable_bus(host.hal.context, true);
+
+    window = (window_t){
+        .hal = &host.hal,
+        .stream = stream,
+        .size = size,
+        .page_size = layout == ASSET_LAYOUT_IMMEDIATE ? COPY_GEN_CHUNK_SIZE : NUFLI_WINDOW_SIZE,
+        .layout = layout,
+        .config = {
+            .dest = 0x2000,
+            .exec = 0x3000,
+            .origin = 0x8000 + COPY_ROUTINE_OFFSET,
+            .window = 0x8000 + NUFLI_OFFSET,
+            .window_size = NUFLI_WINDOW_SIZE,
+            .command_area = COMMAND_AREA,
+            .next_page = CMD_NEXT_PAGE,
+            .stubs = 0x8000 + STUBS_OFFSET,
+        },
+        .window = (uint8_t *)rom + NUFLI_OFFSET,
+        .routine = (uint8_t *)rom + COPY_ROUTINE_OFFSET,
+    };
+    if(layout == ASSET_LAYOUT_IMMEDIATE) {
+        copy_gen_stubs(&window.config, (uint8_t *)rom + STUBS_OFFSET);
+    }
+    load_page();
+
+    command_dispatcher_init(&dispatcher, &handlers);
+    command_loop_init(&loop, &host.hal, bus.command_sm, &dispatcher, &hooks);
+
+    // The loader unlocks the command area first, with reads the command program drops
+    const uint32_t magic = HAL_HOST_UNLOCK_MAGIC;
+    for(int shift = 24; shift >= 0; shift -= 8) {
+        c64_read(COMMAND_AREA + (magic >> shift & 0xff));
+    }
+    c64.pages_left = pages;
+
+    uint64_t start_ns = now_ns();
+    while(!c64.done) {
+        command_loop_ready(&loop);
+        command_loop_wait(&loop);
+        command_loop_handle(&loop);
+    }
+    command_loop_ready(&loop);
+    double ns = now_ns() - start_ns;
+
+    if(host.dropped_commands || host.unanswered_reads) {
+        fail("%" PRIu32 " commands dropped, %" PRIu32 " reads unanswered", host.dropped_commands,
+             host.unanswered_reads);
+    }
+    printf("layout %s, stream %zu bytes, %zu byte pages\n",
+           layout == ASSET_LAYOUT_IMMEDIATE ? "immediate" : "linear", size, window.page_size);
+    printf("%u pages in %.3f ms, %.0f ns a page\n", pages, ns / 1e6, ns / pages);
+    printf("C64: %" PRIu32 " reads, %" PRIu32 " status reads, %" PRIu32 " busy\n", host.reads,
+           host.command_reads, host.busy_reads);
+    printf("Firmware: %u commands, %.0f ns each from taking one to being ready\n", commands,
+           (double)command_ns / commands);
+    printf("OK\n");
+    return 0;
+}
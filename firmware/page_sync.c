@@ -0,0 +1,72 @@
+// vim: ts=4:sw=4:sts=4:et
+#include <stdio.h>
+
+#include "page_sync.h"
+
+static const uint32_t FNV_OFFSET_BASIS = 0x811c9dc5;
+static const uint32_t FNV_PRIME = 0x01000193;
+
+
+uint32_t page_sync_checksum(const uint8_t *data, size_t len) {
+    uint32_t hash = FNV_OFFSET_BASIS;
+    for(size_t i = 0; i < len; i++) {
+        hash ^= data[i];
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+void page_sync_print_manifest(const uint8_t *data, size_t size) {
+    unsigned num_pages = 0;
+    for(size_t offset = 0; offset < size; offset += PAGE_SYNC_PAGE_SIZE) {
+        size_t len = size - offset;
+        if(len > PAGE_SYNC_PAGE_SIZE) {
+            len = PAGE_SYNC_PAGE_SIZE;
+        }
+        printf("PAGE %u %08lx\n", num_pages, (unsigned long)page_sync_checksum(data + offset, len));
+        num_pages++;
+    }
+    printf("OK %u\n", num_pages);
+}
+
+static int hex_nibble(char c) {
+    if(c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    if(c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    }
+    if(c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+bool page_sync_apply(uint8_t *data, size_t size, unsigned page, const char *hex) {
+    size_t offset = (size_t)page * PAGE_SYNC_PAGE_SIZE;
+    if(offset >= size) {
+        return false;
+    }
+    size_t len = size - offset;
+    if(len > PAGE_SYNC_PAGE_SIZE) {
+        len = PAGE_SYNC_PAGE_SIZE;
+    }
+
+    // Validate the whole page before touching the buffer, so a bad line can't leave a
+    // half-written page behind
+    size_t count = 0;
+    for(const char *p = hex; *p; p += 2) {
+        if(hex_nibble(p[0]) < 0 || hex_nibble(p[1]) < 0) {
+            return false;
+        }
+        count++;
+    }
+    if(count != len) {
+        return false;
+    }
+
+    for(size_t i = 0; i < len; i++) {
+        data[offset + i] = (uint8_t)(hex_nibble(hex[2 * i]) << 4 | hex_nibble(hex[2 * i + 1]));
+    }
+    return true;
+}
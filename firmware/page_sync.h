@@ -0,0 +1,24 @@
+// vim: ts=4:sw=4:sts=4:et
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Delta sync: the host asks for a checksum of each page of a buffer, and sends only the pages
+// that differ from its own copy.
+//
+// The checksum is 32-bit FNV-1a over the page.  It is not meant to detect tampering, only to
+// tell which pages changed since the last upload.
+
+#define PAGE_SYNC_PAGE_SIZE 256
+
+// Checksum one page (or the shorter tail of a buffer)
+uint32_t page_sync_checksum(const uint8_t *data, size_t len);
+
+// Print "PAGE <n> <checksum>" for every page of the buffer, followed by "OK <num pages>"
+void page_sync_print_manifest(const uint8_t *data, size_t size);
+
+// Decode a page of hex and write it to page number `page` of the buffer.  Returns false if the
+// page is out of range or the hex doesn't fit the page.
+bool page_sync_apply(uint8_t *data, size_t size, unsigned page, const char *hex);
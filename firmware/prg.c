@@ -0,0 +1,83 @@
+// vim: ts=4:sw=4:sts=4:et
+#include "prg.h"
+
+// BASIC token for SYS
+static const uint8_t TOKEN_SYS = 0x9e;
+
+// The address of the SYS that the first line of a BASIC program starts with, or 0 if it doesn't
+static uint16_t find_sys(const uint8_t *data, size_t size) {
+    // Each line is a pointer to the next line, a line number, then the tokens ending with 0
+    size_t i = 4;
+    while(i < size && data[i] == ' ') {
+        i++;
+    }
+    if(i >= size || data[i] != TOKEN_SYS) {
+        return 0;
+    }
+    for(i++; i < size && (data[i] == ' ' || data[i] == '('); i++) {
+    }
+    uint32_t address = 0;
+    bool digits = false;
+    for(; i < size && data[i] >= '0' && data[i] <= '9'; i++) {
+        address = address * 10 + (data[i] - '0');
+        if(address > 0xffff) {
+            return 0;
+        }
+        digits = true;
+    }
+    return digits ? address : 0;
+}
+
+// True if [start, end) overlaps [from, to)
+static bool overlaps(uint32_t start, uint32_t end, uint32_t from, uint32_t to) {
+    return start < to && from < end;
+}
+
+prg_error_t prg_parse(const uint8_t *file, size_t size, uint16_t exec, prg_t *prg) {
+    if(size < 3) {
+        return PRG_TOO_SHORT;
+    }
+    prg->load = file[0] | (file[1] << 8);
+    prg->data = file + 2;
+    prg->size = size - 2;
+    prg->end = prg->load + prg->size;
+    if(prg->end > 0x10000) {
+        return PRG_TOO_LONG;
+    }
+    if(overlaps(prg->load, prg->end, 0x0000, 0x0002)) {
+        return PRG_OVER_CPU_PORT;
+    }
+    if(overlaps(prg->load, prg->end, 0x8000, 0xc000)) {
+        return PRG_UNDER_CARTRIDGE;
+    }
+    prg->under_io = overlaps(prg->load, prg->end, PRG_IO_START, PRG_IO_END);
+
+    prg->exec = exec;
+    if(prg->exec == 0 && prg->load == PRG_BASIC_START) {
+        prg->exec = find_sys(prg->data, prg->size);
+        if(prg->exec == 0) {
+            return PRG_NO_AUTOSTART;
+        }
+    } else if(prg->exec == 0) {
+        prg->exec = prg->load;
+    }
+    return PRG_OK;
+}
+
+const char *prg_error_name(prg_error_t error) {
+    switch(error) {
+        case PRG_OK:
+            return "ok";
+        case PRG_TOO_SHORT:
+            return "too short";
+        case PRG_TOO_LONG:
+            return "runs past $FFFF";
+        case PRG_OVER_CPU_PORT:
+            return "loads over $00-$01";
+        case PRG_UNDER_CARTRIDGE:
+            return "loads under the cartridge at $8000-$BFFF";
+        case PRG_NO_AUTOSTART:
+            return "BASIC program with no SYS";
+    }
+    return "unknown error";
+}
@@ -0,0 +1,45 @@
+// vim: ts=4:sw=4:sts=4:et
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// C64 .prg files: a 2 byte load address followed by the data.  prg_parse works out where a
+// file loads, and where to start it: the SYS address of a BASIC program that starts with one
+// (like "10 SYS 2064"), otherwise the load address.
+//
+// The loader copies a PRG with the immediate layout (see copy_gen.h), so it can't go under the
+// ROM window or over the CPU port that banks it.  Data under the I/O area at $D000-$DFFF is
+// stored with I/O banked out.
+//
+// tools/prg.py does the same parsing in Python, for the tests.
+
+#define PRG_BASIC_START 0x0801
+#define PRG_IO_START 0xd000
+#define PRG_IO_END 0xe000
+
+typedef enum {
+    PRG_OK = 0,
+    PRG_TOO_SHORT,          // no load address, or no data after it
+    PRG_TOO_LONG,           // runs past $FFFF
+    PRG_OVER_CPU_PORT,      // loads over $0000-$0001
+    PRG_UNDER_CARTRIDGE,    // loads under the ROM window at $8000-$BFFF
+    PRG_NO_AUTOSTART,       // a BASIC program that doesn't start with SYS, and no exec address
+} prg_error_t;
+
+typedef struct {
+    uint16_t load;          // C64 address of the first byte
+    uint32_t end;           // C64 address after the last byte (up to 0x10000)
+    uint16_t exec;          // where to jump when it's loaded
+    const uint8_t *data;    // the data after the load address
+    size_t size;
+    bool under_io;          // some of it loads under the I/O area
+} prg_t;
+
+// Parse the PRG file at file.  If exec isn't 0 it's used as the start address instead of
+// looking for one.
+prg_error_t prg_parse(const uint8_t *file, size_t size, uint16_t exec, prg_t *prg);
+
+// The words "run" prints after ERR when a PRG is refused
+const char *prg_error_name(prg_error_t error);
@@ -0,0 +1,58 @@
+// vim: ts=4:sw=4:sts=4:et
+#include <stdio.h>
+#include <string.h>
+
+#include "read_latency.h"
+
+void read_latency_reset(read_latency_t *latency) {
+    memset(latency, 0, sizeof(*latency));
+}
+
+void read_latency_add(read_latency_t *latency, uint32_t count) {
+    // The PIO program counts down from the limit
+    if(count > READ_LATENCY_LIMIT) {
+        latency->unanswered++;
+    } else {
+        latency->bins[READ_LATENCY_LIMIT - count]++;
+    }
+}
+
+uint32_t read_latency_reads(const read_latency_t *latency) {
+    uint32_t reads = 0;
+    for(int bin = 0; bin < READ_LATENCY_BINS; bin++) {
+        reads += latency->bins[bin];
+    }
+    return reads;
+}
+
+unsigned read_latency_percentile(const read_latency_t *latency, unsigned permille) {
+    uint64_t needed = ((uint64_t)read_latency_reads(latency) * permille + 999) / 1000;
+    uint64_t seen = 0;
+    for(int bin = 0; bin < READ_LATENCY_BINS; bin++) {
+        seen += latency->bins[bin];
+        if(seen && seen >= needed) {
+            return READ_LATENCY_CYCLES(bin);
+        }
+    }
+    return 0;
+}
+
+size_t read_latency_export(const read_latency_t *latency, char *out, size_t size) {
+    size_t len = 0;
+    int n = snprintf(out, size, "LATENCY reads %lu unanswered %lu p50 %u p99 %u max %u\n",
+                     (unsigned long)read_latency_reads(latency),
+                     (unsigned long)latency->unanswered,
+                     read_latency_percentile(latency, 500),
+                     read_latency_percentile(latency, 990),
+                     read_latency_percentile(latency, 1000));
+    len += n > 0 ? n : 0;
+    for(int bin = 0; bin < READ_LATENCY_BINS; bin++) {
+        if(latency->bins[bin]) {
+            n = snprintf(len < size ? out + len : NULL, len < size ? size - len : 0,
+                         "BIN %u %lu\n", READ_LATENCY_CYCLES(bin),
+                         (unsigned long)latency->bins[bin]);
+            len += n > 0 ? n : 0;
+        }
+    }
+    return len;
+}
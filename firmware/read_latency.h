@@ -0,0 +1,53 @@
+// vim: ts=4:sw=4:sts=4:et
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Histogram of how long the cartridge takes to answer the C64's reads, from the counts the
+// read_latency PIO program pushes.
+//
+// Each count is a number of 2 PIO cycle loops from ROMH or ROML going low to OE going low, and
+// has a bin of its own.  Bin n is a latency of READ_LATENCY_CYCLES(n) PIO cycles at most: the
+// loop checks OE 2 cycles after it sees the ROM line go low, and every 2 cycles after that.
+// Reads that aren't answered before the count runs out are counted separately.
+//
+// tools/read_latency.py reads the export format, and tools/read_latency_test.py checks the
+// binning and the format against it.
+
+// Most loops the PIO program counts, as read_latency_LIMIT in read_latency.pio
+#define READ_LATENCY_LIMIT 55
+#define READ_LATENCY_BINS (READ_LATENCY_LIMIT + 1)
+#define READ_LATENCY_CYCLES(bin) (2 * ((bin) + 1))
+
+// What the PIO program pushes for a read that wasn't answered
+#define READ_LATENCY_UNANSWERED 0xffffffff
+
+// Longest export: the summary line, and a BIN line for every bin
+#define READ_LATENCY_EXPORT_MAX (96 + READ_LATENCY_BINS * 20)
+
+typedef struct {
+    uint32_t bins[READ_LATENCY_BINS];
+    uint32_t unanswered;
+} read_latency_t;
+
+// Empty the histogram
+void read_latency_reset(read_latency_t *latency);
+
+// Add a count pushed by the PIO program
+void read_latency_add(read_latency_t *latency, uint32_t count);
+
+// Answered reads in the histogram
+uint32_t read_latency_reads(const read_latency_t *latency);
+
+// The latency in PIO cycles that permille thousandths of the answered reads are within, or 0 if
+// there are none.  read_latency_percentile(latency, 1000) is the maximum.
+unsigned read_latency_percentile(const read_latency_t *latency, unsigned permille);
+
+// Write the export format to out, and return its length like snprintf:
+//
+//     LATENCY reads <answered> unanswered <n> p50 <cycles> p99 <cycles> max <cycles>
+//     BIN <cycles> <reads>
+//
+// with a BIN line for each bin with reads in it, in order.
+size_t read_latency_export(const read_latency_t *latency, char *out, size_t size);
@@ -0,0 +1,72 @@
+// vim: ts=4:sw=4:sts=4:et
+#include <stdio.h>
+#include <string.h>
+
+#include "read_profile.h"
+
+bool read_profile_reset(read_profile_t *profile, unsigned start, unsigned bucket_size) {
+    if(start < READ_PROFILE_WINDOW || start >= READ_PROFILE_WINDOW + READ_PROFILE_WINDOW_SIZE) {
+        return false;
+    }
+    if(bucket_size > READ_PROFILE_BUCKET_MAX) {
+        return false;
+    }
+    uint8_t shift = 0;
+    while((1u << shift) < bucket_size) {
+        shift++;
+    }
+    if(bucket_size != 1u << shift) {
+        return false;
+    }
+    memset(profile, 0, sizeof(*profile));
+    profile->start = start;
+    profile->shift = shift;
+    return true;
+}
+
+void read_profile_add(read_profile_t *profile, uint32_t address) {
+    uint32_t offset = READ_PROFILE_WINDOW + (address & (READ_PROFILE_WINDOW_SIZE - 1))
+                      - profile->start;
+    // Below the start wraps around to a big offset
+    uint32_t bucket = offset >> profile->shift;
+    if(bucket < READ_PROFILE_BUCKETS) {
+        profile->buckets[bucket]++;
+        profile->reads++;
+    } else {
+        profile->outside++;
+    }
+}
+
+uint16_t read_profile_address(const read_profile_t *profile, unsigned bucket) {
+    return profile->start + (bucket << profile->shift);
+}
+
+size_t read_profile_summary(const read_profile_t *profile, char *out, size_t size) {
+    int n = snprintf(out, size, "PROFILE start %04X bucket %u reads %lu outside %lu\n",
+                     profile->start, 1u << profile->shift, (unsigned long)profile->reads,
+                     (unsigned long)profile->outside);
+    return n > 0 ? n : 0;
+}
+
+size_t read_profile_export(const read_profile_t *profile, unsigned *bucket, char *out,
+                           size_t size) {
+    char line[READ_PROFILE_LINE_MAX];
+    size_t len = 0;
+    if(size) {
+        out[0] = '\0';
+    }
+    for(; *bucket < READ_PROFILE_BUCKETS; (*bucket)++) {
+        uint32_t reads = profile->buckets[*bucket];
+        if(!reads) {
+            continue;
+        }
+        int n = snprintf(line, sizeof(line), "HITS %04X %lu\n",
+                         read_profile_address(profile, *bucket), (unsigned long)reads);
+        if(len + n >= size) {
+            break;
+        }
+        memcpy(out + len, line, n + 1);
+        len += n;
+    }
+    return len;
+}
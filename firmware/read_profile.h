@@ -0,0 +1,67 @@
+// vim: ts=4:sw=4:sts=4:et
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Histogram of the addresses the C64 reads from the ROM window, to profile code running from the
+// cartridge.
+//
+// The addresses come from the read program, as the RAM addresses the read DMA channel sends the
+// byte from, so only the low 14 bits count: they're mapped to the C64's $8000-$BFFF.  Command
+// area reads go to the command program instead and aren't seen.  The cartridge port has no SYNC
+// line, so opcode fetches can't be told from operand and data reads; a routine's count is every
+// byte read from it.
+//
+// Each bucket covers a power of two bytes, from a start address, for a range of
+// READ_PROFILE_BUCKETS buckets: 16 byte buckets cover the whole window, and 1 byte buckets 4K of
+// it.  Reads outside the range are counted separately.
+//
+// tools/read_profile.py reads the export format and joins it with the loader's symbols, and
+// tools/read_profile_test.py checks the binning and the format against it.
+
+#define READ_PROFILE_BUCKETS 4096
+#define READ_PROFILE_BUCKET_MAX 256
+
+// Where the C64 sees the ROM window, in 16K cartridge mode
+#define READ_PROFILE_WINDOW 0x8000
+#define READ_PROFILE_WINDOW_SIZE 0x4000
+
+// Longest export line, and so the smallest buffer read_profile_export can fill
+#define READ_PROFILE_LINE_MAX 24
+
+// Longest summary line
+#define READ_PROFILE_SUMMARY_MAX 80
+
+typedef struct {
+    uint32_t buckets[READ_PROFILE_BUCKETS];
+    uint16_t start;     // C64 address of the first bucket
+    uint8_t shift;      // log2 of the bucket size
+    uint32_t reads;     // reads in the buckets
+    uint32_t outside;   // reads outside the range
+} read_profile_t;
+
+// Empty the histogram, with bucket_size byte buckets from the C64 address start.  Returns false,
+// leaving it alone, if bucket_size isn't a power of two up to READ_PROFILE_BUCKET_MAX or start
+// isn't in the window.
+bool read_profile_reset(read_profile_t *profile, unsigned start, unsigned bucket_size);
+
+// Add a read of a RAM address pushed by the read program
+void read_profile_add(read_profile_t *profile, uint32_t address);
+
+// C64 address of the first byte in a bucket
+uint16_t read_profile_address(const read_profile_t *profile, unsigned bucket);
+
+// Write the summary line to out, and return its length like snprintf:
+//
+//     PROFILE start <hex address> bucket <bytes> reads <n> outside <n>
+size_t read_profile_summary(const read_profile_t *profile, char *out, size_t size);
+
+// Write a line for each bucket with reads in it, from *bucket on, for as many as fit in out
+// (at least READ_PROFILE_LINE_MAX bytes), and move *bucket past them.  Returns the length
+// written; call it again until *bucket is READ_PROFILE_BUCKETS.  Each line is
+//
+//     HITS <hex address> <reads>
+size_t read_profile_export(const read_profile_t *profile, unsigned *bucket, char *out,
+                           size_t size);
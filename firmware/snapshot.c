@@ -0,0 +1,223 @@
+// vim: ts=4:sw=4:sts=4:et
+#include <stdbool.h>
+#include <string.h>
+
+#include "snapshot.h"
+
+// 6502 opcodes
+static const uint8_t LDA_IMM = 0xa9;
+static const uint8_t LDA_ABS = 0xad;
+static const uint8_t LDX_IMM = 0xa2;
+static const uint8_t LDY_IMM = 0xa0;
+static const uint8_t STA_ABS = 0x8d;
+static const uint8_t STA_ZP = 0x85;
+static const uint8_t TXS = 0x9a;
+static const uint8_t JMP = 0x4c;
+static const uint8_t RTI = 0x40;
+
+static const uint16_t VIC = 0xd000;
+static const uint16_t VIC_IRQ = 0xd019;        // write 1s to acknowledge
+static const uint16_t VIC_COLLISIONS = 0xd01e;  // $D01E-$D01F, read only
+static const uint16_t SID = 0xd400;
+static const uint16_t COLOR_RAM = 0xd800;
+static const uint16_t CIAS[2] = {0xdc00, 0xdd00};
+static const uint8_t CIA_ICR = 0x0d;
+static const uint8_t CIA_CRA = 0x0e;
+static const uint8_t CIA_CRB = 0x0f;
+static const uint8_t CIA_FORCE_LOAD = 0x10;    // in CRA and CRB: load the latch into the timer
+static const uint8_t CIA_SET_MASK = 0x80;      // in the ICR: set the bits written, not clear
+static const uint8_t PORT_LORAM = 0x01;        // CPU port lines that map the cartridge in
+static const uint8_t PORT_HIRAM = 0x02;
+
+// The stack page, as restored: zero page and the stack with the trampoline and frame in
+static uint8_t low_ram[0x200];
+
+// Offsets sorted by value, for emit_sorted (colour RAM is the most it sorts at once)
+static uint16_t sorted_order[SNAPSHOT_COLORS];
+
+typedef struct {
+    uint8_t *code;
+    size_t len;
+} emitter_t;
+
+
+static void emit(emitter_t *e, uint8_t opcode, uint16_t operand, int operand_size) {
+    uint8_t bytes[3] = {opcode, operand & 0xff, operand >> 8};
+    for(int i = 0; i <= operand_size; i++) {
+        if(e->len < SNAPSHOT_RESTORE_CODE_MAX) {
+            e->code[e->len] = bytes[i];
+        }
+        e->len++;
+    }
+}
+
+static void emit_store(emitter_t *e, uint16_t address) {
+    if(address < 0x100) {
+        emit(e, STA_ZP, address, 1);
+    } else {
+        emit(e, STA_ABS, address, 2);
+    }
+}
+
+// lda # and sta for one register
+static void emit_set(emitter_t *e, uint16_t address, uint8_t value) {
+    emit(e, LDA_IMM, value, 1);
+    emit_store(e, address);
+}
+
+// Store count values at base + first..., with one lda # for each value, like a copy_gen chunk
+static void emit_sorted(emitter_t *e, const uint8_t *values, uint16_t first, uint16_t count,
+                        uint16_t base) {
+    uint16_t starts[256] = {0};
+    for(uint16_t i = first; i < first + count; i++) {
+        starts[values[i]]++;
+    }
+    uint16_t total = 0;
+    for(unsigned value = 0; value < 256; value++) {
+        uint16_t n = starts[value];
+        starts[value] = total;
+        total += n;
+    }
+    for(uint16_t i = first; i < first + count; i++) {
+        sorted_order[starts[values[i]]++] = i;
+    }
+    for(uint16_t i = 0; i < count; i++) {
+        uint8_t value = values[sorted_order[i]];
+        if(i == 0 || value != values[sorted_order[i - 1]]) {
+            emit(e, LDA_IMM, value, 1);
+        }
+        emit_store(e, base + sorted_order[i]);
+    }
+}
+
+// Whether the RAM the cartridge hides with this CPU port setting is all zeros
+static bool cartridge_hides_nothing(const uint8_t *ram, uint8_t port_ddr, uint8_t port) {
+    uint8_t lines = port | (uint8_t)~port_ddr;  // lines set as inputs are pulled up
+    uint32_t start, end;
+    if((lines & PORT_HIRAM) && (lines & PORT_LORAM)) {
+        start = 0x8000;     // ROML, and ROMH over BASIC
+        end = 0xa000;
+    } else if(lines & PORT_HIRAM) {
+        start = 0xa000;     // ROMH
+        end = 0xc000;
+    } else {
+        return true;
+    }
+    for(uint32_t address = start; address < end; address++) {
+        if(ram[address]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+snapshot_error_t snapshot_parse(const uint8_t *file, size_t size, snapshot_t *snapshot) {
+    const size_t magic_size = sizeof(SNAPSHOT_MAGIC) - 1;
+    if(size != SNAPSHOT_SIZE || memcmp(file, SNAPSHOT_MAGIC, magic_size) != 0) {
+        return SNAPSHOT_BAD_FILE;
+    }
+    if(file[magic_size] != SNAPSHOT_VERSION) {
+        return SNAPSHOT_BAD_VERSION;
+    }
+    const uint8_t *cpu = file + SNAPSHOT_CPU;
+    snapshot->file = file;
+    snapshot->pc = cpu[0] | (cpu[1] << 8);
+    snapshot->a = cpu[2];
+    snapshot->x = cpu[3];
+    snapshot->y = cpu[4];
+    snapshot->sp = cpu[5];
+    snapshot->p = cpu[6];
+    snapshot->port_ddr = cpu[7];
+    snapshot->port = cpu[8];
+    if(snapshot->sp < SNAPSHOT_STACK_USED - 1) {
+        return SNAPSHOT_STACK_FULL;
+    }
+    if(!cartridge_hides_nothing(file + SNAPSHOT_RAM, snapshot->port_ddr, snapshot->port)) {
+        return SNAPSHOT_UNDER_CARTRIDGE;
+    }
+    return SNAPSHOT_OK;
+}
+
+size_t snapshot_restore_code(const snapshot_t *snapshot,
+                             uint16_t command_area,
+                             uint8_t next_page,
+                             uint8_t *code) {
+    emitter_t e = {code, 0};
+    const uint8_t *file = snapshot->file;
+
+    // VIC-II and SID, with the VIC's interrupts acknowledged after
+    for(uint16_t reg = 0; reg < SNAPSHOT_VIC_REGS; reg++) {
+        uint16_t address = VIC + reg;
+        if(address != VIC_IRQ && address != VIC_COLLISIONS && address != VIC_COLLISIONS + 1) {
+            emit_set(&e, address, file[SNAPSHOT_VIC + reg]);
+        }
+    }
+    emit_set(&e, VIC_IRQ, 0xff);
+    for(uint16_t reg = 0; reg < SNAPSHOT_SID_REGS; reg++) {
+        emit_set(&e, SID + reg, file[SNAPSHOT_SID + reg]);
+    }
+
+    uint8_t colors[SNAPSHOT_COLORS];
+    for(int i = 0; i < SNAPSHOT_COLORS; i++) {
+        colors[i] = file[SNAPSHOT_COLOR + i] & 0x0f;
+    }
+    emit_sorted(&e, colors, 0, SNAPSHOT_COLORS, COLOR_RAM);
+
+    // Each CIA with its interrupts off, the ports and the timers loaded from their latches.
+    // CIA 1's interrupts are back on at the end of this, and CIA 2's NMIs just before the
+    // trampoline.
+    for(int cia = 0; cia < 2; cia++) {
+        const uint8_t *regs = file + (cia == 0 ? SNAPSHOT_CIA1 : SNAPSHOT_CIA2);
+        emit_set(&e, CIAS[cia] + CIA_ICR, ~CIA_SET_MASK & 0xff);
+        for(uint8_t reg = 0; reg < 8; reg++) {
+            emit_set(&e, CIAS[cia] + reg, regs[reg]);
+        }
+        emit_set(&e, CIAS[cia] + CIA_CRA, regs[CIA_CRA] | CIA_FORCE_LOAD);
+        emit_set(&e, CIAS[cia] + CIA_CRB, regs[CIA_CRB] | CIA_FORCE_LOAD);
+        emit(&e, LDA_ABS, CIAS[cia] + CIA_ICR, 2);  // acknowledge anything that came up
+    }
+    emit_set(&e, CIAS[0] + CIA_ICR, file[SNAPSHOT_CIA1 + CIA_ICR] | CIA_SET_MASK);
+
+    // Zero page and the stack, with the rti frame and the trampoline in below the stack
+    // pointer: P, PC low and PC high for rti, 3 bytes for an NMI, then the trampoline
+    uint16_t sp = 0x100 + snapshot->sp;
+    uint16_t trampoline = sp - (SNAPSHOT_STACK_USED - 1);
+    memcpy(low_ram, file + SNAPSHOT_RAM, sizeof(low_ram));
+    low_ram[sp - 2] = snapshot->p;
+    low_ram[sp - 1] = snapshot->pc & 0xff;
+    low_ram[sp] = snapshot->pc >> 8;
+    const uint8_t trampoline_code[] = {
+        LDA_ABS, (command_area + next_page) & 0xff, (command_area + next_page) >> 8,
+        LDA_IMM, snapshot->port,
+        STA_ZP, 0x01,
+        LDA_IMM, snapshot->a,
+        RTI,
+    };
+    memcpy(low_ram + trampoline, trampoline_code, sizeof(trampoline_code));
+    emit_sorted(&e, low_ram, 2, sizeof(low_ram) - 2, 0);
+
+    emit_set(&e, 0x00, snapshot->port_ddr);
+    emit(&e, LDX_IMM, snapshot->sp - 3, 1);
+    emit(&e, TXS, 0, 0);
+    emit_set(&e, CIAS[1] + CIA_ICR, file[SNAPSHOT_CIA2 + CIA_ICR] | CIA_SET_MASK);
+    emit(&e, LDX_IMM, snapshot->x, 1);
+    emit(&e, LDY_IMM, snapshot->y, 1);
+    emit(&e, JMP, trampoline, 2);
+    return e.len;
+}
+
+const char *snapshot_error_name(snapshot_error_t error) {
+    switch(error) {
+        case SNAPSHOT_OK:
+            return "ok";
+        case SNAPSHOT_BAD_FILE:
+            return "not a snapshot";
+        case SNAPSHOT_BAD_VERSION:
+            return "newer snapshot version";
+        case SNAPSHOT_STACK_FULL:
+            return "no room below the stack pointer";
+        case SNAPSHOT_UNDER_CARTRIDGE:
+            return "uses RAM under the cartridge at $8000-$BFFF";
+    }
+    return "unknown error";
+}
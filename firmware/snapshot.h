@@ -0,0 +1,91 @@
+// vim: ts=4:sw=4:sts=4:et
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// C64 memory snapshots, for resuming a program where it left off.
+//
+// A snapshot file is the 64K of RAM, the CPU registers, and what was last written to the
+// VIC-II, SID, CIA and colour RAM.  The loader restores RAM from $0200 up with the immediate
+// layout (see copy_gen.h), as for a PRG, and the page after the last chunk is a routine from
+// snapshot_restore_code that writes the I/O registers, then zero page and the stack, and
+// returns into the program with rti.
+//
+// The rti needs a frame on the stack, and the last few instructions run from the stack page
+// below it, since the snapshot's CPU port may bank the cartridge out.  So the
+// SNAPSHOT_STACK_USED bytes below the snapshot's stack pointer are overwritten, which a
+// running program can't tell from an interrupt.  Pending interrupts, the TOD clocks and the
+// CIA serial registers aren't restored.
+//
+// Snapshots are only resumed in 16K mode (see handle_no_romh), and the cartridge stays mapped
+// in, so the program reads ROML and ROMH wherever its CPU port lets them through, not the RAM
+// it had there.  A snapshot is refused if that RAM isn't all zeros: $8000-$9FFF with LORAM and
+// HIRAM set, or $A000-$BFFF with only HIRAM set.  With both set, $A000-$BFFF was BASIC.
+//
+// tools/snapshot.py makes snapshot files and generates the same restore code in Python.
+
+// File layout
+#define SNAPSHOT_MAGIC "C64SNAP"
+#define SNAPSHOT_VERSION 1
+#define SNAPSHOT_CPU 0x008     // PC (2 bytes, little endian), A, X, Y, SP, P, then $00 and $01
+#define SNAPSHOT_VIC 0x020     // $D000-$D02E
+#define SNAPSHOT_SID 0x050     // $D400-$D418
+#define SNAPSHOT_CIA1 0x070    // $DC00-$DC0F, with the interrupt mask at $0D
+#define SNAPSHOT_CIA2 0x080    // $DD00-$DD0F, the same
+#define SNAPSHOT_COLOR 0x100   // $D800-$DBE7, in the low nibbles
+#define SNAPSHOT_RAM 0x500     // $0000-$FFFF
+#define SNAPSHOT_SIZE (SNAPSHOT_RAM + 0x10000)
+
+#define SNAPSHOT_VIC_REGS 47
+#define SNAPSHOT_SID_REGS 25
+#define SNAPSHOT_CIA_REGS 16
+#define SNAPSHOT_COLORS 1000
+
+// Where the loader starts restoring RAM: below is zero page and the stack it's using
+#define SNAPSHOT_LOAD 0x0200
+
+// Stack bytes below the stack pointer used to return into the program: the trampoline, 3
+// bytes spare for an NMI that comes in while it runs, and the rti frame
+#define SNAPSHOT_STACK_USED 16
+
+// Largest restore routine: an lda # and a sta for every register and colour, the same for zero
+// page and the stack, and the CIA and CPU setup
+#define SNAPSHOT_RESTORE_CODE_MAX ((SNAPSHOT_VIC_REGS + SNAPSHOT_SID_REGS) * 5 \
+                                   + 16 * 2 + SNAPSHOT_COLORS * 3 + 2 * 64 \
+                                   + 256 * 2 + 254 * 2 + 256 * 3 + 32)
+
+typedef enum {
+    SNAPSHOT_OK = 0,
+    SNAPSHOT_BAD_FILE,      // wrong size, or not a snapshot
+    SNAPSHOT_BAD_VERSION,   // a newer version of the format
+    SNAPSHOT_STACK_FULL,    // no room below the stack pointer to return into the program
+    SNAPSHOT_UNDER_CARTRIDGE,   // uses RAM the cartridge hides at $8000-$BFFF
+} snapshot_error_t;
+
+typedef struct {
+    const uint8_t *file;
+    uint16_t pc;
+    uint8_t a;
+    uint8_t x;
+    uint8_t y;
+    uint8_t sp;
+    uint8_t p;
+    uint8_t port_ddr;       // $00
+    uint8_t port;           // $01
+} snapshot_t;
+
+// Check a snapshot file and read its CPU registers
+snapshot_error_t snapshot_parse(const uint8_t *file, size_t size, snapshot_t *snapshot);
+
+// Generate the routine that restores everything but RAM from SNAPSHOT_LOAD up, to run from the
+// ROM window with I/O banked in.  Its last instruction before returning into the program reads
+// next_page from the command area, so the Pico can put the first chunk back for the next
+// reset.  code must hold SNAPSHOT_RESTORE_CODE_MAX bytes.  Returns the size of the routine.
+size_t snapshot_restore_code(const snapshot_t *snapshot,
+                             uint16_t command_area,
+                             uint8_t next_page,
+                             uint8_t *code);
+
+// A few words on why a snapshot can't be resumed
+const char *snapshot_error_name(snapshot_error_t error);
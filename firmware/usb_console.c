@@ -0,0 +1,59 @@
+// vim: ts=4:sw=4:sts=4:et
+#include <stdio.h>
+#include <string.h>
+
+#include "pico/stdlib.h"
+
+#include "usb_console.h"
+
+// Longest line we accept: a page patch is a page number plus 256 bytes of hex
+#define LINE_MAX 600
+
+static char line[LINE_MAX];
+static size_t line_len = 0;
+static bool line_overflow = false;
+
+
+static void dispatch(const usb_console_command_t *commands, size_t num_commands) {
+    char *args = line;
+    while(*args && *args != ' ') {
+        args++;
+    }
+    if(*args) {
+        *args++ = '\0';
+    }
+
+    for(size_t i = 0; i < num_commands; i++) {
+        if(strcmp(line, commands[i].name) == 0) {
+            commands[i].handler(args);
+            return;
+        }
+    }
+    printf("ERR unknown command %s\n", line);
+}
+
+void usb_console_poll(const usb_console_command_t *commands, size_t num_commands) {
+    int c;
+    while((c = getchar_timeout_us(0)) != PICO_ERROR_TIMEOUT) {
+        if(c == '\r') {
+            continue;
+        }
+        if(c != '\n') {
+            if(line_len < LINE_MAX - 1) {
+                line[line_len++] = (char)c;
+            } else {
+                line_overflow = true;
+            }
+            continue;
+        }
+
+        line[line_len] = '\0';
+        if(line_overflow) {
+            printf("ERR line too long\n");
+        } else if(line_len > 0) {
+            dispatch(commands, num_commands);
+        }
+        line_len = 0;
+        line_overflow = false;
+    }
+}
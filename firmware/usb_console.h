@@ -0,0 +1,21 @@
+// vim: ts=4:sw=4:sts=4:et
+#pragma once
+
+#include <stddef.h>
+
+// Line-based command console on USB stdio.
+//
+// Each line sent by the host is split into a command name and an argument string, and
+// dispatched to the matching handler.  Handlers print their results with printf, and should
+// finish with a line starting with "OK" or "ERR" so the host knows the command is complete.
+
+typedef void (*usb_console_handler_t)(char *args);
+
+typedef struct {
+    const char *name;
+    usb_console_handler_t handler;
+} usb_console_command_t;
+
+// Read any pending characters from USB without blocking, and run a handler for each complete
+// line received.
+void usb_console_poll(const usb_console_command_t *commands, size_t num_commands);
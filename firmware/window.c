@@ -0,0 +1,27 @@
+// vim: ts=4:sw=4:sts=4:et
+#include "window.h"
+
+uint32_t window_load(window_t *window) {
+    const hal_t *hal = window->hal;
+    size_t len = window->size - window->offset;
+    if(len > window->page_size) {
+        len = window->page_size;
+    }
+    if(window->layout == ASSET_LAYOUT_IMMEDIATE) {
+        copy_gen_chunk(&window->config, window->stream, window->size, window->offset,
+                       window->routine);
+        return hal->crc32(hal->context, window->stream + window->offset, len);
+    }
+    return hal->copy_crc32(hal->context, window->window, window->stream + window->offset, len);
+}
+
+bool window_at_last_page(const window_t *window) {
+    return window->offset + window->page_size >= window->size;
+}
+
+void window_next(window_t *window) {
+    window->offset += window->page_size;
+    if(window->offset >= window->size) {
+        window->offset = 0;
+    }
+}
@@ -0,0 +1,38 @@
+// vim: ts=4:sw=4:sts=4:et
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "asset.h"
+#include "copy_gen.h"
+#include "hal.h"
+
+// Paging a stream through the ROM window, a page for each CMD_NEXT_PAGE: the NUFLI image or its
+// copy routine's sections, a PRG, or a file LOADed from a D64.
+//
+// Each page goes in the window, or for the immediate layout is the copy routine that
+// copy_gen_chunk generates for it.  The copies and CRCs go through the HAL, so paging can run
+// against hal_host.c.
+
+typedef struct {
+    const hal_t *hal;
+    const uint8_t *stream;      // what CMD_NEXT_PAGE pages through
+    size_t size;
+    size_t page_size;           // how far CMD_NEXT_PAGE moves offset
+    size_t offset;              // of the page being served
+    asset_layout_t layout;
+    copy_gen_config_t config;   // for the immediate layout's routines
+    uint8_t *window;            // in the ROM area, config.window_size bytes
+    uint8_t *routine;           // in the ROM area, where the immediate layout's routines go
+} window_t;
+
+// Put the page at offset in the ROM area, and return its CRC-32
+uint32_t window_load(window_t *window);
+
+// True if the page being served is the stream's last
+bool window_at_last_page(const window_t *window);
+
+// Move on a page, back to the start after the last.  The page still needs loading.
+void window_next(window_t *window);
@@ -0,0 +1,189 @@
+#!/usr/bin/env python
+"""Fetch and show the bus activity counts from the Pico.
+
+The firmware counts what the C64 does on the bus without an interrupt for each read (see
+firmware/activity.h): the reads on ROMH and ROML by a DMA channel draining each address decoder,
+the reads the read program answered from the window, and the commands main() took.  From those
+it works out the reads of the command area, the status polls, and the reads the command area
+guard filtered out.  This reads them with the "activity" USB command and prints them, or with
+--interval, fetches them twice and prints the rates in between.  --reset zeroes them first:
+
+    python tools/activity.py --reset
+    python tools/activity.py --interval 1
+
+Activity and Led below work the counts out and hold the LED the way activity.c does;
+tools/activity_test.py runs both on the same simulated bus.
+"""
+import argparse
+import sys
+import time
+
+# From firmware/activity.h
+LED_TICK_MS = 10        # ACTIVITY_LED_TICK_MS
+LED_HOLD_TICKS = 10     # ACTIVITY_LED_HOLD_TICKS
+
+# activity_source_t order
+SOURCES = ['romh', 'roml', 'window', 'commands']
+
+# The counts in export order, and what each is
+COUNTS = ['romh', 'roml', 'window', 'command_area', 'commands', 'status', 'filtered']
+DESCRIPTIONS = {
+    'romh': 'reads with ROMH low',
+    'roml': 'reads with ROML low',
+    'window': 'reads answered from the ROM area',
+    'command_area': 'reads of the command area',
+    'commands': 'commands taken',
+    'status': 'status polls',
+    'filtered': 'reads the guard filtered out',
+}
+
+
+def difference(a, b):
+    return a - b if a > b else 0
+
+
+class Activity:
+    """activity_t: the totals of free-running 32 bit counts sampled from main()'s idle loop"""
+
+    def __init__(self, seen=(0, 0, 0, 0), unlocked=False):
+        self.seen = list(seen)
+        self.totals = [0] * len(SOURCES)
+        self.unlocked = unlocked
+        self.unlocks = 0
+        self.locked_reads = 0
+        self.locked_since = 0
+
+    def sample(self, source, seen):
+        self.totals[source] += (seen - self.seen[source]) & 0xffffffff
+        self.seen[source] = seen
+
+    def rebase(self, source, seen):
+        self.seen[source] = seen
+
+    def command_area_reads(self):
+        return difference(self.totals[0] + self.totals[1], self.totals[2])
+
+    def guard(self, unlocked):
+        if unlocked == self.unlocked:
+            return
+        reads = self.command_area_reads()
+        if unlocked:
+            self.locked_reads += difference(reads, self.locked_since)
+            self.unlocks += 1
+        else:
+            self.locked_since = reads
+        self.unlocked = unlocked
+
+    def counts(self):
+        """A dict of the counts, by the names in COUNTS"""
+        reads = self.command_area_reads()
+        locked = self.locked_reads
+        if not self.unlocked:
+            locked += difference(reads, self.locked_since)
+        return {
+            'romh': self.totals[0],
+            'roml': self.totals[1],
+            'window': self.totals[2],
+            'command_area': reads,
+            'commands': self.totals[3],
+            'status': difference(difference(reads, locked), self.totals[3]),
+            'filtered': difference(locked, self.unlocks),
+        }
+
+
+class Led:
+    """activity_led_t: on for LED_HOLD_TICKS ticks after the reads last changed"""
+
+    def __init__(self, reads=0):
+        self.reads = reads
+        self.hold = 0
+
+    def tick(self, reads):
+        """A tick of the LED timer with the reads on both lines now.  Returns whether it's on."""
+        if reads != self.reads:
+            self.reads = reads
+            self.hold = LED_HOLD_TICKS
+        elif self.hold:
+            self.hold -= 1
+        return self.hold > 0
+
+
+def export(counts):
+    """The text the "activity" USB command prints before its OK"""
+    return 'ACTIVITY ' + ' '.join(f'{name} {counts[name]}' for name in COUNTS) + '\n'
+
+
+class ExportError(ValueError):
+    pass
+
+
+def parse_export(lines):
+    """Return a dict of the counts from the lines the "activity" USB command prints, up to its
+    OK.  Other lines are log output and are skipped."""
+    counts = None
+    for line in lines:
+        words = line.split()
+        if not words:
+            continue
+        if words[0] == 'OK':
+            break
+        if words[0] == 'ERR':
+            raise ExportError(line.strip())
+        if words[0] == 'ACTIVITY':
+            if words[1::2] != COUNTS or not all(word.isdigit() for word in words[2::2]):
+                raise ExportError(f'bad counts: {line.strip()}')
+            counts = {name: int(value) for name, value in zip(words[1::2], words[2::2])}
+    if counts is None:
+        raise ExportError('no ACTIVITY line')
+    return counts
+
+
+def command(port, text):
+    """Send a USB command and return its lines up to the OK"""
+    port.write(f'{text}\n'.encode())
+    lines = []
+    while True:
+        line = port.readline().decode('ascii', 'replace')
+        if not line:
+            raise TimeoutError('no response from pico')
+        lines.append(line)
+        if line.startswith(('OK', 'ERR')):
+            return lines
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--port', default='/dev/ttyACM0')
+    parser.add_argument('--reset', action='store_true', help='zero the counts first')
+    parser.add_argument('--interval', type=float, metavar='SECONDS',
+                        help='show the rates over this long instead of the counts')
+    args = parser.parse_args()
+
+    import serial  # pyserial, only needed when talking to the hardware
+
+    with serial.Serial(args.port, timeout=2) as port:
+        if args.reset:
+            lines = command(port, 'activity reset')
+            if lines[-1].startswith('ERR'):
+                sys.exit(f'pico: {lines[-1].strip()}')
+        try:
+            start = parse_export(command(port, 'activity'))
+            if args.interval:
+                started = time.monotonic()
+                time.sleep(args.interval)
+                counts = parse_export(command(port, 'activity'))
+                seconds = time.monotonic() - started
+        except ExportError as e:
+            sys.exit(f'pico: {e}')
+
+    for name in COUNTS:
+        if args.interval:
+            rate = (counts[name] - start[name]) / seconds
+            print(f'{name:12} {rate:12.1f}/s  {DESCRIPTIONS[name]}')
+        else:
+            print(f'{name:12} {start[name]:12}  {DESCRIPTIONS[name]}')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,281 @@
+#!/usr/bin/env python
+"""Test the activity counts and LED: firmware/activity.c against tools/activity.py.
+
+activity.c is compiled with the host's C compiler ($CC, default cc) and called through ctypes.
+A simulated C64 reads the window, polls the status, sends commands and unlocks and relocks the
+command area guard, with the hardware's free-running counts starting near where they wrap and
+the DMA channels counting them stopping and starting again.  Sampled the way main() does, at
+each guard change and at random in between, activity.c must give the same counts as
+activity.py and as the simulation counted, and export them as text activity.py parses back.
+The activity LED must be on for exactly ACTIVITY_LED_HOLD_TICKS ticks after the reads last
+changed, and off otherwise:
+
+    python tools/activity_test.py
+"""
+import ctypes
+import random
+import sys
+import tempfile
+
+import activity
+import host_c
+
+
+ROMH, ROML, WINDOW, COMMANDS = range(len(activity.SOURCES))
+
+
+class CActivity(ctypes.Structure):
+    _fields_ = [('seen', ctypes.c_uint32 * len(activity.SOURCES)),
+                ('totals', ctypes.c_uint64 * len(activity.SOURCES)),
+                ('unlocked', ctypes.c_bool),
+                ('unlocks', ctypes.c_uint64),
+                ('locked_reads', ctypes.c_uint64),
+                ('locked_since', ctypes.c_uint64)]
+
+
+class CActivityCounts(ctypes.Structure):
+    _fields_ = [(name, ctypes.c_uint64) for name in
+                ('romh', 'roml', 'window', 'command_area', 'commands', 'status', 'filtered')]
+
+
+class CActivityLed(ctypes.Structure):
+    _fields_ = [('reads', ctypes.c_uint32), ('hold', ctypes.c_uint)]
+
+
+class CLibrary:
+    """firmware/activity.c, compiled for the host"""
+
+    def __init__(self, build_dir):
+        self.lib = host_c.load(build_dir, 'activity.c')
+        self.lib.activity_counts.restype = CActivityCounts
+        self.lib.activity_export.restype = ctypes.c_size_t
+        self.lib.activity_led_tick.restype = ctypes.c_bool
+
+
+class Both:
+    """activity.c and activity.py side by side, fed the same samples"""
+
+    def __init__(self, c, seen, unlocked):
+        self.lib = c.lib
+        self.c = CActivity()
+        self.lib.activity_reset(ctypes.byref(self.c), (ctypes.c_uint32 * len(seen))(*seen),
+                                ctypes.c_bool(unlocked))
+        self.py = activity.Activity(seen, unlocked)
+
+    def sample(self, source, seen):
+        self.lib.activity_sample(ctypes.byref(self.c), source, ctypes.c_uint32(seen))
+        self.py.sample(source, seen)
+
+    def rebase(self, source, seen):
+        self.lib.activity_rebase(ctypes.byref(self.c), source, ctypes.c_uint32(seen))
+        self.py.rebase(source, seen)
+
+    def guard(self, unlocked):
+        self.lib.activity_guard(ctypes.byref(self.c), ctypes.c_bool(unlocked))
+        self.py.guard(unlocked)
+
+    def c_counts(self):
+        counts = self.lib.activity_counts(ctypes.byref(self.c))
+        return {name: getattr(counts, name) for name in activity.COUNTS}
+
+    def export(self, size=None):
+        """The text, and the length activity_export returned"""
+        out = ctypes.create_string_buffer(header_define('ACTIVITY_EXPORT_MAX'))
+        size = len(out) if size is None else size
+        length = self.lib.activity_export(ctypes.byref(self.c), out, ctypes.c_size_t(size))
+        return out.value.decode(), length
+
+
+def header_define(name):
+    return host_c.header_define('activity.h', name)
+
+
+class Bus:
+    """The hardware's free-running counts, and what the C64 did to make them"""
+
+    def __init__(self, rng):
+        self.rng = rng
+        # Near the wrap, so a run goes past it
+        self.seen = [0x100000000 - rng.randrange(1, 2000) for _ in activity.SOURCES]
+        self.unlocked = rng.random() < 0.5
+        self.unlocking = 0
+        self.truth = dict.fromkeys(activity.COUNTS, 0)
+
+    def count(self, source):
+        self.seen[source] = (self.seen[source] + 1) & 0xffffffff
+
+    def read(self, window):
+        line = self.rng.choice((ROMH, ROML))
+        self.count(line)
+        self.truth['romh' if line == ROMH else 'roml'] += 1
+        if window:
+            self.count(WINDOW)
+            self.truth['window'] += 1
+        else:
+            self.truth['command_area'] += 1
+
+    def step(self):
+        """One thing the C64 does.  Returns True if it changed the guard."""
+        roll = self.rng.random()
+        if roll < 0.5:
+            self.read(window=True)
+        elif self.unlocked and roll < 0.75:
+            self.read(window=False)
+            self.truth['status'] += 1
+        elif self.unlocked and roll < 0.95:
+            self.read(window=False)
+            self.count(COMMANDS)
+            self.truth['commands'] += 1
+        elif self.unlocked:
+            self.unlocked = False   # relocked, by time or too many commands
+            return True
+        elif roll < 0.9:
+            self.read(window=False)
+            self.truth['filtered'] += 1
+        else:
+            self.read(window=False)  # the read that completes the magic sequence
+            self.unlocked = True
+            return True
+        return False
+
+
+def sample_all(both, bus):
+    """Sample like sample_activity(), starting stopped channels again"""
+    for source in range(len(activity.SOURCES)):
+        both.sample(source, bus.seen[source])
+        if source != COMMANDS and bus.rng.random() < 0.05:
+            bus.seen[source] = 0
+            both.rebase(source, 0)
+    both.guard(bus.unlocked)
+
+
+def check_counts(c, seed):
+    """Error messages for one simulated run"""
+    errors = []
+    rng = random.Random(seed)
+    bus = Bus(rng)
+    both = Both(c, bus.seen, bus.unlocked)
+    for _ in range(rng.randrange(100, 3000)):
+        if bus.step() or rng.random() < 0.02:
+            sample_all(both, bus)
+        elif rng.random() < 0.05:
+            # Sampled part way, which must agree with activity.py if not the truth
+            source = rng.randrange(len(activity.SOURCES))
+            both.sample(source, bus.seen[source])
+            if both.c_counts() != both.py.counts():
+                errors.append(f'seed {seed}: C counts {both.c_counts()}, '
+                              f'Python {both.py.counts()}')
+                return errors
+    sample_all(both, bus)
+    counts = both.c_counts()
+    if counts != both.py.counts():
+        errors.append(f'seed {seed}: C counts {counts}, Python {both.py.counts()}')
+    if counts != bus.truth:
+        errors.append(f'seed {seed}: counts {counts}, the C64 did {bus.truth}')
+
+    text, length = both.export()
+    if text != activity.export(counts) or length != len(text):
+        errors.append(f'seed {seed}: C exports {text!r}')
+        return errors
+    try:
+        parsed = activity.parse_export(['log output\n'] + text.splitlines(True)
+                                       + ['OK\n', 'ACTIVITY romh 1\n'])
+        if parsed != counts:
+            errors.append(f'seed {seed}: {counts} parses as {parsed}')
+    except activity.ExportError as e:
+        errors.append(f'seed {seed}: {counts} doesn\'t parse: {e}')
+    # A short buffer gets a truncated export, and the full length like snprintf
+    short, length = both.export(10)
+    if short != text[:9] or length != len(text):
+        errors.append(f'seed {seed}: truncated export is wrong')
+
+    # A reset starts from zero where the counts are
+    both.lib.activity_reset(ctypes.byref(both.c), both.c.seen, ctypes.c_bool(bus.unlocked))
+    if any(both.c_counts().values()):
+        errors.append(f'seed {seed}: counts after a reset are {both.c_counts()}')
+    return errors
+
+
+def check_known(c):
+    """Error messages for counts worked out by hand.  From locked, with ROML's DMA count about to
+    wrap: 4 locked command area reads on ROML, the last of them unlocking it, then 5 window reads
+    on ROMH, 2 status polls and a command on ROML."""
+    seen = [100, 0xfffffffe, 50, 7]
+    both = Both(c, seen, False)
+    both.sample(ROML, 2)
+    both.guard(True)
+    both.sample(ROMH, 105)
+    both.sample(WINDOW, 55)
+    both.sample(ROML, 5)
+    both.sample(COMMANDS, 8)
+    text, _ = both.export()
+    expected = ('ACTIVITY romh 5 roml 7 window 5 command_area 7 commands 1 status 2 '
+                'filtered 3\n')
+    return [] if text == expected else [f'exports {text!r}, expected {expected!r}']
+
+
+def check_led(c, seed):
+    """Error messages for the LED ticked with the reads changing at random"""
+    rng = random.Random(seed)
+    reads = rng.randrange(1 << 32)
+    led = CActivityLed()
+    c.lib.activity_led_reset(ctypes.byref(led), ctypes.c_uint32(reads))
+    model = activity.Led(reads)
+    last_change = None
+    for tick in range(2000):
+        if rng.random() < 0.05:
+            reads = (reads + rng.randrange(1, 1000)) & 0xffffffff
+            last_change = tick
+        on = c.lib.activity_led_tick(ctypes.byref(led), ctypes.c_uint32(reads))
+        expected = last_change is not None and tick - last_change < activity.LED_HOLD_TICKS
+        if on != model.tick(reads) or on != expected:
+            return [f'seed {seed}: LED {"on" if on else "off"} at tick {tick}, '
+                    f'reads last changed at {last_change}']
+    return []
+
+
+def check_export_format():
+    """Error messages for the export limits and broken exports"""
+    errors = []
+    if header_define('ACTIVITY_EXPORT_MAX') <= len(activity.export(
+            dict.fromkeys(activity.COUNTS, (1 << 64) - 1))):
+        errors.append('ACTIVITY_EXPORT_MAX is too short')
+    for name, value in (('ACTIVITY_LED_TICK_MS', activity.LED_TICK_MS),
+                        ('ACTIVITY_LED_HOLD_TICKS', activity.LED_HOLD_TICKS)):
+        if header_define(name) != value:
+            errors.append(f'{name} is {header_define(name)}, activity.py has {value}')
+    broken = [
+        ['OK\n'],
+        ['ACTIVITY romh 1 roml 2\n', 'OK\n'],
+        ['ACTIVITY romh 1 roml 2 window 3 command_area 0 commands 0 status 0 filtered -1\n'],
+        ['ACTIVITY roml 1 romh 2 window 3 command_area 0 commands 0 status 0 filtered 0\n'],
+        ['ERR usage: activity [reset]\n'],
+    ]
+    for lines in broken:
+        try:
+            activity.parse_export(lines)
+            errors.append(f'accepted {lines}')
+        except activity.ExportError:
+            pass
+    return errors
+
+
+def main():
+    with tempfile.TemporaryDirectory() as build_dir:
+        c = CLibrary(build_dir)
+        failures = 0
+        for seed in range(50):
+            errors = check_counts(c, seed) + check_led(c, seed)
+            failures += bool(errors)
+            for error in errors:
+                print(error)
+        errors = check_known(c) + check_export_format()
+        failures += len(errors)
+        for error in errors:
+            print(error)
+    print(f'{failures} failed' if failures else 'all OK')
+    sys.exit(1 if failures else 0)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,145 @@
+#!/usr/bin/env python
+"""Fetch the benchmark cartridge's results from the Pico and show them as rates.
+
+"bench on" over USB has the Pico serve c64-rom/benchmark_rom.asm instead of the loader from the
+next C64 reset.  The benchmark times with CIA 2's timers, in C64 cycles, copying 16 windows of
+1K into RAM with CMD_NEXT_PAGE between them, 64 round trips of a command that does nothing, and
+256 reads of the status.  It shows the results on the C64's screen, and sends them back to the
+Pico (see firmware/benchmark.h).  This reads them with the "bench" command and converts them
+with --video's clock.  --on and --off switch the benchmark in and out first:
+
+    python tools/benchmark.py --on      # then reset the C64
+    python tools/benchmark.py --video ntsc
+    python tools/benchmark.py --off
+
+The parsing here follows benchmark.c's export line for line; tools/benchmark_test.py holds the
+two together.
+"""
+import argparse
+import sys
+
+import c64cart
+
+# From firmware/benchmark.h
+COPY_WINDOWS = 16       # BENCHMARK_COPY_WINDOWS
+WINDOW_SIZE = 1024      # BENCHMARK_WINDOW_SIZE
+ROUND_TRIPS = 64        # BENCHMARK_ROUND_TRIPS
+POLLS = 256             # BENCHMARK_POLLS
+
+# benchmark_result_t order, and what each result is the cycles for
+RESULTS = ['copy', 'round_trip', 'poll']
+COUNTS = {'copy': COPY_WINDOWS * WINDOW_SIZE, 'round_trip': ROUND_TRIPS, 'poll': POLLS}
+
+
+def export(cycles):
+    """The text the "bench" USB command prints before its OK, for a dict of result name to
+    cycles"""
+    lines = [f'BENCHMARK results {len(cycles)} of {len(RESULTS)}']
+    lines += [f'BENCH {name} cycles {cycles[name]} count {COUNTS[name]}'
+              for name in RESULTS if name in cycles]
+    return ''.join(line + '\n' for line in lines)
+
+
+class ExportError(ValueError):
+    pass
+
+
+def parse_export(lines):
+    """Return a dict of result name to cycles from the lines the "bench" USB command prints, up
+    to its OK.  Other lines are log output and are skipped."""
+    cycles = {}
+    summary = None
+    for line in lines:
+        words = line.split()
+        if not words:
+            continue
+        if words[0] == 'OK':
+            break
+        if words[0] == 'ERR':
+            raise ExportError(line.strip())
+        if words[0] == 'BENCHMARK':
+            if len(words) != 5 or not words[2].isdigit() or not words[4].isdigit():
+                raise ExportError(f'bad summary: {line.strip()}')
+            summary = int(words[2]), int(words[4])
+        elif words[0] == 'BENCH':
+            fields = dict(zip(words[2::2], words[3::2]))
+            if len(words) < 2 or words[1] not in COUNTS:
+                raise ExportError(f'no result {" ".join(words[1:2])}')
+            try:
+                cycles[words[1]] = int(fields['cycles'])
+                count = int(fields['count'])
+            except (KeyError, ValueError):
+                raise ExportError(f'bad result: {line.strip()}')
+            if count != COUNTS[words[1]]:
+                raise ExportError(f'{words[1]} is for {count}, expected {COUNTS[words[1]]}')
+    if summary is None:
+        raise ExportError('no BENCHMARK line')
+    if summary != (len(cycles), len(RESULTS)):
+        raise ExportError(f'summary has {summary[0]} of {summary[1]} results, '
+                          f'there are {len(cycles)} of {len(RESULTS)}')
+    return cycles
+
+
+def describe(name, cycles, phi2_hz):
+    """A result as a rate at the C64's clock"""
+    count = COUNTS[name]
+    seconds = cycles / phi2_hz
+    if name == 'copy':
+        return (f'{count // 1024}K in {seconds * 1000:.1f} ms: {count / seconds / 1024:.1f} KiB/s, '
+                f'{cycles / count:.2f} cycles a byte')
+    if name == 'round_trip':
+        return (f'{count} commands in {seconds * 1000:.1f} ms: {seconds * 1e6 / count:.1f} µs, '
+                f'{cycles / count:.1f} cycles each')
+    return f'{count} polls in {cycles} cycles: {cycles / count:.2f} cycles each'
+
+
+def command(port, text):
+    """Send a USB command and return its lines up to the OK"""
+    port.write(f'{text}\n'.encode())
+    lines = []
+    while True:
+        line = port.readline().decode('ascii', 'replace')
+        if not line:
+            raise TimeoutError('no response from pico')
+        lines.append(line)
+        if line.startswith(('OK', 'ERR')):
+            return lines
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--port', default='/dev/ttyACM0')
+    parser.add_argument('--video', choices=c64cart.PHI2_HZ, default='pal',
+                        help="the C64's video standard, for its clock (default %(default)s)")
+    switch = parser.add_mutually_exclusive_group()
+    switch.add_argument('--on', action='store_true',
+                        help='serve the benchmark from the next C64 reset, and forget the results')
+    switch.add_argument('--off', action='store_true', help='serve the loader again')
+    args = parser.parse_args()
+
+    import serial  # pyserial, only needed when talking to the hardware
+
+    with serial.Serial(args.port, timeout=2) as port:
+        for flag, text in ((args.on, 'bench on'), (args.off, 'bench off')):
+            if flag:
+                lines = command(port, text)
+                if lines[-1].startswith('ERR'):
+                    sys.exit(f'pico: {lines[-1].strip()}')
+        try:
+            cycles = parse_export(command(port, 'bench'))
+        except ExportError as e:
+            sys.exit(f'pico: {e}')
+
+    if args.on:
+        print('reset the C64 to run the benchmark')
+    if not cycles:
+        print('no results yet')
+    for name in RESULTS:
+        if name in cycles:
+            print(f'{name:10} {cycles[name]:8} cycles  '
+                  + describe(name, cycles[name], c64cart.PHI2_HZ[args.video]))
+
+
+if __name__ == '__main__':
+    main()
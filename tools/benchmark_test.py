@@ -0,0 +1,346 @@
+#!/usr/bin/env python
+"""Test the benchmark cartridge: firmware/benchmark.c against tools/benchmark.py, and
+c64-rom/benchmark_rom.bin on an emulated 6502.
+
+benchmark.c is compiled with the host's C compiler ($CC, default cc) and called through ctypes.
+Both must export the same text for any results that have come, which benchmark.py must parse
+back, and the firmware must refuse a result it doesn't have.  The constants in
+benchmark_rom.asm must be the ones in benchmark.h, command_dispatch.h and benchmark.py.
+
+benchmark_rom.bin then runs against c64cart.Cartridge with a model of CIA 2's timers, and
+firmware/command_dispatch.c built for the host (see tools/command_replay.py) taking its commands,
+with CMD_NEXT_PAGE moving a different 1K into the window each time.  The results it shows and
+sends must be what the timers counted less the overhead, the poll loop's must be exactly its
+cycle count, the copy must end with the last window in RAM, and the round trips must take as
+long as the modelled command time:
+
+    python tools/benchmark_test.py
+"""
+import ctypes
+import os
+import re
+import sys
+import tempfile
+
+import benchmark
+import c64cart
+import command_replay
+import host_c
+import mos6502
+
+FIRMWARE_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'firmware')
+C64_ROM_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'c64-rom')
+
+KERNAL_STUBS = (0xff81, 0xff84)  # CINT, IOINIT
+NUFLI_OFFSET = 0x400             # where the window is in the ROM area
+COPY_DEST = 0xc000               # copy_dest in benchmark_rom.asm
+RESULTS_ADDRESS = 0xc400         # results
+SCREEN = 0x0400
+RESULT_ROW = 2
+VALUE_COLUMN = 13
+CMD_NEXT_PAGE = 0x01
+CMD_PING = 0x06
+CMD_BENCH_RESULT = 0x07
+
+# How long the modelled Pico takes over each opcode, in µs
+COMMAND_US = {CMD_NEXT_PAGE: 20.0, CMD_PING: 5.0, CMD_BENCH_RESULT: 2.0}
+# The poll loop: ldx #0, then 256 of lda (4) dex (2) bne (3, or 2 the last time)
+POLL_CYCLES = 2 + benchmark.POLLS * 9 - 1
+# Most a round trip's wait can take past the command: up to a status read loop (7) late,
+# and the lda, dey and bne around it
+ROUND_TRIP_SLACK = 20
+
+
+class CBenchmarkResults(ctypes.Structure):
+    _fields_ = [('cycles', ctypes.c_uint32 * len(benchmark.RESULTS)),
+                ('received', ctypes.c_uint32)]
+
+
+class CBenchmark:
+    """firmware/benchmark.c, compiled for the host"""
+
+    def __init__(self, build_dir):
+        self.lib = host_c.load(build_dir, 'benchmark.c')
+        self.lib.benchmark_record.restype = ctypes.c_bool
+        self.lib.benchmark_name.restype = ctypes.c_char_p
+        self.lib.benchmark_count.restype = ctypes.c_uint32
+        self.lib.benchmark_export.restype = ctypes.c_size_t
+        self.results = CBenchmarkResults()
+        self.lib.benchmark_reset(ctypes.byref(self.results))
+
+    def record(self, index, cycles):
+        return self.lib.benchmark_record(ctypes.byref(self.results), ctypes.c_uint(index),
+                                         ctypes.c_uint32(cycles))
+
+    def export(self, size=None):
+        """The text, and the length benchmark_export returned"""
+        out = ctypes.create_string_buffer(header_define('benchmark.h', 'BENCHMARK_EXPORT_MAX'))
+        size = len(out) if size is None else size
+        length = self.lib.benchmark_export(ctypes.byref(self.results), out,
+                                           ctypes.c_size_t(size))
+        return out.value.decode(), length
+
+
+def header_define(header, name):
+    # BENCHMARK_EXPORT_MAX is in terms of the enum
+    return host_c.header_define(header, name, {'BENCHMARK_RESULTS': len(benchmark.RESULTS)})
+
+
+def asm_constants():
+    """The .const values in benchmark_rom.asm"""
+    with open(os.path.join(C64_ROM_DIR, 'benchmark_rom.asm')) as f:
+        return {name: int(value[1:], 16) if value.startswith('$') else int(value)
+                for name, value in re.findall(r'\.const (\w+) = (\$?[0-9a-fA-F]+)\b', f.read())}
+
+
+CASES = [
+    {},
+    {'copy': 123456},
+    {'round_trip': 1890, 'poll': 2305},
+    {'copy': 0, 'round_trip': 0, 'poll': 0},
+    {'copy': 0xffffffff, 'round_trip': 0xffffffff, 'poll': 0xffffffff},
+]
+
+
+def check_c(build_dir):
+    """Error messages for benchmark.c against benchmark.py"""
+    errors = []
+    for cycles in CASES:
+        c = CBenchmark(build_dir)
+        for name, value in cycles.items():
+            if not c.record(benchmark.RESULTS.index(name), value):
+                errors.append(f'C refuses {name}')
+        if c.record(len(benchmark.RESULTS), 1):
+            errors.append('C records a result it doesn\'t have')
+        text, length = c.export()
+        if text != benchmark.export(cycles) or length != len(text):
+            errors.append(f'C exports {text!r} for {cycles}')
+            continue
+        try:
+            parsed = benchmark.parse_export(['log output\n'] + text.splitlines(True)
+                                            + ['OK\n', 'BENCH copy cycles 1 count 16384\n'])
+        except benchmark.ExportError as e:
+            errors.append(f'{cycles} doesn\'t parse: {e}')
+            continue
+        if parsed != cycles:
+            errors.append(f'{cycles} parses as {parsed}')
+        # A short buffer gets a truncated export, and the full length like snprintf
+        short, length = c.export(10)
+        if short != text[:9] or length != len(text):
+            errors.append(f'{cycles}: truncated export is wrong')
+    c = CBenchmark(build_dir)
+    for index, name in enumerate(benchmark.RESULTS):
+        if (c.lib.benchmark_name(index), c.lib.benchmark_count(index)) != (
+                name.encode(), benchmark.COUNTS[name]):
+            errors.append(f'C has result {index} as {c.lib.benchmark_name(index)}')
+    if c.lib.benchmark_name(len(benchmark.RESULTS)) is not None:
+        errors.append('C names a result it doesn\'t have')
+    # Worked out by hand
+    c = CBenchmark(build_dir)
+    c.record(benchmark.RESULTS.index('copy'), 123456)
+    text, _ = c.export()
+    if text != 'BENCHMARK results 1 of 3\nBENCH copy cycles 123456 count 16384\n':
+        errors.append(f'C exports {text!r} for a copy of 123456 cycles')
+    if header_define('benchmark.h', 'BENCHMARK_EXPORT_MAX') <= len(benchmark.export(CASES[-1])):
+        errors.append('BENCHMARK_EXPORT_MAX is too short')
+
+    broken = [
+        ['OK\n'],
+        ['BENCHMARK results 2 of 3\n', 'BENCH copy cycles 5 count 16384\n', 'OK\n'],
+        ['BENCHMARK results 1 of 3\n', 'BENCH copy cycles 5 count 1024\n', 'OK\n'],
+        ['BENCHMARK results 1 of 3\n', 'BENCH flops cycles 5 count 1\n', 'OK\n'],
+        ['BENCHMARK results 1 of 3\n', 'BENCH poll cycles many count 256\n', 'OK\n'],
+        ['ERR usage: bench [on|off]\n'],
+    ]
+    for lines in broken:
+        try:
+            benchmark.parse_export(lines)
+            errors.append(f'accepted {lines}')
+        except benchmark.ExportError:
+            pass
+    return errors
+
+
+def check_constants():
+    """Error messages for benchmark_rom.asm's constants against the firmware and benchmark.py"""
+    errors = []
+    asm = asm_constants()
+    expected = {
+        'COPY_WINDOWS': (header_define('benchmark.h', 'BENCHMARK_COPY_WINDOWS'),
+                         benchmark.COPY_WINDOWS),
+        'ROUND_TRIPS': (header_define('benchmark.h', 'BENCHMARK_ROUND_TRIPS'),
+                        benchmark.ROUND_TRIPS),
+        'POLLS': (header_define('benchmark.h', 'BENCHMARK_POLLS'), benchmark.POLLS),
+        'NUM_RESULTS': (len(benchmark.RESULTS), len(benchmark.RESULTS)),
+    }
+    with open(os.path.join(FIRMWARE_DIR, 'command_dispatch.h')) as f:
+        opcodes = {name: int(value, 16) for name, value in
+                   re.findall(r'(CMD_\w+) = (0x[0-9a-fA-F]+)', f.read())}
+    for name in ('CMD_NEXT_PAGE', 'CMD_PING', 'CMD_BENCH_RESULT'):
+        expected[name] = (opcodes[name], opcodes[name])
+    for name, (header, python) in expected.items():
+        if not asm.get(name) == header == python:
+            errors.append(f'{name} is {asm.get(name)} in the .asm, {header} in the firmware '
+                          f'and {python} here')
+    if header_define('benchmark.h', 'BENCHMARK_WINDOW_SIZE') != benchmark.WINDOW_SIZE:
+        errors.append('BENCHMARK_WINDOW_SIZE differs from benchmark.py')
+    if (CMD_NEXT_PAGE, CMD_PING, CMD_BENCH_RESULT) != (
+            opcodes['CMD_NEXT_PAGE'], opcodes['CMD_PING'], opcodes['CMD_BENCH_RESULT']):
+        errors.append('the opcodes here differ from command_dispatch.h')
+    return errors
+
+
+class BenchmarkCartridge(c64cart.Cartridge):
+    """The cartridge serving the benchmark, with CIA 2's timers and the host-built dispatcher.
+
+    Only the mode the benchmark uses is modelled: timer B counting timer A's underflows, both
+    from $ffff, so together they count 32 bits of cycles down from $ffffffff.  They start when
+    control register A's start bit is written and stop when it's cleared."""
+
+    def __init__(self, rom, build_dir, video='pal'):
+        super().__init__(rom, video=video)
+        self.dispatcher = command_replay.Dispatcher(build_dir)
+        self.timer_start = None      # cycle the timers started
+        self.timer_stop = None       # and stopped, or None while running
+        self.intervals = []          # cycles between each start and stop
+        self.window = 0
+        self.load_window()
+        self.received = {}           # index -> cycles, from CMD_BENCH_RESULT
+        for address in KERNAL_STUBS:
+            self.ram[address] = 0x60  # rts
+
+    @staticmethod
+    def window_bytes(window):
+        return bytes((i * 7 + window * 37) & 0xff for i in range(benchmark.WINDOW_SIZE))
+
+    def load_window(self):
+        self.rom[NUFLI_OFFSET:NUFLI_OFFSET + benchmark.WINDOW_SIZE] = \
+            self.window_bytes(self.window)
+
+    def command_duration(self, command):
+        return COMMAND_US.get(self.dispatcher.opcode(command), 1.0)
+
+    def handle_command(self, command):
+        _, calls = self.dispatcher.dispatch(command)
+        for call in calls:
+            if call[0] == 'next_page':
+                self.window += 1
+                self.load_window()
+            elif call[0] == 'bench_result':
+                self.received[call[1]] = call[2]
+
+    def timer_value(self):
+        if self.timer_start is None:
+            return 0xffffffff
+        end = self.timer_stop if self.timer_stop is not None else self.cpu.cycles
+        return (0xffffffff - (end - self.timer_start)) & 0xffffffff
+
+    def read(self, address):
+        if 0xdd04 <= address < 0xdd08 and self.io_visible():
+            return (self.timer_value() >> (8 * (address - 0xdd04))) & 0xff
+        return super().read(address)
+
+    def write(self, address, value):
+        if address == 0xdd0e and self.io_visible():
+            if value & 0x01:
+                self.timer_start, self.timer_stop = self.cpu.cycles, None
+            elif self.timer_start is not None and self.timer_stop is None:
+                self.timer_stop = self.cpu.cycles
+                self.intervals.append(self.timer_stop - self.timer_start)
+        super().write(address, value)
+
+
+def run(build_dir, max_cycles=2_000_000):
+    """Boot the benchmark and run it until it loops on itself at the end"""
+    with open(os.path.join(C64_ROM_DIR, 'benchmark_rom.bin'), 'rb') as f:
+        cartridge = BenchmarkCartridge(f.read(), build_dir)
+    cpu = mos6502.Cpu(cartridge)
+    cartridge.attach(cpu)
+    cpu.pc = cpu.read16(0x8000)  # the KERNAL jumps through the cartridge's cold start vector
+    while True:
+        if cpu.cycles > max_cycles:
+            raise RuntimeError(f'still running after {max_cycles} cycles, at ${cpu.pc:04X}')
+        cpu.step()
+        if cpu.pc == cpu.last_opcode_pc:
+            break
+    cartridge.update()
+    return cartridge, cpu
+
+
+def screen_value(cartridge, row):
+    """The hex the benchmark shows on a row, as an int"""
+    start = SCREEN + row * 40 + VALUE_COLUMN
+    digits = ''
+    for code in cartridge.ram[start:start + 8]:
+        if 0x30 <= code <= 0x39:
+            digits += chr(code)
+        elif 1 <= code <= 6:
+            digits += 'ABCDEF'[code - 1]
+        else:
+            return None
+    return int(digits, 16)
+
+
+def check_run(build_dir):
+    """Error messages from running benchmark_rom.bin, and the results it sent"""
+    errors = []
+    cartridge, cpu = run(build_dir)
+    if len(cartridge.intervals) != 1 + len(benchmark.RESULTS):
+        return [f'the timers ran {len(cartridge.intervals)} times'], {}
+    overhead = cartridge.intervals[0]
+    expected = [interval - overhead for interval in cartridge.intervals[1:]]
+    stored = [int.from_bytes(cartridge.ram[RESULTS_ADDRESS + 4 * i:RESULTS_ADDRESS + 4 * i + 4],
+                             'little') for i in range(len(benchmark.RESULTS))]
+    if stored != expected:
+        errors.append(f'results {stored}, timers counted {expected} past the overhead')
+    shown = [screen_value(cartridge, RESULT_ROW + i) for i in range(len(benchmark.RESULTS))]
+    if shown != expected:
+        errors.append(f'screen shows {shown}')
+    sent = [cartridge.received.get(i) for i in range(len(benchmark.RESULTS))]
+    if sent != expected:
+        errors.append(f'sent {sent}')
+    results = dict(zip(benchmark.RESULTS, expected))
+
+    if results['poll'] != POLL_CYCLES:
+        errors.append(f'poll took {results["poll"]} cycles, expected {POLL_CYCLES}')
+    ping = int(COMMAND_US[CMD_PING] * cartridge.cycles_per_us)
+    if not ping * benchmark.ROUND_TRIPS <= results['round_trip'] \
+            <= (ping + ROUND_TRIP_SLACK) * benchmark.ROUND_TRIPS:
+        errors.append(f'round trips took {results["round_trip"]} cycles, for {ping} each')
+    next_page = int(COMMAND_US[CMD_NEXT_PAGE] * cartridge.cycles_per_us)
+    if results['copy'] < benchmark.COPY_WINDOWS * next_page + benchmark.COUNTS['copy'] * 9:
+        errors.append(f'copy took {results["copy"]} cycles, too few for 9 a byte')
+    if cartridge.window != benchmark.COPY_WINDOWS:
+        errors.append(f'{cartridge.window} windows paged in')
+    last = bytes(cartridge.ram[COPY_DEST:COPY_DEST + benchmark.WINDOW_SIZE])
+    if last != cartridge.window_bytes(benchmark.COPY_WINDOWS - 1):
+        errors.append('copy_dest doesn\'t hold the last window')
+
+    # The benchmark unlocks once, so must stay under the guard's COMMAND_GUARD_COMMANDS
+    if len(cartridge.commands) >= 128:
+        errors.append(f'{len(cartridge.commands)} commands after one unlock')
+    if cartridge.locked or cartridge.rx or cartridge.pending:
+        errors.append('commands left unhandled')
+    return errors, results
+
+
+def main():
+    failures = 0
+    with tempfile.TemporaryDirectory() as build_dir:
+        run_errors, results = check_run(build_dir)
+        checks = [('C against benchmark.py', check_c(build_dir)),
+                  ('constants', check_constants()),
+                  ('benchmark_rom.bin', run_errors)]
+    for name, errors in checks:
+        print(f'{name}: ' + ('OK' if not errors else ''.join(f'  FAIL: {e}' for e in errors)))
+        failures += bool(errors)
+    for name, cycles in results.items():
+        print(f'{name:10} {cycles:8} cycles  '
+              + benchmark.describe(name, cycles, c64cart.PHI2_HZ['pal']))
+
+    print(f'{failures} failed' if failures else 'all OK')
+    sys.exit(1 if failures else 0)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,648 @@
+#!/usr/bin/env python
+"""Assemble the C64 ROMs without KickAssembler.
+
+c64-rom/Makefile builds loader_rom.bin and benchmark_rom.bin with KickAssembler, and they're
+checked in so the firmware builds without it.  This assembles the subset of KickAssembler the
+.asm files there use, to the same bytes, so the checked-in binaries can be rebuilt and checked
+against their sources anywhere Python runs (see tools/c64asm_test.py):
+
+    python tools/c64asm.py c64-rom/loader_rom.asm
+
+The subset: .label/.const/.var, .byte/.word/.text/.fill, .encoding "petscii_mixed" and
+"screencode_upper", .segmentdef/.segment/.file for one binary, .pseudopc, .for, .if, .errorif
+and .macro, anonymous !: labels, List(), floor(), mod() and toIntString(), and the 6502's
+documented instructions.  Zero page addressing is used where the address is known to be under
+$100 when the instruction is reached, as KickAssembler does.  Anything else is an AsmError.
+"""
+import argparse
+import math
+import os
+import re
+import sys
+
+import mos6502
+
+OPCODES = {(name, mode): opcode for opcode, (name, mode, cycles) in mos6502.OPCODES.items()}
+OPCODES[('jsr', 'abs')] = OPCODES.pop(('jsr', 'imp'))
+MNEMONICS = {name for name, mode in OPCODES}
+OPERAND_SIZES = {'imp': 0, 'acc': 0, 'imm': 1, 'zp': 1, 'zpx': 1, 'zpy': 1, 'izx': 1, 'izy': 1,
+                 'rel': 1, 'abs': 2, 'abx': 2, 'aby': 2, 'ind': 2}
+
+MAX_PASSES = 10
+
+
+class AsmError(ValueError):
+    pass
+
+
+def encode(text, encoding):
+    """Bytes for a string or character in the encoding"""
+    out = bytearray()
+    for char in text:
+        code = ord(char)
+        if encoding == 'petscii_mixed':
+            if 'a' <= char <= 'z':
+                code -= 0x20
+            elif 'A' <= char <= 'Z':
+                code += 0x80
+        elif encoding == 'screencode_upper':
+            if '@' <= char <= '_':
+                code -= 0x40
+            elif 'a' <= char <= 'z':
+                code -= 0x60
+        if code > 0xff:
+            raise AsmError(f'{char!r} has no {encoding} code')
+        out.append(code)
+    return bytes(out)
+
+
+class Char(str):
+    """A character literal, which is a number in the current encoding"""
+
+
+class List(list):
+    def add(self, *values):
+        self.extend(values)
+        return self
+
+    def get(self, index):
+        return self[int(index)]
+
+    def size(self):
+        return len(self)
+
+
+class String(str):
+    def size(self):
+        return len(self)
+
+
+# Expressions: numbers, strings, names, calls and method calls, and C's operators
+TOKEN = re.compile(r'\s*(?:(\$[0-9a-fA-F]+|%[01]+|\d+(?:\.\d+)?)|("[^"]*")|(\'[^\']\')|'
+                   r'([A-Za-z_]\w*)|(<<|>>|==|!=|<=|>=|&&|\|\||[-+*/&|^<>!(),.~]))')
+BINARY = {
+    '||': (1, lambda a, b: a or b), '&&': (2, lambda a, b: a and b),
+    '|': (3, lambda a, b: a | b), '^': (4, lambda a, b: a ^ b), '&': (5, lambda a, b: a & b),
+    '==': (6, lambda a, b: a == b), '!=': (6, lambda a, b: a != b),
+    '<': (7, lambda a, b: a < b), '>': (7, lambda a, b: a > b),
+    '<=': (7, lambda a, b: a <= b), '>=': (7, lambda a, b: a >= b),
+    '<<': (8, lambda a, b: a << b), '>>': (8, lambda a, b: a >> b),
+    '+': (9, None), '-': (9, lambda a, b: a - b),
+    '*': (10, lambda a, b: a * b), '/': (10, lambda a, b: a / b),
+}
+
+
+class Unknown(Exception):
+    """A label that isn't defined yet in this pass"""
+
+
+def tokenize(text):
+    tokens = []
+    position = 0
+    text = text.rstrip()
+    while position < len(text):
+        match = TOKEN.match(text, position)
+        if not match:
+            raise AsmError(f'can\'t parse {text[position:]!r}')
+        number, string, char, name, operator = match.groups()
+        if number:
+            if number[0] == '$':
+                tokens.append(('value', int(number[1:], 16)))
+            elif number[0] == '%':
+                tokens.append(('value', int(number[1:], 2)))
+            else:
+                tokens.append(('value', float(number) if '.' in number else int(number)))
+        elif string:
+            tokens.append(('value', String(string[1:-1])))
+        elif char:
+            tokens.append(('value', Char(char[1])))
+        elif name:
+            tokens.append(('name', name))
+        else:
+            tokens.append(('op', operator))
+        position = match.end()
+    return tokens
+
+
+class Expression:
+    """A parser and evaluator for one expression, with names looked up in the assembler"""
+
+    def __init__(self, assembler, text):
+        self.assembler = assembler
+        self.tokens = tokenize(text)
+        self.position = 0
+
+    def peek(self):
+        return self.tokens[self.position] if self.position < len(self.tokens) else (None, None)
+
+    def take(self, op=None):
+        token = self.peek()
+        if op is not None and token != ('op', op):
+            raise AsmError(f'expected {op!r}')
+        self.position += 1
+        return token
+
+    def evaluate(self):
+        value = self.binary(0)
+        if self.position != len(self.tokens):
+            raise AsmError(f'unexpected {self.peek()[1]!r}')
+        return value
+
+    def number(self, value):
+        if isinstance(value, Char):
+            return self.assembler.encode(value)[0]
+        return value
+
+    def binary(self, level):
+        left = self.unary()
+        while True:
+            kind, op = self.peek()
+            if kind != 'op' or op not in BINARY or BINARY[op][0] <= level:
+                return left
+            self.take()
+            right = self.binary(BINARY[op][0])
+            if op == '+':
+                if isinstance(left, str) or isinstance(right, str):
+                    left = String(f'{left}{right}')
+                else:
+                    left = left + right
+            elif op in ('&&', '||'):
+                left = BINARY[op][1](left, right)
+            else:
+                left = BINARY[op][1](self.number(left), self.number(right))
+                if op in ('|', '^', '&', '<<', '>>') and not isinstance(left, int):
+                    raise AsmError(f'{op} needs integers')
+
+    def unary(self):
+        kind, op = self.peek()
+        if kind == 'op' and op in ('-', '<', '>', '!', '~'):
+            self.take()
+            value = self.number(self.unary())
+            return {'-': lambda v: -v, '<': lambda v: int(v) & 0xff,
+                    '>': lambda v: int(v) >> 8 & 0xff, '!': lambda v: not v,
+                    '~': lambda v: ~int(v)}[op](value)
+        return self.postfix()
+
+    def arguments(self):
+        self.take('(')
+        values = []
+        if self.peek() != ('op', ')'):
+            values.append(self.binary(0))
+            while self.peek() == ('op', ','):
+                self.take()
+                values.append(self.binary(0))
+        self.take(')')
+        return values
+
+    def postfix(self):
+        kind, token = self.take()
+        if kind == 'value':
+            value = token
+        elif kind == 'name':
+            if self.peek() == ('op', '('):
+                value = self.call(token, self.arguments())
+            else:
+                value = self.assembler.lookup(token)
+        elif (kind, token) == ('op', '('):
+            value = self.binary(0)
+            self.take(')')
+        else:
+            raise AsmError(f'unexpected {token!r}')
+        while self.peek() == ('op', '.'):
+            self.take()
+            kind, method = self.take()
+            if kind != 'name' or not hasattr(value, method):
+                raise AsmError(f'no method {method}')
+            value = getattr(value, method)(*self.arguments())
+        return value
+
+    def call(self, name, args):
+        functions = {'floor': lambda x: math.floor(x), 'mod': lambda a, b: a % b,
+                     'toIntString': lambda x: String(str(int(x))), 'List': List}
+        if name not in functions:
+            raise AsmError(f'no function {name}')
+        return functions[name](*[self.number(arg) for arg in args])
+
+
+def split_top(text, separator=','):
+    """Split at separators outside parentheses and quotes"""
+    parts, depth, quote, start = [], 0, None, 0
+    for i, char in enumerate(text):
+        if quote:
+            quote = None if char == quote else quote
+        elif char in '"\'':
+            quote = char
+        elif char == '(':
+            depth += 1
+        elif char == ')':
+            depth -= 1
+        elif char == separator and depth == 0:
+            parts.append(text[start:i].strip())
+            start = i + 1
+    parts.append(text[start:].strip())
+    return parts
+
+
+def closing_paren(text):
+    """Where the parenthesis text starts with is closed"""
+    depth = 0
+    for i, char in enumerate(text):
+        depth += {'(': 1, ')': -1}.get(char, 0)
+        if depth == 0:
+            return i
+    raise AsmError(f'unclosed ( in {text!r}')
+
+
+def strip_comment(line):
+    quote = None
+    for i, char in enumerate(line):
+        if quote:
+            quote = None if char == quote else quote
+        elif char in '"\'':
+            quote = char
+        elif line.startswith('//', i):
+            return line[:i]
+    return line
+
+
+class Node:
+    def __init__(self, number, text, children=None):
+        self.number = number
+        self.text = text
+        self.children = children
+
+
+def parse_blocks(lines):
+    """Statements, with a directive ending in { holding the statements up to its }"""
+    stack = [[]]
+    for number, line in enumerate(lines, 1):
+        text = strip_comment(line).strip()
+        if not text:
+            continue
+        if text == '}':
+            if len(stack) == 1:
+                raise AsmError(f'line {number}: unmatched }}')
+            stack.pop()
+        elif text.endswith('{'):
+            node = Node(number, text[:-1].strip(), [])
+            stack[-1].append(node)
+            stack.append(node.children)
+        else:
+            stack[-1].append(Node(number, text))
+    if len(stack) != 1:
+        raise AsmError('unclosed {')
+    return stack[0]
+
+
+def parameters(text):
+    """The name=value pairs of a [...] list"""
+    match = re.fullmatch(r'\[(.*)\]', text.strip())
+    if not match:
+        raise AsmError(f'expected [...], not {text!r}')
+    return dict((part.split('=', 1)[0].strip(), part.split('=', 1)[1].strip())
+                for part in split_top(match.group(1)) if part)
+
+
+class Segment:
+    def __init__(self, name, params):
+        self.name = name
+        self.params = params
+        self.memory = {}
+
+
+class Assembler:
+    def __init__(self, source):
+        self.nodes = parse_blocks(source.splitlines())
+
+    def assemble(self):
+        """The .file's bytes, and its name"""
+        previous = None
+        for _ in range(MAX_PASSES):
+            self.final = False
+            anonymous = getattr(self, 'anonymous_done', None)
+            self.run_pass(previous)
+            if (self.labels, self.anonymous) == (previous, anonymous):
+                break
+            previous = self.labels
+        else:
+            raise AsmError('labels don\'t settle')
+        self.final = True
+        self.run_pass(previous)
+        return self.output(), self.file['name'].strip('"')
+
+    def run_pass(self, previous):
+        self.previous = previous or {}
+        self.labels = {}
+        self.scopes = []
+        self.macros = {}
+        self.anonymous = []
+        self.anonymous_previous = getattr(self, 'anonymous_done', [])
+        self.unknown = False
+        self.forward = False
+        self.encoding = 'screencode_upper'
+        self.segments = {}
+        self.segment = None
+        self.pc = None
+        self.pseudo = 0     # .pseudopc's offset from where the bytes go
+        self.file = None
+        self.run(self.nodes)
+        self.anonymous_done = self.anonymous
+
+    def encode(self, text):
+        return encode(text, self.encoding)
+
+    def lookup(self, name):
+        for scope in reversed(self.scopes):
+            if name in scope:
+                return scope[name]
+        if name in self.labels:
+            return self.labels[name]
+        self.forward = True
+        if name in self.previous:
+            return self.previous[name]
+        if self.final:
+            raise AsmError(f'unknown name {name}')
+        self.unknown = True
+        raise Unknown(name)
+
+    def value(self, text, default=None):
+        """An expression, or default if it needs a label that isn't known yet in this pass"""
+        text = text.strip()
+        if text in ('!+', '!-') or re.fullmatch(r'!\++|!-+', text):
+            return self.anonymous_label(text)
+        try:
+            return Expression(self, text).evaluate()
+        except Unknown:
+            if default is None:
+                raise AsmError(f'{text} needs labels defined after it')
+            return default
+
+    def anonymous_label(self, text):
+        count = len(text) - 1
+        if text[1] == '-':
+            index = len(self.anonymous) - count
+            if index < 0:
+                raise AsmError(f'no {text} label')
+            return self.anonymous[index]
+        index = len(self.anonymous) + count - 1
+        self.forward = True
+        if index < len(self.anonymous_previous):
+            return self.anonymous_previous[index]
+        if self.final:
+            raise AsmError(f'no {text} label')
+        self.unknown = True
+        return 0x10000
+
+    def define(self, name, value):
+        if name in self.labels:
+            raise AsmError(f'{name} is already defined')
+        self.labels[name] = value
+
+    def emit(self, data):
+        if self.segment is None or self.pc is None:
+            raise AsmError('no segment or address to put bytes at')
+        for byte in data:
+            address = self.pc - self.pseudo
+            if address in self.segment.memory:
+                raise AsmError(f'${address:04x} is written twice')
+            self.segment.memory[address] = byte
+            self.pc += 1
+        maximum = self.segment.params.get('max')
+        if maximum is not None and self.pc - self.pseudo > self.value(maximum) + 1:
+            raise AsmError(f'segment {self.segment.name} is over its max of {maximum}')
+
+    def run(self, nodes):
+        for node in nodes:
+            try:
+                self.statement(node)
+            except AsmError as e:
+                if str(e).startswith('line '):
+                    raise
+                raise AsmError(f'line {node.number}: {e}') from None
+
+    def statement(self, node):
+        text = node.text
+        label = re.match(r'(!|[A-Za-z_]\w*):\s*', text)
+        if label:
+            if label.group(1) == '!':
+                self.anonymous.append(self.pc)
+            else:
+                self.define(label.group(1), self.pc)
+            text = text[label.end():]
+            if not text:
+                return
+        if text.startswith('*='):
+            self.pc = int(self.value(text[2:]))
+            return
+        if text.startswith('.'):
+            self.directive(node, text)
+            return
+        word = re.match(r'[A-Za-z_]\w*', text)
+        if word and word.group(0) in self.macros and text[word.end():].lstrip().startswith('('):
+            parameters, body = self.macros[word.group(0)]
+            args = [self.value(arg) for arg in split_top(text[word.end():].strip()[1:-1]) if arg]
+            if len(args) != len(parameters):
+                raise AsmError(f'{word.group(0)} takes {len(parameters)} arguments')
+            self.scopes.append(dict(zip(parameters, args)))
+            self.run(body)
+            self.scopes.pop()
+            return
+        if word and word.group(0).lower() in MNEMONICS:
+            self.instruction(word.group(0).lower(), text[word.end():].strip())
+            return
+        raise AsmError(f'can\'t assemble {text!r}')
+
+    def directive(self, node, text):
+        name, _, rest = text.partition(' ')
+        rest = rest.strip()
+        if name in ('.label', '.const', '.var'):
+            match = re.fullmatch(r'([A-Za-z_]\w*)\s*=\s*(.+)', rest)
+            if not match:
+                raise AsmError(f'bad {name}')
+            value = self.value(match.group(2), default=0)
+            if self.scopes and name == '.var':
+                self.scopes[-1][match.group(1)] = value
+            else:
+                self.define(match.group(1), value)
+        elif name == '.byte':
+            self.emit([self.byte(part) for part in split_top(rest)])
+        elif name == '.word':
+            for part in split_top(rest):
+                value = self.integer(self.value(part, default=0), 0xffff)
+                self.emit([value & 0xff, value >> 8])
+        elif name == '.text':
+            value = self.value(rest)
+            if not isinstance(value, str):
+                raise AsmError('.text needs a string')
+            self.emit(self.encode(value))
+        elif name == '.fill':
+            count, byte = split_top(rest)
+            self.emit([self.byte(byte)] * self.integer(self.value(count), 0xffff))
+        elif name == '.encoding':
+            self.encoding = rest.strip('"')
+            if self.encoding not in ('petscii_mixed', 'screencode_upper'):
+                raise AsmError(f'no encoding {self.encoding}')
+        elif name == '.file':
+            self.file = parameters(rest)
+        elif name == '.segmentdef':
+            match = re.fullmatch(r'(\w+)\s*(\[.*\])?', rest)
+            params = parameters(match.group(2)) if match.group(2) else {}
+            self.segments[match.group(1)] = Segment(match.group(1), params)
+        elif name == '.segment':
+            match = re.fullmatch(r'(\w+)\s*(\[.*\])?', rest)
+            if match.group(1) not in self.segments:
+                params = parameters(match.group(2)) if match.group(2) else {}
+                self.segments[match.group(1)] = Segment(match.group(1), params)
+            self.segment = self.segments[match.group(1)]
+            start = self.segment.params.get('start')
+            self.pc = int(self.value(start)) if start else None
+        elif name == '.errorif':
+            condition, message = split_top(rest)
+            if self.final and self.value(condition):
+                raise AsmError(self.value(message))
+        elif name == '.pseudopc' and node.children is not None:
+            address = self.integer(self.value(rest, default=0), 0xffff)
+            saved = self.pseudo
+            self.pseudo = saved + address - self.pc
+            self.pc = address
+            self.run(node.children)
+            self.pc -= self.pseudo - saved
+            self.pseudo = saved
+        elif name.startswith('.if') and node.children is not None:
+            if self.value(text[3:].strip()):
+                self.run(node.children)
+        elif name.startswith('.for') and node.children is not None:
+            self.loop(text[4:].strip(), node.children)
+        elif name == '.macro' and node.children is not None:
+            match = re.fullmatch(r'([A-Za-z_]\w*)\s*\((.*)\)', rest)
+            self.macros[match.group(1)] = ([p.strip() for p in match.group(2).split(',') if p],
+                                           node.children)
+        else:
+            raise AsmError(f'no directive {text!r}')
+
+    def loop(self, header, body):
+        match = re.fullmatch(r'\(\s*var\s+(\w+)\s*=([^;]*);([^;]*);\s*(\w+)\s*(\+\+|--)\s*\)',
+                             header)
+        if not match or match.group(1) != match.group(4):
+            raise AsmError(f'can\'t loop over {header!r}')
+        name, step = match.group(1), 1 if match.group(5) == '++' else -1
+        scope = {name: self.value(match.group(2))}
+        self.scopes.append(scope)
+        while self.value(match.group(3)):
+            self.scopes.append({})
+            self.run(body)
+            self.scopes.pop()
+            scope[name] += step
+        self.scopes.pop()
+
+    def integer(self, value, maximum):
+        if isinstance(value, Char):
+            value = self.encode(value)[0]
+        if isinstance(value, float):
+            if not value.is_integer():
+                raise AsmError(f'{value} isn\'t a whole number')
+            value = int(value)
+        if not isinstance(value, int) or isinstance(value, bool):
+            raise AsmError(f'{value!r} isn\'t a number')
+        if self.final and not 0 <= value <= maximum:
+            raise AsmError(f'{value} is out of range')
+        return value & maximum
+
+    def byte(self, text):
+        return self.integer(self.value(text, default=0), 0xff)
+
+    def instruction(self, name, operand):
+        """Work out the addressing mode from the operand, and emit the instruction"""
+        if not operand:
+            mode = 'acc' if (name, 'acc') in OPCODES else 'imp'
+            self.opcode(name, mode)
+            return
+        if operand.startswith('#'):
+            self.opcode(name, 'imm', self.byte(operand[1:]))
+            return
+        parts = split_top(operand)
+        index = parts[1].lower() if len(parts) == 2 else None
+        if len(parts) > 2 or index not in (None, 'x', 'y'):
+            raise AsmError(f'bad operand {operand!r}')
+        base = parts[0]
+        indirect = base.startswith('(') and closing_paren(base) == len(base) - 1
+        if indirect and index == 'y':
+            self.opcode(name, 'izy', self.byte(base[1:-1]))
+            return
+        if indirect and name == 'jmp' and index is None:
+            self.opcode(name, 'ind', self.integer(self.value(base[1:-1], default=0), 0xffff))
+            return
+        inner = split_top(base[1:-1]) if indirect else []
+        if indirect and len(inner) == 2 and inner[1].lower() == 'x' and index is None:
+            self.opcode(name, 'izx', self.byte(inner[0]))
+            return
+        if (name, 'rel') in OPCODES:
+            target = self.integer(self.value(base, default=self.pc), 0xffff)
+            offset = target - (self.pc + 2)
+            if self.final and not -128 <= offset <= 127:
+                raise AsmError(f'branch to ${target:04x} is out of range')
+            self.opcode(name, 'rel', offset & 0xff)
+            return
+        # Forward references are absolute, as in KickAssembler
+        self.forward = False
+        value = self.value(base, default=0x10000)
+        known = not self.forward and value != 0x10000
+        value = self.integer(value, 0xffff) if known or self.final else 0
+        zero_page = {None: 'zp', 'x': 'zpx', 'y': 'zpy'}[index]
+        if known and value < 0x100 and (name, zero_page) in OPCODES:
+            self.opcode(name, zero_page, value)
+        else:
+            self.opcode(name, {None: 'abs', 'x': 'abx', 'y': 'aby'}[index], value)
+
+    def opcode(self, name, mode, operand=0):
+        if (name, mode) not in OPCODES:
+            raise AsmError(f'{name} has no {mode} mode')
+        size = OPERAND_SIZES[mode]
+        self.emit([OPCODES[(name, mode)]] + [operand >> (8 * i) & 0xff for i in range(size)])
+
+    def output(self):
+        if not self.file:
+            raise AsmError('no .file')
+        memory = {}
+        for name in self.file['segments'].strip('"').split(','):
+            if name not in self.segments:
+                raise AsmError(f'no segment {name}')
+            memory.update(self.segments[name].memory)
+        if not memory:
+            return b''
+        start = min(memory)
+        return bytes(memory.get(address, 0) for address in range(start, max(memory) + 1))
+
+
+def assemble(path):
+    """The bytes the .asm file at path assembles to, and the name of the file they go in"""
+    with open(path) as f:
+        source = f.read()
+    try:
+        return Assembler(source).assemble()
+    except AsmError as e:
+        raise AsmError(f'{path}: {e}') from None
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('source', nargs='+', help='.asm files')
+    parser.add_argument('-o', '--output-dir', help='where the .file goes (default: next to the '
+                                                  'source)')
+    parser.add_argument('-vicesymbols', action='store_true',
+                        help='accepted like KickAssembler\'s, but no symbol file is written')
+    args = parser.parse_args()
+    for path in args.source:
+        try:
+            data, name = assemble(path)
+        except AsmError as e:
+            sys.exit(str(e))
+        output = os.path.join(args.output_dir or os.path.dirname(path), name)
+        with open(output, 'wb') as f:
+            f.write(data)
+        print(f'{output}: {len(data)} bytes')
+
+
+if __name__ == '__main__':
+    main()
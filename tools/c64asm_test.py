@@ -0,0 +1,117 @@
+#!/usr/bin/env python
+"""Test tools/c64asm.py, and that the checked-in C64 ROMs are built from their sources.
+
+Each c64-rom/*.asm must assemble to exactly the .bin next to it, so a change to one without the
+other fails here.  The ROMs must start with the cartridge header the C64's KERNAL looks for.
+Small sources check the assembler against bytes worked out by hand from the 6502's opcode table:
+zero page and absolute addressing, forward references, branches, indirect modes, loops,
+.pseudopc and anonymous labels, and the errors KickAssembler would also give:
+
+    python tools/c64asm_test.py
+"""
+import glob
+import os
+import sys
+
+import c64asm
+
+C64_ROM_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'c64-rom')
+
+HEADER = '.file [name="t.bin", type="bin", segments="Code"]\n.segment Code [start=$8000]\n'
+
+# Source after HEADER, and the bytes it must assemble to
+CASES = [
+    ('lda $fb\nlda $fb, x\nlda $1234\nldx $fb, y\nsta $d020, y\n',
+     'a5 fb b5 fb ad 34 12 b6 fb 99 20 d0'),
+    ('.label zp = $fe\nsta zp\nlda (zp), y\nlda ($40, x)\njmp ($fffc)\n',
+     '85 fe b1 fe a1 40 6c fc ff'),
+    # A forward reference is absolute even when it turns out to be in the zero page
+    ('lda later\n.label later = $10\nlda later\n', 'ad 10 00 a5 10'),
+    ('loop: dex\nbne loop\nbeq done\nnop\ndone: rts\n', 'ca d0 fd f0 01 ea 60'),
+    ('!: inx\nbne !-\nbeq !+\nnop\n!: asl\njsr $ffd2\n', 'e8 d0 fd f0 01 ea 0a 20 d2 ff'),
+    ('.for (var i = 3; i > 0; i--) {\nlda #i * 2\n}\n', 'a9 06 a9 04 a9 02'),
+    ('.const L = List().add($43, $36)\n'
+     '.for (var i = 0; i < L.size(); i++) {\nlda $9e00 + L.get(i)\n}\n', 'ad 43 9e ad 36 9e'),
+    ('.if (mod(7, 4) == 3) {\nnop\n}\n.if (floor(7 / 4) == 2) {\nbrk\n}\n', 'ea'),
+    ('.word end, $1234\n.byte <end, >end\nend:\n', '06 80 34 12 06 80'),
+    ('jmp inner\ncode:\n.pseudopc $c000 {\ninner: jmp inner\n}\n', '4c 00 c0 4c 00 c0'),
+    ('.encoding "petscii_mixed"\n.text "CBM80"\n.encoding "screencode_upper"\n.text "AZ @"\n'
+     'lda #\'A\'\n', 'c3 c2 cd 38 30 01 1a 20 00 a9 01'),
+    ('.macro pad(s) {\n.text s\n.fill 4 - s.size(), \' \'\n}\n'
+     'pad("AB")\npad("" + toIntString(7))\n', '01 02 20 20 37 20 20 20'),
+]
+
+BROKEN = [
+    'start: bne far\n.fill 200, 0\nfar: rts\n',    # out of range branch
+    'lda undefined\n',
+    'lda #$100\n',
+    'stx $1234, x\n',                               # no such mode
+    '.errorif 1 > 0, "checked"\n',
+    'twice: nop\ntwice: nop\n',
+    'bogus\n',
+]
+
+
+def assemble(source):
+    return c64asm.Assembler(HEADER + source).assemble()[0]
+
+
+def check_assembler():
+    """Error messages for the small sources"""
+    errors = []
+    for source, expected in CASES:
+        try:
+            data = assemble(source)
+        except c64asm.AsmError as e:
+            errors.append(f'{source!r}: {e}')
+            continue
+        if data != bytes.fromhex(expected):
+            errors.append(f'{source!r} assembles to {data.hex(" ")}, expected {expected}')
+    for source in BROKEN:
+        try:
+            assemble(source)
+            errors.append(f'accepted {source!r}')
+        except c64asm.AsmError:
+            pass
+    return errors
+
+
+def check_roms():
+    """Error messages for the checked-in ROMs against their sources"""
+    errors = []
+    sources = sorted(glob.glob(os.path.join(C64_ROM_DIR, '*.asm')))
+    if not sources:
+        errors.append(f'no .asm files in {C64_ROM_DIR}')
+    for path in sources:
+        try:
+            data, name = c64asm.assemble(path)
+        except c64asm.AsmError as e:
+            errors.append(str(e))
+            continue
+        with open(os.path.join(C64_ROM_DIR, name), 'rb') as f:
+            checked_in = f.read()
+        if data != checked_in:
+            first = next((i for i, (a, b) in enumerate(zip(data, checked_in)) if a != b),
+                         min(len(data), len(checked_in)))
+            errors.append(f'{name} isn\'t what {os.path.basename(path)} assembles to: '
+                          f'{len(checked_in)} bytes against {len(data)}, first different at '
+                          f'${0x8000 + first:04x}')
+        # The KERNAL starts a cartridge with "CBM80" at $8004
+        if data[4:9] != bytes.fromhex('c3 c2 cd 38 30'):
+            errors.append(f'{name} has no cartridge signature')
+        start = data[0] | data[1] << 8
+        if not 0x8009 <= start < 0x8000 + len(data) or data[2:4] != data[0:2]:
+            errors.append(f'{name} starts at ${start:04x}')
+    return errors
+
+
+def main():
+    errors = check_assembler() + check_roms()
+    for error in errors:
+        print(error)
+    print(f'{len(errors)} failed' if errors else 'all OK')
+    sys.exit(1 if errors else 0)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,122 @@
+"""Behavioural model of the cartridge as the C64 sees it, for running C64 code on the host.
+
+The 16K ROM window at $8000-$BFFF returns bytes from the Pico's ROM area, except for the
+256 byte command area, which behaves like command.pio and the main loop in
+c64_pico_ram_interface.c:
+
+- The command area starts locked: reads aren't answered (they return OPEN_BUS) or queued,
+  until the last four offsets read are UNLOCK_MAGIC.  Relocking isn't modelled.
+- Reading offset 0 returns the status: $00 if the Pico is ready for a command, $ff if busy.
+- Reading any other offset returns the status and queues that offset as a command (up to the
+  4 entry RX FIFO).  A command received while ready makes the Pico busy.
+- The Pico takes queued commands one at a time.  Each takes a configurable time, after which
+  its effect is applied, and the Pico is ready again once there are none left.  Subclasses can
+  override command_duration and handle_command for commands that depend on the ones before.
+
+With eight_k (the switch in the 8K position), only ROML at $8000-$9FFF is the cartridge, and
+$A000-$BFFF reads the RAM where BASIC would be, for callers to put a stand-in in.
+
+Writes to the window go to the C64 RAM underneath.  There's no KERNAL, so $E000-$FFFF is plain
+RAM and callers should put stubs where the code under test expects KERNAL routines.  I/O at
+$D000-$DFFF is a block of write-only registers while the CPU port at $01 banks it in, and RAM
+otherwise (the character ROM isn't modelled).
+"""
+
+ROM_SIZE = 16384
+FIFO_DEPTH = 4
+UNLOCK_MAGIC = 0x43363421  # command.pio
+OPEN_BUS = 0xff            # what the C64 sees when nothing drives the bus (really varies)
+PHI2_HZ = {'pal': 985248, 'ntsc': 1022727}
+
+
+class Cartridge:
+    def __init__(self, rom, command_prefix=0x1e, video='pal', eight_k=False):
+        self.ram = bytearray(65536)
+        self.ram[0x01] = 0x37    # CPU port as the KERNAL leaves it: BASIC, KERNAL and I/O in
+        self.io = bytearray(0x1000)
+        self.rom = bytearray(rom) + bytearray(ROM_SIZE - len(rom))
+        self.command_prefix = command_prefix
+        self.rom_end = 0xa000 if eight_k else 0xc000
+        self.cycles_per_us = PHI2_HZ[video] / 1e6
+        self.cpu = None          # set by attach(), to read the clock
+        self.handlers = {}       # command -> (function(cartridge), duration in us)
+        self.ready = True        # the Pico's ready token is in the TX FIFO
+        self.rx = []             # commands waiting for the Pico's CPU
+        self.pending = None      # (finish cycle, command) being handled
+        self.command_reads = 0
+        self.busy_reads = 0
+        self.commands = []       # (cycle, command) of every command received
+        self.locked = True
+        self.sequence = 0        # the last four offsets read while locked
+        self.filtered_reads = 0
+
+    def attach(self, cpu):
+        self.cpu = cpu
+
+    def on_command(self, command, duration_us, function):
+        self.handlers[command] = (function, duration_us)
+
+    def update(self):
+        now = self.cpu.cycles if self.cpu else 0
+        while True:
+            if self.pending and now >= self.pending[0]:
+                self.handle_command(self.pending[1])
+                self.pending = None
+                self.ready = not self.rx  # main loop puts the ready token back once drained
+            if self.pending is None and self.rx:
+                command = self.rx.pop(0)
+                duration = self.command_duration(command)
+                self.pending = (now + int(duration * self.cycles_per_us), command)
+                continue
+            return
+
+    def command_duration(self, command):
+        """How long the Pico takes to handle a command, in µs, when it takes it"""
+        return self.handlers.get(command, (None, 0))[1]
+
+    def handle_command(self, command):
+        """Apply a command's effect, when the Pico has finished handling it"""
+        function = self.handlers.get(command, (None, 0))[0]
+        if function:
+            function(self)
+
+    def is_command_area(self, address):
+        return (address >> 8) & 0x3f == self.command_prefix
+
+    def read(self, address):
+        if 0x8000 <= address < self.rom_end:
+            if self.is_command_area(address):
+                return self.read_command(address & 0xff)
+            return self.rom[address & 0x3fff]
+        return self.ram[address]
+
+    def read_command(self, command):
+        if self.locked:
+            self.sequence = ((self.sequence << 8) | command) & 0xffffffff
+            if self.sequence == UNLOCK_MAGIC:
+                self.locked = False
+            else:
+                self.filtered_reads += 1
+            return OPEN_BUS
+        self.update()
+        self.command_reads += 1
+        status = 0x00 if self.ready else 0xff
+        if status:
+            self.busy_reads += 1
+        if command:
+            if len(self.rx) < FIFO_DEPTH:
+                self.rx.append(command)
+                self.commands.append((self.cpu.cycles if self.cpu else 0, command))
+            self.ready = False  # the ready token is consumed
+            self.update()
+        return status
+
+    def io_visible(self):
+        port = self.ram[0x01]
+        return bool(port & 0x04) and bool(port & 0x03)
+
+    def write(self, address, value):
+        if 0xd000 <= address < 0xe000 and self.io_visible():
+            self.io[address & 0xfff] = value
+            return
+        self.ram[address] = value
@@ -0,0 +1,417 @@
+#!/usr/bin/env python
+"""Test the logic analyser capture in firmware/capture.c and capture.pio against
+tools/capture_vcd.py.
+
+capture.c is compiled with the host's C compiler ($CC, default cc) and called through ctypes.
+Both must parse the same "capture" triggers the same way, and find the same trigger in
+captures of made-up reads, wrapped around the ring at random places.  Both must export the
+same text, a buffer at a time, which capture_vcd.py must parse back and write as a VCD file
+that reads back as the same samples.  The pins and sizes in capture.h and capture_vcd.py must
+match.
+
+The capture programs are also run on the PIO simulator (tools/pio_sim.py) on their own PIO
+block, watching the cartridge's programs answer a stream of C64 reads, with the DMA channel
+copying samples into a ring.  For each trigger, the capture must stop with the trigger read in
+it, at the sample the trigger logic finds, and every window read in it must show the right
+data on D0..D7 while OE is low.
+
+    python tools/capture_test.py
+"""
+import argparse
+import ctypes
+import io
+import os
+import random
+import sys
+import tempfile
+
+import capture_vcd
+import host_c
+import pio_sim
+import pioparse
+
+FIRMWARE_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'firmware')
+COMMAND_AREA = 0x8000 + (pioparse.parse(os.path.join(FIRMWARE_DIR, 'address_decoder.pio'))[
+    'address_decoder'].defines['COMMAND_PREFIX'] << 8)
+
+
+class CTrigger(ctypes.Structure):
+    _fields_ = [('kind', ctypes.c_int), ('address', ctypes.c_uint16)]
+
+
+class CCapture(ctypes.Structure):
+    _fields_ = [('ring', ctypes.POINTER(ctypes.c_uint32)), ('ring_size', ctypes.c_uint32),
+                ('first', ctypes.c_uint32), ('count', ctypes.c_uint32),
+                ('trigger', ctypes.c_int32), ('period_ps', ctypes.c_uint32)]
+
+
+class CCaptureLib:
+    """firmware/capture.c, compiled for the host"""
+
+    def __init__(self, build_dir):
+        self.lib = host_c.load(build_dir, 'capture.c')
+        self.lib.capture_parse_trigger.restype = ctypes.c_bool
+        self.lib.capture_trigger_matches.restype = ctypes.c_bool
+        self.lib.capture_summary.restype = ctypes.c_size_t
+        self.lib.capture_export.restype = ctypes.c_size_t
+
+    def parse_trigger(self, args):
+        """(trigger, the words after it), or None if it's refused"""
+        buffer = ctypes.create_string_buffer(args.encode())
+        trigger = CTrigger()
+        rest = ctypes.c_void_p()
+        if not self.lib.capture_parse_trigger(buffer, COMMAND_AREA, ctypes.byref(trigger),
+                                              ctypes.byref(rest)):
+            return None
+        return trigger, ctypes.string_at(rest.value).decode().split()
+
+    def capture(self, ring, first, count, period_ps=16000):
+        """A capture of count samples from ring, oldest at first"""
+        array = (ctypes.c_uint32 * len(ring))(*ring)
+        capture = CCapture(array, len(ring), first, count, -1, period_ps)
+        capture._array = array  # keep the ring alive with it
+        return capture
+
+    def find_trigger(self, capture, trigger, post):
+        self.lib.capture_find_trigger(ctypes.byref(capture), ctypes.byref(trigger),
+                                      ctypes.c_uint32(post))
+        return None if capture.trigger < 0 else capture.trigger
+
+    def export(self, capture, size):
+        """The export text, the summary then RUN lines a size byte buffer at a time, and
+        whether every buffer was within size"""
+        out = ctypes.create_string_buffer(max(size, header_define('CAPTURE_SUMMARY_MAX')))
+        self.lib.capture_summary(ctypes.byref(capture), out, ctypes.c_size_t(len(out)))
+        text = out.value.decode()
+        fits = True
+        sample = ctypes.c_uint32(0)
+        while sample.value < capture.count:
+            length = self.lib.capture_export(ctypes.byref(capture), ctypes.byref(sample), out,
+                                             ctypes.c_size_t(size))
+            fits &= 0 < length < size and length == len(out.value)
+            text += out.value.decode()
+        return text, fits
+
+
+def header_define(name):
+    return host_c.header_define('capture.h', name)
+
+
+def python_trigger(args):
+    try:
+        return capture_vcd.Trigger.parse(args, COMMAND_AREA)
+    except ValueError:
+        return None
+
+
+def check_parse(c):
+    """Error messages for parsing triggers"""
+    errors = []
+    for args in ('now', 'now 100 2', 'address 8000', 'address bfff 5', 'address A000 300 1',
+                 'address 9fff', 'address 0x9000', 'address 7fff', 'address c000',
+                 'address 18000', 'address 8zz0', 'address', 'command 01', 'command ff 10',
+                 'command 100', 'command', 'off', 'bogus 10', ''):
+        expected, got = python_trigger(args), c.parse_trigger(args)
+        if (expected is None) != (got is None):
+            errors.append(f'{args!r}: C and capture_vcd.py disagree on refusing it')
+            continue
+        if expected is None:
+            continue
+        (trigger, rest), (c_trigger, c_rest) = expected, got
+        c_address = None if c_trigger.kind == 0 else c_trigger.address
+        if (trigger.address, rest) != (c_address, c_rest):
+            errors.append(f'{args!r}: C parses it as {c_address} {c_rest}, '
+                          f'capture_vcd.py as {trigger.address} {rest}')
+        if trigger.address is not None and \
+                c.lib.capture_trigger_rom_pin(ctypes.byref(c_trigger)) != trigger.rom_pin():
+            errors.append(f'{args!r}: C and capture_vcd.py pick different ROM lines')
+    return errors
+
+
+# A read of $A005 answered with $42, worked out from the pins in capture.h: idle with A0..A13
+# on the address, ROMH low, then OE low with the data out, with GPIO 23 changing in the first
+# sample to be masked out
+KNOWN_SAMPLES = [0x14e00500, 0x14600500, 0x10600500, 0x00600542, 0x00600542, 0x14600500]
+KNOWN_EXPORT = ('CAPTURE samples 6 trigger 2 period_ps 16000 pins 1C7FFFFF\n'
+                'RUN 14600500 2\nRUN 10600500 1\nRUN 00600542 2\nRUN 14600500 1\n')
+
+
+def check_known(c):
+    """Error messages for capture.c against a capture and triggers worked out by hand"""
+    errors = []
+    trigger, rest = c.parse_trigger('command 01 300')
+    if (trigger.address, rest) != (0x9e01, ['300']):
+        errors.append(f'"command 01" is ${trigger.address:04X} {rest}, expected $9E01')
+    trigger, _ = c.parse_trigger('address a005')
+    if c.lib.capture_trigger_rom_pin(ctypes.byref(trigger)) != 26:
+        errors.append('$A005 isn\'t read with ROMH')
+    # Wrapped around the end of the ring, 2 samples counted after the trigger
+    ring = KNOWN_SAMPLES[2:] + [0] * 250 + KNOWN_SAMPLES[:2]
+    capture = c.capture(ring, 254, len(KNOWN_SAMPLES))
+    if c.find_trigger(capture, trigger, 2) != 2:
+        errors.append(f'the read of $A005 triggers at {capture.trigger}, expected 2')
+    text, _ = c.export(capture, 1024)
+    if text != KNOWN_EXPORT:
+        errors.append(f'exports {text!r}')
+    return errors
+
+
+def bus_samples(rng, reads, noise=True):
+    """Samples of a made-up bus: for each address, some samples idle and some with its ROM
+    line low and the data out, with the other GPIOs changing to be masked out"""
+    samples = []
+    for address in reads:
+        rom = capture_vcd.PIN_ROML if address < capture_vcd.ROMH else capture_vcd.PIN_ROMH
+        idle = (1 << capture_vcd.PIN_ROML) | (1 << capture_vcd.PIN_ROMH) \
+            | (1 << capture_vcd.PIN_OE) | ((address & 0x3fff) << capture_vcd.PIN_A0)
+        for n in range(rng.randrange(1, 12)):
+            samples.append(idle)
+        low = idle & ~(1 << rom)
+        for n in range(rng.randrange(1, 12)):
+            samples.append(low)
+        for n in range(rng.randrange(0, 6)):
+            samples.append(low & ~(1 << capture_vcd.PIN_OE) | rng.randrange(256))
+    if noise:
+        samples = [pins | rng.randrange(8) << 23 | rng.randrange(8) << 29 for pins in samples]
+    return samples
+
+
+def cases():
+    rng = random.Random(44)
+    addresses = [0x8000 + rng.randrange(0x4000) for _ in range(40)]
+    yield 'empty', [], 'now', 0, 0
+    yield 'one sample', [1 << capture_vcd.PIN_OE], 'now', 0, 0
+    yield 'now', bus_samples(rng, addresses), 'now', 100, 0
+    for n in (5, 20, 39):
+        samples = bus_samples(rng, addresses[:n + 1])
+        post = rng.randrange(0, 5)
+        samples += bus_samples(rng, addresses[n + 1:])[:post + rng.randrange(0, 8)]
+        yield f'address ${addresses[n]:04X}', samples, f'address {addresses[n]:04x}', post, \
+            rng.randrange(256)
+    samples = bus_samples(rng, addresses[:10] + [COMMAND_AREA + 1] + addresses[10:20])
+    yield 'command 01 too late', samples, 'command 01', 100, 0
+    yield 'too few samples', bus_samples(rng, addresses[:3])[:50], 'address 8000', 60, 0
+    samples = bus_samples(rng, [0xa000] * 30, noise=False)
+    yield 'same address', samples, 'address a000', 20, 0
+    yield 'no change', [0x1c400000] * 5000, 'now', 1000, 0
+
+
+def check(c, name, samples, trigger_args, post, first):
+    """Error messages for one capture: samples, oldest first, put in a ring from first"""
+    ring_size = 1 << max(8, len(samples).bit_length())
+    ring = [0] * ring_size
+    for n, pins in enumerate(samples):
+        ring[(first + n) % ring_size] = pins
+    errors = []
+    trigger, _ = python_trigger(trigger_args)
+    c_trigger, _ = c.parse_trigger(trigger_args)
+    capture = c.capture(ring, first, len(samples))
+    got = [c.lib.capture_sample(ctypes.byref(capture), n) for n in range(len(samples))]
+    if got != [pins & capture_vcd.PIN_MASK for pins in samples]:
+        errors.append('C samples the ring wrong')
+    if any(c.lib.capture_trigger_matches(ctypes.byref(c_trigger), pins) != trigger.matches(pins)
+           for pins in samples):
+        errors.append('C and capture_vcd.py match the trigger differently')
+    expected = capture_vcd.find_trigger(samples, trigger, post)
+    if c.find_trigger(capture, c_trigger, post) != expected:
+        errors.append(f'C finds the trigger at {capture.trigger}, capture_vcd.py at {expected}')
+
+    reference = capture_vcd.Capture(samples, expected, capture.period_ps)
+    for size in (header_define('CAPTURE_LINE_MAX'), 100, 1024):
+        text, fits = c.export(capture, size)
+        if text != reference.export():
+            errors.append(f'C and capture_vcd.py export differently with {size} byte buffers')
+        if not fits:
+            errors.append(f'export overran or miscounted a {size} byte buffer')
+    errors += check_round_trip(reference)
+    return errors
+
+
+def read_vcd(text):
+    """Name -> value at each of the samples in a VCD file, with the time of each sample"""
+    codes = {}
+    changes = []
+    time = None
+    for line in text.splitlines():
+        words = line.split()
+        if not words or words[0] in ('$dumpvars', '$end'):
+            continue
+        if words[0] == '$var':
+            codes[words[3]] = words[4]
+        elif words[0].startswith('#'):
+            time = int(words[0][1:])
+        elif time is not None:
+            if words[0].startswith('b'):
+                changes.append((time, codes[words[1]], int(words[0][1:], 2)))
+            else:
+                changes.append((time, codes[words[0][1:]], int(words[0][0])))
+    return changes, time
+
+
+def check_round_trip(capture):
+    """Error messages for parsing the export back and writing and reading it as a VCD file"""
+    try:
+        parsed = capture_vcd.parse_export(['log\n'] + capture.export().splitlines(True)
+                                          + ['OK\n', 'RUN 00000000 1\n'])
+    except capture_vcd.ExportError as e:
+        return [f'export doesn\'t parse: {e}']
+    if (parsed.samples, parsed.trigger, parsed.period_ps) != \
+            (capture.samples, capture.trigger, capture.period_ps):
+        return ['parsed export differs']
+
+    f = io.StringIO()
+    capture_vcd.write_vcd(parsed, f)
+    changes, end = read_vcd(f.getvalue())
+    if end != len(capture.samples) * capture.period_ps:
+        return [f'VCD ends at {end}']
+    values = {}
+    index = 0
+    for n, pins in enumerate(capture.samples):
+        while index < len(changes) and changes[index][0] <= n * capture.period_ps:
+            values[changes[index][1]] = changes[index][2]
+            index += 1
+        expected = {name: (pins >> pin) & ((1 << width) - 1)
+                    for name, pin, width in capture_vcd.SIGNALS}
+        expected['trigger'] = int(n == capture.trigger)
+        if values != expected:
+            return [f'VCD sample {n} is {values}, not {expected}']
+    return []
+
+
+class CapturePio(pio_sim.Pio):
+    """PIO1 with the capture and capture_trigger state machines as start_capture sets them up,
+    and the DMA channel copying each sample into a ring"""
+
+    def __init__(self, sync_cycles, trigger, post, ring_size):
+        super().__init__(sync_cycles)
+        programs = pioparse.parse(os.path.join(FIRMWARE_DIR, 'capture.pio'))
+        self.capture = pio_sim.StateMachine(self, 0, programs['capture'], autopush=32,
+                                            fifo_depth=8)
+        program = programs['capture_trigger']
+        self.trigger = pio_sim.StateMachine(self, 1, program, in_base=pio_sim.PIN_A0,
+                                            in_shift_right=False)
+        if trigger.address is None:
+            self.trigger.pc = program.target('fire')
+        else:
+            self.trigger.jmp_pin = trigger.rom_pin()
+            self.trigger.y = trigger.address & (capture_vcd.WINDOW_SIZE - 1)
+        self.trigger.osr = post
+        self.machines = [self.capture, self.trigger]
+        self.ring = [0] * ring_size
+        self.written = 0
+
+    def cycle(self):
+        super().cycle()
+        if self.capture.rx:
+            self.ring[self.written % len(self.ring)] = self.capture.rx.pop(0)
+            self.written += 1
+
+    def finish(self):
+        """(first, count) of the samples in the ring, like stop_capture"""
+        if self.written > len(self.ring):
+            return self.written % len(self.ring), len(self.ring)
+        return 0, self.written
+
+
+def check_pio(c, args, trigger_args, post):
+    """Error messages for capturing the cartridge answering reads on the PIO simulator"""
+    prefix = (COMMAND_AREA >> 8) & 0x3f
+    reads = pio_sim.unlock_reads(prefix) + [0x8400 + i for i in range(20)] \
+        + [0xa100 + i for i in range(5)] + [COMMAND_AREA + 1] + [0x8600 + i for i in range(15)]
+    trigger, _ = python_trigger(trigger_args)
+    c_trigger, _ = c.parse_trigger(trigger_args)
+    pio = CapturePio(args.sync_cycles, trigger, post, 1024)
+    run = pio_sim.simulate(args, reads, pio1=pio)
+    if not run.ok:
+        return ['the cartridge got reads wrong']
+    if not pio.irq[1] or pio.capture.rx:
+        return ['capture didn\'t stop']
+
+    first, count = pio.finish()
+    capture = c.capture(pio.ring, first, count, 16000)
+    found = c.find_trigger(capture, c_trigger, post)
+    samples = [pio.ring[(first + n) % len(pio.ring)] & capture_vcd.PIN_MASK
+               for n in range(count)]
+    errors = []
+    if found != capture_vcd.find_trigger(samples, trigger, post):
+        errors.append('C and capture_vcd.py find different triggers')
+    if trigger.address is None:
+        if found is None or found > 4:
+            errors.append(f'"now" triggered at sample {found}')
+    else:
+        starts = [n for n in range(count) if trigger.matches(samples[n])
+                  and (n == 0 or not trigger.matches(samples[n - 1]))]
+        if len(starts) != 1:
+            errors.append(f'the trigger read is in it {len(starts)} times')
+        elif found != starts[0]:
+            errors.append(f'trigger found at sample {found}, the read is at {starts[0]}')
+        elif not post <= count - 1 - found <= post + capture_vcd.TRIGGER_SLACK:
+            errors.append(f'{count - 1 - found} samples after the trigger, not {post}')
+
+    # The data at the end of each window read, while OE is still low
+    memory = pio_sim.load_rom()
+    reads_seen = 0
+    for n in range(count - 1):
+        pins, following = samples[n], samples[n + 1]
+        for rom in (capture_vcd.PIN_ROML, capture_vcd.PIN_ROMH):
+            if (pins >> rom) & 1 or not (following >> rom) & 1:
+                continue
+            address = (pins >> capture_vcd.PIN_A0) & 0x3fff
+            if (pins >> capture_vcd.PIN_OE) & 1 or address >> 8 == prefix:
+                continue
+            reads_seen += 1
+            if pins & 0xff != memory[address]:
+                errors.append(f'sample {n} has ${pins & 0xff:02X} for ${address:04X}')
+    if not reads_seen:
+        errors.append('no window reads in it')
+    text, _ = c.export(capture, 1024)
+    errors += check_round_trip(capture_vcd.parse_export(text.splitlines(True)))
+    print(f'  {count} samples, trigger at {found}, {reads_seen} reads checked')
+    return errors
+
+
+def main():
+    failures = 0
+    defines = {'CAPTURE_PIN_D0': capture_vcd.PIN_D0, 'CAPTURE_PIN_A0': capture_vcd.PIN_A0,
+               'CAPTURE_PIN_ROML': capture_vcd.PIN_ROML, 'CAPTURE_PIN_ROMH': capture_vcd.PIN_ROMH,
+               'CAPTURE_PIN_IE': capture_vcd.PIN_IE, 'CAPTURE_PIN_OE': capture_vcd.PIN_OE,
+               'CAPTURE_PIN_MASK': capture_vcd.PIN_MASK, 'CAPTURE_WINDOW': capture_vcd.WINDOW,
+               'CAPTURE_WINDOW_SIZE': capture_vcd.WINDOW_SIZE, 'CAPTURE_ROMH': capture_vcd.ROMH,
+               'CAPTURE_TRIGGER_SLACK': capture_vcd.TRIGGER_SLACK}
+    wrong = {name: header_define(name) for name, value in defines.items()
+             if header_define(name) != value}
+    if (pio_sim.PIN_D0, pio_sim.PIN_A0, pio_sim.PIN_ROML, pio_sim.PIN_ROMH, pio_sim.PIN_OE) != \
+            (capture_vcd.PIN_D0, capture_vcd.PIN_A0, capture_vcd.PIN_ROML,
+             capture_vcd.PIN_ROMH, capture_vcd.PIN_OE):
+        wrong['pio_sim.py pins'] = 'differ'
+    print('defines: ' + (f'FAIL: {wrong}' if wrong else 'OK'))
+    failures += bool(wrong)
+
+    with tempfile.TemporaryDirectory() as build_dir:
+        c = CCaptureLib(build_dir)
+        errors = check_parse(c) + check_known(c)
+        print('triggers' + ''.join(f'  FAIL: {e}' for e in errors))
+        failures += bool(errors)
+
+        for name, samples, trigger, post, first in cases():
+            errors = check(c, name, samples, trigger, post, first)
+            print(f'{name}: {len(samples)} samples' + ''.join(f'  FAIL: {e}' for e in errors))
+            failures += bool(errors)
+
+        parser = argparse.ArgumentParser()
+        pio_sim.add_arguments(parser)
+        args = parser.parse_args([])
+        args.verbose = False
+        for trigger, post in (('now', 1000), ('address 8405', 300), ('address a102', 300),
+                              ('command 01', 100)):
+            print(f'pio {trigger}, {post} after:')
+            errors = check_pio(c, args, trigger, post)
+            print(f'pio {trigger}' + ''.join(f'  FAIL: {e}' for e in errors))
+            failures += bool(errors)
+
+    print(f'{failures} failed' if failures else 'all OK')
+    sys.exit(1 if failures else 0)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,272 @@
+#!/usr/bin/env python
+"""Capture the cartridge port like a logic analyser, and write it as a VCD file.
+
+The firmware's "capture" USB command samples D0..D7, A0..A13, ROML, ROMH, IE and OE every
+2 * clkdiv PIO cycles into a ring buffer on the idle PIO block, and stops a number of samples
+after a trigger: straight away, on a read of a C64 address, or on a command (see
+firmware/capture.h).  This arms it, waits for the trigger, fetches the samples and writes them
+as a VCD file that a waveform viewer like GTKWave opens, with a "trigger" signal marking the
+sample the trigger happened at.
+
+    python tools/capture_vcd.py --trigger 'command 01' -o next_page.vcd
+    python tools/capture_vcd.py --trigger 'address a000' --post 2048 --clkdiv 1 -o copy.vcd
+    python tools/capture_vcd.py --trigger now -o idle.vcd
+    python tools/capture_vcd.py -o last.vcd
+
+Without --trigger it fetches the last capture.  --export reads a saved copy of the "capture"
+output instead of asking the Pico.  Trigger and Capture match capture.c's trigger logic and
+text, for tools/capture_test.py.
+"""
+import argparse
+import sys
+import time
+
+# Pin assignments and sizes from firmware/capture.h
+PIN_D0 = 0
+PIN_A0 = 8
+PIN_ROML = 22
+PIN_ROMH = 26
+PIN_IE = 27
+PIN_OE = 28
+PIN_MASK = 0x1c7fffff
+WINDOW = 0x8000
+WINDOW_SIZE = 0x4000
+ROMH = 0xa000
+TRIGGER_SLACK = 16
+
+# Signals in the VCD file: name, first pin, width
+SIGNALS = [('D', PIN_D0, 8), ('A', PIN_A0, 14), ('ROML', PIN_ROML, 1), ('ROMH', PIN_ROMH, 1),
+           ('IE', PIN_IE, 1), ('OE', PIN_OE, 1)]
+
+
+class Trigger:
+    """A capture trigger: "now", or a read of a C64 address"""
+
+    def __init__(self, address=None):
+        self.address = address
+
+    @classmethod
+    def parse(cls, args, command_area=0x9e00):
+        """The trigger from the "capture" command's arguments, and the words after it.  Raises
+        ValueError if it's not "now", "address <hex>" in the window or "command <hex>"."""
+        words = args.split()
+        if words[:1] == ['now']:
+            return cls(), words[1:]
+        if len(words) < 2 or words[0] not in ('address', 'command'):
+            raise ValueError(f'not a trigger: {args!r}')
+        value = int(words[1], 16)
+        if words[0] == 'address' and not WINDOW <= value < WINDOW + WINDOW_SIZE:
+            raise ValueError(f'${value:04X} is outside the window')
+        if words[0] == 'command':
+            if not 0 <= value <= 0xff:
+                raise ValueError(f'command {value:X} isn\'t a byte')
+            value += command_area
+        return cls(value), words[2:]
+
+    def rom_pin(self):
+        return PIN_ROML if self.address < ROMH else PIN_ROMH
+
+    def matches(self, pins):
+        """True if a sample is a read of the address"""
+        if self.address is None:
+            return True
+        return not (pins >> self.rom_pin()) & 1 and \
+            (pins >> PIN_A0) & (WINDOW_SIZE - 1) == self.address & (WINDOW_SIZE - 1)
+
+
+def find_trigger(samples, trigger, post):
+    """The index of the sample the trigger happened at, given that capture_trigger counted post
+    samples after it, or None if the capture stopped before it could have triggered"""
+    if len(samples) <= post:
+        return None
+    expected = len(samples) - 1 - post
+    if trigger.address is None:
+        return expected
+    for n in range(expected, max(-1, expected - TRIGGER_SLACK - 1), -1):
+        if trigger.matches(samples[n] & PIN_MASK):
+            while n > 0 and trigger.matches(samples[n - 1] & PIN_MASK):
+                n -= 1
+            return n
+    return expected
+
+
+class Capture:
+    def __init__(self, samples, trigger=None, period_ps=16000):
+        self.samples = [pins & PIN_MASK for pins in samples]
+        self.trigger = trigger
+        self.period_ps = period_ps
+
+    def runs(self):
+        """(pins, samples) for each run of samples with the same pins"""
+        runs = []
+        for pins in self.samples:
+            if runs and runs[-1][0] == pins:
+                runs[-1][1] += 1
+            else:
+                runs.append([pins, 1])
+        return [tuple(run) for run in runs]
+
+    def export(self):
+        """The text the "capture" USB command prints before its OK"""
+        trigger = 'none' if self.trigger is None else self.trigger
+        lines = [f'CAPTURE samples {len(self.samples)} trigger {trigger} '
+                 f'period_ps {self.period_ps} pins {PIN_MASK:08X}']
+        lines += [f'RUN {pins:08X} {count}' for pins, count in self.runs()]
+        return ''.join(line + '\n' for line in lines)
+
+
+class ExportError(ValueError):
+    pass
+
+
+def parse_export(lines):
+    """Return a Capture from the lines the "capture" USB command prints, up to its OK.  Other
+    lines are log output and are skipped."""
+    capture = None
+    expected = 0
+    for line in lines:
+        words = line.split()
+        if not words:
+            continue
+        if words[0] == 'OK':
+            break
+        if words[0] == 'ERR':
+            raise ExportError(line.strip())
+        if words[0] == 'CAPTURE':
+            fields = dict(zip(words[1::2], words[2::2]))
+            try:
+                expected = int(fields['samples'])
+                trigger = None if fields['trigger'] == 'none' else int(fields['trigger'])
+                capture = Capture([], trigger, int(fields['period_ps']))
+            except (KeyError, ValueError) as e:
+                raise ExportError(f'bad summary: {line.strip()} ({e})')
+        elif words[0] == 'RUN':
+            if capture is None:
+                raise ExportError('RUN before the CAPTURE line')
+            try:
+                pins, count = int(words[1], 16), int(words[2])
+            except (IndexError, ValueError):
+                raise ExportError(f'bad line: {line.strip()}')
+            capture.samples += [pins & PIN_MASK] * count
+    if capture is None:
+        raise ExportError('no CAPTURE line')
+    if len(capture.samples) != expected:
+        raise ExportError(f'{len(capture.samples)} samples of {expected}')
+    return capture
+
+
+def identifier(index):
+    """A short VCD identifier code"""
+    code = ''
+    while True:
+        code += chr(33 + index % 94)
+        index //= 94
+        if not index:
+            return code
+
+
+def vcd_value(value, width, code):
+    return f'{value}{code}' if width == 1 else f'b{value:0{width}b} {code}'
+
+
+def write_vcd(capture, f):
+    """Write the capture as a VCD file, one sample every period_ps picoseconds"""
+    codes = [identifier(i) for i in range(len(SIGNALS) + 1)]
+    f.write('$version c64 pico ram interface capture $end\n$timescale 1ps $end\n'
+            '$scope module cartridge $end\n')
+    for (name, _, width), code in zip(SIGNALS, codes):
+        f.write(f'$var wire {width} {code} {name}' + (f' [{width - 1}:0]' if width > 1 else '')
+                + ' $end\n')
+    f.write(f'$var wire 1 {codes[-1]} trigger $end\n$upscope $end\n$enddefinitions $end\n')
+
+    # Values change where a run starts, and the trigger marker is 1 for the trigger's sample
+    changes = []
+    n = 0
+    for _, count in capture.runs():
+        changes.append(n)
+        n += count
+    if capture.trigger is not None:
+        changes += [capture.trigger, capture.trigger + 1]
+    widths = [width for _, _, width in SIGNALS] + [1]
+    last = None
+    for n in sorted(set(change for change in changes if change < len(capture.samples))):
+        pins = capture.samples[n]
+        values = [(pins >> pin) & ((1 << width) - 1) for _, pin, width in SIGNALS]
+        values.append(int(n == capture.trigger))
+        lines = [vcd_value(value, width, code) + '\n'
+                 for i, (value, width, code) in enumerate(zip(values, widths, codes))
+                 if last is None or last[i] != value]
+        if last is None:
+            lines = ['$dumpvars\n'] + lines + ['$end\n']
+        if lines:
+            f.write(f'#{n * capture.period_ps}\n' + ''.join(lines))
+        last = values
+    f.write(f'#{len(capture.samples) * capture.period_ps}\n')
+
+
+def command(port, text):
+    """Send a USB command and return its lines up to the OK"""
+    port.write(f'{text}\n'.encode())
+    lines = []
+    while True:
+        line = port.readline().decode('ascii', 'replace')
+        if not line:
+            raise TimeoutError('no response from pico')
+        lines.append(line)
+        if line.startswith(('OK', 'ERR')):
+            return lines
+
+
+def fetch(port, trigger, post, clkdiv):
+    """Arm a capture if there's a trigger, wait for it and return the "capture" output"""
+    if trigger:
+        if post is None and clkdiv is not None:
+            sys.exit('--clkdiv needs --post')
+        words = [trigger] + [str(v) for v in (post, clkdiv) if v is not None]
+        response = command(port, 'capture ' + ' '.join(words))
+        if response[-1].startswith('ERR'):
+            sys.exit(f'pico: {response[-1].strip()}')
+        print('waiting for the trigger, ^C to stop', file=sys.stderr)
+    try:
+        while True:
+            response = command(port, 'capture')
+            if not response[-1].startswith('ERR waiting'):
+                return response
+            time.sleep(0.2)
+    except KeyboardInterrupt:
+        command(port, 'capture off')
+        return command(port, 'capture')
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--port', default='/dev/ttyACM0')
+    parser.add_argument('--export', help='read a saved "capture" output instead of the Pico')
+    parser.add_argument('--trigger',
+                        help='arm a capture first: "now", "address <hex>" or "command <hex>"')
+    parser.add_argument('--post', type=int,
+                        help='samples to take after the trigger (default a quarter of them)')
+    parser.add_argument('--clkdiv', type=int, help='PIO clock divider (default 2)')
+    parser.add_argument('-o', '--output', required=True, help='VCD file to write')
+    args = parser.parse_args()
+
+    try:
+        if args.export:
+            with open(args.export) as f:
+                capture = parse_export(f)
+        else:
+            import serial  # pyserial, only needed when talking to the hardware
+
+            with serial.Serial(args.port, timeout=2) as port:
+                capture = parse_export(fetch(port, args.trigger, args.post, args.clkdiv))
+    except ExportError as e:
+        sys.exit(f'pico: {e}')
+    with open(args.output, 'w') as f:
+        write_vcd(capture, f)
+    trigger = 'no trigger' if capture.trigger is None else f'trigger at {capture.trigger}'
+    print(f'{len(capture.samples)} samples, {capture.period_ps / 1000:g} ns apart, {trigger}')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,190 @@
+#!/usr/bin/env python
+"""Show the system clock profile the Pico is running, and the read margin at each profile.
+
+The firmware build picks a clock profile with C64_CLOCK_PROFILE, and at start-up the firmware
+sets its clock and core voltage, measures the clock it got and checks the read path still has
+CLOCK_PROFILE_MIN_MARGIN_PS to spare at it, falling back to the default profile if not (see
+firmware/clock_profile.h).  This asks the Pico with the "clock" USB command which profile is
+running and why, or with --list works out each profile's worst case read latency and margin
+without one:
+
+    python tools/clock_profile.py
+    python tools/clock_profile.py --list
+
+The margin sums are done here the same way as in clock_profile.c, so
+tools/clock_profile_test.py can hold the firmware to them, and its cycle counts to
+tools/pio_timing.py.
+"""
+import argparse
+import sys
+
+# From firmware/clock_profile.h
+READ_CYCLES = 13            # CLOCK_PROFILE_READ_CYCLES
+COMMAND_CYCLES = 13         # CLOCK_PROFILE_COMMAND_CYCLES
+DMA_CYCLES = 4              # CLOCK_PROFILE_DMA_CYCLES
+PHI2_HZ = 1022727           # CLOCK_PROFILE_PHI2_HZ
+ROML_DELAY_PS = 60000       # CLOCK_PROFILE_ROML_DELAY_PS
+SETUP_PS = 100000           # CLOCK_PROFILE_SETUP_PS
+BUFFER_DELAY_PS = 10000     # CLOCK_PROFILE_BUFFER_DELAY_PS
+MIN_MARGIN_PS = 50000       # CLOCK_PROFILE_MIN_MARGIN_PS
+TOLERANCE_PERMILLE = 10     # CLOCK_PROFILE_TOLERANCE_PERMILLE
+INT32_MIN = -(1 << 31)
+UINT32_MAX = (1 << 32) - 1
+
+
+class Profile:
+    def __init__(self, name, sys_khz, vreg_mv):
+        self.name = name
+        self.sys_khz = sys_khz
+        self.vreg_mv = vreg_mv
+
+    def __eq__(self, other):
+        return vars(self) == vars(other)
+
+    def __repr__(self):
+        return f'Profile({self.name!r}, {self.sys_khz}, {self.vreg_mv})'
+
+
+# clock_profiles in firmware/clock_profile.c
+PROFILES = [
+    Profile('default', 125000, 1100),
+    Profile('fast', 200000, 1150),
+    Profile('turbo', 250000, 1200),
+    Profile('extreme', 266000, 1250),
+]
+
+
+def find(name):
+    return next((p for p in PROFILES if p.name == name), None)
+
+
+def deadline_ps():
+    """Time after ROML/ROMH falls that the data must be on the bus, for NTSC"""
+    return 10 ** 12 // PHI2_HZ // 2 - ROML_DELAY_PS - SETUP_PS - BUFFER_DELAY_PS
+
+
+def latency_ps(sys_hz):
+    """Worst case from ROML/ROMH falling to OE low, for the slower of a read and a command"""
+    cycles = max(READ_CYCLES + 2 * DMA_CYCLES, COMMAND_CYCLES)
+    if sys_hz == 0:
+        return UINT32_MAX
+    return min(-(-cycles * 10 ** 12 // sys_hz), UINT32_MAX)
+
+
+def margin_ps(sys_hz):
+    return max(deadline_ps() - latency_ps(sys_hz), INT32_MIN)
+
+
+def clock_ok(profile, measured_khz):
+    tolerance = profile.sys_khz // 1000 * TOLERANCE_PERMILLE
+    return profile.sys_khz - tolerance <= measured_khz <= profile.sys_khz + tolerance
+
+
+def describe(profile, measured_khz):
+    """The CLOCK line the "clock" USB command prints"""
+    sys_hz = measured_khz * 1000 & UINT32_MAX
+    return f'CLOCK profile {profile.name} sys_khz {measured_khz} vreg_mv {profile.vreg_mv} ' \
+           f'latency_ps {latency_ps(sys_hz)} margin_ps {margin_ps(sys_hz)}\n'
+
+
+class ExportError(ValueError):
+    pass
+
+
+class Clock:
+    """What the "clock" USB command says: the profile running, the fields of its CLOCK line,
+    why the build's profile isn't running (or None), and the profiles there are"""
+
+    def __init__(self, profile, fields, fallback, profiles):
+        self.profile = profile
+        self.fields = fields
+        self.fallback = fallback
+        self.profiles = profiles
+
+
+def parse_export(lines):
+    """Return a Clock from the lines the "clock" USB command prints, up to its OK.  Other lines
+    are log output and are skipped."""
+    clock = None
+    fallback = None
+    profiles = []
+    for line in lines:
+        words = line.split()
+        if not words:
+            continue
+        if words[0] == 'OK':
+            break
+        if words[0] == 'ERR':
+            raise ExportError(line.strip())
+        if words[0] == 'CLOCK':
+            fields = dict(zip(words[1::2], words[2::2]))
+            try:
+                clock = (fields.pop('profile'), {key: int(fields[key]) for key in (
+                    'sys_khz', 'vreg_mv', 'latency_ps', 'margin_ps')})
+            except (KeyError, ValueError) as e:
+                raise ExportError(f'bad line: {line.strip()} ({e})')
+        elif words[0] == 'FALLBACK':
+            if len(words) < 3:
+                raise ExportError(f'bad line: {line.strip()}')
+            fallback = (words[1], ' '.join(words[2:]))
+        elif words[0] == 'PROFILES':
+            profiles = words[1:]
+    if clock is None:
+        raise ExportError('no CLOCK line')
+    return Clock(clock[0], clock[1], fallback, profiles)
+
+
+def command(port, text):
+    """Send a USB command and return its lines up to the OK"""
+    port.write(f'{text}\n'.encode())
+    lines = []
+    while True:
+        line = port.readline().decode('ascii', 'replace')
+        if not line:
+            raise TimeoutError('no response from pico')
+        lines.append(line)
+        if line.startswith(('OK', 'ERR')):
+            return lines
+
+
+def fetch(port):
+    """The Clock the Pico on an open serial port is running"""
+    try:
+        return parse_export(command(port, 'clock'))
+    except ExportError as e:
+        sys.exit(f'pico: {e}')
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--port', default='/dev/ttyACM0')
+    parser.add_argument('--list', action='store_true',
+                        help='list the profiles and their margins instead of asking the Pico')
+    args = parser.parse_args()
+
+    if args.list:
+        print(f'deadline {deadline_ps() / 1000:.1f} ns after ROML/ROMH falls (NTSC), '
+              f'least margin {MIN_MARGIN_PS / 1000:g} ns')
+        for profile in PROFILES:
+            margin = margin_ps(profile.sys_khz * 1000)
+            print(f'{profile.name:8} {profile.sys_khz / 1000:5g} MHz {profile.vreg_mv} mV  '
+                  f'latency {latency_ps(profile.sys_khz * 1000) / 1000:5.1f} ns  '
+                  f'margin {margin / 1000:5.1f} ns' + ('' if margin >= MIN_MARGIN_PS
+                                                       else '  too small'))
+        return
+
+    import serial  # pyserial, only needed when talking to the hardware
+
+    with serial.Serial(args.port, timeout=2) as port:
+        clock = fetch(port)
+    print(f'{clock.profile} at {clock.fields["sys_khz"] / 1000:g} MHz, '
+          f'{clock.fields["vreg_mv"]} mV: read latency {clock.fields["latency_ps"] / 1000:.1f} '
+          f'ns worst case, margin {clock.fields["margin_ps"] / 1000:.1f} ns')
+    if clock.fallback:
+        print(f'the build asked for {clock.fallback[0]}, but: {clock.fallback[1]}')
+    print(f'profiles: {" ".join(clock.profiles)}')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,263 @@
+#!/usr/bin/env python
+"""Test the clock profiles in firmware/clock_profile.c against tools/clock_profile.py, and the
+firmware's margin figures against tools/pio_timing.py and tools/pio_sim.py.
+
+clock_profile.c is compiled with the host's C compiler ($CC, default cc) and called through
+ctypes.  Both must have the same profiles and the same deadline, latency, margin and clock check
+at every clock, down to none and up to ones that overflow, and describe a profile the same way,
+which clock_profile.py must parse back.  The cycle counts in clock_profile.h must be the ones
+pio_timing.py works out from the .pio sources, the deadline pio_sim.py's for NTSC, and no read
+pio_sim.py simulates at a profile's clock may be slower than its latency.  Every profile must
+pass its own margin check, with faster ones never having less:
+
+    python tools/clock_profile_test.py
+"""
+import argparse
+import ctypes
+import os
+import re
+import sys
+import tempfile
+
+import clock_profile
+import host_c
+import pio_sim
+import pio_timing
+
+FIRMWARE_DIR = pio_sim.FIRMWARE_DIR
+
+
+class CProfile(ctypes.Structure):
+    _fields_ = [('name', ctypes.c_char_p), ('sys_khz', ctypes.c_uint32),
+                ('vreg_mv', ctypes.c_uint32)]
+
+
+class CClockProfile:
+    """firmware/clock_profile.c, compiled for the host"""
+
+    def __init__(self, build_dir):
+        self.lib = host_c.load(build_dir, 'clock_profile.c')
+        self.lib.clock_profile_find.restype = ctypes.POINTER(CProfile)
+        self.lib.clock_profile_deadline_ps.restype = ctypes.c_uint32
+        self.lib.clock_profile_latency_ps.restype = ctypes.c_uint32
+        self.lib.clock_profile_margin_ps.restype = ctypes.c_int32
+        self.lib.clock_profile_clock_ok.restype = ctypes.c_bool
+        self.lib.clock_profile_describe.restype = ctypes.c_size_t
+
+    def profiles(self):
+        count = ctypes.c_uint.in_dll(self.lib, 'clock_profile_count').value
+        table = (CProfile * count).in_dll(self.lib, 'clock_profiles')
+        return [clock_profile.Profile(p.name.decode(), p.sys_khz, p.vreg_mv) for p in table]
+
+    def find(self, name):
+        found = self.lib.clock_profile_find(name.encode())
+        return clock_profile.Profile(found.contents.name.decode(), found.contents.sys_khz,
+                                     found.contents.vreg_mv) if found else None
+
+    def profile(self, profile):
+        """A CProfile for a clock_profile.Profile, kept with its name so it isn't freed"""
+        name = ctypes.c_char_p(profile.name.encode())
+        return CProfile(name.value, profile.sys_khz, profile.vreg_mv), name
+
+    def clock_ok(self, profile, measured_khz):
+        c, _ = self.profile(profile)
+        return self.lib.clock_profile_clock_ok(ctypes.byref(c), ctypes.c_uint32(measured_khz))
+
+    def describe(self, profile, measured_khz, size=clock_profile.UINT32_MAX):
+        """The line, and the length clock_profile_describe returned"""
+        c, _ = self.profile(profile)
+        out = ctypes.create_string_buffer(header_define('CLOCK_PROFILE_LINE_MAX'))
+        size = min(size, len(out))
+        length = self.lib.clock_profile_describe(ctypes.byref(c), ctypes.c_uint32(measured_khz),
+                                                 out, ctypes.c_size_t(size))
+        return out.value.decode(), length
+
+
+def header_define(name):
+    return host_c.header_define('clock_profile.h', name)
+
+
+def options(*argv):
+    parser = argparse.ArgumentParser()
+    pio_sim.add_arguments(parser)
+    args = parser.parse_args(['--video', 'ntsc', *argv])
+    # pio_sim.py's own options, for its built-in pattern
+    args.pattern, args.reads, args.trace, args.verbose = 'mixed', 300, None, False
+    return args
+
+
+CLOCKS_HZ = [0, 1, 999, 1000000, 12000000, 48000000, 100000000, 124999999, 125000000,
+             133000000, 200000000, 250000000, 266000000, 300000000, 420000000, 0xffffffff]
+
+
+def check_c(c):
+    """Error messages for clock_profile.c against clock_profile.py"""
+    errors = []
+    if c.profiles() != clock_profile.PROFILES:
+        errors.append(f'C has profiles {c.profiles()}')
+    for profile in clock_profile.PROFILES:
+        if c.find(profile.name) != profile:
+            errors.append(f'C finds {c.find(profile.name)} for {profile.name}')
+    if c.find('warp') is not None:
+        errors.append('C finds an unknown profile')
+    if c.lib.clock_profile_deadline_ps() != clock_profile.deadline_ps():
+        errors.append(f'C deadline {c.lib.clock_profile_deadline_ps()} ps')
+    for hz in CLOCKS_HZ:
+        got = (c.lib.clock_profile_latency_ps(ctypes.c_uint32(hz)),
+               c.lib.clock_profile_margin_ps(ctypes.c_uint32(hz)))
+        expected = (clock_profile.latency_ps(hz), clock_profile.margin_ps(hz))
+        if got != expected:
+            errors.append(f'{hz} Hz: C latency and margin {got}, expected {expected}')
+    for profile in clock_profile.PROFILES:
+        tolerance = profile.sys_khz // 1000 * clock_profile.TOLERANCE_PERMILLE
+        for khz in (0, profile.sys_khz - tolerance - 1, profile.sys_khz - tolerance,
+                    profile.sys_khz, profile.sys_khz + tolerance,
+                    profile.sys_khz + tolerance + 1, 2 * profile.sys_khz):
+            if c.clock_ok(profile, khz) != clock_profile.clock_ok(profile, khz):
+                errors.append(f'{profile.name} measured at {khz} kHz: C says '
+                              f'{c.clock_ok(profile, khz)}')
+        for khz in (profile.sys_khz, profile.sys_khz - 3, 12000, 0):
+            line, length = c.describe(profile, khz)
+            if line != clock_profile.describe(profile, khz) or length != len(line):
+                errors.append(f'C describes {profile.name} at {khz} kHz as {line!r}')
+                continue
+            try:
+                clock = clock_profile.parse_export(
+                    ['log output\n', line, 'FALLBACK extreme read margin too small\n',
+                     'PROFILES ' + ' '.join(p.name for p in clock_profile.PROFILES) + '\n',
+                     'OK\n', 'CLOCK profile other\n'])
+            except clock_profile.ExportError as e:
+                errors.append(f'{profile.name} doesn\'t parse: {e}')
+                continue
+            if (clock.profile, clock.fields['sys_khz'], clock.fields['margin_ps'],
+                    clock.fallback, clock.profiles) != (
+                    profile.name, khz, clock_profile.margin_ps(khz * 1000),
+                    ('extreme', 'read margin too small'),
+                    [p.name for p in clock_profile.PROFILES]):
+                errors.append(f'{profile.name} parses differently')
+        # A short buffer gets a truncated line, and the full length like snprintf
+        line, _ = c.describe(profile, profile.sys_khz)
+        short, length = c.describe(profile, profile.sys_khz, 20)
+        if short != line[:19] or length != len(line):
+            errors.append(f'{profile.name}: truncated line is wrong')
+    if header_define('CLOCK_PROFILE_LINE_MAX') <= max(
+            len(clock_profile.describe(p, 0xffffffff // 1000)) for p in clock_profile.PROFILES):
+        errors.append('CLOCK_PROFILE_LINE_MAX is too short')
+    return errors
+
+
+# The README's table: NTSC's 318.889 ns deadline, and 21 system clock cycles for the slowest
+# answer, at each profile's clock
+KNOWN_PS = {125000000: (168000, 150889), 200000000: (105000, 213889),
+            250000000: (84000, 234889), 266000000: (78948, 239941)}
+
+
+def check_known(c):
+    """Error messages for clock_profile.c's figures against ones worked out by hand"""
+    errors = []
+    if c.lib.clock_profile_deadline_ps() != 318889:
+        errors.append(f'C deadline {c.lib.clock_profile_deadline_ps()} ps, expected 318889')
+    for hz, expected in KNOWN_PS.items():
+        got = (c.lib.clock_profile_latency_ps(ctypes.c_uint32(hz)),
+               c.lib.clock_profile_margin_ps(ctypes.c_uint32(hz)))
+        if got != expected:
+            errors.append(f'{hz} Hz: C latency and margin {got}, expected {expected}')
+    return errors
+
+
+def check_timing():
+    """Error messages for clock_profile.h's figures against pio_timing.py and pio_sim.py"""
+    errors = []
+    defines = {'CLOCK_PROFILE_READ_CYCLES': clock_profile.READ_CYCLES,
+               'CLOCK_PROFILE_COMMAND_CYCLES': clock_profile.COMMAND_CYCLES,
+               'CLOCK_PROFILE_DMA_CYCLES': clock_profile.DMA_CYCLES,
+               'CLOCK_PROFILE_PHI2_HZ': clock_profile.PHI2_HZ,
+               'CLOCK_PROFILE_ROML_DELAY_PS': clock_profile.ROML_DELAY_PS,
+               'CLOCK_PROFILE_SETUP_PS': clock_profile.SETUP_PS,
+               'CLOCK_PROFILE_BUFFER_DELAY_PS': clock_profile.BUFFER_DELAY_PS,
+               'CLOCK_PROFILE_MIN_MARGIN_PS': clock_profile.MIN_MARGIN_PS,
+               'CLOCK_PROFILE_TOLERANCE_PERMILLE': clock_profile.TOLERANCE_PERMILLE}
+    wrong = {name: header_define(name) for name, value in defines.items()
+             if header_define(name) != value}
+    if wrong:
+        errors.append(f'defines {wrong}')
+
+    args = options()
+    paths = pio_timing.analyse(options('--dma-cycles', '0'))
+    if (paths['read'].cycles, paths['command'].cycles) != (clock_profile.READ_CYCLES,
+                                                          clock_profile.COMMAND_CYCLES):
+        errors.append(f'pio_timing.py has {paths["read"].cycles} cycles for a read and '
+                      f'{paths["command"].cycles} for a command without the DMA')
+    if args.dma_cycles != clock_profile.DMA_CYCLES:
+        errors.append(f'pio_sim.py\'s DMA takes {args.dma_cycles} cycles')
+    if abs(pio_sim.read_deadline_ns(args) * 1000 - clock_profile.deadline_ps()) > 1:
+        errors.append(f'pio_sim.py\'s deadline is {pio_sim.read_deadline_ns(args):.3f} ns')
+    if clock_profile.MIN_MARGIN_PS != int(pio_timing_min_margin_ns() * 1000):
+        errors.append(f'pio_timing.py\'s least margin is {pio_timing_min_margin_ns()} ns')
+
+    for profile in clock_profile.PROFILES:
+        mhz = str(profile.sys_khz / 1000)
+        paths = pio_timing.analyse(options('--sys-clock', mhz))
+        worst = max(paths['read'].ns, paths['command'].ns)
+        if abs(worst * 1000 - clock_profile.latency_ps(profile.sys_khz * 1000)) > 1:
+            errors.append(f'{profile.name}: pio_timing.py has a latency of {worst:.3f} ns')
+        run = pio_sim.simulate(options('--sys-clock', mhz))
+        simulated = max(latency - args.buffer_delay for _, _, latency, _ in run.results
+                        if latency is not None)
+        if simulated * 1000 > clock_profile.latency_ps(profile.sys_khz * 1000) or not run.ok:
+            errors.append(f'{profile.name}: pio_sim.py simulates {simulated:.1f} ns')
+    return errors
+
+
+def pio_timing_min_margin_ns():
+    """--min-margin's default in pio_timing.py, which the build uses"""
+    with open(os.path.join(os.path.dirname(os.path.abspath(__file__)), 'pio_timing.py')) as f:
+        return float(re.search(r"'--min-margin'.*?default=([\d.]+)", f.read(), re.S).group(1))
+
+
+def check_profiles():
+    """Error messages for the profiles themselves"""
+    errors = []
+    margins = [clock_profile.margin_ps(p.sys_khz * 1000) for p in clock_profile.PROFILES]
+    for profile, margin in zip(clock_profile.PROFILES, margins):
+        if margin < clock_profile.MIN_MARGIN_PS:
+            errors.append(f'{profile.name} has a margin of {margin} ps')
+        if not clock_profile.clock_ok(profile, profile.sys_khz):
+            errors.append(f'{profile.name} fails its own clock check')
+        # The SDK has VREG_VOLTAGE_0_85 to VREG_VOLTAGE_1_30 in 50 mV steps, and the flash
+        # runs at half the system clock, up to 133 MHz
+        if profile.vreg_mv % 50 or not 850 <= profile.vreg_mv <= 1300:
+            errors.append(f'{profile.name}: no regulator setting for {profile.vreg_mv} mV')
+        if profile.sys_khz > 266000:
+            errors.append(f'{profile.name}: flash over 133 MHz')
+    if clock_profile.PROFILES[0] != clock_profile.Profile('default', 125000, 1100):
+        errors.append('the first profile isn\'t the SDK\'s default')
+    ordered = sorted(clock_profile.PROFILES, key=lambda p: p.sys_khz)
+    if ordered != clock_profile.PROFILES or any(
+            a.vreg_mv > b.vreg_mv for a, b in zip(ordered, ordered[1:])) or margins != sorted(
+            margins):
+        errors.append('faster profiles don\'t have more voltage and margin')
+    return errors
+
+
+def main():
+    failures = 0
+    with tempfile.TemporaryDirectory() as build_dir:
+        c = CClockProfile(build_dir)
+        checks = [('C against clock_profile.py', check_c(c)),
+                  ('C against the README', check_known(c)),
+                  ('figures against pio_timing.py and pio_sim.py', check_timing()),
+                  ('profiles', check_profiles())]
+    for name, errors in checks:
+        print(f'{name}: ' + ('OK' if not errors else ''.join(f'  FAIL: {e}' for e in errors)))
+        failures += bool(errors)
+    for profile in clock_profile.PROFILES:
+        print(f'{profile.name}: {profile.sys_khz / 1000:g} MHz, margin '
+              f'{clock_profile.margin_ps(profile.sys_khz * 1000) / 1000:.1f} ns')
+
+    print(f'{failures} failed' if failures else 'all OK')
+    sys.exit(1 if failures else 0)
+
+
+if __name__ == '__main__':
+    main()
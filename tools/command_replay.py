@@ -0,0 +1,321 @@
+#!/usr/bin/env python
+"""Replay a recorded stream of C64 commands through a host build of the command dispatcher.
+
+Problems in the command loop depend on when the C64 sends its commands, which can't be
+reproduced at a desk.  After "trace on", the firmware records each command value with the time
+the command program pushed it, how long its handler took and how long the rest of the loop took
+to be ready for the next (see firmware/command_trace.h).  This fetches the trace with the
+"trace" USB command, or reads a saved copy of it, and replays it through
+firmware/command_dispatch.c built for the host with $CC (default cc).
+
+The replay is a model of main()'s loop: one command at a time, each starting when it has
+arrived and the last one is ready, and taking its recorded handler and loop time.  --speed
+scales the arrival times, as if the C64 sent the same commands faster (2) or slower (0.5), and
+--cost replaces an opcode's handler time, to see what a faster or slower handler would do to the
+queue.  It reports how long the commands queued and were handled, for each opcode as the
+dispatcher decodes them; the same trace and options always give the same report, so it can be
+kept as a benchmark for changes to the command loop.
+
+    python tools/command_replay.py --on
+    (run the C64)
+    python tools/command_replay.py --save trace.txt
+    python tools/command_replay.py --trace trace.txt --speed 2 --cost 01=300
+"""
+import argparse
+import ctypes
+import os
+import re
+import sys
+import tempfile
+
+import command_stats
+import host_c
+
+FIRMWARE_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'firmware')
+FIFO_DEPTH = 4          # the command program's RX FIFO
+CART_MAX = 3            # CART_MAX in c64_pico_ram_interface.c
+
+
+class Entry:
+    def __init__(self, arrival_us, value, handler_us, overhead_us):
+        self.arrival_us = arrival_us
+        self.value = value
+        self.handler_us = handler_us
+        self.overhead_us = overhead_us
+
+    def __eq__(self, other):
+        return vars(self) == vars(other)
+
+    def __repr__(self):
+        return f'Entry({self.arrival_us}, {self.value:#04x}, {self.handler_us}, ' \
+               f'{self.overhead_us})'
+
+
+class Trace:
+    def __init__(self, entries=None, dropped=0):
+        self.entries = list(entries or [])
+        self.dropped = dropped
+
+    def export(self):
+        """The text the "trace" USB command prints before its OK"""
+        lines = [f'TRACE commands {len(self.entries)} dropped {self.dropped}']
+        lines += [f'CMD {e.arrival_us} {e.value:02X} {e.handler_us} {e.overhead_us}'
+                  for e in self.entries]
+        return ''.join(line + '\n' for line in lines)
+
+
+class ExportError(ValueError):
+    pass
+
+
+def parse_export(lines):
+    """Return a Trace from the lines the "trace" USB command prints, up to its OK.  Other lines
+    are log output and are skipped."""
+    trace = None
+    expected = 0
+    for line in lines:
+        words = line.split()
+        if not words:
+            continue
+        if words[0] == 'OK':
+            break
+        if words[0] == 'ERR':
+            raise ExportError(line.strip())
+        if words[0] == 'TRACE':
+            fields = dict(zip(words[1::2], words[2::2]))
+            try:
+                expected = int(fields['commands'])
+                trace = Trace(dropped=int(fields['dropped']))
+            except (KeyError, ValueError) as e:
+                raise ExportError(f'bad summary: {line.strip()} ({e})')
+        elif words[0] == 'CMD':
+            if trace is None:
+                raise ExportError('CMD before the TRACE line')
+            try:
+                trace.entries.append(Entry(int(words[1]), int(words[2], 16), int(words[3]),
+                                           int(words[4])))
+            except (IndexError, ValueError):
+                raise ExportError(f'bad line: {line.strip()}')
+    if trace is None:
+        raise ExportError('no TRACE line')
+    if len(trace.entries) != expected:
+        raise ExportError(f'{len(trace.entries)} commands of {expected}')
+    return trace
+
+
+def name_max():
+    with open(os.path.join(FIRMWARE_DIR, 'd64.h')) as f:
+        return int(re.search(r'#define D64_NAME_MAX (\d+)', f.read()).group(1))
+
+
+HANDLER = ctypes.CFUNCTYPE(None, ctypes.c_void_p)
+OPEN_LOAD_FILE = ctypes.CFUNCTYPE(None, ctypes.c_void_p, ctypes.POINTER(ctypes.c_char),
+                                  ctypes.c_uint)
+SELECT_CART = ctypes.CFUNCTYPE(None, ctypes.c_void_p, ctypes.c_uint)
+BENCH_RESULT = ctypes.CFUNCTYPE(None, ctypes.c_void_p, ctypes.c_uint, ctypes.c_uint32)
+
+
+class CHandlers(ctypes.Structure):
+    _fields_ = [('next_page', HANDLER), ('sleep', HANDLER), ('check_crc', HANDLER),
+                ('save_nufli', HANDLER), ('open_load_file', OPEN_LOAD_FILE),
+                ('select_cart', SELECT_CART), ('ping', HANDLER), ('bench_result', BENCH_RESULT),
+                ('no_romh', HANDLER), ('context', ctypes.c_void_p)]
+
+
+class CDispatcher(ctypes.Structure):
+    _fields_ = [('handlers', ctypes.POINTER(CHandlers)), ('cart_count', ctypes.c_uint),
+                ('load_name_state', ctypes.c_int), ('load_name', ctypes.c_char * name_max()),
+                ('load_name_len', ctypes.c_uint), ('load_name_left', ctypes.c_uint),
+                ('bench_state', ctypes.c_int), ('bench_index', ctypes.c_uint),
+                ('bench_cycles', ctypes.c_uint32), ('bench_nibbles_left', ctypes.c_uint)]
+
+
+class Dispatcher:
+    """firmware/command_dispatch.c built for the host, with handlers that note what they were
+    called with"""
+
+    def __init__(self, build_dir, cart_count=CART_MAX):
+        self.lib = host_c.load(build_dir, 'command_dispatch.c')
+        self.lib.command_dispatch_opcode.restype = ctypes.c_uint8
+        self.calls = []
+
+        def call(name):
+            return HANDLER(lambda context: self.calls.append((name,)))
+
+        # Kept on self so they outlive the C side's pointers to them
+        self.handlers = CHandlers(
+            call('next_page'), call('sleep'), call('check_crc'), call('save_nufli'),
+            OPEN_LOAD_FILE(lambda context, name, length: self.calls.append(
+                ('open_load_file', ctypes.string_at(name, length)))),
+            SELECT_CART(lambda context, cart: self.calls.append(('select_cart', cart))),
+            call('ping'),
+            BENCH_RESULT(lambda context, index, cycles: self.calls.append(
+                ('bench_result', index, cycles))),
+            call('no_romh'), None)
+        self.dispatcher = CDispatcher()
+        self.lib.command_dispatcher_init(ctypes.byref(self.dispatcher),
+                                         ctypes.byref(self.handlers))
+        self.dispatcher.cart_count = cart_count
+
+    def opcode(self, value):
+        """The opcode a command counts as, after the ones dispatched so far"""
+        return self.lib.command_dispatch_opcode(ctypes.byref(self.dispatcher),
+                                                ctypes.c_uint32(value))
+
+    def reset(self):
+        """command_dispatch_reset(), as when the guard locks or unlocks"""
+        self.lib.command_dispatch_reset(ctypes.byref(self.dispatcher))
+
+    def dispatch(self, value):
+        """The opcode a command counts as, and the handler calls it made"""
+        opcode = self.opcode(value)
+        self.calls = []
+        self.lib.command_dispatch(ctypes.byref(self.dispatcher), ctypes.c_uint32(value))
+        return opcode, self.calls
+
+
+class Replayed:
+    """A command as replayed: when it arrived, started and was ready, in µs"""
+
+    def __init__(self, entry, opcode, calls, arrival, start, handler_us):
+        self.entry = entry
+        self.opcode = opcode
+        self.calls = calls
+        self.arrival = arrival
+        self.start = start
+        self.handler_us = handler_us
+        self.ready = start + handler_us + entry.overhead_us
+
+    @property
+    def queued(self):
+        return self.start - self.arrival
+
+    @property
+    def round_trip(self):
+        return self.ready - self.arrival
+
+
+def replay(trace, dispatcher, speed=1.0, costs=None):
+    """Replay the trace's commands through the dispatcher, with the arrival times divided by
+    speed and the handler times in costs (opcode -> µs) instead of the recorded ones"""
+    costs = costs or {}
+    replayed = []
+    free = 0
+    for entry in trace.entries:
+        arrival = entry.arrival_us / speed
+        opcode, calls = dispatcher.dispatch(entry.value)
+        command = Replayed(entry, opcode, calls, arrival, max(arrival, free),
+                           costs.get(opcode, entry.handler_us))
+        free = command.ready
+        replayed.append(command)
+    return replayed
+
+
+def max_queued(replayed):
+    """Most commands waiting to start at once, counting each as it arrives"""
+    deepest = 0
+    for n, command in enumerate(replayed):
+        waiting = sum(1 for earlier in replayed[:n] if earlier.start > command.arrival)
+        deepest = max(deepest, waiting + (command.start > command.arrival))
+    return deepest
+
+
+def percentile(values, permille):
+    values = sorted(values)
+    return values[min(len(values) - 1, (len(values) * permille + 999) // 1000 - 1)]
+
+
+def report(replayed, speed, dropped=0):
+    """The replay as text: totals, then a line for each opcode, slowest round trip p99 first"""
+    if not replayed:
+        return 'no commands\n'
+    span = replayed[-1].ready - replayed[0].arrival
+    busy = sum(c.handler_us + c.entry.overhead_us for c in replayed)
+    deepest = max_queued(replayed)
+    lines = [f'{len(replayed)} commands at {speed:g}x speed over {span:.0f} µs, '
+             f'busy {100 * busy / span if span else 100:.1f}%, at most {deepest} queued'
+             + (' (more than the RX FIFO holds)' if deepest > FIFO_DEPTH else '')
+             + (f', {dropped} not recorded' if dropped else ''),
+             f'{"opcode":18} {"count":>6} {"queued mean":>12} {"max":>8} {"handler mean":>13} '
+             f'{"max":>8} {"round trip p99":>15} {"max":>8}']
+    opcodes = {}
+    for command in replayed:
+        opcodes.setdefault(command.opcode, []).append(command)
+    rows = []
+    for opcode, commands in opcodes.items():
+        round_trips = [c.round_trip for c in commands]
+        rows.append((percentile(round_trips, 990), opcode, commands, round_trips))
+    for p99, opcode, commands, round_trips in sorted(rows, key=lambda row: (-row[0], row[1])):
+        queued = [c.queued for c in commands]
+        handlers = [c.handler_us for c in commands]
+        lines.append(f'{opcode:02X} {command_stats.opcode_name(opcode):15} {len(commands):6} '
+                     f'{sum(queued) / len(queued):12.1f} {max(queued):8.0f} '
+                     f'{sum(handlers) / len(handlers):13.1f} {max(handlers):8} '
+                     f'{p99:15.0f} {max(round_trips):8.0f}')
+    return ''.join(line + '\n' for line in lines)
+
+
+def parse_cost(text):
+    opcode, us = text.split('=')
+    return int(opcode, 16), int(us)
+
+
+def command(port, text):
+    """Send a USB command and return its lines up to the OK"""
+    port.write(f'{text}\n'.encode())
+    lines = []
+    while True:
+        line = port.readline().decode('ascii', 'replace')
+        if not line:
+            raise TimeoutError('no response from pico')
+        lines.append(line)
+        if line.startswith(('OK', 'ERR')):
+            return lines
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--port', default='/dev/ttyACM0')
+    parser.add_argument('--trace', help='read a saved "trace" output instead of the Pico')
+    parser.add_argument('--on', action='store_true', help='start recording into an empty trace')
+    parser.add_argument('--off', action='store_true', help='stop recording after fetching it')
+    parser.add_argument('--save', help='also write the trace to this file, for --trace')
+    parser.add_argument('--speed', type=float, default=1.0,
+                        help='C64 speed to replay at, as a multiple of the recorded one')
+    parser.add_argument('--cost', type=parse_cost, action='append', default=[],
+                        metavar='OPCODE=US', help='handler time for a hex opcode, in µs')
+    parser.add_argument('--carts', type=int, default=CART_MAX,
+                        help='cartridges in the library, for CMD_SELECT_CART (default %(default)s)')
+    args = parser.parse_args()
+
+    try:
+        if args.trace:
+            with open(args.trace) as f:
+                lines = f.readlines()
+        else:
+            import serial  # pyserial, only needed when talking to the hardware
+
+            with serial.Serial(args.port, timeout=2) as port:
+                if args.on:
+                    command(port, 'trace on')
+                    print('recording; run this again without --on for the replay')
+                    return
+                lines = command(port, 'trace')
+                if args.off:
+                    command(port, 'trace off')
+        trace = parse_export(lines)
+    except ExportError as e:
+        sys.exit(f'pico: {e}')
+    if args.save:
+        with open(args.save, 'w') as f:
+            f.write(trace.export())
+
+    with tempfile.TemporaryDirectory() as build_dir:
+        dispatcher = Dispatcher(build_dir, args.carts)
+        replayed = replay(trace, dispatcher, args.speed, dict(args.cost))
+    print(report(replayed, args.speed, trace.dropped), end='')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,273 @@
+#!/usr/bin/env python
+"""Test the command trace and dispatcher in the firmware against tools/command_replay.py.
+
+firmware/command_trace.c and command_dispatch.c are compiled with the host's C compiler ($CC,
+default cc) and called through ctypes.  The trace must export the same text as
+command_replay.py in any size of buffer, which must parse back, and count what it can't hold as
+dropped.  The dispatcher must call the right handler for each command, with LOAD names whole
+and cut at D64_NAME_MAX, and drop a name or benchmark result when it's reset part way through.
+The replay must queue commands as worked out by hand and give the same result every time.
+Broken exports must be refused:
+
+    python tools/command_replay_test.py
+"""
+import ctypes
+import random
+import sys
+import tempfile
+
+import command_replay
+import host_c
+
+ENTRIES = host_c.header_define('command_trace.h', 'COMMAND_TRACE_ENTRIES')
+LINE_MAX = host_c.header_define('command_trace.h', 'COMMAND_TRACE_LINE_MAX')
+SUMMARY_MAX = host_c.header_define('command_trace.h', 'COMMAND_TRACE_SUMMARY_MAX')
+
+
+class CEntry(ctypes.Structure):
+    _fields_ = [('arrival_us', ctypes.c_uint32), ('handler_us', ctypes.c_uint32),
+                ('overhead_us', ctypes.c_uint32), ('value', ctypes.c_uint8)]
+
+
+class CTrace(ctypes.Structure):
+    _fields_ = [('entries', CEntry * ENTRIES), ('count', ctypes.c_uint32),
+                ('dropped', ctypes.c_uint32)]
+
+
+class CCommandTrace:
+    """firmware/command_trace.c, compiled for the host"""
+
+    def __init__(self, build_dir):
+        self.lib = host_c.load(build_dir, 'command_trace.c')
+        self.lib.command_trace_add.restype = ctypes.c_bool
+        self.lib.command_trace_summary.restype = ctypes.c_size_t
+        self.lib.command_trace_export.restype = ctypes.c_size_t
+
+    def trace(self, entries):
+        """The trace, and what command_trace_add returned for each entry"""
+        trace = CTrace()
+        self.lib.command_trace_reset(ctypes.byref(trace))
+        results = [self.lib.command_trace_add(ctypes.byref(trace), ctypes.byref(
+                       CEntry(e.arrival_us, e.handler_us, e.overhead_us, e.value)))
+                   for e in entries]
+        return trace, results
+
+    def export(self, trace, size):
+        """The summary and every entry, exported in chunks of size bytes like the USB command"""
+        out = ctypes.create_string_buffer(max(size, SUMMARY_MAX))
+        self.lib.command_trace_summary(ctypes.byref(trace), out, ctypes.c_size_t(len(out)))
+        text = out.value.decode()
+        cursor = ctypes.c_uint(0)
+        while cursor.value < trace.count:
+            before = cursor.value
+            length = self.lib.command_trace_export(ctypes.byref(trace), ctypes.byref(cursor),
+                                                   out, ctypes.c_size_t(size))
+            if cursor.value == before or length != len(out.value):
+                raise RuntimeError(f'export stuck at entry {before}')
+            text += out.value.decode()
+        return text
+
+
+def random_entries(rng, count):
+    arrival = 0
+    entries = []
+    for _ in range(count):
+        arrival += rng.randrange(1 << rng.randrange(1, 20))
+        entries.append(command_replay.Entry(arrival, rng.randrange(256),
+                                            rng.randrange(1 << rng.randrange(1, 32)),
+                                            rng.randrange(1000)))
+    return entries
+
+
+def trace_cases():
+    rng = random.Random(45)
+    yield 'empty', []
+    yield 'one', [command_replay.Entry(0, 0x01, 120, 35)]
+    yield 'largest', [command_replay.Entry(0xffffffff, 0xff, 0xffffffff, 0xffffffff)]
+    yield 'random', random_entries(rng, 300)
+    yield 'overflowing', random_entries(rng, ENTRIES + 20)
+
+
+def check_trace(c, entries):
+    """Error messages for one trace"""
+    errors = []
+    kept = entries[:ENTRIES]
+    expected = command_replay.Trace(kept, len(entries) - len(kept))
+    trace, results = c.trace(entries)
+    if results != [n < ENTRIES for n in range(len(entries))]:
+        errors.append('C keeps the wrong entries')
+    if trace.dropped != expected.dropped:
+        errors.append(f'C dropped {trace.dropped}, expected {expected.dropped}')
+    for size in (LINE_MAX, 100, 1024):
+        text = c.export(trace, size)
+        if text != expected.export():
+            errors.append(f'C and command_replay.py export differently in {size} bytes')
+            continue
+        try:
+            parsed = command_replay.parse_export(
+                ['log output\n'] + text.splitlines(True) + ['OK\n', 'CMD 0 01 0 0\n'])
+        except command_replay.ExportError as e:
+            errors.append(f'export doesn\'t parse: {e}')
+        else:
+            if parsed.entries != kept or parsed.dropped != expected.dropped:
+                errors.append('parsed export differs')
+    return errors
+
+
+def check_known(c):
+    """Error messages for a trace exported as worked out by hand: two commands kept and one
+    dropped from a trace with room for two"""
+    entries = [command_replay.Entry(7, 0x01, 120, 35), command_replay.Entry(0xffffffff, 0x1f, 0, 4),
+               command_replay.Entry(9, 0x02, 1, 1)]
+    trace, _ = c.trace(entries)
+    # Only the first two, as if the trace were full after them
+    trace.count, trace.dropped = 2, 1
+    text = c.export(trace, LINE_MAX)
+    expected = 'TRACE commands 2 dropped 1\nCMD 7 01 120 35\nCMD 4294967295 1F 0 4\n'
+    return [] if text == expected else [f'exports {text!r}, expected {expected!r}']
+
+
+RESET = None    # in dispatch_cases(): command_dispatch_reset()
+
+
+def dispatch_cases():
+    """Commands, and the handler calls they should make"""
+    name = b'A VERY LONG FILENAME'
+    cut = name[:command_replay.name_max()]
+    yield 'opcodes', [0x01, 0x02, 0x03, 0x04], [
+        ('next_page',), ('sleep',), ('check_crc',), ('save_nufli',)]
+    yield 'load', [0x05, 5, *b'DEMO', 0x01], [('open_load_file', b'DEMO'), ('next_page',)]
+    yield 'load empty name', [0x05, 1, 0x02], [('open_load_file', b''), ('sleep',)]
+    # A name's characters can be any value, commands included
+    yield 'load opcodes', [0x05, 4, 0x01, 0x05, 0x10], [('open_load_file', b'\x01\x05\x10')]
+    yield 'load long name', [0x05, len(name) + 1, *name], [('open_load_file', cut)]
+    yield 'carts', [0x10, 0x12, 0x13, 0x1f], [('select_cart', 0), ('select_cart', 2)]
+    yield 'ping', [0x06], [('ping',)]
+    # A benchmark result's number + 1, then its nibbles + 1, which can look like commands too
+    yield 'bench result', [0x07, 2, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x10, 0x06], [
+        ('bench_result', 1, 0x0123456f), ('ping',)]
+    yield 'no romh', [0x08], [('no_romh',)]
+    # The guard locking or unlocking (RESET) drops a name or result part way through
+    yield 'load cut short', [0x05, 5, *b'DE', RESET, 0x01], [('next_page',)]
+    yield 'bench result cut short', [0x07, 2, 0x01, 0x02, RESET, 0x06], [('ping',)]
+    yield 'unknown', [0x00, 0x09, 0x0f, 0x20, 0xff, 0x1234], []
+
+
+def check_dispatch(dispatcher, commands, calls):
+    """Error messages for one list of commands through a fresh dispatcher"""
+    errors = []
+    got = []
+    following, left = None, 0  # what the next commands are part of, and how many there are
+    for value in commands:
+        if value is RESET:
+            dispatcher.reset()
+            left = 0
+            continue
+        opcode, made = dispatcher.dispatch(value)
+        expected = following if left else value & 0xff
+        if opcode != expected:
+            errors.append(f'{value:#x} counts as {opcode:02X}, expected {expected:02X}')
+        if left:
+            left = value - 1 if left == 'length' else left - 1
+        elif value == 0x05:
+            following, left = 0x05, 'length'
+        elif value == 0x07:
+            following, left = 0x07, 9
+        got += made
+    if got != calls:
+        errors.append(f'calls {got}, expected {calls}')
+    return errors
+
+
+class Stub:
+    """A dispatcher that only classifies: enough for replays of opcodes on their own"""
+
+    def dispatch(self, value):
+        return value, []
+
+
+def replay_cases():
+    """Traces, speeds and costs, and the queueing each command should get"""
+    three = command_replay.Trace([command_replay.Entry(t, 0x01, 15, 0) for t in (0, 10, 20)])
+    yield 'recorded speed', three, 1.0, {}, [0, 5, 10]
+    yield 'half speed', three, 0.5, {}, [0, 0, 0]
+    yield 'double speed', three, 2.0, {}, [0, 10, 20]
+    yield 'cheaper', three, 1.0, {0x01: 5}, [0, 0, 0]
+    # Overhead keeps the loop busy after the handler too
+    loop = command_replay.Trace([command_replay.Entry(0, 0x01, 10, 5),
+                                 command_replay.Entry(12, 0x02, 100, 5),
+                                 command_replay.Entry(20, 0x01, 10, 5)])
+    yield 'overhead', loop, 1.0, {}, [0, 3, 100]
+    yield 'costly sleep', loop, 1.0, {0x02: 1000}, [0, 3, 1000]
+
+
+def check_replay(dispatcher, trace, speed, costs, queued):
+    errors = []
+    replayed = command_replay.replay(trace, dispatcher, speed, costs)
+    got = [c.queued for c in replayed]
+    if got != queued:
+        errors.append(f'queued {got}, expected {queued}')
+    again = command_replay.replay(trace, dispatcher, speed, costs)
+    if command_replay.report(again, speed) != command_replay.report(replayed, speed):
+        errors.append('replaying again gives a different report')
+    return errors
+
+
+def main():
+    failures = 0
+    with tempfile.TemporaryDirectory() as build_dir:
+        c = CCommandTrace(build_dir)
+        for name, entries in trace_cases():
+            errors = check_trace(c, entries)
+            print(f'trace {name}: {len(entries)} commands'
+                  + ''.join(f'  FAIL: {e}' for e in errors))
+            failures += bool(errors)
+        errors = check_known(c)
+        print('trace worked out by hand' + ''.join(f'  FAIL: {e}' for e in errors))
+        failures += bool(errors)
+
+        for name, commands, calls in dispatch_cases():
+            errors = check_dispatch(command_replay.Dispatcher(build_dir), commands, calls)
+            print(f'dispatch {name}: {len(calls)} calls'
+                  + ''.join(f'  FAIL: {e}' for e in errors))
+            failures += bool(errors)
+
+        for name, trace, speed, costs, queued in replay_cases():
+            errors = check_replay(Stub(), trace, speed, costs, queued)
+            print(f'replay {name}: queued {queued}'
+                  + ''.join(f'  FAIL: {e}' for e in errors))
+            failures += bool(errors)
+
+        # A whole random trace through the real dispatcher: the same report each time, and
+        # commands never start before they arrive or before the last one is ready
+        trace = command_replay.Trace(random_entries(random.Random(64), ENTRIES))
+        replayed = command_replay.replay(trace, command_replay.Dispatcher(build_dir))
+        again = command_replay.replay(trace, command_replay.Dispatcher(build_dir))
+        ok = command_replay.report(replayed, 1.0) == command_replay.report(again, 1.0) and all(
+            c.start >= c.arrival and (n == 0 or c.start >= replayed[n - 1].ready)
+            for n, c in enumerate(replayed))
+        print('replay random: ' + ('OK' if ok else 'FAIL'))
+        failures += not ok
+
+    broken = [
+        ('no summary', ['CMD 0 01 0 0\n', 'OK\n']),
+        ('summary disagrees', ['TRACE commands 2 dropped 0\n', 'CMD 0 01 0 0\n', 'OK\n']),
+        ('missing field', ['TRACE commands 1 dropped 0\n', 'CMD 0 01 0\n', 'OK\n']),
+        ('bad value', ['TRACE commands 1 dropped 0\n', 'CMD 0 xx 0 0\n', 'OK\n']),
+        ('error', ['ERR usage: trace [on|off|reset]\n']),
+    ]
+    for name, lines in broken:
+        try:
+            command_replay.parse_export(lines)
+            error = 'accepted'
+        except command_replay.ExportError:
+            error = None
+        print(f'refuse {name}' + (f'  FAIL: {error}' if error else ''))
+        failures += bool(error)
+
+    print(f'{failures} failed' if failures else 'all OK')
+    sys.exit(1 if failures else 0)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,223 @@
+#!/usr/bin/env python
+"""Fetch and show how long each command from the C64 takes to handle.
+
+The firmware times every command the C64 sends, from taking it from the command program to
+putting the ready token back, and keeps the min, mean, p99 and max for each opcode (see
+firmware/command_stats.h).  This reads them with the "cmdstats" USB command and prints a table,
+slowest p99 first; those are the commands the C64 spends longest polling the status for.
+--reset empties them first:
+
+    python tools/command_stats.py
+
+How the firmware adds up the times, prints them and lays out the mailbox the C64 reads at
+$9000 is written out again below, for tools/command_stats_test.py.
+"""
+import argparse
+import struct
+import sys
+
+SLOTS = 16              # COMMAND_STATS_SLOTS
+BUCKETS = 64            # COMMAND_STATS_BUCKETS
+RECORD_SIZE = 24        # COMMAND_STATS_RECORD_SIZE
+MAILBOX_SIZE = SLOTS * RECORD_SIZE
+U32_MAX = 0xffffffff
+
+# Opcodes from command_t in firmware/command_dispatch.h
+OPCODE_NAMES = {0x01: 'next page', 0x02: 'sleep', 0x03: 'check crc', 0x04: 'save nufli',
+                0x05: 'load open', 0x06: 'ping', 0x07: 'bench result', 0x08: 'no romh'}
+
+
+def opcode_name(opcode):
+    if opcode in OPCODE_NAMES:
+        return OPCODE_NAMES[opcode]
+    if 0x10 <= opcode < 0x20:
+        return f'select cart {opcode - 0x10}'
+    return '?'
+
+
+def bucket_of(us):
+    """Histogram bucket for a round trip: exact below 4, then 2 for each power of two"""
+    if us < 4:
+        return us
+    e = us.bit_length() - 1
+    return 4 + (e - 2) * 2 + ((us >> (e - 1)) & 1)
+
+
+def bucket_top(bucket):
+    """Largest round trip in a bucket"""
+    if bucket < 4:
+        return bucket
+    e = (bucket - 4) // 2 + 2
+    return (1 << e) + ((bucket - 4) % 2 << (e - 1)) + (1 << (e - 1)) - 1
+
+
+def elapsed(start, end):
+    return 0 if end < start else min(end - start, U32_MAX)
+
+
+class Interval:
+    def __init__(self):
+        self.count = 0
+        self.min = 0
+        self.max = 0
+        self.sum = 0
+
+    def add(self, us):
+        if not self.count or us < self.min:
+            self.min = us
+        self.max = max(self.max, us)
+        self.count += 1
+        self.sum += us
+
+    @property
+    def mean(self):
+        return self.sum // self.count if self.count else 0
+
+
+class Slot:
+    def __init__(self, opcode):
+        self.opcode = opcode
+        self.round_trip = Interval()
+        self.handler = Interval()
+        self.buckets = [0] * BUCKETS
+
+    def percentile(self, permille):
+        """Round trip that permille thousandths of the commands are within, as the top of its
+        bucket but no more than the max"""
+        needed = -(-self.round_trip.count * permille // 1000)
+        seen = 0
+        for bucket, count in enumerate(self.buckets):
+            seen += count
+            if seen and seen >= needed:
+                return min(bucket_top(bucket), self.round_trip.max)
+        return 0
+
+
+class Stats:
+    def __init__(self):
+        self.slots = []
+        self.dropped = 0
+
+    def record(self, opcode, received, started, finished, ready):
+        """Add a command's timing in µs; False if there's no slot left for it"""
+        slot = next((s for s in self.slots if s.opcode == opcode), None)
+        if slot is None:
+            if len(self.slots) == SLOTS:
+                self.dropped += 1
+                return False
+            slot = Slot(opcode)
+            self.slots.append(slot)
+        round_trip = elapsed(received, ready)
+        slot.round_trip.add(round_trip)
+        slot.handler.add(elapsed(started, finished))
+        slot.buckets[bucket_of(round_trip)] += 1
+        return True
+
+    def mailbox(self):
+        """The bytes the C64 sees at COMMAND_STATS_OFFSET"""
+        out = b''.join(struct.pack('<B3x5I', s.opcode, s.round_trip.count, s.round_trip.min,
+                                   s.round_trip.mean, s.percentile(990), s.round_trip.max)
+                       for s in self.slots)
+        return out.ljust(MAILBOX_SIZE, b'\0')
+
+    def export(self):
+        """The text the "cmdstats" USB command prints before its OK"""
+        lines = [f'CMDSTATS slots {len(self.slots)} dropped {self.dropped}']
+        lines += [f'CMDSTAT {s.opcode:02X} count {s.round_trip.count} min {s.round_trip.min} '
+                  f'mean {s.round_trip.mean} p99 {s.percentile(990)} max {s.round_trip.max} '
+                  f'handler_min {s.handler.min} handler_mean {s.handler.mean} '
+                  f'handler_max {s.handler.max}' for s in self.slots]
+        return ''.join(line + '\n' for line in lines)
+
+
+FIELDS = ('count', 'min', 'mean', 'p99', 'max', 'handler_min', 'handler_mean', 'handler_max')
+
+
+class ExportError(ValueError):
+    pass
+
+
+def parse_export(lines):
+    """Return the dropped count and a dict of opcode to a dict of FIELDS from the lines the
+    "cmdstats" USB command prints, up to its OK.  Other lines are log output and are skipped."""
+    summary = None
+    opcodes = {}
+    for line in lines:
+        words = line.split()
+        if not words:
+            continue
+        if words[0] == 'OK':
+            break
+        if words[0] == 'ERR':
+            raise ExportError(line.strip())
+        if words[0] == 'CMDSTATS':
+            fields = dict(zip(words[1::2], words[2::2]))
+            try:
+                summary = int(fields['slots']), int(fields['dropped'])
+            except (KeyError, ValueError):
+                raise ExportError(f'bad summary: {line.strip()}')
+        elif words[0] == 'CMDSTAT':
+            try:
+                opcode = int(words[1], 16)
+                fields = dict(zip(words[2::2], (int(w) for w in words[3::2])))
+                opcodes[opcode] = {key: fields[key] for key in FIELDS}
+            except (IndexError, KeyError, ValueError):
+                raise ExportError(f'bad line: {line.strip()}')
+    if summary is None:
+        raise ExportError('no CMDSTATS line')
+    if summary[0] != len(opcodes):
+        raise ExportError(f'summary has {summary[0]} slots, there are {len(opcodes)} lines')
+    return summary[1], opcodes
+
+
+def parse_mailbox(data):
+    """Return a dict of opcode to (count, min, mean, p99, max) from the mailbox bytes"""
+    opcodes = {}
+    for offset in range(0, min(len(data), MAILBOX_SIZE) - RECORD_SIZE + 1, RECORD_SIZE):
+        opcode, *values = struct.unpack_from('<B3x5I', data, offset)
+        if not values[0]:
+            break
+        opcodes[opcode] = tuple(values)
+    return opcodes
+
+
+def command(port, text):
+    """Send a USB command and return its lines up to the OK"""
+    port.write(f'{text}\n'.encode())
+    lines = []
+    while True:
+        line = port.readline().decode('ascii', 'replace')
+        if not line:
+            raise TimeoutError('no response from pico')
+        lines.append(line)
+        if line.startswith(('OK', 'ERR')):
+            return lines
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--port', default='/dev/ttyACM0')
+    parser.add_argument('--reset', action='store_true', help='empty the statistics first')
+    args = parser.parse_args()
+
+    import serial  # pyserial, only needed when talking to the hardware
+
+    with serial.Serial(args.port, timeout=2) as port:
+        if args.reset:
+            command(port, 'cmdstats reset')
+        try:
+            dropped, rows = parse_export(command(port, 'cmdstats'))
+        except ExportError as e:
+            sys.exit(f'pico: {e}')
+
+    print(f'{"opcode":18} {"count":>8} {"min":>8} {"mean":>8} {"p99":>8} {"max":>8} '
+          f'{"handler mean":>12}')
+    for opcode, row in sorted(rows.items(), key=lambda item: -item[1]['p99']):
+        print(f'{opcode:02X} {opcode_name(opcode):15} {row["count"]:8} {row["min"]:8} '
+              f'{row["mean"]:8} {row["p99"]:8} {row["max"]:8} {row["handler_mean"]:12}')
+    print('times in µs' + (f', {dropped} commands with no slot' if dropped else ''))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,241 @@
+#!/usr/bin/env python
+"""Test the command statistics in firmware/command_stats.c against tools/command_stats.py.
+
+command_stats.c is compiled with the host's C compiler ($CC, default cc) and called through
+ctypes.  Each case is a list of commands with their four timestamps; both must aggregate them
+the same, export the same text, which command_stats.py must parse back, and write the same
+mailbox bytes.  Every p99 must be no less than the real one, within its bucket, and no more
+than the max.  More opcodes than slots must be counted as dropped, and broken exports refused:
+
+    python tools/command_stats_test.py
+"""
+import ctypes
+import random
+import sys
+import tempfile
+
+import command_stats
+import host_c
+
+
+class CTiming(ctypes.Structure):
+    _fields_ = [(name, ctypes.c_uint64)
+                for name in ('received_us', 'started_us', 'finished_us', 'ready_us')]
+
+
+class CInterval(ctypes.Structure):
+    _fields_ = [('count', ctypes.c_uint32), ('min', ctypes.c_uint32), ('max', ctypes.c_uint32),
+                ('sum', ctypes.c_uint64)]
+
+
+class CSlot(ctypes.Structure):
+    _fields_ = [('opcode', ctypes.c_uint8), ('round_trip', CInterval), ('handler', CInterval),
+                ('buckets', ctypes.c_uint32 * command_stats.BUCKETS)]
+
+
+class CStats(ctypes.Structure):
+    _fields_ = [('slots', CSlot * command_stats.SLOTS), ('dropped', ctypes.c_uint32)]
+
+
+class CCommandStats:
+    """firmware/command_stats.c, compiled for the host"""
+
+    def __init__(self, build_dir):
+        self.lib = host_c.load(build_dir, 'command_stats.c')
+        self.lib.command_stats_record.restype = ctypes.c_bool
+        self.lib.command_stats_find.restype = ctypes.POINTER(CSlot)
+        self.lib.command_stats_percentile.restype = ctypes.c_uint32
+        self.lib.command_stats_export.restype = ctypes.c_size_t
+
+    def stats(self, commands):
+        """The stats, and what command_stats_record returned for each command"""
+        stats = CStats()
+        self.lib.command_stats_reset(ctypes.byref(stats))
+        results = [self.lib.command_stats_record(ctypes.byref(stats), ctypes.c_uint8(opcode),
+                                                 ctypes.byref(CTiming(*times)))
+                   for opcode, times in commands]
+        return stats, results
+
+    def percentile(self, stats, opcode, permille):
+        slot = self.lib.command_stats_find(ctypes.byref(stats), ctypes.c_uint8(opcode))
+        return self.lib.command_stats_percentile(slot, permille)
+
+    def mailbox(self, stats):
+        out = ctypes.create_string_buffer(command_stats.MAILBOX_SIZE)
+        self.lib.command_stats_mailbox(ctypes.byref(stats), out)
+        return out.raw
+
+    def export(self, stats, size=None):
+        """The export text, and the length command_stats_export returned"""
+        size = 32 + command_stats.SLOTS * 160 if size is None else size
+        out = ctypes.create_string_buffer(size + 1)
+        length = self.lib.command_stats_export(ctypes.byref(stats), out, ctypes.c_size_t(size))
+        return out.value.decode(), length
+
+
+def header_define(name):
+    return host_c.header_define('command_stats.h', name)
+
+
+def command(rng, opcode, handler, overhead):
+    """Timestamps for a command: receive, start after the "Got command" printf, then ready"""
+    received = rng.randrange(1 << 40)
+    started = received + rng.randrange(overhead + 1)
+    finished = started + handler
+    return opcode, (received, started, finished, finished + rng.randrange(overhead + 1))
+
+
+def cases():
+    rng = random.Random(42)
+    yield 'empty', []
+    yield 'one', [(0x01, (1000, 1010, 1500, 1520))]
+    yield 'exact buckets', [(0x03, (0, 0, 0, us)) for us in range(8)]
+    yield 'backwards', [(0x02, (500, 400, 300, 200))]
+    yield 'huge', [(0x02, (0, 0, 1 << 40, 1 << 41)), (0x02, (0, 0, 0, 0xffffffff))]
+    # The C64 waiting on a sleep: 5 s handlers among fast page flips
+    yield 'next page and sleep', (
+        [command(rng, 0x01, rng.randrange(80, 120), 300) for _ in range(500)]
+        + [command(rng, 0x02, 5000000, 300) for _ in range(3)])
+    # 99 fast and one slow: p99 is still fast
+    yield '99 fast, 1 slow', ([(0x04, (0, 0, 0, 100))] * 99 + [(0x04, (0, 0, 0, 90000))])
+    yield 'many opcodes', [command(rng, rng.choice((1, 3, 4, 5, 0x10, 0x11, 0x18)),
+                                   int(rng.lognormvariate(5, 2)), 2000) for _ in range(3000)]
+    yield 'too many opcodes', [command(rng, opcode, 10, 10)
+                               for opcode in list(range(0x20)) * 3]
+
+
+def check(c, name, commands):
+    """Error messages for one case"""
+    errors = []
+    expected = command_stats.Stats()
+    results = [expected.record(opcode, *times) for opcode, times in commands]
+    stats, c_results = c.stats(commands)
+    if c_results != results:
+        errors.append('C and command_stats.py drop differently')
+    if stats.dropped != expected.dropped:
+        errors.append(f'C dropped {stats.dropped}, command_stats.py {expected.dropped}')
+
+    for slot in expected.slots:
+        for permille in (0, 1, 500, 990, 1000):
+            got = c.percentile(stats, slot.opcode, permille)
+            if got != slot.percentile(permille):
+                errors.append(f'{slot.opcode:02X} {permille} permille: C {got}, '
+                              f'command_stats.py {slot.percentile(permille)}')
+        # The p99 against the real one, from the round trips sorted
+        trips = sorted(command_stats.elapsed(times[0], times[3])
+                       for opcode, times in commands if opcode == slot.opcode)
+        real = trips[-(-len(trips) * 990 // 1000) - 1]
+        p99 = slot.percentile(990)
+        if not real <= p99 <= min(command_stats.bucket_top(command_stats.bucket_of(real)),
+                                  trips[-1]):
+            errors.append(f'{slot.opcode:02X} p99 {p99} for a real p99 of {real}')
+
+    text, length = c.export(stats)
+    if text != expected.export() or length != len(text):
+        errors.append('C and command_stats.py export differently')
+    try:
+        dropped, parsed = command_stats.parse_export(
+            ['log output\n'] + text.splitlines(True) + ['OK\n', 'CMDSTAT 01\n'])
+    except command_stats.ExportError as e:
+        errors.append(f'export doesn\'t parse: {e}')
+    else:
+        opcodes = sorted(s.opcode for s in expected.slots)
+        if dropped != expected.dropped or sorted(parsed) != opcodes \
+                or any(parsed[s.opcode]['p99'] != s.percentile(990) for s in expected.slots):
+            errors.append('parsed export differs')
+
+    mailbox = c.mailbox(stats)
+    if mailbox != expected.mailbox():
+        errors.append('C and command_stats.py mailboxes differ')
+    elif command_stats.parse_mailbox(mailbox) != {
+            opcode: tuple(row[key] for key in ('count', 'min', 'mean', 'p99', 'max'))
+            for opcode, row in parsed.items()}:
+        errors.append('mailbox disagrees with the export')
+
+    # A short buffer gets a truncated export, and the full length like snprintf
+    short, short_length = c.export(stats, 20)
+    if short != text[:19] or short_length != len(text):
+        errors.append('truncated export is wrong')
+    return errors
+
+
+def check_known(c):
+    """Error messages for statistics worked out by hand: two CMD_NEXT_PAGEs of 110 and 210 µs
+    with 100 and 200 µs handlers, and a 4 µs CMD_PING"""
+    stats, _ = c.stats([(0x01, (0, 5, 105, 110)), (0x01, (1000, 1003, 1203, 1210)),
+                        (0x06, (2000, 2001, 2002, 2004))])
+    errors = []
+    text, _ = c.export(stats)
+    expected = ('CMDSTATS slots 2 dropped 0\n'
+                'CMDSTAT 01 count 2 min 110 mean 160 p99 210 max 210 handler_min 100 '
+                'handler_mean 150 handler_max 200\n'
+                'CMDSTAT 06 count 1 min 4 mean 4 p99 4 max 4 handler_min 1 handler_mean 1 '
+                'handler_max 1\n')
+    if text != expected:
+        errors.append(f'exports {text!r}, expected {expected!r}')
+    # opcode, 3 zero bytes, then count, min, mean, p99 and max, little endian
+    mailbox = c.mailbox(stats)
+    expected = bytes.fromhex('01000000 02000000 6e000000 a0000000 d2000000 d2000000'
+                             '06000000 01000000 04000000 04000000 04000000 04000000'
+                             '00000000')
+    if mailbox[:len(expected)] != expected:
+        errors.append(f'mailbox starts {mailbox[:len(expected)].hex()}')
+    return errors
+
+
+def main():
+    failures = 0
+    defines = {'COMMAND_STATS_SLOTS': command_stats.SLOTS,
+               'COMMAND_STATS_BUCKETS': command_stats.BUCKETS,
+               'COMMAND_STATS_RECORD_SIZE': command_stats.RECORD_SIZE}
+    wrong = {name: header_define(name) for name, value in defines.items()
+             if header_define(name) != value}
+    print('defines: ' + (f'FAIL: {wrong}' if wrong else 'OK'))
+    failures += bool(wrong)
+    ok = command_stats.bucket_of(0xffffffff) == command_stats.BUCKETS - 1 and all(
+        command_stats.bucket_of(command_stats.bucket_top(b)) == b
+        and command_stats.bucket_of(command_stats.bucket_top(b) + 1) == b + 1
+        for b in range(command_stats.BUCKETS - 1))
+    print('buckets: ' + ('OK' if ok else 'FAIL'))
+    failures += not ok
+
+    with tempfile.TemporaryDirectory() as build_dir:
+        c = CCommandStats(build_dir)
+        for name, commands in cases():
+            errors = check(c, name, commands)
+            expected = command_stats.Stats()
+            for opcode, times in commands:
+                expected.record(opcode, *times)
+            worst = max(expected.slots, key=lambda s: s.percentile(990), default=None)
+            print(f'{name}: {len(commands)} commands, {len(expected.slots)} opcodes'
+                  + (f', slowest p99 {worst.opcode:02X} {worst.percentile(990)} µs'
+                     if worst else '')
+                  + ''.join(f'  FAIL: {e}' for e in errors))
+            failures += bool(errors)
+        errors = check_known(c)
+        print('known commands' + ''.join(f'  FAIL: {e}' for e in errors))
+        failures += bool(errors)
+
+    broken = [
+        ('no summary', ['CMDSTAT 01 count 1 min 1 mean 1 p99 1 max 1 handler_min 0 '
+                        'handler_mean 0 handler_max 0\n', 'OK\n']),
+        ('summary disagrees', ['CMDSTATS slots 2 dropped 0\n', 'OK\n']),
+        ('missing field', ['CMDSTATS slots 1 dropped 0\n', 'CMDSTAT 01 count 1\n', 'OK\n']),
+        ('bad opcode', ['CMDSTATS slots 1 dropped 0\n', 'CMDSTAT xx count 1\n', 'OK\n']),
+        ('error', ['ERR usage: cmdstats [reset]\n']),
+    ]
+    for name, lines in broken:
+        try:
+            command_stats.parse_export(lines)
+            error = 'accepted'
+        except command_stats.ExportError:
+            error = None
+        print(f'refuse {name}' + (f'  FAIL: {error}' if error else ''))
+        failures += bool(error)
+
+    print(f'{failures} failed' if failures else 'all OK')
+    sys.exit(1 if failures else 0)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,269 @@
+#!/usr/bin/env python
+"""Generate a 6502 routine that copies one particular image into C64 RAM.
+
+firmware/copy_gen.c generates the same code on the Pico when it serves an image, and
+tools/copy_gen_test.py compares the two through CLibrary.  The image is split into 32 byte sections:
+
+- Sections that are one byte repeated are filled from a register at the end, and never go
+  through the window.
+- The other sections are packed into a stream of 1K windows.  For each window, the routine
+  waits for the Pico to be ready, copies it with lda abs,x / sta abs,x straight to each
+  section's final address, and sends CMD_NEXT_PAGE.
+
+The routine runs from the ROM window, so it needs no patching or zero-page pointers.
+
+The immediate layout sends the data as the operands of the routine instead.  Each 2K chunk of
+the image becomes an lda # for each value in it, followed by a sta abs for each byte with that
+value.  The Pico generates the chunks one at a time at the same address, and each one ends by
+jumping to a stub that sends CMD_NEXT_PAGE and waits for the next.  A chunk under the I/O
+area banks I/O out while it stores.
+
+    python tools/copy_gen.py c64-rom/raspi.nuf --skip 2 -o copy_routine.bin
+    python tools/copy_gen.py c64-rom/raspi.nuf --skip 2 --layout immediate
+"""
+import argparse
+import ctypes
+import sys
+
+import host_c
+
+SECTION_SIZE = 32
+CHUNK_SIZE = 2048
+STUBS_SIZE = 28
+
+LDA_IMM = 0xa9
+LDA_ABS = 0xad
+LDA_ABX = 0xbd
+STA_ABS = 0x8d
+STA_ABX = 0x9d
+STA_ZP = 0x85
+LDX_IMM = 0xa2
+DEX = 0xca
+BNE = 0xd0
+BPL = 0x10
+BMI = 0x30
+JMP = 0x4c
+
+# Banking I/O out with the CPU port, so stores to $D000-$DFFF go to RAM
+CPU_PORT = 0x01
+CPU_PORT_NO_IO = 0x33
+CPU_PORT_DEFAULT = 0x37
+IO_START = 0xd000
+IO_END = 0xe000
+
+
+class Config:
+    def __init__(self, dest=0x2000, exec_address=0x3000, origin=0xa000, window=0x8400,
+                 window_size=0x400, command_area=0x9e00, next_page=0x01, stubs=0xbf00):
+        self.dest = dest
+        self.exec_address = exec_address
+        self.origin = origin
+        self.window = window
+        self.window_size = window_size
+        self.command_area = command_area
+        self.next_page = next_page
+        self.stubs = stubs
+
+
+class Emitter:
+    def __init__(self, origin):
+        self.origin = origin
+        self.code = bytearray()
+
+    @property
+    def pc(self):
+        return self.origin + len(self.code)
+
+    def op(self, opcode, operand=None, size=0):
+        self.code.append(opcode)
+        if size == 1:
+            self.code.append(operand & 0xff)
+        elif size == 2:
+            self.code += bytes([operand & 0xff, operand >> 8])
+
+    def loop_end(self, loop):
+        """dex, and loop while x >= 0.  bpl if it reaches, otherwise bmi over a jmp."""
+        self.op(DEX)
+        offset = loop - (self.pc + 2)
+        if offset >= -128:
+            self.op(BPL, offset, 1)
+        else:
+            self.op(BMI, 3, 1)
+            self.op(JMP, loop, 2)
+
+
+def generate(image, config=None):
+    """Return (code, stream), or raise ValueError if the image can't be split into sections."""
+    config = config or Config()
+    if len(image) % SECTION_SIZE:
+        raise ValueError(f'image size {len(image)} is not a multiple of {SECTION_SIZE}')
+
+    copies = []
+    fills = []
+    for offset in range(0, len(image), SECTION_SIZE):
+        section = image[offset:offset + SECTION_SIZE]
+        if section.count(section[0]) == SECTION_SIZE:
+            fills.append((section[0], offset))
+        else:
+            copies.append(offset)
+    fills.sort()
+
+    e = Emitter(config.origin)
+    stream = bytearray()
+    per_window = config.window_size // SECTION_SIZE
+    for first in range(0, len(copies), per_window):
+        window = copies[first:first + per_window]
+        wait = e.pc
+        e.op(LDA_ABS, config.command_area, 2)  # status
+        e.op(STA_ABS, 0xd020, 2)               # flash border if the pico's cpu is busy
+        e.op(BNE, wait - (e.pc + 2), 1)
+        e.op(LDX_IMM, SECTION_SIZE - 1, 1)
+        loop = e.pc
+        for i, offset in enumerate(window):
+            e.op(LDA_ABX, config.window + i * SECTION_SIZE, 2)
+            e.op(STA_ABX, config.dest + offset, 2)
+            stream += image[offset:offset + SECTION_SIZE]
+        e.loop_end(loop)
+        e.op(LDA_ABS, config.command_area + config.next_page, 2)
+
+    if fills:
+        e.op(LDX_IMM, SECTION_SIZE - 1, 1)
+        loop = e.pc
+        value = None
+        for fill, offset in fills:
+            if fill != value:
+                e.op(LDA_IMM, fill, 1)
+                value = fill
+            e.op(STA_ABX, config.dest + offset, 2)
+        e.loop_end(loop)
+
+    e.op(JMP, config.exec_address, 2)
+    return bytes(e.code), bytes(stream)
+
+
+def chunk(image, offset, config=None):
+    """Return the immediate layout's routine for the chunk of the image at offset."""
+    config = config or Config()
+    data = image[offset:offset + CHUNK_SIZE]
+    e = Emitter(config.origin)
+    start = config.dest + offset
+    under_io = start < IO_END and IO_START < start + len(data)
+    if under_io:
+        e.op(LDA_IMM, CPU_PORT_NO_IO, 1)
+        e.op(STA_ZP, CPU_PORT, 1)
+    value = None
+    for i in sorted(range(len(data)), key=lambda i: data[i]):
+        if data[i] != value:
+            e.op(LDA_IMM, data[i], 1)
+            value = data[i]
+        e.op(STA_ABS, config.dest + offset + i, 2)
+    if under_io:
+        e.op(LDA_IMM, CPU_PORT_DEFAULT, 1)
+        e.op(STA_ZP, CPU_PORT, 1)
+    last = offset + len(data) >= len(image)
+    e.op(JMP, config.stubs + (STUBS_SIZE // 2 if last else 0), 2)
+    return bytes(e.code)
+
+
+def stubs(config=None):
+    """Return the stubs that send CMD_NEXT_PAGE, wait, and go to the next chunk or exec."""
+    config = config or Config()
+    e = Emitter(config.stubs)
+    for target in (config.origin, config.exec_address):
+        e.op(LDA_ABS, config.command_area + config.next_page, 2)
+        wait = e.pc
+        e.op(LDA_ABS, config.command_area, 2)
+        e.op(STA_ABS, 0xd020, 2)
+        e.op(BNE, wait - (e.pc + 2), 1)
+        e.op(JMP, target, 2)
+    return bytes(e.code)
+
+
+class CConfig(ctypes.Structure):
+    _fields_ = [('dest', ctypes.c_uint16), ('exec_address', ctypes.c_uint16),
+                ('origin', ctypes.c_uint16), ('window', ctypes.c_uint16),
+                ('window_size', ctypes.c_uint16), ('command_area', ctypes.c_uint16),
+                ('next_page', ctypes.c_uint8), ('stubs', ctypes.c_uint16)]
+
+    @classmethod
+    def of(cls, config):
+        return cls(*(getattr(config or Config(), name) for name, _ in cls._fields_))
+
+
+class CLibrary:
+    """firmware/copy_gen.c, compiled for the host, with the same functions as this module"""
+
+    def __init__(self, build_dir):
+        self.lib = host_c.load(build_dir, 'copy_gen.c')
+        for name in ('copy_gen_build', 'copy_gen_chunk'):
+            getattr(self.lib, name).restype = ctypes.c_size_t
+        self.chunk_code_max = host_c.header_define('copy_gen.h', 'COPY_GEN_CHUNK_CODE_MAX',
+                                                   {'COPY_GEN_CHUNK_SIZE': CHUNK_SIZE})
+
+    def generate(self, image, config=None, code_max=0x1f00):
+        """Like generate(), with ValueError for an image copy_gen_build() refuses"""
+        code = ctypes.create_string_buffer(code_max)
+        stream = ctypes.create_string_buffer(max(len(image), 1))
+        stream_size = ctypes.c_size_t()
+        size = self.lib.copy_gen_build(ctypes.byref(CConfig.of(config)), bytes(image),
+                                       ctypes.c_size_t(len(image)), code,
+                                       ctypes.c_size_t(code_max), stream,
+                                       ctypes.byref(stream_size))
+        if size == 0:
+            raise ValueError('copy_gen_build refused the image')
+        return code.raw[:size], stream.raw[:stream_size.value]
+
+    def chunk(self, image, offset, config=None):
+        code = ctypes.create_string_buffer(self.chunk_code_max)
+        size = self.lib.copy_gen_chunk(ctypes.byref(CConfig.of(config)), bytes(image),
+                                       ctypes.c_size_t(len(image)), ctypes.c_size_t(offset),
+                                       code)
+        return code.raw[:size]
+
+    def stubs(self, config=None):
+        code = ctypes.create_string_buffer(STUBS_SIZE)
+        self.lib.copy_gen_stubs(ctypes.byref(CConfig.of(config)), code)
+        return code.raw
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('image')
+    parser.add_argument('--skip', type=int, default=0, help='bytes to skip (2 for a load address)')
+    parser.add_argument('--layout', choices=('sections', 'immediate'), default='sections')
+    parser.add_argument('-o', '--output', help='write the routine (or the first chunk) here')
+    parser.add_argument('--stream', help='write the window stream here')
+    args = parser.parse_args()
+
+    with open(args.image, 'rb') as f:
+        image = f.read()[args.skip:]
+    if args.layout == 'immediate':
+        chunks = [chunk(image, offset) for offset in range(0, len(image), CHUNK_SIZE)]
+        print(f'{len(chunks)} chunks, routines {min(map(len, chunks))}-'
+              f'{max(map(len, chunks))} bytes, {STUBS_SIZE} bytes of stubs')
+        if args.output:
+            with open(args.output, 'wb') as f:
+                f.write(chunks[0])
+        return
+
+    try:
+        code, stream = generate(image)
+    except ValueError as e:
+        sys.exit(str(e))
+
+    copied = len(stream) // SECTION_SIZE
+    print(f'{len(image) // SECTION_SIZE} sections: {copied} copied, '
+          f'{len(image) // SECTION_SIZE - copied} filled')
+    print(f'{len(stream)} byte stream ({-(-len(stream) // Config().window_size)} windows), '
+          f'{len(code)} byte routine')
+    if args.output:
+        with open(args.output, 'wb') as f:
+            f.write(code)
+    if args.stream:
+        with open(args.stream, 'wb') as f:
+            f.write(stream)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,190 @@
+#!/usr/bin/env python
+"""Test firmware/copy_gen.c against tools/copy_gen.py and hand-assembled routines.
+
+copy_gen.c is compiled with the host's C compiler ($CC, default cc) and called through ctypes.
+For the sections layout, copy_gen_build() must give the same routine and stream as
+copy_gen.generate() for raspi.nuf, images with and without filled sections, and a routine that
+only just fits, and refuse the same images.  For the immediate layout, copy_gen_chunk() must
+give the same routine as copy_gen.chunk() for every chunk, with images that go under the I/O
+area, start or end inside it or stay clear of it, and the stubs must match.  Small images must
+give routines assembled by hand, so the two can't agree on a wrong one.
+
+c64-rom/loader_rom.bin must load raspi.nuf with each layout on tools/loader_sim.py, in the 16K
+switch position and in the 8K one, where it must find no ROMH and use its own copy loop:
+
+    python tools/copy_gen_test.py
+"""
+import os
+import random
+import sys
+import tempfile
+
+import copy_gen
+import host_c
+import loader_sim
+
+# 32 bytes 0-31 then 32 of $11, at $2000: a window of one section, then the fill
+KNOWN_SECTIONS = bytes([
+    0xad, 0x00, 0x9e,   # wait: lda $9e00
+    0x8d, 0x20, 0xd0,   #       sta $d020
+    0xd0, 0xf8,         #       bne wait
+    0xa2, 0x1f,         #       ldx #31
+    0xbd, 0x00, 0x84,   # loop: lda $8400,x
+    0x9d, 0x00, 0x20,   #       sta $2000,x
+    0xca,               #       dex
+    0x10, 0xf7,         #       bpl loop
+    0xad, 0x01, 0x9e,   #       lda $9e01
+    0xa2, 0x1f,         #       ldx #31
+    0xa9, 0x11,         # fill: lda #$11
+    0x9d, 0x20, 0x20,   #       sta $2020,x
+    0xca,               #       dex
+    0x10, 0xf8,         #       bpl fill
+    0x4c, 0x00, 0x30,   #       jmp $3000
+])
+
+# $05 $00 $05 at $2000, the last chunk
+KNOWN_CHUNK = bytes([
+    0xa9, 0x00, 0x8d, 0x01, 0x20,               # lda #0, sta $2001
+    0xa9, 0x05, 0x8d, 0x00, 0x20, 0x8d, 0x02, 0x20,  # lda #5, sta $2000, sta $2002
+    0x4c, 0x0e, 0xbf,                           # jmp to the stub that starts the image
+])
+
+# $07 at $D000, with I/O banked out around it
+KNOWN_CHUNK_UNDER_IO = bytes([
+    0xa9, 0x33, 0x85, 0x01,                     # lda #$33, sta $01
+    0xa9, 0x07, 0x8d, 0x00, 0xd0,               # lda #7, sta $d000
+    0xa9, 0x37, 0x85, 0x01,                     # lda #$37, sta $01
+    0x4c, 0x0e, 0xbf,
+])
+
+KNOWN_STUBS = bytes([
+    0xad, 0x01, 0x9e,   # lda $9e01: next page
+    0xad, 0x00, 0x9e,   # wait: lda $9e00
+    0x8d, 0x20, 0xd0,   # sta $d020
+    0xd0, 0xf8,         # bne wait
+    0x4c, 0x00, 0xa0,   # jmp $a000: the next chunk
+    0xad, 0x01, 0x9e,
+    0xad, 0x00, 0x9e,
+    0x8d, 0x20, 0xd0,
+    0xd0, 0xf8,
+    0x4c, 0x00, 0x30,   # jmp $3000: the image is loaded
+])
+
+
+def sections_image(rng, size, fill_chance):
+    """Random sections, some of them one byte repeated"""
+    image = bytearray()
+    for _ in range(size // copy_gen.SECTION_SIZE):
+        if rng.random() < fill_chance:
+            image += bytes([rng.choice((0, 0x20, 0xff))]) * copy_gen.SECTION_SIZE
+        else:
+            image += bytes(rng.randrange(256) for _ in range(copy_gen.SECTION_SIZE))
+    return bytes(image)
+
+
+def check_sections(c, name, image, config=None, code_max=0x1f00):
+    """Error messages for one image in the sections layout"""
+    try:
+        expected = copy_gen.generate(image, config)
+    except ValueError:
+        expected = None
+    if expected and len(expected[0]) > code_max:
+        expected = None
+    try:
+        got = c.generate(image, config, code_max)
+    except ValueError:
+        got = None
+    if got == expected:
+        return []
+    if expected is None or got is None:
+        return [f'{name}: copy_gen.c {"refuses" if got is None else "accepts"} it']
+    return [f'{name}: {"routine" if got[0] != expected[0] else "stream"} differs']
+
+
+def check_immediate(c, name, image, config):
+    """Error messages for every chunk of one image in the immediate layout"""
+    for offset in range(0, len(image), copy_gen.CHUNK_SIZE):
+        if c.chunk(image, offset, config) != copy_gen.chunk(image, offset, config):
+            return [f'{name}: chunk at {offset} differs']
+    return []
+
+
+def main():
+    rng = random.Random(34)
+    with open(os.path.join(host_c.C64_ROM_DIR, 'raspi.nuf'), 'rb') as f:
+        raspi = f.read()[2:]
+    failures = 0
+    with tempfile.TemporaryDirectory() as build_dir:
+        c = copy_gen.CLibrary(build_dir)
+
+        mixed = sections_image(rng, 0x3000, 0.3)
+        routine, _ = copy_gen.generate(mixed)
+        sections = [
+            ('raspi.nuf', raspi, None),
+            ('mixed sections', mixed, None),
+            ('no fills', sections_image(rng, 0x2000, 0), None),
+            ('all fills', sections_image(rng, 0x2000, 1), None),
+            ('elsewhere', mixed, copy_gen.Config(dest=0x4000, exec_address=0x4000,
+                                                 window=0x8800, window_size=0x200)),
+            ('not whole sections', mixed[:-1], None),
+        ]
+        for name, image, config in sections:
+            errors = check_sections(c, name, image, config)
+            print(f'sections, {name}' + ''.join(f'  FAIL: {e}' for e in errors))
+            failures += bool(errors)
+        errors = (check_sections(c, 'just fits', mixed, None, len(routine))
+                  + check_sections(c, 'too big', mixed, None, len(routine) - 1))
+        print('sections, routine size limit' + ''.join(f'  FAIL: {e}' for e in errors))
+        failures += bool(errors)
+
+        random_image = bytes(rng.randrange(256) for _ in range(0x2345))
+        immediate = [
+            ('raspi.nuf', raspi, copy_gen.Config()),
+            ('clear of I/O', random_image, copy_gen.Config(dest=0x0801, exec_address=0x0801)),
+            ('through I/O', random_image, copy_gen.Config(dest=0xc000, exec_address=0xc000)),
+            ('ends in I/O', random_image[:0x1100], copy_gen.Config(dest=0xbf80)),
+            ('starts in I/O', random_image[:0x1800], copy_gen.Config(dest=0xdff0)),
+            ('short last chunk', random_image[:copy_gen.CHUNK_SIZE + 5], copy_gen.Config()),
+        ]
+        for name, image, config in immediate:
+            errors = check_immediate(c, name, image, config)
+            if c.stubs(config) != copy_gen.stubs(config):
+                errors.append(f'{name}: stubs differ')
+            print(f'immediate, {name}' + ''.join(f'  FAIL: {e}' for e in errors))
+            failures += bool(errors)
+
+        known = [
+            ('sections', lambda gen: b''.join(gen.generate(bytes(range(32)) + b'\x11' * 32)),
+             KNOWN_SECTIONS + bytes(range(32))),
+            ('chunk', lambda gen: gen.chunk(b'\x05\x00\x05', 0), KNOWN_CHUNK),
+            ('chunk under I/O', lambda gen: gen.chunk(b'\x07', 0, copy_gen.Config(dest=0xd000)),
+             KNOWN_CHUNK_UNDER_IO),
+            ('stubs', lambda gen: gen.stubs(), KNOWN_STUBS),
+        ]
+        for name, make, expected in known:
+            errors = [f'{which} gives {got.hex()}'
+                      for which, got in (('copy_gen.c', make(c)), ('copy_gen.py', make(copy_gen)))
+                      if got != expected]
+            print(f'known {name}' + ''.join(f'  FAIL: {e}' for e in errors))
+            failures += bool(errors)
+
+    with open(os.path.join(host_c.C64_ROM_DIR, 'loader_rom.bin'), 'rb') as f:
+        loader = f.read()
+    for layout in ('linear', 'sections', 'immediate'):
+        for eight_k in (False, True):
+            try:
+                cartridge, _, _, _ = loader_sim.load(loader, raspi, copy_gen.Config(), layout,
+                                                     eight_k=eight_k)
+                error = loader_sim.check(cartridge)
+            except RuntimeError as e:
+                error = str(e)
+            print(f'loader, {layout}, {"8K" if eight_k else "16K"}'
+                  + (f'  FAIL: {error}' if error else ''))
+            failures += bool(error)
+
+    print(f'{failures} failed' if failures else 'all OK')
+    sys.exit(1 if failures else 0)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,63 @@
+#!/usr/bin/env python
+"""Host-side reference for the RP2040 DMA sniffer's CRC-32 modes.
+
+The firmware runs the sniffer in CRC32R mode (bit-reversed input) with the OUT_REV and OUT_INV
+flags and a seed of 0xffffffff, which gives the same result as zlib.crc32().  sniffer_crc32()
+models each of those settings separately so other combinations can be checked too.
+
+Print the CRC of a file to compare with the firmware's "crc" USB command:
+
+    python tools/crc32.py --skip 2 c64-rom/raspi.nuf
+"""
+import argparse
+
+POLY = 0x04C11DB7
+
+
+def reverse_bits(value, width):
+    result = 0
+    for _ in range(width):
+        result = (result << 1) | (value & 1)
+        value >>= 1
+    return result
+
+
+def sniffer_crc32(data, seed=0xffffffff, reverse_in=True, reverse_out=True, invert_out=True):
+    """CRC-32 as the DMA sniffer computes it for byte transfers.
+
+    reverse_in selects CRC32R instead of CRC32 mode; reverse_out and invert_out are the
+    SNIFF_CTRL OUT_REV and OUT_INV flags, which only affect the value read back.
+    """
+    crc = seed
+    for byte in data:
+        if reverse_in:
+            byte = reverse_bits(byte, 8)
+        crc ^= byte << 24
+        for _ in range(8):
+            if crc & 0x80000000:
+                crc = ((crc << 1) ^ POLY) & 0xffffffff
+            else:
+                crc = (crc << 1) & 0xffffffff
+    if reverse_out:
+        crc = reverse_bits(crc, 32)
+    if invert_out:
+        crc ^= 0xffffffff
+    return crc
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Print the CRC-32 of a file')
+    parser.add_argument('--skip', metavar='N', default=0, type=int,
+                        help='start N bytes into the file')
+    parser.add_argument('--pad', metavar='N', default=0, type=int,
+                        help='append N zero bytes')
+    parser.add_argument('input')
+    args = parser.parse_args()
+
+    with open(args.input, 'rb') as f:
+        data = f.read()[args.skip:] + bytes(args.pad)
+    print(f'{sniffer_crc32(data):08x}')
+
+
+if __name__ == '__main__':
+    main()
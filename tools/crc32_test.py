@@ -0,0 +1,72 @@
+#!/usr/bin/env python
+"""Test tools/crc32.py's model of the DMA sniffer, and the settings firmware/dma_crc.c uses.
+
+The seed, the CRC32 or CRC32R mode and the OUT_REV and OUT_INV flags are read from dma_crc.c,
+and with them sniffer_crc32() must give zlib.crc32() for empty, short, odd-length and large
+data.  The model must give the published check values of the CRC-32 family for "123456789"
+with each combination of reflection and inversion, so a setting that is wrong in both the
+model and the firmware can't pass by agreeing with itself:
+
+    python tools/crc32_test.py
+"""
+import os
+import random
+import re
+import sys
+import zlib
+
+import crc32
+import host_c
+
+CHECK_INPUT = b'123456789'
+
+# (reverse_in, reverse_out, invert_out): the check value of that CRC-32, all seeded 0xffffffff
+CHECK_VALUES = {
+    (True, True, True): 0xcbf43926,     # CRC-32, zlib's
+    (False, False, True): 0xfc891918,   # CRC-32/BZIP2
+    (False, False, False): 0x0376e6e7,  # CRC-32/MPEG-2
+    (True, True, False): 0x340bc6d9,    # CRC-32/JAMCRC
+}
+
+
+def firmware_settings():
+    """(seed, reverse_in, reverse_out, invert_out) as dma_crc.c sets up the sniffer"""
+    with open(os.path.join(host_c.FIRMWARE_DIR, 'dma_crc.c')) as f:
+        source = f.read()
+    seed = int(re.search(r'CRC32_SEED = (0x[0-9a-fA-F]+)', source).group(1), 16)
+    mode = re.search(r'DMA_SNIFF_CTRL_CALC_VALUE_(CRC32R?)\b', source).group(1)
+    flags = re.search(r'hw_set_bits\(&dma_hw->sniff_ctrl, ([^;]*)\);', source)
+    flags = flags.group(1) if flags else ''
+    return (seed, mode == 'CRC32R', 'DMA_SNIFF_CTRL_OUT_REV_BITS' in flags,
+            'DMA_SNIFF_CTRL_OUT_INV_BITS' in flags)
+
+
+def main():
+    errors = []
+    for (reverse_in, reverse_out, invert_out), expected in CHECK_VALUES.items():
+        crc = crc32.sniffer_crc32(CHECK_INPUT, reverse_in=reverse_in, reverse_out=reverse_out,
+                                  invert_out=invert_out)
+        if crc != expected:
+            errors.append(f'reverse in {reverse_in}, out {reverse_out}, invert {invert_out}: '
+                          f'{crc:08x}, expected {expected:08x}')
+
+    seed, reverse_in, reverse_out, invert_out = firmware_settings()
+    print(f'dma_crc.c: seed {seed:08x}, {"CRC32R" if reverse_in else "CRC32"}'
+          + (', OUT_REV' if reverse_out else '') + (', OUT_INV' if invert_out else ''))
+    rng = random.Random(27)
+    samples = [b'', b'\x00', b'\xff', CHECK_INPUT, bytes(range(256)) * 3,
+               bytes(rng.randrange(256) for _ in range(16385))]
+    for data in samples:
+        crc = crc32.sniffer_crc32(data, seed, reverse_in, reverse_out, invert_out)
+        if crc != zlib.crc32(data):
+            errors.append(f'{len(data)} bytes: the firmware\'s settings give {crc:08x}, '
+                          f'zlib {zlib.crc32(data):08x}')
+
+    for error in errors:
+        print(error)
+    print(f'{len(errors)} failed' if errors else 'all OK')
+    sys.exit(1 if errors else 0)
+
+
+if __name__ == '__main__':
+    main()
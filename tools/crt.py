@@ -0,0 +1,123 @@
+#!/usr/bin/env python
+"""Parse .crt cartridge images into the 16K banks the firmware serves (see library mode in
+firmware/c64_pico_ram_interface.c).
+
+A .crt is a 64 byte header ("C64 CARTRIDGE", the hardware type and the /EXROM and /GAME lines
+the cartridge pulls) followed by CHIP packets, each a ROM with its bank and load address.  This
+hardware can serve ROML at $8000 and ROMH at $A000 from a 16K window, so only plain 8K and
+16K cartridges (hardware type 0) with one bank of ROM are accepted.  Bank switching cartridges
+switch banks by writing to I/O, which the Pico doesn't see, and Ultimax cartridges need /EXROM
+high, which the board doesn't do.
+
+embed_asset.py --kind crt uses this to write the bank: ROML in the first 8K and ROMH in the
+second, or $FF where the cartridge has no ROM.  Run it on its own to check a file:
+
+    python tools/crt.py game.crt
+"""
+import argparse
+import struct
+import sys
+
+SIGNATURE = b'C64 CARTRIDGE   '
+CHIP = b'CHIP'
+BANK_SIZE = 0x4000
+ROML = 0x8000
+ROMH = 0xa000
+CHIP_ROM = 0
+FILL = 0xff
+
+# Hardware types people are likely to try, for the error message
+HARDWARE_TYPES = {1: 'Action Replay', 3: 'Final Cartridge III', 4: 'Simons\' BASIC',
+                  5: 'Ocean', 15: 'C64 Game System', 17: 'Dinamic', 19: 'Magic Desk',
+                  32: 'EasyFlash', 36: 'Retro Replay', 60: 'GMod2'}
+
+
+class CrtError(ValueError):
+    pass
+
+
+class Cartridge:
+    def __init__(self, name, mode, bank):
+        self.name = name     # from the header
+        self.mode = mode     # '8k' or '16k', the switch position it needs
+        self.bank = bank     # 16K: ROML then ROMH
+
+
+def parse(data):
+    """Return a Cartridge, or raise CrtError saying why the hardware can't serve it"""
+    if len(data) < 0x40 or data[:16] != SIGNATURE:
+        raise CrtError('not a .crt file')
+    header_size, version, hardware, exrom, game = struct.unpack('>IHHBB', data[16:26])
+    name = data[32:64].split(b'\0')[0].decode('latin-1')
+    if hardware != 0:
+        kind = HARDWARE_TYPES.get(hardware, 'bank switching')
+        raise CrtError(f'hardware type {hardware} ({kind}) switches banks through I/O, which '
+                       'this hardware can\'t see; only type 0 is supported')
+    if exrom != 0:
+        raise CrtError('Ultimax mode needs /EXROM high, which this hardware can\'t do'
+                       if game == 0 else 'the cartridge pulls neither /EXROM nor /GAME')
+    mode = '16k' if game == 0 else '8k'
+
+    bank = bytearray([FILL]) * BANK_SIZE
+    filled = set()
+    offset = max(header_size, 0x40)
+    while offset < len(data):
+        if data[offset:offset + 4] != CHIP or offset + 16 > len(data):
+            raise CrtError(f'bad CHIP packet at {offset:#x}')
+        length, chip_type, bank_number, load, size = struct.unpack('>IHHHH',
+                                                                   data[offset + 4:offset + 16])
+        rom = data[offset + 16:offset + 16 + size]
+        if chip_type != CHIP_ROM:
+            raise CrtError(f'CHIP at {offset:#x} is RAM or flash, not ROM')
+        if bank_number != 0:
+            raise CrtError(f'CHIP at {offset:#x} is bank {bank_number}: only bank 0 can be served')
+        if len(rom) != size or length < 16 + size:
+            raise CrtError(f'CHIP at {offset:#x} is cut short')
+        end = load + size
+        top = ROMH if mode == '8k' else ROML + BANK_SIZE
+        if load not in (ROML, ROMH) or end > top:
+            raise CrtError(f'CHIP at ${load:04X}-${end - 1:04X} is outside '
+                           f'${ROML:04X}-${top - 1:04X} for {mode.upper()} mode')
+        if filled & set(range(load, end)):
+            raise CrtError(f'CHIP at ${load:04X} overlaps another')
+        filled |= set(range(load, end))
+        bank[load - ROML:end - ROML] = rom
+        offset += length
+
+    if ROML not in filled:
+        raise CrtError('no ROM at $8000')
+    return Cartridge(name, mode, bytes(bank))
+
+
+def build(rom, mode='8k', hardware=0, name=b'TEST', chips=None, exrom=0, game=None):
+    """A .crt with rom split into CHIP packets at $8000 (and $A000 for 16K), for tests"""
+    if game is None:
+        game = 0 if mode == '16k' else 1
+    header = SIGNATURE + struct.pack('>IHHBB', 0x40, 0x0100, hardware, exrom, game) \
+        + bytes(6) + name.ljust(32, b'\0')
+    if chips is None:
+        chips = [(0, ROML, rom[:0x2000])]
+        if len(rom) > 0x2000:
+            chips.append((0, ROMH, rom[0x2000:]))
+    packets = b''.join(CHIP + struct.pack('>IHHHH', 16 + len(data), CHIP_ROM, bank, load,
+                                          len(data)) + data
+                       for bank, load, data in chips)
+    return header + packets
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('crt')
+    args = parser.parse_args()
+    with open(args.crt, 'rb') as f:
+        try:
+            cartridge = parse(f.read())
+        except CrtError as e:
+            sys.exit(f'{args.crt}: {e}')
+    print(f'"{cartridge.name}": {cartridge.mode.upper()}, switch in the '
+          f'{cartridge.mode.upper()} position')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,266 @@
+#!/usr/bin/env python
+"""Test the .crt parser, and switching cartridges from the loader's library menu on the 6502.
+
+tools/crt.py must accept the plain 8K and 16K cartridges the hardware can serve, and reject
+bank switching, Ultimax and broken files with a reason.
+
+Then loader_rom.bin boots on the emulated 6502 with a model of the firmware's library: the
+banks parsed from generated .crt files, the menu and switch table built like build_cart_menu(),
+and CMD_SELECT_CART + n pointing the window at bank n with the command area off, like
+select_cart().  A key is held down on the emulated keyboard.  Picking a cartridge must reset
+into it (through a stand-in for the KERNAL's reset and CBM80 check) within a frame of the key
+being seen, with the whole 16K its own; a number with no cartridge must be ignored, and space
+must carry on loading the NUFLI image:
+
+    python tools/crt_test.py
+"""
+import argparse
+import os
+import random
+import sys
+
+import c64cart
+import copy_gen
+import crt
+import loader_sim
+import mos6502
+
+CMD_SELECT_CART = 0x10
+MAILBOX_CART_COUNT = 0x810
+CART_SWITCH_OFFSET = 0x900
+CART_MENU_OFFSET = 0xc00
+CART_MENU_SIZE = 1000
+CART_MAX = 3
+
+# Keyboard matrix positions of 1-9 and space, as in the loader: CIA 1 port A value, port B bit
+KEY_COLUMNS = (0x7f, 0x7f, 0xfd, 0xfd, 0xfb, 0xfb, 0xf7, 0xf7, 0xef, 0x7f)
+KEY_ROWS = (0x01, 0x08, 0x01, 0x08, 0x01, 0x08, 0x01, 0x08, 0x01, 0x10)
+KEY_SPACE = 9
+
+# The KERNAL's reset routine up to the cartridge check ($FCE2), and the check itself ($FD02),
+# as in the real ROM.  Without a cartridge it would go on at RESET_NO_CART.
+RESET = 0xfce2
+RESET_CODE = bytes([0xa2, 0xff, 0x78, 0x9a, 0xd8, 0x20, 0x02, 0xfd, 0xd0, 0x03, 0x6c, 0x00,
+                    0x80])
+RESET_NO_CART = RESET + len(RESET_CODE)
+CHECK_CBM80 = 0xfd02
+CHECK_CBM80_CODE = bytes([0xa2, 0x05, 0xbd, 0x0f, 0xfd, 0xdd, 0x03, 0x80, 0xd0, 0x03, 0xca,
+                          0xd0, 0xf5, 0x60, 0xc3, 0xc2, 0xcd, 0x38, 0x30])
+
+FRAME_CYCLES = {'pal': 312 * 63, 'ntsc': 263 * 65}
+
+
+def cbm80_rom(size, start, code, seed):
+    """Random ROM with a CBM80 header starting at start, and code there"""
+    rom = bytearray(random.Random(seed).randrange(256) for _ in range(size))
+    rom[0:9] = bytes([start & 0xff, start >> 8, start & 0xff, start >> 8]) + b'\xc3\xc2\xcd80'
+    rom[start - 0x8000:start - 0x8000 + len(code)] = code
+    return rom
+
+
+def game_8k():
+    """Reads $9E05, in the command area of the loader, into $02 and stops at $800E"""
+    rom = cbm80_rom(0x2000, 0x8009, bytes([0xad, 0x05, 0x9e, 0x85, 0x02, 0x4c, 0x0e, 0x80]), 1)
+    rom[0x1e05] = 0x5a
+    return crt.build(bytes(rom), '8k', name=b'GAME 8K'), 0x800e, 0x5a
+
+
+def game_16k():
+    """Starts in ROMH, reads $BF00 into $02 and stops at $A005"""
+    rom = cbm80_rom(0x4000, 0xa000, bytes([0xad, 0x00, 0xbf, 0x85, 0x02, 0x4c, 0x05, 0xa0]), 2)
+    rom[0x3f00] = 0xa5
+    return crt.build(bytes(rom), '16k', name=b'GAME 16K'), 0xa005, 0xa5
+
+
+def parser_cases(loader):
+    """(description, .crt, expected mode or None if it must be rejected)"""
+    rom_8k = cbm80_rom(0x2000, 0x8009, b'', 3)
+    rom_16k = cbm80_rom(0x4000, 0x8009, b'', 4)
+    yield '8K', crt.build(rom_8k), '8k'
+    yield '16K in two CHIPs', crt.build(rom_16k, '16k'), '16k'
+    yield '16K in one CHIP', crt.build(rom_16k, '16k', chips=[(0, crt.ROML, rom_16k)]), '16k'
+    yield '4K 8K cartridge', crt.build(rom_8k[:0x1000]), '8k'
+    yield 'the loader as an 8K cartridge', crt.build(loader), '8k'
+    yield 'Ocean', crt.build(rom_8k, hardware=5), None
+    yield 'EasyFlash', crt.build(rom_16k, '16k', hardware=32), None
+    yield 'Ultimax', crt.build(rom_8k, exrom=1, game=0), None
+    yield 'bank 1', crt.build(rom_8k, chips=[(1, crt.ROML, rom_8k)]), None
+    yield 'ROMH in 8K mode', crt.build(rom_8k, chips=[(0, crt.ROML, rom_8k),
+                                                     (0, crt.ROMH, rom_8k)]), None
+    yield 'overlapping CHIPs', crt.build(rom_16k, '16k', chips=[(0, crt.ROML, rom_16k),
+                                                               (0, crt.ROMH, rom_8k)]), None
+    yield 'no ROM at $8000', crt.build(rom_8k, '16k', chips=[(0, crt.ROMH, rom_8k)]), None
+    yield 'cut short', crt.build(rom_8k)[:-1], None
+    yield 'not a .crt', bytes(rom_8k), None
+
+
+def screen_codes(text):
+    return bytes(c - 0x40 if 0x40 <= c <= 0x5a else c for c in text.upper().encode('ascii'))
+
+
+class LibraryCartridge(loader_sim.LoaderCartridge):
+    """The cartridge serving the NUFLI image, with the firmware's cartridge library, and the
+    C64's keyboard with one key held down"""
+
+    def __init__(self, loader, carts, key, video, command_us, select_us):
+        config = copy_gen.Config(dest=0x2000, exec_address=0x3000)
+        with open(os.path.join(loader_sim.C64_ROM_DIR, 'raspi.nuf'), 'rb') as f:
+            raspi = f.read()[2:]
+        super().__init__(loader, raspi, config, 'linear', video, command_us)
+        self.key = key          # index in KEY_COLUMNS, or None
+        self.key_seen = None    # cycle the loader first saw the key
+        self.active = None      # index into carts being served, or None for the loader
+        self.carts = self.build_menu(loader, carts)
+        for n in range(len(self.carts)):
+            self.on_command(CMD_SELECT_CART + n, select_us,
+                            lambda cart, n=n: cart.select(n))
+
+    def build_menu(self, loader, carts):
+        """Like build_cart_menu(): returns the carts that can be switched to"""
+        menu = bytearray(b' ' * CART_MENU_SIZE)
+
+        def put(row, column, text):
+            start = row * 40 + column
+            menu[start:start + len(text)] = screen_codes(text)
+
+        put(1, 9, 'pico cartridge library')
+        shown = []
+        # Like load_carts(), the ones that start like the loader don't count towards CART_MAX
+        for cart in [cart for cart in carts if cart.bank[:len(loader)] != loader][:CART_MAX]:
+            k = next(k for k in range(len(loader)) if cart.bank[k] != loader[k])
+            entry = CART_SWITCH_OFFSET + len(shown) * 3
+            self.rom[entry:entry + 3] = bytes([(0x8000 + k) & 0xff, (0x8000 + k) >> 8,
+                                               cart.bank[k]])
+            put(4 + len(shown), 2, f'{len(shown) + 1}  {cart.name[:28]:<28} {cart.mode.upper()}')
+            shown.append(cart)
+        if shown:
+            put(6 + len(shown), 2, f'press 1-{len(shown)} to start, space for nufli')
+            put(7 + len(shown), 2, 'set the 8k/16k switch to match first')
+        self.rom[CART_MENU_OFFSET:CART_MENU_OFFSET + CART_MENU_SIZE] = menu
+        self.rom[MAILBOX_CART_COUNT] = len(shown)
+        self.menu = bytes(menu)
+        return shown
+
+    def select(self, n):
+        self.rom = bytearray(self.carts[n].bank)
+        self.active = n
+
+    def is_command_area(self, address):
+        return self.active is None and super().is_command_area(address)
+
+    def read(self, address):
+        if address == 0xdc01 and self.io_visible():
+            value = 0xff
+            if self.key is not None and not self.io[0xc00] & ~KEY_COLUMNS[self.key] & 0xff:
+                value &= ~KEY_ROWS[self.key]
+                if self.key_seen is None:
+                    self.key_seen = self.cpu.cycles
+            return value
+        if 0x8000 <= address < self.rom_end:
+            self.update()  # the switch stub polls the window itself, not the status
+        return super().read(address)
+
+
+def boot(loader, carts, key, video, command_us, select_us):
+    cartridge = LibraryCartridge(loader, carts, key, video, command_us, select_us)
+    for address in loader_sim.KERNAL_STUBS:
+        cartridge.ram[address] = 0x60  # rts
+    cartridge.ram[RESET:RESET + len(RESET_CODE)] = RESET_CODE
+    cartridge.ram[CHECK_CBM80:CHECK_CBM80 + len(CHECK_CBM80_CODE)] = CHECK_CBM80_CODE
+    cartridge.ram[0xfffc:0xfffe] = bytes([RESET & 0xff, RESET >> 8])
+    cpu = mos6502.Cpu(cartridge)
+    cartridge.attach(cpu)
+    cpu.pc = cpu.read16(0x8000)
+    return cartridge, cpu
+
+
+def run_until(cpu, stops, max_cycles):
+    while cpu.pc not in stops and cpu.cycles < max_cycles:
+        cpu.step()
+    return cpu.pc
+
+
+def check_switch(loader, carts, key, stop, marker, args):
+    """Returns an error, or None, and what happened"""
+    cartridge, cpu = boot(loader, carts, key, args.video, args.command_us, args.select_us)
+    pc = run_until(cpu, (stop, RESET_NO_CART, 0x3000), 1_000_000)
+    if pc != stop:
+        return f'stopped at ${pc:04X}', ''
+    selects = [cycle for cycle, command in cartridge.commands if command >= CMD_SELECT_CART]
+    if [command for _, command in cartridge.commands][-1:] != [CMD_SELECT_CART + key]:
+        return 'the last command wasn\'t the cartridge\'s', ''
+    cycles = cpu.cycles - cartridge.key_seen
+    frame = FRAME_CYCLES[args.video]
+    done = (f'key to cartridge start {cycles} cycles ({cycles / frame:.0%} of a frame), '
+            f'{cpu.cycles - selects[0]} after the command')
+    if cartridge.ram[0x02] != marker:
+        return 'the cartridge read the command area, not its own ROM', done
+    if cycles >= frame:
+        return 'slower than a frame', done
+    return None, done
+
+
+def check_menu(loader, carts, args):
+    """No cartridge 3 and then space: the menu must stay up, and then load the NUFLI image"""
+    cartridge, cpu = boot(loader, carts, 2, args.video, args.command_us, args.select_us)
+    run_until(cpu, (), 200_000)
+    screen = bytes(cartridge.ram[0x0400:0x0400 + CART_MENU_SIZE])
+    if screen != cartridge.menu or cartridge.io[0x800] != 1:
+        return 'menu isn\'t on the screen', ''
+    if any(command >= CMD_SELECT_CART for _, command in cartridge.commands):
+        return 'switched to a cartridge that isn\'t there', ''
+    cartridge.key = KEY_SPACE
+    pc = run_until(cpu, (0x3000,), 2_000_000)
+    if pc != 0x3000:
+        return f'stopped at ${pc:04X}', ''
+    if cartridge.io[0x800] != 0:
+        return 'menu still showing', ''
+    error = loader_sim.check(cartridge)
+    return error, '' if error else 'loaded the NUFLI image'
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--loader', default=os.path.join(loader_sim.C64_ROM_DIR,
+                                                         'loader_rom.bin'))
+    parser.add_argument('--video', choices=c64cart.PHI2_HZ, default='pal')
+    parser.add_argument('--command-us', type=float, default=20.0,
+                        help='time for the Pico to handle CMD_NEXT_PAGE (default %(default)s)')
+    parser.add_argument('--select-us', type=float, default=50.0,
+                        help='time for the Pico to handle CMD_SELECT_CART, including '
+                             'retargeting the read program (default %(default)s)')
+    args = parser.parse_args()
+
+    with open(args.loader, 'rb') as f:
+        loader = f.read()
+
+    failures = 0
+    for name, data, expected in parser_cases(loader):
+        try:
+            result = crt.parse(data).mode
+        except crt.CrtError as e:
+            result = None
+            reason = str(e)
+        ok = result == expected
+        print(f'{name}: ' + (result.upper() if result else f'rejected ({reason})')
+              + ('' if ok else '  FAIL'))
+        failures += not ok
+
+    games = [game_8k(), game_16k()]
+    carts = [crt.parse(data) for data, _, _ in games]
+    carts.append(crt.parse(crt.build(loader, name=b'LOADER')))  # can't be told apart: dropped
+    for key, (_, stop, marker) in enumerate(games):
+        error, done = check_switch(loader, carts, key, stop, marker, args)
+        print(f'key {key + 1} ({carts[key].name}): {done}' + (f'  FAIL: {error}' if error else ''))
+        failures += bool(error)
+    error, done = check_menu(loader, carts, args)
+    print(f'key 3, then space: {done}' + (f'  FAIL: {error}' if error else ''))
+    failures += bool(error)
+
+    print(f'{failures} failed' if failures else 'all OK')
+    sys.exit(1 if failures else 0)
+
+
+if __name__ == '__main__':
+    main()
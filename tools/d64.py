@@ -0,0 +1,246 @@
+#!/usr/bin/env python
+"""Build and read .d64 disk images the way the firmware reads them (firmware/d64.c).
+
+A .d64 is the 1541's sectors in order, 256 bytes each: 21 per track on tracks 1-17, 19 on
+18-24, 18 on 25-30 and 17 on 31-40.  The BAM at 18/0 points to the directory, a chain of
+sectors with 8 entries each, and every file is a chain of sectors whose first two bytes are the
+track and sector of the next, or 0 and the index of the last byte used.
+
+build writes an image with a .prg in it for each file given, named after the file, with
+sectors spaced out like the 1541 spaces them.  list prints the directory like LOAD"$",8 would:
+
+    python tools/d64.py build disk.d64 game.prg intro.prg
+    python tools/d64.py list disk.d64
+"""
+import argparse
+import os
+import sys
+
+SECTOR_SIZE = 256
+NAME_MAX = 16
+DIRECTORY_TRACK = 18
+ENTRIES_PER_SECTOR = 8
+ENTRY_SIZE = 32
+TYPE_SEQ = 0x81
+TYPE_PRG = 0x82
+TYPE_NAMES = {0: 'DEL', 1: 'SEQ', 2: 'PRG', 3: 'USR', 4: 'REL'}
+NAME_PADDING = 0xa0
+MAX_SECTORS = 768  # in a 40 track image, to stop chains that loop
+
+# Image size -> tracks.  The larger of each pair has an error byte per sector on the end.
+IMAGE_SIZES = {174848: 35, 175531: 35, 196608: 40, 197376: 40}
+IMAGE_SIZE = {35: 174848, 40: 196608}
+
+# Sectors skipped between each one in a chain, as the 1541 writes them, so the next has come
+# round to the head by the time the last is handled
+FILE_INTERLEAVE = 10
+DIRECTORY_INTERLEAVE = 3
+
+
+class D64Error(ValueError):
+    pass
+
+
+class Entry:
+    def __init__(self, raw):
+        self.type = raw[2]
+        self.track = raw[3]
+        self.sector = raw[4]
+        self.raw_name = bytes(raw[5:5 + NAME_MAX])
+        self.name = self.raw_name.split(bytes([NAME_PADDING]))[0]
+        self.blocks = raw[30] | (raw[31] << 8)
+
+
+def sectors_in_track(track):
+    if track <= 17:
+        return 21
+    elif track <= 24:
+        return 19
+    elif track <= 30:
+        return 18
+    return 17
+
+
+def sector_offset(image_size, track, sector):
+    """Byte offset of a sector, or None if the image has no such sector"""
+    tracks = IMAGE_SIZES.get(image_size, 0)
+    if not 1 <= track <= tracks or sector >= sectors_in_track(track):
+        return None
+    return sum(sectors_in_track(t) for t in range(1, track)) * SECTOR_SIZE + sector * SECTOR_SIZE
+
+
+def chain(image, track, sector):
+    """Offsets of the sectors in a chain, raising D64Error if it's broken"""
+    for _ in range(MAX_SECTORS):
+        offset = sector_offset(len(image), track, sector)
+        if offset is None:
+            raise D64Error('broken sector chain')
+        yield offset
+        track, sector = image[offset], image[offset + 1]
+        if track == 0:
+            return
+    raise D64Error('broken sector chain')
+
+
+def directory(image):
+    """Every directory entry that's been used, including deleted files"""
+    bam = sector_offset(len(image), DIRECTORY_TRACK, 0)
+    if bam is None:
+        raise D64Error('not a .d64 image')
+    if image[bam] == 0:
+        return
+    for offset in chain(image, image[bam], image[bam + 1]):
+        for i in range(ENTRIES_PER_SECTOR):
+            raw = image[offset + i * ENTRY_SIZE:offset + (i + 1) * ENTRY_SIZE]
+            if raw[2]:
+                yield Entry(raw)
+
+
+def name_matches(name, pattern):
+    """Match a padded directory name like the 1541: "?" is any character, "*" the rest"""
+    for i, c in enumerate(pattern):
+        if c == ord('*'):
+            return True
+        if i == NAME_MAX or name[i] == NAME_PADDING or (c != ord('?') and c != name[i]):
+            return False
+    return len(pattern) == NAME_MAX or name[len(pattern)] == NAME_PADDING
+
+
+def find(image, pattern):
+    """The first closed PRG whose name matches pattern, like d64_find()"""
+    bam = sector_offset(len(image), DIRECTORY_TRACK, 0)
+    if bam is None:
+        raise D64Error('not a .d64 image')
+    track, sector = image[bam], image[bam + 1]
+    if track:
+        for offset in chain(image, track, sector):
+            for i in range(ENTRIES_PER_SECTOR):
+                entry = Entry(image[offset + i * ENTRY_SIZE:offset + (i + 1) * ENTRY_SIZE])
+                if entry.type == TYPE_PRG and name_matches(entry.raw_name, pattern):
+                    return entry
+    raise D64Error('file not found')
+
+
+def read(image, entry, max_size=0x10000):
+    """A file's data including its load address, like d64_read()"""
+    data = bytearray()
+    for offset in chain(image, entry.track, entry.sector):
+        if image[offset]:
+            data += image[offset + 2:offset + SECTOR_SIZE]
+        else:
+            data += image[offset + 2:offset + 1 + image[offset + 1]]
+        if len(data) > max_size:
+            raise D64Error('file too big')
+    return bytes(data)
+
+
+class Allocator:
+    """Hands out free sectors like the 1541: outwards from the directory track, interleaved"""
+
+    def __init__(self, tracks):
+        self.used = {(DIRECTORY_TRACK, s) for s in range(sectors_in_track(DIRECTORY_TRACK))}
+        self.order = [t for pair in zip(range(17, 0, -1), range(19, 36)) for t in pair] \
+            + list(range(36, tracks + 1))
+        self.track = self.order[0]
+        self.sector = 0
+
+    def next(self):
+        for track in self.order[self.order.index(self.track):]:
+            count = sectors_in_track(track)
+            start = self.sector if track == self.track else 0
+            for i in range(count):
+                sector = (start + i) % count
+                if (track, sector) not in self.used:
+                    self.used.add((track, sector))
+                    self.track, self.sector = track, (sector + FILE_INTERLEAVE) % count
+                    return track, sector
+        raise D64Error('disk full')
+
+
+def build(files, tracks=35, disk_name=b'PICO', disk_id=b'64'):
+    """An image with each (name, data, type) in files, names and data as bytes"""
+    image = bytearray(IMAGE_SIZE[tracks])
+    allocator = Allocator(tracks)
+    entries = []
+    for name, data, file_type in files:
+        pieces = [data[i:i + SECTOR_SIZE - 2] for i in range(0, len(data), SECTOR_SIZE - 2)]
+        pieces = pieces or [b'']
+        sectors = [allocator.next() for _ in pieces]
+        for i, piece in enumerate(pieces):
+            offset = sector_offset(len(image), *sectors[i])
+            link = sectors[i + 1] if i + 1 < len(sectors) else (0, len(piece) + 1)
+            image[offset:offset + 2 + len(piece)] = bytes(link) + piece
+        entries.append((name, file_type, sectors[0], len(sectors)))
+
+    # Directory from 18/1, 8 entries to a sector
+    free = range(1, sectors_in_track(DIRECTORY_TRACK))
+    order = sorted(free, key=lambda s: ((s - 1) % DIRECTORY_INTERLEAVE, s))  # 1, 4, 7, ...
+    count = max(1, (len(entries) + ENTRIES_PER_SECTOR - 1) // ENTRIES_PER_SECTOR)
+    if count > len(order):
+        raise D64Error('directory full')
+    directory_sectors = order[:count]
+    for n, sector in enumerate(directory_sectors):
+        offset = sector_offset(len(image), DIRECTORY_TRACK, sector)
+        last = n + 1 == len(directory_sectors)
+        image[offset:offset + 2] = bytes([0, 0xff] if last else
+                                         [DIRECTORY_TRACK, directory_sectors[n + 1]])
+        for i, (name, file_type, (track, first), blocks) in \
+                enumerate(entries[n * ENTRIES_PER_SECTOR:(n + 1) * ENTRIES_PER_SECTOR]):
+            e = offset + i * ENTRY_SIZE
+            image[e + 2:e + 5] = bytes([file_type, track, first])
+            image[e + 5:e + 5 + NAME_MAX] = name[:NAME_MAX].ljust(NAME_MAX, bytes([NAME_PADDING]))
+            image[e + 30:e + 32] = bytes([blocks & 0xff, blocks >> 8])
+
+    # BAM: the directory pointer, then free sectors of tracks 1-35, then the disk's name
+    bam = sector_offset(len(image), DIRECTORY_TRACK, 0)
+    image[bam:bam + 4] = bytes([DIRECTORY_TRACK, 1, 0x41, 0])
+    allocator.used.update((DIRECTORY_TRACK, s) for s in directory_sectors)
+    for track in range(1, 36):
+        free = [s for s in range(sectors_in_track(track)) if (track, s) not in allocator.used]
+        bits = sum(1 << s for s in free)
+        image[bam + 4 * track:bam + 4 * track + 4] = bytes([len(free), bits & 0xff,
+                                                            (bits >> 8) & 0xff, bits >> 16])
+    image[bam + 0x90:bam + 0xab] = (disk_name[:NAME_MAX].ljust(NAME_MAX, bytes([NAME_PADDING]))
+                                    + bytes([NAME_PADDING] * 2) + disk_id[:2]
+                                    + bytes([NAME_PADDING]) + b'2A'
+                                    + bytes([NAME_PADDING] * 4))
+    return image
+
+
+def petscii_name(path):
+    """A directory name for a file: its name without the extension, in upper case"""
+    name = os.path.splitext(os.path.basename(path))[0].upper()
+    return bytes(c if 0x20 <= c < 0x60 else ord('.') for c in name.encode('ascii', 'replace'))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    commands = parser.add_subparsers(dest='command', required=True)
+    build_parser = commands.add_parser('build', help='write an image with .prg files in it')
+    build_parser.add_argument('image')
+    build_parser.add_argument('prgs', nargs='+', metavar='prg')
+    build_parser.add_argument('--tracks', type=int, choices=(35, 40), default=35)
+    list_parser = commands.add_parser('list', help='print the directory')
+    list_parser.add_argument('image')
+    args = parser.parse_args()
+
+    try:
+        if args.command == 'build':
+            files = [(petscii_name(path), open(path, 'rb').read(), TYPE_PRG)
+                     for path in args.prgs]
+            with open(args.image, 'wb') as f:
+                f.write(build(files, args.tracks))
+            return
+        with open(args.image, 'rb') as f:
+            image = f.read()
+        for entry in directory(image):
+            name = '"' + entry.name.decode('latin-1') + '"'
+            closed = '' if entry.type & 0x80 else '*'
+            print(f'{entry.blocks:<5}{name:<19}{closed}{TYPE_NAMES.get(entry.type & 7, "???")}')
+    except D64Error as e:
+        sys.exit(f'{args.image}: {e}')
+
+
+if __name__ == '__main__':
+    main()
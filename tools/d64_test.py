@@ -0,0 +1,401 @@
+#!/usr/bin/env python
+"""Test firmware/d64.c on the host, and LOAD through the loader's ILOAD hook on the 6502.
+
+d64.c is compiled with the host's C compiler ($CC, default cc) and called through ctypes.
+Each case is an image built by tools/d64.py, maybe broken on purpose, and a name to LOAD; the C
+parser and d64.py must both give the expected file or error.  The cases cover directories over
+several sectors, "?" and "*" patterns, files that aren't closed PRGs, chains that loop or leave
+the disk, 40 track images and images with error bytes.
+
+Then loader_rom.bin boots on the emulated 6502 with the cartridge in 8K mode and a D64
+mounted, and must go to BASIC with the ILOAD vector pointing at its hook.  Files are LOADed
+through the KERNAL's LOAD entry into the hook from a model of the firmware's side
+(CMD_LOAD_OPEN and the name, then CMD_NEXT_PAGE), and compared with a 1541.  A VERIFY, another
+device, an empty name or "$" must go on to the KERNAL's own load:
+
+    python tools/d64_test.py
+"""
+import argparse
+import ctypes
+import os
+import random
+import sys
+import tempfile
+
+import c64cart
+import d64
+import host_c
+import loader_sim
+import mos6502
+import prg
+
+
+CMD_NEXT_PAGE = 0x01
+CMD_LOAD_OPEN = 0x05
+MAILBOX = 0x800
+MAILBOX_D64_DEVICE = MAILBOX + 0x0a
+MAILBOX_LOAD_ERROR = MAILBOX + 0x0b
+MAILBOX_LOAD_ADDRESS = MAILBOX + 0x0c
+MAILBOX_LOAD_SIZE = MAILBOX + 0x0e
+KERNAL_FILE_NOT_FOUND = 4
+
+# Stand-ins for the KERNAL and BASIC: rts for the routines the loader calls, and addresses
+# the runs stop at
+KERNAL_STUBS = (0xff81, 0xff84, 0xff87, 0xff8a, 0xf5af, 0xf5d2)
+KERNAL_ILOAD = 0xf4a5
+# The KERNAL's LOAD from $FFD5: stx $c3, sty $c4, jmp ($0330).  Its ILOAD at $F4A5 then stores
+# the verify flag from A at $93, so the hook sees the last LOAD's flag there.
+KERNAL_LOAD = 0xf49e
+KERNAL_LOAD_CODE = bytes([0x86, 0xc3, 0x84, 0xc4, 0x6c, 0x30, 0x03])
+BASIC_COLD_START = 0xe394
+LOAD_RETURN = 0xfff0
+NAME_BUFFER = 0x0200
+
+
+class CEntry(ctypes.Structure):
+    _fields_ = [('track', ctypes.c_uint8), ('sector', ctypes.c_uint8),
+                ('type', ctypes.c_uint8), ('blocks', ctypes.c_uint16),
+                ('name', ctypes.c_char * (d64.NAME_MAX + 1))]
+
+
+class CParser:
+    """firmware/d64.c, compiled for the host"""
+
+    def __init__(self, build_dir):
+        self.lib = host_c.load(build_dir, 'd64.c')
+        self.lib.d64_sector_offset.restype = ctypes.c_long
+        self.lib.d64_error_name.restype = ctypes.c_char_p
+
+    def sector_offset(self, image_size, track, sector):
+        offset = self.lib.d64_sector_offset(ctypes.c_size_t(image_size), track, sector)
+        return None if offset < 0 else offset
+
+    def load(self, image, pattern, out_max=0x10000):
+        """The file's data, or d64_error_name() of the error"""
+        entry = CEntry()
+        error = self.lib.d64_find(bytes(image), ctypes.c_size_t(len(image)), pattern,
+                                  ctypes.c_size_t(len(pattern)), ctypes.byref(entry))
+        if error == 0:
+            out = ctypes.create_string_buffer(out_max)
+            size = ctypes.c_size_t()
+            error = self.lib.d64_read(bytes(image), ctypes.c_size_t(len(image)),
+                                      ctypes.byref(entry), out, ctypes.c_size_t(out_max),
+                                      ctypes.byref(size))
+            if error == 0:
+                return out.raw[:size.value]
+        return self.lib.d64_error_name(error).decode()
+
+
+def python_load(image, pattern, out_max=0x10000):
+    try:
+        return d64.read(image, d64.find(image, pattern), out_max)
+    except d64.D64Error as e:
+        return str(e)
+
+
+def data(seed, size):
+    return bytes(random.Random(seed).randrange(256) for _ in range(size))
+
+
+def first_sector(image, name):
+    entry = next(e for e in d64.directory(image) if e.name == name)
+    return d64.sector_offset(len(image), entry.track, entry.sector), entry
+
+
+def set_entry_start(image, name, track, sector):
+    """Point a directory entry's chain at another sector"""
+    bam = d64.sector_offset(len(image), d64.DIRECTORY_TRACK, 0)
+    for offset in d64.chain(image, image[bam], image[bam + 1]):
+        for e in range(offset, offset + d64.SECTOR_SIZE, d64.ENTRY_SIZE):
+            if bytes(image[e + 5:e + 5 + len(name)]) == name:
+                image[e + 3:e + 5] = bytes([track, sector])
+
+
+def cases():
+    """(description, image, pattern, expected data or error, buffer size)"""
+    sizes = [2, 3, 254, 255, 508, 509, 1000, 20000, 50000] + [100] * 9
+    files = [(b'DATA', b'sequential', d64.TYPE_SEQ),
+             (b'DATA', data(1, 300), d64.TYPE_PRG),
+             (b'GONE', data(2, 10), 0x00),
+             (b'SPLAT', data(3, 10), 0x02),
+             (b'SIXTEENCHARSNAME', data(4, 600), d64.TYPE_PRG)]
+    files += [(b'FILE%d' % i, data(10 + i, size), d64.TYPE_PRG) for i, size in enumerate(sizes)]
+    image = d64.build(files)
+    contents = {name: file for name, file, kind in files if kind == d64.TYPE_PRG}
+
+    for name, file, kind in files[4:]:
+        yield f'{name.decode()}, {len(file)} bytes', image, name, file, 0x10000
+    yield 'directory over 3 sectors', image, b'FILE17', contents[b'FILE17'], 0x10000
+    yield '"*" is the first PRG', image, b'*', contents[b'DATA'], 0x10000
+    yield '"FILE1*"', image, b'FILE1*', contents[b'FILE1'], 0x10000
+    yield '"F?LE3"', image, b'F?LE3', contents[b'FILE3'], 0x10000
+    yield '"FILE1" is not FILE10', image, b'FILE1', contents[b'FILE1'], 0x10000
+    yield 'prefix without "*"', image, b'FIL', 'file not found', 0x10000
+    yield 'longer than the name', image, b'FILE1 ', 'file not found', 0x10000
+    yield '17 characters', image, b'SIXTEENCHARSNAMEX', 'file not found', 0x10000
+    yield 'deleted file', image, b'GONE', 'file not found', 0x10000
+    yield 'unclosed file', image, b'SPLAT', 'file not found', 0x10000
+    yield 'buffer too small', image, b'FILE8', 'file too big', 49999
+    yield 'with error bytes', image + bytes(683), b'FILE7', contents[b'FILE7'], 0x10000
+    yield 'truncated image', image[:-1], b'FILE7', 'not a .d64 image', 0x10000
+
+    looped = bytearray(image)
+    offset, entry = first_sector(looped, b'FILE6')
+    last = list(d64.chain(looped, entry.track, entry.sector))[-1]
+    looped[last:last + 2] = bytes([entry.track, entry.sector])
+    yield 'chain loops', looped, b'FILE6', 'broken sector chain', 0x40000
+
+    off_disk = bytearray(image)
+    offset, _ = first_sector(off_disk, b'FILE7')
+    off_disk[offset:offset + 2] = bytes([36, 0])
+    yield 'chain goes to track 36', off_disk, b'FILE7', 'broken sector chain', 0x10000
+    off_disk = bytearray(image)
+    offset, _ = first_sector(off_disk, b'FILE7')
+    off_disk[offset:offset + 2] = bytes([18, 19])
+    yield 'chain goes to sector 19 of 18', off_disk, b'FILE7', 'broken sector chain', 0x10000
+
+    # A file moved to track 38 only loads from a 40 track image
+    for tracks, expected in ((40, data(5, 200)), (35, 'broken sector chain')):
+        moved = d64.build([(b'FAR', data(5, 200), d64.TYPE_PRG)], tracks=40)
+        moved = moved[:d64.IMAGE_SIZE[tracks]]
+        if tracks == 40:
+            offset, _ = first_sector(moved, b'FAR')
+            far = d64.sector_offset(len(moved), 38, 3)
+            moved[far:far + d64.SECTOR_SIZE] = moved[offset:offset + d64.SECTOR_SIZE]
+        set_entry_start(moved, b'FAR', 38, 3)
+        yield f'file on track 38 of {tracks}', moved, b'FAR', expected, 0x10000
+
+
+# From the 1541's layout: 21 sectors a track up to 17, 19 to 24, 18 to 30 and 17 after that
+KNOWN_OFFSETS = [(174848, 1, 0, 0), (174848, 17, 20, 0x16400), (174848, 18, 0, 0x16500),
+                 (174848, 25, 0, 0x1ea00), (174848, 31, 0, 0x25600), (174848, 35, 16, 0x2aa00),
+                 (174848, 35, 17, None), (174848, 36, 0, None), (174848, 0, 0, None),
+                 (196608, 36, 0, 0x2ab00), (196608, 40, 16, 0x2ff00), (196608, 41, 0, None)]
+
+
+def known_image():
+    """A disk made byte by byte: the BAM at 18/0 pointing at a directory in 18/1 with one PRG,
+    "HI", in a single sector at 17/0 holding 01 08 60"""
+    image = bytearray(d64.IMAGE_SIZE[35])
+    image[0x16500:0x16502] = bytes([18, 1])
+    image[0x16600:0x16602] = bytes([0, 0xff])
+    image[0x16602:0x16620] = (bytes([0x82, 17, 0]) + b'HI' + bytes([0xa0] * 14)
+                              + bytes(9) + bytes([1, 0]))
+    image[0x15000:0x15005] = bytes([0, 4, 0x01, 0x08, 0x60])
+    return image
+
+
+def check_known(parser_c):
+    """Error messages for the C parser against offsets and an image worked out by hand"""
+    errors = [f'track {track} sector {sector} of {size} is at {got}, expected {offset}'
+              for size, track, sector, offset in KNOWN_OFFSETS
+              for got in [parser_c.sector_offset(size, track, sector)] if got != offset]
+    image = known_image()
+    for pattern, expected in ((b'HI', bytes([0x01, 0x08, 0x60])), (b'*', bytes([1, 8, 0x60])),
+                              (b'H', 'file not found')):
+        got = parser_c.load(image, pattern)
+        if got != expected:
+            errors.append(f'{pattern.decode()} from the hand-made disk gave {got!r}')
+    return errors
+
+
+class D64Cartridge(c64cart.Cartridge):
+    """The cartridge in 8K mode, with the firmware's side of LOAD from a mounted D64"""
+
+    def __init__(self, loader, image, device, command_us, open_us):
+        super().__init__(loader, eight_k=True)
+        self.image = image
+        self.file = b''
+        self.offset = 0
+        self.name_state = None  # None, 'length' or 'chars', like load_name_state
+        self.rom[MAILBOX_D64_DEVICE] = device
+        for command in range(1, 256):
+            duration = open_us if command != CMD_NEXT_PAGE else command_us
+            self.on_command(command, duration, lambda cart, c=command: cart.command(c))
+
+    def command(self, command):
+        if self.name_state == 'length':
+            self.name, self.name_left, self.name_state = b'', command - 1, 'chars'
+        elif self.name_state == 'chars':
+            self.name += bytes([command])[:d64.NAME_MAX - len(self.name)]
+            self.name_left -= 1
+        elif command == CMD_LOAD_OPEN:
+            self.name_state = 'length'
+        elif command == CMD_NEXT_PAGE:
+            self.offset += loader_sim.NUFLI_WINDOW_SIZE
+            self.load_window()
+        if self.name_state == 'chars' and self.name_left == 0:
+            self.name_state = None
+            self.open()
+
+    def open(self):
+        file = python_load(self.image, self.name)
+        if isinstance(file, str) or len(file) < 2:
+            self.rom[MAILBOX_LOAD_ERROR] = KERNAL_FILE_NOT_FOUND
+            return
+        self.rom[MAILBOX_LOAD_ERROR] = 0
+        self.rom[MAILBOX_LOAD_ADDRESS:MAILBOX_LOAD_ADDRESS + 2] = file[:2]
+        size = len(file) - 2
+        self.rom[MAILBOX_LOAD_SIZE:MAILBOX_LOAD_SIZE + 2] = bytes([size & 0xff, size >> 8])
+        self.file = file[2:]
+        self.offset = 0
+        self.load_window()
+
+    def load_window(self):
+        window = self.file[self.offset:self.offset + loader_sim.NUFLI_WINDOW_SIZE]
+        start = loader_sim.NUFLI_OFFSET
+        self.rom[start:start + loader_sim.NUFLI_WINDOW_SIZE] = \
+            window + bytes(loader_sim.NUFLI_WINDOW_SIZE - len(window))
+
+
+def run_until(cpu, stops, max_cycles=20_000_000):
+    while cpu.pc not in stops:
+        if cpu.cycles > max_cycles:
+            raise RuntimeError(f'still running after {max_cycles} cycles, at ${cpu.pc:04X}')
+        cpu.step()
+
+
+def boot(loader, image, device, command_us, open_us):
+    """Boot to BASIC with the D64 mounted.  Returns the cartridge and CPU, or an error."""
+    cartridge = D64Cartridge(loader, image, device, command_us, open_us)
+    for address in KERNAL_STUBS:
+        cartridge.ram[address] = 0x60  # rts
+    cartridge.ram[KERNAL_LOAD:KERNAL_LOAD + len(KERNAL_LOAD_CODE)] = KERNAL_LOAD_CODE
+    cartridge.ram[0xa000:0xa002] = bytes([BASIC_COLD_START & 0xff, BASIC_COLD_START >> 8])
+    cartridge.ram[0xa004:0xa00c] = b'CBMBASIC'
+    cpu = mos6502.Cpu(cartridge)
+    cartridge.attach(cpu)
+    cpu.pc = cpu.read16(0x8000)
+    run_until(cpu, (BASIC_COLD_START, 0x3000))
+    vector = cpu.read16(0x0330)
+    if cpu.pc != BASIC_COLD_START:
+        return None, None, 'loaded the image instead of starting BASIC'
+    if not 0x8000 <= vector < 0xa000:
+        return None, None, f'ILOAD vector is ${vector:04X}'
+    return cartridge, cpu, None
+
+
+def kernal_load(cpu, name, device, secondary=0, address=0x0801, verify=0):
+    """Call the KERNAL's LOAD with the verify flag in A and the address in X/Y, after SETNAM
+    and SETLFS, and with the other flag left at $93 as if the last LOAD was the other kind.
+    Returns where it stopped."""
+    cartridge = cpu.bus
+    cartridge.ram[NAME_BUFFER:NAME_BUFFER + len(name)] = name
+    cartridge.ram[0xb7] = len(name)
+    cartridge.ram[0xbb:0xbd] = bytes([NAME_BUFFER & 0xff, NAME_BUFFER >> 8])
+    cartridge.ram[0xb9] = secondary
+    cartridge.ram[0xba] = device
+    cartridge.ram[0x93] = 1 - verify
+    cpu.push((LOAD_RETURN - 1) >> 8)
+    cpu.push((LOAD_RETURN - 1) & 0xff)
+    cpu.a = verify
+    cpu.x = address & 0xff
+    cpu.y = address >> 8
+    cpu.pc = KERNAL_LOAD
+    start = cpu.cycles
+    run_until(cpu, (LOAD_RETURN, KERNAL_ILOAD))
+    return cpu.pc, cpu.cycles - start
+
+
+def hook_cases(raspi, basic):
+    """(description, name, secondary address, device, verify, X/Y address, expected result)"""
+    relocated = bytes([0x01, 0x10]) + basic[2:]
+    yield 'LOAD"RASPI",8,1', b'RASPI', 1, 8, 0, 0x0000, ('loaded', raspi)
+    yield 'LOAD"HE*",8', b'HE*', 0, 8, 0, 0x0801, ('loaded', basic)
+    yield 'LOAD"HELLO",8 to $1001', b'HELLO', 0, 8, 0, 0x1001, ('loaded', relocated)
+    yield 'LOAD"MISSING",8', b'MISSING', 0, 8, 0, 0x0801, ('error', KERNAL_FILE_NOT_FOUND)
+    yield 'LOAD"RASPI",9', b'RASPI', 1, 9, 0, 0x0000, ('kernal',)
+    yield 'VERIFY"RASPI",8', b'RASPI', 1, 8, 1, 0x0000, ('kernal',)
+    yield 'LOAD"",8', b'', 0, 8, 0, 0x0801, ('kernal',)
+    yield 'LOAD"$",8', b'$', 0, 8, 0, 0x0801, ('kernal',)
+
+
+def check_hook(cpu, name, secondary, device, verify, address, expected):
+    """Returns whether the LOAD did what was expected, what it did, and the time it took"""
+    cartridge = cpu.bus
+    if expected[0] == 'loaded':
+        file = expected[1]
+        load = file[0] | (file[1] << 8)
+        cartridge.ram[load:load + len(file) - 2] = bytes([0xaa]) * (len(file) - 2)
+    stopped, cycles = kernal_load(cpu, name, device, secondary, address, verify)
+    seconds = cycles / c64cart.PHI2_HZ['pal']
+    if expected[0] == 'kernal':
+        return stopped == KERNAL_ILOAD and cpu.a == verify, 'went to the KERNAL', seconds
+    if stopped != LOAD_RETURN:
+        return False, 'went to the KERNAL', seconds
+    carry = cpu.p & mos6502.C
+    if expected[0] == 'error':
+        return bool(carry) and cpu.a == expected[1], f'error {cpu.a}', seconds
+    end = load + len(file) - 2
+    loaded = bytes(cartridge.ram[load:end])
+    ok = not carry and loaded == file[2:] and (cpu.x | (cpu.y << 8)) == end \
+        and cpu.read16(0xae) == end
+    return ok, f'${load:04X}-${end - 1:04X}', seconds
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--loader', default=os.path.join(loader_sim.C64_ROM_DIR,
+                                                         'loader_rom.bin'))
+    parser.add_argument('--command-us', type=float, default=20.0,
+                        help='time for the Pico to handle CMD_NEXT_PAGE (default %(default)s)')
+    parser.add_argument('--open-us', type=float, default=1000.0,
+                        help='time for the Pico to handle each name command, including '
+                             'reading the file (default %(default)s)')
+    args = parser.parse_args()
+
+    failures = 0
+    with tempfile.TemporaryDirectory() as build_dir:
+        parser_c = CParser(build_dir)
+
+        offsets_match = all(parser_c.sector_offset(size, track, sector)
+                            == d64.sector_offset(size, track, sector)
+                            for size in list(d64.IMAGE_SIZES) + [174847]
+                            for track in range(42) for sector in range(22))
+        print('sector offsets: ' + ('OK' if offsets_match else 'FAIL: C and d64.py differ'))
+        failures += not offsets_match
+        errors = check_known(parser_c)
+        print('offsets and a disk from the 1541\'s layout: '
+              + ('OK' if not errors else ''.join(f'  FAIL: {e}' for e in errors)))
+        failures += bool(errors)
+
+        for name, image, pattern, expected, out_max in cases():
+            results = {'C': parser_c.load(image, pattern, out_max),
+                       'd64.py': python_load(image, pattern, out_max)}
+            describe = expected if isinstance(expected, str) else f'{len(expected)} bytes'
+            errors = [f'{which} gave ' + (result if isinstance(result, str)
+                                          else f'{len(result)} bytes that differ')
+                      for which, result in results.items() if result != expected]
+            print(f'{name}: {describe}' + ''.join(f'  FAIL: {e}' for e in errors))
+            failures += bool(errors)
+
+    with open(args.loader, 'rb') as f:
+        loader = f.read()
+    basic = bytes([0x01, 0x08]) + data(6, 3000)
+    raspi = open(os.path.join(loader_sim.C64_ROM_DIR, 'raspi.nuf'), 'rb').read()
+    image = d64.build([(b'RASPI', raspi, d64.TYPE_PRG), (b'HELLO', basic, d64.TYPE_PRG)])
+    cartridge, cpu, error = boot(loader, image, 8, args.command_us, args.open_us)
+    print('boot to BASIC with device 8: ' + (f'FAIL: {error}' if error else
+                                              f'ILOAD vector ${cpu.read16(0x0330):04X}'))
+    failures += bool(error)
+    if error:
+        print(f'{failures} failed')
+        sys.exit(1)
+
+    for name, pattern, secondary, device, verify, address, expected in hook_cases(raspi, basic):
+        ok, result, seconds = check_hook(cpu, pattern, secondary, device, verify, address,
+                                         expected)
+        line = f'{name}: {result}'
+        if expected[0] == 'loaded':
+            drive = prg.drive_1541_seconds(len(expected[1]) - 2)
+            line += f', {seconds * 1000:.1f} ms (1541 about {drive:.1f} s, {drive / seconds:.0f}x)'
+        print(line + ('' if ok else '  FAIL'))
+        failures += not ok
+
+    print(f'{failures} failed' if failures else 'all OK')
+    sys.exit(1 if failures else 0)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,206 @@
+#!/usr/bin/env python
+"""Embed binary assets in the firmware with .incbin.
+
+"embed" writes an assembly file that includes the binary directly, with the requested
+alignment and section, and a header declaring it.  "manifest" collects the assets of a target
+into a table that the firmware can look assets up in.  c64_assets.cmake runs both.
+"""
+import argparse
+import json
+import os
+import re
+import textwrap
+import zlib
+
+import crt
+import snapshot
+
+
+def packbits(data):
+    """PackBits: a header byte n <= 127 is followed by n+1 literal bytes, and n >= 129 is
+    followed by one byte to repeat 257-n times.  Matches asset_unpack() in the firmware."""
+    out = bytearray()
+    literal = bytearray()
+    i = 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and run < 128 and data[i + run] == data[i]:
+            run += 1
+        if run >= 3:
+            if literal:
+                out += bytes([len(literal) - 1]) + literal
+                literal = bytearray()
+            out += bytes([257 - run, data[i]])
+            i += run
+        else:
+            literal.append(data[i])
+            i += 1
+            if len(literal) == 128:
+                out += bytes([127]) + literal
+                literal = bytearray()
+    if literal:
+        out += bytes([len(literal) - 1]) + literal
+    return bytes(out)
+
+
+def write_file(path, contents):
+    mode = 'wb' if isinstance(contents, bytes) else 'wt'
+    with open(path, mode) as f:
+        f.write(contents)
+
+
+def embed(args):
+    if args.kind in ('prg', 'd64', 'snapshot') and (args.skip or args.compress):
+        raise SystemExit(f'{args.name}: a {args.kind.upper()} is served straight from flash, so '
+                         'it can\'t be skipped into or compressed')
+    if args.kind == 'crt' and args.skip:
+        raise SystemExit(f'{args.name}: a CRT is parsed from its header, so it can\'t be skipped '
+                         'into')
+    with open(args.input, 'rb') as f:
+        data = f.read()[args.skip:]
+    name = args.name
+    kind = args.kind
+    bank = None
+    if args.kind == 'crt':
+        # Embed the 16K bank the firmware serves, not the file
+        try:
+            cartridge = crt.parse(data)
+        except crt.CrtError as e:
+            raise SystemExit(f'{args.input}: {e}')
+        data = bank = cartridge.bank
+        kind = f'crt_{cartridge.mode}'
+    if args.kind == 'snapshot':
+        try:
+            snapshot.parse(data)
+        except snapshot.SnapshotError as e:
+            raise SystemExit(f'{args.input}: {e}')
+    macro = re.sub(r'[^0-9A-Za-z_]', '_', name).upper()
+    crc = zlib.crc32(data)
+    section = args.section or f'.rodata.{name}'
+    os.makedirs(args.output_dir, exist_ok=True)
+
+    if args.compress:
+        packed = packbits(data)
+        incbin_path = os.path.join(args.output_dir, f'{name}.packed')
+        write_file(incbin_path, packed)
+        symbol, skip, size = f'{name}_packed', 0, len(packed)
+    elif bank:
+        incbin_path = os.path.join(args.output_dir, f'{name}.bank')
+        write_file(incbin_path, bank)
+        symbol, skip, size = name, 0, len(bank)
+    else:
+        incbin_path = os.path.abspath(args.input)
+        symbol, skip, size = name, args.skip, len(data)
+
+    write_file(os.path.join(args.output_dir, f'{name}_asset.S'), textwrap.dedent(f"""\
+        // Generated by embed_asset.py from {os.path.basename(args.input)}
+        .section {section}, "a"
+
+        .balign {args.align}
+        .global {symbol}
+        .type {symbol}, %object
+        {symbol}:
+        .incbin "{incbin_path}", {skip}
+        .size {symbol}, . - {symbol}
+
+        .balign 4
+        .global {name}_crc32
+        .type {name}_crc32, %object
+        {name}_crc32:
+        .4byte 0x{crc:08X}
+        .size {name}_crc32, 4
+        """))
+
+    header = textwrap.dedent(f"""\
+        // Generated by embed_asset.py from {os.path.basename(args.input)}
+        #pragma once
+
+        #include <stdint.h>
+
+        #define {macro}_SIZE {len(data)}
+        #define {macro}_ALIGN {args.align}
+        """)
+    if args.compress:
+        header += textwrap.dedent(f"""\
+            #define {macro}_PACKED_SIZE {size}
+
+            // PackBits compressed, unpack with asset_unpack()
+            extern const uint8_t {name}_packed[{size}];
+            """)
+    else:
+        header += f'\nextern const uint8_t {name}[{size}];\n'
+    header += f'extern const uint32_t {name}_crc32;  // CRC-32 of the unpacked data\n'
+    write_file(os.path.join(args.output_dir, f'{name}.h'), header)
+
+    write_file(os.path.join(args.output_dir, f'{name}.asset.json'), json.dumps({
+        'name': name,
+        'source': os.path.abspath(args.input),
+        'size': len(data),
+        'packed_size': size if args.compress else None,
+        'align': args.align,
+        'section': section,
+        'crc32': f'{crc:08x}',
+        'layout': args.layout,
+        'kind': kind,
+        'exec': args.exec_address,
+    }, indent=2) + '\n')
+
+
+def manifest(args):
+    assets = []
+    for path in args.assets:
+        with open(path) as f:
+            assets.append(json.load(f))
+
+    includes = ''.join(f'#include "{a["name"]}.h"\n' for a in assets)
+    entries = ''.join(
+        f'    {{"{a["name"]}", {a["name"] + ("_packed" if a["packed_size"] else "")}, '
+        f'{a["size"]}, {a["packed_size"] or 0}, {a["align"]}, 0x{a["crc32"].upper()}, '
+        f'ASSET_LAYOUT_{a["layout"].upper()}, ASSET_KIND_{a["kind"].upper()}, '
+        f'0x{a["exec"] or 0:04X}}},\n'
+        for a in assets)
+    write_file(os.path.join(args.output_dir, 'asset_manifest.c'),
+               '// Generated by embed_asset.py\n'
+               '#include "asset.h"\n' + includes +
+               '\nconst asset_t assets[] = {\n' + entries + '};\n'
+               f'\nconst size_t asset_count = {len(assets)};\n')
+    write_file(os.path.join(args.output_dir, 'asset_manifest.json'),
+               json.dumps(assets, indent=2) + '\n')
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    commands = parser.add_subparsers(dest='command', required=True)
+
+    embed_parser = commands.add_parser('embed', help='embed one asset')
+    embed_parser.add_argument('--name', required=True, help='C symbol for the data')
+    embed_parser.add_argument('--skip', metavar='N', default=0, type=int,
+                              help='start N bytes into the source file')
+    embed_parser.add_argument('--align', metavar='N', default=4, type=int,
+                              help='byte alignment of the data')
+    embed_parser.add_argument('--section', help='linker section (default .rodata.<name>)')
+    embed_parser.add_argument('--compress', action='store_true', help='PackBits compress')
+    embed_parser.add_argument('--layout', choices=('linear', 'sections', 'immediate'),
+                              default='linear', help='how the firmware sends it to the C64')
+    embed_parser.add_argument('--kind', choices=('raw', 'prg', 'd64', 'crt', 'snapshot'),
+                              default='raw',
+                              help='what the asset is (prg: a C64 program the loader can run, '
+                                   'd64: a disk image to LOAD from, crt: an 8K or 16K '
+                                   'cartridge, snapshot: a C64 to resume)')
+    embed_parser.add_argument('--exec', dest='exec_address', type=lambda s: int(s, 0),
+                              help='PRG start address, if the file has no BASIC SYS')
+    embed_parser.add_argument('--output-dir', required=True)
+    embed_parser.add_argument('input')
+    embed_parser.set_defaults(func=embed)
+
+    manifest_parser = commands.add_parser('manifest', help='write the asset table')
+    manifest_parser.add_argument('--output-dir', required=True)
+    manifest_parser.add_argument('assets', nargs='*', metavar='name.asset.json')
+    manifest_parser.set_defaults(func=manifest)
+
+    args = parser.parse_args()
+    args.func(args)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,239 @@
+#!/usr/bin/env python
+"""Test firmware/flash_store.c on a simulated flash, with the power cut at every write.
+
+flash_store.c is compiled with the host's C compiler ($CC, default cc) and called through
+ctypes, with a backend in RAM that behaves like NOR flash: an erase sets a sector to $ff, and
+programming can only clear bits, so a page programmed twice without an erase is an error.
+Random puts and deletes of a few keys fill the ring several times over, so sectors are
+collected and records copied.
+
+Then the same run is cut short at each erase and program in turn, with the write in progress
+left half done, and the store mounted again as after a power loss, maybe cut again part way
+through the mount.  Every put that returned before the cut must read back, the one in progress
+must read back as its old or new value, and the store must go on working:
+
+    python tools/flash_store_test.py
+"""
+import ctypes
+import random
+import sys
+import tempfile
+
+import host_c
+
+SECTOR_SIZE = host_c.header_define('flash_store.h', 'FLASH_STORE_SECTOR_SIZE')
+PAGE_SIZE = host_c.header_define('flash_store.h', 'FLASH_STORE_PAGE_SIZE')
+MAX_RECORD = host_c.header_define('flash_store.h', 'FLASH_STORE_MAX_RECORD',
+                                  {'FLASH_STORE_SECTOR_SIZE': SECTOR_SIZE,
+                                   'FLASH_STORE_PAGE_SIZE': PAGE_SIZE})
+OK, NOT_FOUND, TOO_BIG, FULL = range(4)    # flash_store_result_t
+SECTORS = 4
+KEYS = 5
+
+ERASE = ctypes.CFUNCTYPE(None, ctypes.c_void_p, ctypes.c_uint32)
+PROGRAM = ctypes.CFUNCTYPE(None, ctypes.c_void_p, ctypes.c_uint32, ctypes.c_void_p,
+                           ctypes.c_size_t)
+READ = ctypes.CFUNCTYPE(None, ctypes.c_void_p, ctypes.c_uint32, ctypes.c_void_p,
+                        ctypes.c_size_t)
+
+
+class CBackend(ctypes.Structure):
+    _fields_ = [('sector_count', ctypes.c_uint32), ('context', ctypes.c_void_p),
+                ('erase', ERASE), ('program', PROGRAM), ('read', READ)]
+
+
+class CStore(ctypes.Structure):
+    _fields_ = [('backend', ctypes.POINTER(CBackend)), ('head_sector', ctypes.c_uint32),
+                ('head_offset', ctypes.c_uint32), ('sequence', ctypes.c_uint32)]
+
+
+class Flash:
+    """NOR flash in RAM, which loses power after a given number of writes: that write is left
+    half done, and the ones after it don't happen"""
+
+    def __init__(self, rng, data=None):
+        self.rng = rng
+        self.data = bytearray(data) if data else bytearray(b'\xff' * SECTORS * SECTOR_SIZE)
+        self.writes = 0
+        self.cut_at = None
+        self.errors = []
+        self.backend = CBackend(SECTORS, None, ERASE(self.erase), PROGRAM(self.program),
+                                READ(self.read))
+
+    def powered(self):
+        """Whether the next write happens, cutting the power if it's the one to be cut at"""
+        self.writes += 1
+        return self.cut_at is None or self.writes < self.cut_at
+
+    def cut(self):
+        return self.cut_at is not None and self.writes >= self.cut_at
+
+    def erase(self, context, sector):
+        if not 0 <= sector < SECTORS:
+            self.errors.append(f'erase of sector {sector}')
+            return
+        base = sector * SECTOR_SIZE
+        if self.powered():
+            self.data[base:base + SECTOR_SIZE] = b'\xff' * SECTOR_SIZE
+        elif self.writes == self.cut_at:
+            # Cut part way: some pages erased, one of them only partly
+            for page in range(base, base + SECTOR_SIZE, PAGE_SIZE):
+                if self.rng.random() < 0.5:
+                    self.data[page:page + PAGE_SIZE] = bytes(
+                        b | self.rng.choice((0, 0xff)) for b in self.data[page:page + PAGE_SIZE])
+
+    def program(self, context, offset, data, length):
+        if offset % PAGE_SIZE or length % PAGE_SIZE or offset + length > len(self.data):
+            self.errors.append(f'program of {length} bytes at {offset:#x}')
+            return
+        new = ctypes.string_at(data, length)
+        if self.cut():
+            return
+        if any(b != 0xff for b in self.data[offset:offset + length]):
+            self.errors.append(f'program at {offset:#x} without an erase')
+        if self.powered():
+            self.data[offset:offset + length] = new
+        else:
+            # Cut part way: some bytes programmed, some not, some with only some bits cleared
+            self.data[offset:offset + length] = bytes(
+                old & (n | self.rng.choice((0, 0xff, self.rng.randrange(256))))
+                for old, n in zip(self.data[offset:offset + length], new))
+
+    def read(self, context, offset, data, length):
+        if offset + length > len(self.data):
+            self.errors.append(f'read of {length} bytes at {offset:#x}')
+            return
+        ctypes.memmove(data, bytes(self.data[offset:offset + length]), length)
+
+
+class Store:
+    """firmware/flash_store.c mounted on a Flash"""
+
+    def __init__(self, lib, flash):
+        self.lib = lib
+        self.flash = flash
+        self.store = CStore()
+        lib.flash_store_mount(ctypes.byref(self.store), ctypes.byref(flash.backend))
+
+    def put(self, key, value):
+        return self.lib.flash_store_put(ctypes.byref(self.store), key, value,
+                                        ctypes.c_size_t(len(value)))
+
+    def get(self, key):
+        """The value, or None if there isn't one"""
+        out = ctypes.create_string_buffer(MAX_RECORD)
+        length = ctypes.c_size_t()
+        result = self.lib.flash_store_get(ctypes.byref(self.store), key, out,
+                                          ctypes.c_size_t(len(out)), ctypes.byref(length))
+        return out.raw[:length.value] if result == OK else None
+
+
+def operations(seed, count):
+    """Puts of (key, value), a value of b'' deleting the key"""
+    rng = random.Random(seed)
+    ops = []
+    for n in range(count):
+        key = rng.randrange(1, KEYS + 1)
+        if rng.random() < 0.1:
+            ops.append((key, b''))
+        else:
+            size = rng.choice((1, 10, PAGE_SIZE - 16, PAGE_SIZE, 700, 1200))
+            ops.append((key, bytes([n & 0xff, key]) * (size // 2) + bytes(size % 2)))
+    return ops
+
+
+def run(lib, flash, ops):
+    """Mount a store and put ops until the power is cut.  Returns what's stored, and the put
+    the power was cut in, if it was."""
+    stored = {}
+    store = Store(lib, flash)
+    if flash.cut():
+        return stored, None
+    for key, value in ops:
+        result = store.put(key, value)
+        if flash.cut():
+            return stored, (key, value)
+        if result == OK:
+            stored[key] = value or None
+        elif result != FULL:
+            flash.errors.append(f'put of {len(value)} bytes gives {result}')
+    return stored, None
+
+
+def check_store(store, stored, in_progress=None):
+    """Error messages for a store that should hold stored, and maybe the put in progress"""
+    errors = []
+    for key in range(1, KEYS + 1):
+        got = store.get(key)
+        allowed = [stored.get(key)]
+        if in_progress and in_progress[0] == key:
+            allowed.append(in_progress[1] or None)
+        if got not in allowed:
+            describe = 'nothing' if got is None else f'{len(got)} bytes'
+            errors.append(f'key {key} reads {describe}, expected one of '
+                          + ', '.join('nothing' if a is None else f'{len(a)} bytes'
+                                      for a in allowed))
+    return errors
+
+
+def check_uncut(lib, seed):
+    """Error messages for a run without a power cut, and the number of writes it made"""
+    flash = Flash(random.Random(seed))
+    stored, _ = run(lib, flash, operations(seed, 150))
+    errors = flash.errors + check_store(Store(lib, flash), stored)
+    return errors, flash.writes
+
+
+def check_cut(lib, seed, cut_at, second_cut):
+    """Error messages for the run cut at write cut_at, then mounted again, that mount cut at its
+    write second_cut if that isn't None, then used"""
+    rng = random.Random(seed * 100000 + cut_at)
+    flash = Flash(rng)
+    flash.cut_at = cut_at
+    ops = operations(seed, 150)
+    stored, in_progress = run(lib, flash, ops)
+    if second_cut is not None:
+        again = Flash(rng, flash.data)
+        again.cut_at = second_cut
+        Store(lib, again)
+        flash.data = again.data
+        flash.errors += again.errors
+    after = Flash(rng, flash.data)
+    store = Store(lib, after)
+    errors = flash.errors + check_store(store, stored, in_progress)
+    # Whichever the put in progress left, the store must take more puts and keep them
+    if in_progress:
+        stored[in_progress[0]] = store.get(in_progress[0])
+    for key, value in operations(seed + 1000, 40):
+        result = store.put(key, value)
+        if result == OK:
+            stored[key] = value or None
+        elif result != FULL:
+            errors.append(f'put after the cut gives {result}')
+    errors += after.errors + check_store(store, stored)
+    return [f'cut at write {cut_at}' + ('' if second_cut is None else f', then {second_cut}')
+            + f': {e}' for e in errors]
+
+
+def main():
+    failures = 0
+    with tempfile.TemporaryDirectory() as build_dir:
+        lib = host_c.load(build_dir, 'flash_store.c')
+        for seed in range(2):
+            errors, writes = check_uncut(lib, seed)
+            cuts = 0
+            for cut_at in range(1, writes + 1):
+                for second_cut in (None, 2, 20):
+                    cut_errors = check_cut(lib, seed, cut_at, second_cut)
+                    cuts += 1
+                    errors += cut_errors[:1]
+            print(f'seed {seed}: {writes} writes, cut at each of them {cuts} ways'
+                  + ''.join(f'\n  FAIL: {e}' for e in errors[:10]))
+            failures += bool(errors)
+
+    print(f'{failures} failed' if failures else 'all OK')
+    sys.exit(1 if failures else 0)
+
+
+if __name__ == '__main__':
+    main()
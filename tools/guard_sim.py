@@ -0,0 +1,136 @@
+#!/usr/bin/env python
+"""Check the command area guard against C64 access traces, on tools/pio_sim.py's model.
+
+The command SM starts locked and only unlocks when it sees UNLOCK_MAGIC (see command.pio), so
+stray reads of the command area must never reach the CPU.  Each case below is a trace of C64
+reads with the commands the CPU must receive and the number of reads that must be filtered:
+
+- BASIC running with the cartridge in 8K mode, which reads $9F6E/$9F6F on every ROM access
+- a machine code monitor dumping $9D00-$9FFF, which reads every command
+- the magic bytes in the wrong order
+- the loader: unlock, then poll the status and send commands
+- more commands than --guard-commands after one unlock
+- a command after --guard-timeout-us of idle
+- the loader's doubled unlock after a relock that lost the first of its reads
+- unlocking again after being locked
+
+The traces are generated here; a trace recorded from a real C64 (one hex address per line, as
+for pio_sim.py --trace) can be checked with --trace, which fails if any command reaches the
+CPU.  Either way, the filtered reads are reported with the CPU time they would have cost at
+--command-us each.
+
+    python tools/guard_sim.py
+    python tools/guard_sim.py --trace basic.trace
+"""
+import argparse
+import sys
+
+import pio_sim
+
+COMMAND_AREA = 0x9e00  # COMMAND_PREFIX 0x1e
+STATUS = COMMAND_AREA
+CMD_NEXT_PAGE = COMMAND_AREA + 0x01
+WINDOW = 0x8400
+
+
+def basic_reads(count):
+    """BASIC in 8K mode: reads $9F6E/$9F6F, and the code it's running from the window"""
+    for i in range(count):
+        yield (0x9f6e, 0x9f6f, WINDOW + i % 256)[i % 3]
+
+
+def wait_ready(reads=40):
+    """Poll the status, then read the window for long enough that the command's been handled"""
+    yield STATUS
+    yield from (WINDOW + i for i in range(reads))
+
+
+def send(commands):
+    for command in commands:
+        yield command
+        yield from wait_ready()
+
+
+def cases(unlock, limit):
+    yield ('BASIC in 8K mode', list(basic_reads(600)), [], 0)
+    yield ('monitor dump $9D00-$9FFF', list(range(0x9d00, 0xa000)), [], 256)
+    yield ('magic bytes out of order', sorted(unlock) + list(wait_ready()), [], 4 + 1)
+    yield ('loader', unlock + list(wait_ready()) + list(send([CMD_NEXT_PAGE] * 3)),
+           [0x01] * 3, 3)
+    yield (f'{limit + 3} commands after one unlock',
+           unlock + list(send([CMD_NEXT_PAGE] * (limit + 3))), [0x01] * limit, 3 + 1 + 3 * 2)
+    yield ('command after the timeout',
+           unlock + list(send([CMD_NEXT_PAGE])) + list(wait_ready(200)) + [CMD_NEXT_PAGE],
+           [0x01], 3 + 1)
+    # The firmware stops the SM to relock it, and a read in that time isn't answered, as if the
+    # first read of the loader's doubled unlock never happened
+    yield ('doubled unlock missing a read to the relock',
+           unlock + list(send([CMD_NEXT_PAGE])) + list(wait_ready(200)) + unlock[1:] + unlock
+           + list(send([COMMAND_AREA + 0x03])),
+           [0x01, 0x03], 3 + 3 + 4 - 1)
+    yield ('unlock after relocking',
+           unlock + list(send([CMD_NEXT_PAGE] * limit)) + [CMD_NEXT_PAGE]
+           + unlock + list(send([COMMAND_AREA + 0x03])),
+           [0x01] * limit + [0x03], 3 + 1 + 1 + 3)
+
+
+def read_trace(path):
+    with open(path) as f:
+        for line in f:
+            line = line.split('#')[0].strip()
+            if line:
+                yield int(line.lstrip('$'), 16)
+
+
+def filtered_reads(run):
+    """The filtered reads as the activity counters count them: command area reads while locked,
+    less the one that unlocks it each time"""
+    return sum(1 for r in run.results if r[1] == 'filtered') - run.guard.unlocks
+
+
+def summary(run, command_us):
+    filtered = filtered_reads(run)
+    return (f'{len(run.results)} reads, {filtered} filtered, '
+            f'{len(run.commands)} commands, {run.guard.relocks} relocks, '
+            f'saved ~{filtered * command_us:.0f} us of CPU time')
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    pio_sim.add_arguments(parser)
+    parser.add_argument('--trace', help='check a recorded trace instead of the built-in cases')
+    parser.add_argument('--verbose', '-v', action='store_true')
+    parser.set_defaults(guard_commands=8, guard_timeout_us=100.0)
+    args = parser.parse_args()
+
+    if args.trace:
+        run = pio_sim.simulate(args, read_trace(args.trace))
+        print(summary(run, args.command_us))
+        if run.commands:
+            print(f'FAIL: {len(run.commands)} commands reached the CPU')
+            sys.exit(1)
+        sys.exit(0 if run.ok else 1)
+
+    unlock = pio_sim.unlock_reads((COMMAND_AREA >> 8) & 0x3f)
+    failures = 0
+    for name, reads, commands, filtered in cases(unlock, args.guard_commands):
+        run = pio_sim.simulate(args, reads)
+        errors = []
+        if not run.ok:
+            errors.append(f'{sum(1 for r in run.results if not r[3])} reads failed')
+        if run.commands != commands:
+            errors.append(f'expected {len(commands)} commands, got {len(run.commands)}: '
+                          + ' '.join(f'{c:02X}' for c in run.commands))
+        if filtered_reads(run) != filtered:
+            errors.append(f'expected {filtered} filtered, counted {filtered_reads(run)}')
+        print(f'{name}: {summary(run, args.command_us)}')
+        for error in errors:
+            print(f'  FAIL: {error}')
+        failures += bool(errors)
+    print(f'{failures} cases failed' if failures else 'all cases OK')
+    sys.exit(1 if failures else 0)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,102 @@
+#!/usr/bin/env python
+"""Build the firmware logic for Linux and benchmark it, for profiling with the usual tools.
+
+The state machine setup, the command loop and the paging of the window only talk to the
+hardware through firmware/hal.h.  This builds them with the host backend, firmware/hal_host.c,
+into firmware/host_bench.c's test and benchmark binary with $CC (default cc) and $CFLAGS
+(default -O2 -g), and runs it: a simulated C64 unlocks the command area and pages through a
+stream with CMD_NEXT_PAGE, every byte it reads is checked, and it reports the wall clock time a
+page and how much of it the firmware took.
+
+--boot runs the start-up instead: cart_bus_boot copies the loader image into the ROM area and
+starts serving it, as main() does at reset, while a C64 that was powered on with the Pico reads
+the reset vectors and CBM80 signature.  It must read open bus, then the loader, never anything
+else, and the calls through the HAL it took to be answered are printed.
+
+--perf runs it under "perf record" and prints "perf report"; --keep leaves the binary in a
+directory, for gprof, valgrind or a debugger:
+
+    python tools/host_bench.py --layout immediate --pages 2000
+    python tools/host_bench.py --boot c64-rom/loader_rom.bin
+    python tools/host_bench.py --perf
+    CFLAGS="-O2 -pg" python tools/host_bench.py --keep build-host
+"""
+import argparse
+import os
+import shlex
+import subprocess
+import sys
+import tempfile
+
+FIRMWARE_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'firmware')
+
+# What host_bench.c runs, besides itself
+SOURCES = ['hal_host.c', 'cart_bus.c', 'command_loop.c', 'window.c', 'command_dispatch.c',
+           'copy_gen.c']
+
+
+def build(build_dir, cflags=None):
+    """Compile host_bench into build_dir and return its path"""
+    binary = os.path.join(build_dir, 'host_bench')
+    if cflags is None:
+        cflags = shlex.split(os.environ.get('CFLAGS', '-O2 -g'))
+    subprocess.run([os.environ.get('CC', 'cc'), *cflags, '-Wall', '-o', binary,
+                    *(os.path.join(FIRMWARE_DIR, f) for f in ['host_bench.c'] + SOURCES)],
+                   check=True)
+    return binary
+
+
+def command_line(binary, layout='linear', size=None, pages=None, crcs=False, boot=None,
+                 loader_crc=None):
+    if boot is not None:
+        command = [binary, '--boot', boot]
+        if loader_crc is not None:
+            command += ['--loader-crc', str(loader_crc)]
+        return command
+    command = [binary, '--layout', layout]
+    if size is not None:
+        command += ['--size', str(size)]
+    if pages is not None:
+        command += ['--pages', str(pages)]
+    if crcs:
+        command.append('--crcs')
+    return command
+
+
+def run(binary, **options):
+    """Run host_bench, returning (exit status, output)"""
+    result = subprocess.run(command_line(binary, **options), stdout=subprocess.PIPE,
+                            stderr=subprocess.STDOUT, text=True)
+    return result.returncode, result.stdout
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--layout', choices=['linear', 'immediate'], default='linear')
+    parser.add_argument('--size', type=int, help='bytes in the stream (default 17K)')
+    parser.add_argument('--pages', type=int, help='pages the C64 reads (default 1000)')
+    parser.add_argument('--boot', metavar='LOADER',
+                        help='run the start-up with this loader image instead')
+    parser.add_argument('--perf', action='store_true', help='profile with perf record')
+    parser.add_argument('--keep', metavar='DIR', help='build in DIR and leave the binary there')
+    args = parser.parse_args()
+
+    with tempfile.TemporaryDirectory() as build_dir:
+        if args.keep:
+            os.makedirs(args.keep, exist_ok=True)
+            build_dir = args.keep
+        binary = build(build_dir)
+        command = command_line(binary, args.layout, args.size, args.pages, boot=args.boot)
+        if args.perf:
+            data = os.path.join(build_dir, 'perf.data')
+            status = subprocess.run(['perf', 'record', '-g', '-o', data, '--'] + command).returncode
+            if status == 0:
+                subprocess.run(['perf', 'report', '--stdio', '-i', data])
+        else:
+            status = subprocess.run(command).returncode
+    sys.exit(status)
+
+
+if __name__ == '__main__':
+    main()
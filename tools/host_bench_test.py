@@ -0,0 +1,156 @@
+#!/usr/bin/env python
+"""Test the host build of the firmware logic, firmware/host_bench.c on firmware/hal_host.c.
+
+The binary is built with tools/host_bench.py and run for each layout over streams that end on
+and off a page boundary, which checks every byte the simulated C64 reads.  The CRC-32 of each
+page must match tools/crc32.py's, the same options must give the same reads, and bad options
+must be refused.  The program lengths and defines hal_host.h copies from the .pio sources must
+match them.
+
+The start-up runs with c64-rom/loader_rom.bin and a C64 reading from power on: it must read the
+loader's signature from the call that enables the bus on, and open bus before, and a loader
+that fails its CRC must never be served.  main() must call cart_bus_boot before it starts USB
+or does anything else slow:
+
+    python tools/host_bench_test.py
+"""
+import os
+import re
+import sys
+import tempfile
+import zlib
+
+import crc32
+import host_bench
+import host_c
+import pioparse
+
+FIRMWARE_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'firmware')
+WINDOW_SIZE = 1024
+CHUNK_SIZE = 2048           # COPY_GEN_CHUNK_SIZE
+
+
+def header_defines():
+    with open(os.path.join(FIRMWARE_DIR, 'hal_host.h')) as f:
+        return {m.group(1): int(m.group(2), 0)
+                for m in re.finditer(r'#define HAL_HOST_(\w+) (\w+)', f.read())}
+
+
+def stream(size):
+    """host_bench.c's stream"""
+    seed = 0x12345678
+    data = bytearray(size)
+    for i in range(size):
+        seed = (seed * 1103515245 + 12345) & 0xffffffff
+        data[i] = (seed >> 16) & 0xff
+    return bytes(data)
+
+
+def expected_crcs(size, page_size, pages):
+    data = stream(size)
+    lines = []
+    offset = 0
+    for _ in range(pages):
+        crc = crc32.sniffer_crc32(data[offset:offset + page_size])
+        lines.append(f'page {offset} {crc:08X}')
+        offset += page_size
+        if offset >= size:
+            offset = 0
+    return lines
+
+
+def check_boot(binary):
+    """(name, error message or None) for each check of the start-up"""
+    loader = os.path.join(host_c.C64_ROM_DIR, 'loader_rom.bin')
+    with open(loader, 'rb') as f:
+        crc = zlib.crc32(f.read())
+    results = []
+    for name, loader_crc in (('boot', None), ('boot, zlib CRC', crc)):
+        status, output = host_bench.run(binary, boot=loader, loader_crc=loader_crc)
+        answered = re.search(r'answered after call (\d+) of (\d+)', output)
+        error = None
+        if status != 0 or not output.endswith('OK\n') or not answered:
+            error = output.splitlines()[-1] if output else f'exit status {status}'
+        elif answered.group(1) != answered.group(2):
+            error = f'answered after call {answered.group(1)}, before the last'
+        results.append((name, error))
+    status, output = host_bench.run(binary, boot=loader, loader_crc=crc ^ 1)
+    ok = status == 1 and 'error 7' in output and 'never answered' in output
+    results.append(('boot, bad CRC', None if ok else output.strip() or f'exit status {status}'))
+
+    # main() enables the bus in cart_bus_boot, and only then starts the rest
+    with open(os.path.join(FIRMWARE_DIR, 'c64_pico_ram_interface.c')) as f:
+        source = f.read()
+    body = source[source.index('\nint main() {'):]
+    body = body[:body.index('\n}\n')]
+    boot = body.find('cart_bus_boot(')
+    early = [call for call in ('stdio_usb_init(', 'flash_store_mount(', 'build_copy_routine(',
+                               'load_carts(', 'dma_copy_crc32(')
+             if call not in body or body.index(call) < boot]
+    results.append(('main() order', f'cart_bus_boot isn\'t before {", ".join(early)}'
+                    if boot < 0 or early else None))
+    return results
+
+
+def main():
+    failures = 0
+
+    defines = header_defines()
+    programs = {}
+    for name in ['address_decoder', 'read', 'command']:
+        programs.update(pioparse.parse(os.path.join(FIRMWARE_DIR, name + '.pio')))
+    checks = [
+        ('ADDRESS_DECODER_LENGTH', len(programs['address_decoder'].instructions)),
+        ('READ_LENGTH', len(programs['read'].instructions)),
+        ('COMMAND_LENGTH', len(programs['command'].instructions)),
+        ('COMMAND_PREFIX', programs['address_decoder'].defines['COMMAND_PREFIX']),
+        ('UNLOCK_MAGIC', programs['command'].defines['UNLOCK_MAGIC']),
+    ]
+    for name, value in checks:
+        ok = defines.get(name) == value
+        print(f'HAL_HOST_{name} {value:#x}' + ('' if ok else f'  FAIL: {defines.get(name)}'))
+        failures += not ok
+
+    with tempfile.TemporaryDirectory() as build_dir:
+        binary = host_bench.build(build_dir, ['-O2'])
+
+        for layout, page_size in [('linear', WINDOW_SIZE), ('immediate', CHUNK_SIZE)]:
+            for size in [1, page_size, 2500, 17 * 1024, 0x10000]:
+                pages = -(-size // page_size) * 2 + 1
+                status, output = host_bench.run(binary, layout=layout, size=size, pages=pages,
+                                                crcs=True)
+                crcs = [line for line in output.splitlines() if line.startswith('page ')]
+                error = None
+                if status != 0 or not output.endswith('OK\n'):
+                    error = output.splitlines()[-1] if output else f'exit status {status}'
+                elif crcs != expected_crcs(size, page_size, pages):
+                    error = 'CRCs differ'
+                print(f'{layout} {size} bytes, {pages} pages'
+                      + (f'  FAIL: {error}' if error else ''))
+                failures += bool(error)
+
+        for name, error in check_boot(binary):
+            print(name + (f'  FAIL: {error}' if error else ''))
+            failures += bool(error)
+
+        def reads(output):
+            return [line for line in output.splitlines() if line.startswith('C64:')]
+
+        first = host_bench.run(binary, layout='immediate', pages=20)[1]
+        again = host_bench.run(binary, layout='immediate', pages=20)[1]
+        ok = reads(first) and reads(first) == reads(again)
+        print('repeatable' + ('' if ok else f'  FAIL: {reads(first)} {reads(again)}'))
+        failures += not ok
+
+        for name, options in [('no pages', {'pages': 0}), ('no stream', {'size': 0}),
+                              ('stream too big', {'size': 0x10001}), ('layout', {'layout': 'x'})]:
+            status = host_bench.run(binary, **options)[0]
+            print(f'refuse {name}' + ('' if status == 2 else f'  FAIL: exit status {status}'))
+            failures += status != 2
+
+    print(f'{failures} failed' if failures else 'all OK')
+    sys.exit(1 if failures else 0)
+
+
+if __name__ == '__main__':
+    main()
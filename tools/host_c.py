@@ -0,0 +1,45 @@
+"""Build firmware sources for the host, for the tests to call through ctypes.
+
+The firmware keeps the logic worth testing in plain C files with no Pico SDK dependencies, so
+they compile with the host's C compiler ($CC, default cc) into a shared library:
+
+    lib = host_c.load(build_dir, 'activity.c')
+    lib.activity_export.restype = ctypes.c_size_t
+
+header_define() reads a #define from a firmware header, so a test can check a limit or a
+constant without copying it.
+"""
+import ctypes
+import os
+import re
+import subprocess
+
+FIRMWARE_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'firmware')
+C64_ROM_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'c64-rom')
+
+
+def compile_library(build_dir, *sources, flags=()):
+    """Compile firmware sources into a shared library in build_dir, and return its path"""
+    name = os.path.splitext(os.path.basename(sources[0]))[0]
+    library = os.path.join(build_dir, f'lib{name}.so')
+    subprocess.run([os.environ.get('CC', 'cc'), '-shared', '-fPIC', '-O2', '-Wall', *flags,
+                    '-o', library, *(os.path.join(FIRMWARE_DIR, source) for source in sources)],
+                   check=True)
+    return library
+
+
+def load(build_dir, *sources, flags=()):
+    """Compile firmware sources for the host and load them"""
+    return ctypes.CDLL(compile_library(build_dir, *sources, flags=flags))
+
+
+def header_define(header, name, names=None):
+    """The value of a #define in a firmware header: a number, or an expression of numbers and
+    the names in the names dict"""
+    with open(os.path.join(FIRMWARE_DIR, header)) as f:
+        match = re.search(rf'^#define {name} (.+?)\s*(//.*)?$', f.read(), re.MULTILINE)
+    if not match:
+        raise KeyError(f'no #define {name} in {header}')
+    expression = re.sub(r'\b(0x[0-9a-fA-F]+|\d+)[uU]?[lL]*\b', r'\1', match.group(1))
+    expression = expression.replace('/', '//')     # C's integer division
+    return eval(expression, {'__builtins__': {}}, dict(names or {}))
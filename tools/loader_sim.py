@@ -0,0 +1,232 @@
+#!/usr/bin/env python
+"""Run loader_rom.bin on an emulated 6502 and time the NUFLI load.
+
+The loader runs against c64cart.Cartridge, with the ROM window set up like main() and
+CMD_NEXT_PAGE moving the next 1K of raspi.nuf into the window.  The run ends when the loader
+jumps to the NUFLI displayer, and then the image at $2000-$79FF must match raspi.nuf.
+
+--layout picks how the image is sent, like LAYOUT in the firmware's asset manifest: "linear"
+pages the image through the window for the loader's own copy, "sections" serves a copy routine
+from tools/copy_gen.py at $A000 and pages through its stream, and "immediate" serves each chunk
+as a routine at $A000 with the stubs at $BF00.  Whatever the layout, the loaded image must
+match, and only the loader may write outside it (apart from I/O).
+
+--eight-k puts the switch in the 8K position, where ROMH isn't mapped and $A000 is BASIC: the
+loader must find no ROMH signature, send CMD_NO_ROMH instead of jumping to a copy routine there,
+and load the image with its own copy loop, whatever the layout.
+
+--prg serves a .prg from the catalog instead, the way the "run" USB command does: it's parsed by
+tools/prg.py and always sent with the immediate layout, and the run ends at its start address.
+
+Reports the total cycles and a breakdown by loop.  Loops are found from backward branches;
+pass the KickAssembler .vs file (built with -vicesymbols) to label them.  Cycle counts are
+CPU cycles only: the KERNAL calls are stubbed out and VIC-II badlines aren't modelled.
+
+    python tools/loader_sim.py --symbols c64-rom/loader_rom.vs
+    python tools/loader_sim.py --prg game.prg
+"""
+import argparse
+import os
+import sys
+
+import c64cart
+import copy_gen
+import mos6502
+import prg
+
+C64_ROM_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'c64-rom')
+
+NUFLI_OFFSET = 0x400
+NUFLI_WINDOW_SIZE = 0x400
+CMD_NEXT_PAGE = 0x01
+CMD_NO_ROMH = 0x08
+MAILBOX_COPY_ROUTINE = 0x809
+COPY_ROUTINE_OFFSET = 0x2000
+STUBS_OFFSET = 0x3f00
+ROMH_SIGNATURE_OFFSET = 0x3ffc
+ROMH_SIGNATURE = b'ROMH'
+KERNAL_STUBS = (0xff81, 0xff84)  # CINT, IOINIT
+
+
+def read_symbols(path):
+    """Address -> label from a VICE symbol file ("al C:8021 .copy1k")."""
+    symbols = {}
+    if path:
+        with open(path) as f:
+            for line in f:
+                words = line.split()
+                if len(words) == 3 and words[0] == 'al':
+                    symbols[int(words[1].split(':')[-1], 16)] = words[2].lstrip('.')
+    return symbols
+
+
+class LoaderCartridge(c64cart.Cartridge):
+    """The cartridge with main()'s paging, serving image to be loaded at config.dest."""
+
+    def __init__(self, loader, image, config, layout, video='pal', command_us=20.0,
+                 eight_k=False):
+        super().__init__(loader, video=video, eight_k=eight_k)
+        self.layout = layout
+        self.boot_layout = layout
+        self.eight_k = eight_k
+        self.image = image
+        self.config = config
+        self.stream = image
+        self.page_size = NUFLI_WINDOW_SIZE
+        if self.layout == 'sections':
+            code, self.stream = copy_gen.generate(image, self.config)
+            self.rom[COPY_ROUTINE_OFFSET:COPY_ROUTINE_OFFSET + len(code)] = code
+        elif self.layout == 'immediate':
+            self.rom[STUBS_OFFSET:STUBS_OFFSET + copy_gen.STUBS_SIZE] = copy_gen.stubs(self.config)
+            self.page_size = copy_gen.CHUNK_SIZE
+        self.rom[MAILBOX_COPY_ROUTINE] = 0x00 if self.layout == 'linear' else 0xff
+        self.rom[ROMH_SIGNATURE_OFFSET:ROMH_SIGNATURE_OFFSET + 4] = ROMH_SIGNATURE
+        self.no_romh = False        # whether the loader sent CMD_NO_ROMH
+        self.outside_writes = set()  # RAM outside the image written by the copy routine
+        self.stream_offset = 0
+        self.load_window()
+        # C64 RAM isn't cleared at power on, so a section the loader misses can't match by luck
+        self.ram[config.dest:config.dest + len(image)] = bytes([0xaa]) * len(image)
+        self.on_command(CMD_NEXT_PAGE, command_us, LoaderCartridge.next_page)
+        self.on_command(CMD_NO_ROMH, command_us, LoaderCartridge.send_linear)
+
+    def load_window(self):
+        if self.layout == 'immediate':
+            code = copy_gen.chunk(self.stream, self.stream_offset, self.config)
+            self.rom[COPY_ROUTINE_OFFSET:COPY_ROUTINE_OFFSET + len(code)] = code
+            return
+        window = self.stream[self.stream_offset:self.stream_offset + NUFLI_WINDOW_SIZE]
+        self.rom[NUFLI_OFFSET:NUFLI_OFFSET + NUFLI_WINDOW_SIZE] = \
+            window + bytes(NUFLI_WINDOW_SIZE - len(window))
+
+    def send_linear(self):
+        """CMD_NO_ROMH, like handle_no_romh(): page the image through the window from the start"""
+        self.no_romh = True
+        self.layout = 'linear'
+        self.stream = self.image
+        self.page_size = NUFLI_WINDOW_SIZE
+        self.stream_offset = 0
+        self.rom[MAILBOX_COPY_ROUTINE] = 0x00
+        self.load_window()
+
+    def next_page(self):
+        self.stream_offset += self.page_size
+        if self.stream_offset >= len(self.stream):
+            self.stream_offset = 0
+        self.load_window()
+
+    def write(self, address, value):
+        image = range(self.config.dest, self.config.dest + len(self.image))
+        io = range(0xd000, 0xe000)
+        if self.cpu.last_opcode_pc >= 0xa000 and address not in image and address not in io \
+                and address != 0x01:  # the CPU port, to bank I/O out
+            self.outside_writes.add(address)
+        super().write(address, value)
+
+
+def run(cpu, stop_pc, max_cycles):
+    """Run until stop_pc, returning cycles per instruction address and taken backward jumps."""
+    pc_cycles = {}
+    loops = {}  # (target, branch address) -> times taken
+    while cpu.pc != stop_pc:
+        if cpu.cycles > max_cycles:
+            raise RuntimeError(f'still running after {max_cycles} cycles, at ${cpu.pc:04X}')
+        pc = cpu.pc
+        pc_cycles[pc] = pc_cycles.get(pc, 0) + cpu.step()
+        if cpu.pc < pc and cpu.pc != stop_pc and \
+                mos6502.OPCODES[cpu.read(pc)][0] not in ('jsr', 'rts', 'rti'):
+            loops[(cpu.pc, pc)] = loops.get((cpu.pc, pc), 0) + 1
+    return pc_cycles, loops
+
+
+def load(loader, image, config, layout, video='pal', command_us=20.0, max_cycles=10_000_000,
+         eight_k=False):
+    """Boot the loader with the cartridge serving image, and run it to config.exec_address.
+    Returns the cartridge, the CPU, and run()'s cycles and loops."""
+    cartridge = LoaderCartridge(loader, image, config, layout, video, command_us, eight_k)
+    for address in KERNAL_STUBS:
+        cartridge.ram[address] = 0x60  # rts
+    cpu = mos6502.Cpu(cartridge)
+    cartridge.attach(cpu)
+    cpu.pc = cpu.read16(0x8000)  # the KERNAL jumps through the cartridge's cold start vector
+    pc_cycles, loops = run(cpu, config.exec_address, max_cycles)
+    return cartridge, cpu, pc_cycles, loops
+
+
+def check(cartridge):
+    """An error message if the image didn't load cleanly, otherwise None"""
+    dest, image = cartridge.config.dest, cartridge.image
+    if cartridge.no_romh != (cartridge.eight_k and cartridge.boot_layout != 'linear'):
+        return 'loader ' + ('sent' if cartridge.no_romh else 'didn\'t send') + ' CMD_NO_ROMH'
+    loaded = bytes(cartridge.ram[dest:dest + len(image)])
+    if loaded != image:
+        mismatch = next(i for i in range(len(image)) if loaded[i] != image[i])
+        return f'loaded image differs at ${dest + mismatch:04X}'
+    if cartridge.outside_writes:
+        return f'copy routine wrote outside the image, at ${min(cartridge.outside_writes):04X}'
+    return None
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--loader', default=os.path.join(C64_ROM_DIR, 'loader_rom.bin'))
+    parser.add_argument('--nufli', default=os.path.join(C64_ROM_DIR, 'raspi.nuf'))
+    parser.add_argument('--prg', help='serve this .prg instead of the NUFLI image')
+    parser.add_argument('--symbols', help='VICE symbol file (.vs) for the loader')
+    parser.add_argument('--video', choices=c64cart.PHI2_HZ, default='pal')
+    parser.add_argument('--command-us', type=float, default=20.0,
+                        help='time for the Pico to handle CMD_NEXT_PAGE (default %(default)s)')
+    parser.add_argument('--dest', type=lambda s: int(s, 0), default=0x2000)
+    parser.add_argument('--exec', dest='exec_address', type=lambda s: int(s, 0),
+                        help='start address (default $3000, or from the .prg)')
+    parser.add_argument('--max-cycles', type=int, default=10_000_000)
+    parser.add_argument('--eight-k', action='store_true',
+                        help='the switch in the 8K position, with no ROMH')
+    parser.add_argument('--layout', choices=('linear', 'sections', 'immediate'),
+                        default='linear', help='how the image is sent (default %(default)s)')
+    args = parser.parse_args()
+
+    with open(args.loader, 'rb') as f:
+        loader = f.read()
+    if args.prg:
+        with open(args.prg, 'rb') as f:
+            try:
+                program = prg.parse(f.read(), args.exec_address)
+            except prg.PrgError as e:
+                sys.exit(f'{args.prg}: {e}')
+        if args.eight_k:
+            parser.error('a PRG needs the 16K position')
+        name, image, layout = os.path.basename(args.prg), program.data, 'immediate'
+        config = copy_gen.Config(dest=program.load, exec_address=program.exec_address)
+    else:
+        with open(args.nufli, 'rb') as f:
+            image = f.read()[2:]
+        name, layout = os.path.basename(args.nufli), args.layout
+        config = copy_gen.Config(dest=args.dest, exec_address=args.exec_address or 0x3000)
+    symbols = read_symbols(args.symbols)
+
+    cartridge, cpu, pc_cycles, loops = load(loader, image, config, layout, args.video,
+                                            args.command_us, args.max_cycles, args.eight_k)
+    total = cpu.cycles
+    print(f'{total} cycles to ${config.exec_address:04X} '
+          f'({total / c64cart.PHI2_HZ[args.video] * 1000:.2f} ms {args.video.upper()})')
+    print(f'{cartridge.command_reads} command area reads ({cartridge.busy_reads} busy, '
+          f'{cartridge.filtered_reads} filtered), {len(cartridge.commands)} commands')
+
+    print('loops (nested loops are included in their outer loop):')
+    for (start, end), taken in sorted(loops.items()):
+        cycles = sum(c for pc, c in pc_cycles.items() if start <= pc <= end)
+        label = symbols.get(start, f'${start:04X}')
+        print(f'  {label:>12} ${start:04X}-${end:04X}: {taken + 1:6} passes, '
+              f'{cycles:8} cycles ({100 * cycles / total:5.1f}%)')
+
+    error = check(cartridge)
+    if error:
+        print(f'FAIL: {error}')
+        sys.exit(1)
+    print(f'${config.dest:04X}-${config.dest + len(image) - 1:04X} matches {name}')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,356 @@
+"""Cycle-counting 6502 emulator (documented opcodes only) for running C64 code on the host.
+
+Memory access goes through a bus object with read(address) and write(address, value), so
+tests can model the cartridge's ROM window and command area.  cycles counts CPU cycles,
+including the extra cycles for page crossings and taken branches.
+"""
+
+C, Z, I, D, B, U, V, N = (1 << n for n in range(8))
+
+
+class RamBus:
+    """Flat 64K of RAM."""
+
+    def __init__(self):
+        self.ram = bytearray(65536)
+
+    def read(self, address):
+        return self.ram[address]
+
+    def write(self, address, value):
+        self.ram[address] = value
+
+
+class Cpu:
+    def __init__(self, bus):
+        self.bus = bus
+        self.a = self.x = self.y = 0
+        self.s = 0xff
+        self.p = U | I
+        self.pc = 0
+        self.cycles = 0
+        self.last_opcode_pc = 0
+
+    # -- memory helpers --
+
+    def read(self, address):
+        return self.bus.read(address & 0xffff)
+
+    def write(self, address, value):
+        self.bus.write(address & 0xffff, value & 0xff)
+
+    def read16(self, address):
+        return self.read(address) | self.read(address + 1) << 8
+
+    def read16_zp(self, address):
+        return self.read(address & 0xff) | self.read((address + 1) & 0xff) << 8
+
+    def fetch(self):
+        value = self.read(self.pc)
+        self.pc = (self.pc + 1) & 0xffff
+        return value
+
+    def fetch16(self):
+        low = self.fetch()
+        return low | self.fetch() << 8
+
+    def push(self, value):
+        self.write(0x100 | self.s, value)
+        self.s = (self.s - 1) & 0xff
+
+    def pull(self):
+        self.s = (self.s + 1) & 0xff
+        return self.read(0x100 | self.s)
+
+    def set_nz(self, value):
+        self.p = (self.p & ~(N | Z)) | (value & N) | (Z if value == 0 else 0)
+        return value
+
+    def flag(self, bit, on):
+        self.p = (self.p | bit) if on else (self.p & ~bit)
+
+    # -- addressing modes: return (address, page_crossed) --
+
+    def mode_address(self, mode):
+        if mode == 'zp':
+            return self.fetch(), False
+        if mode == 'zpx':
+            return (self.fetch() + self.x) & 0xff, False
+        if mode == 'zpy':
+            return (self.fetch() + self.y) & 0xff, False
+        if mode == 'abs':
+            return self.fetch16(), False
+        if mode == 'abx':
+            base = self.fetch16()
+            address = (base + self.x) & 0xffff
+            return address, (base ^ address) & 0xff00 != 0
+        if mode == 'aby':
+            base = self.fetch16()
+            address = (base + self.y) & 0xffff
+            return address, (base ^ address) & 0xff00 != 0
+        if mode == 'izx':
+            return self.read16_zp(self.fetch() + self.x), False
+        if mode == 'izy':
+            base = self.read16_zp(self.fetch())
+            address = (base + self.y) & 0xffff
+            return address, (base ^ address) & 0xff00 != 0
+        raise ValueError(mode)
+
+    # -- ALU --
+
+    def adc(self, value):
+        carry = self.p & C
+        if self.p & D:
+            low = (self.a & 0x0f) + (value & 0x0f) + carry
+            if low > 9:
+                low += 6
+            high = (self.a >> 4) + (value >> 4) + (low > 0x0f)
+            binary = (self.a + value + carry) & 0xff
+            self.flag(Z, binary == 0)
+            self.flag(N, high & 8)
+            self.flag(V, (~(self.a ^ value) & (self.a ^ (high << 4)) & 0x80))
+            if high > 9:
+                high += 6
+            self.flag(C, high > 0x0f)
+            self.a = ((high << 4) | (low & 0x0f)) & 0xff
+            return
+        result = self.a + value + carry
+        self.flag(C, result > 0xff)
+        self.flag(V, (~(self.a ^ value) & (self.a ^ result) & 0x80))
+        self.a = self.set_nz(result & 0xff)
+
+    def sbc(self, value):
+        if self.p & D:
+            borrow = 1 - (self.p & C)
+            binary = self.a - value - borrow
+            low = (self.a & 0x0f) - (value & 0x0f) - borrow
+            high = (self.a >> 4) - (value >> 4)
+            if low < 0:
+                low -= 6
+                high -= 1
+            if high < 0:
+                high -= 6
+            self.flag(C, binary >= 0)
+            self.flag(V, ((self.a ^ value) & (self.a ^ binary) & 0x80))
+            self.set_nz(binary & 0xff)
+            self.a = ((high << 4) | (low & 0x0f)) & 0xff
+            return
+        self.adc(value ^ 0xff)
+
+    def compare(self, register, value):
+        result = register - value
+        self.flag(C, result >= 0)
+        self.set_nz(result & 0xff)
+
+    # -- execution --
+
+    def branch(self, condition):
+        offset = self.fetch()
+        if condition:
+            target = (self.pc + (offset - 256 if offset & 0x80 else offset)) & 0xffff
+            self.cycles += 2 if (target ^ self.pc) & 0xff00 else 1
+            self.pc = target
+
+    def step(self):
+        """Run one instruction, returning its cycle count."""
+        start = self.cycles
+        self.last_opcode_pc = self.pc
+        opcode = self.fetch()
+        try:
+            name, mode, cycles = OPCODES[opcode]
+        except KeyError:
+            raise RuntimeError(f'illegal opcode ${opcode:02X} at ${self.last_opcode_pc:04X}')
+        self.cycles += cycles
+        getattr(self, 'op_' + name)(mode)
+        return self.cycles - start
+
+    def operand(self, mode, penalty=True):
+        if mode == 'imm':
+            return self.fetch()
+        address, crossed = self.mode_address(mode)
+        if crossed and penalty:
+            self.cycles += 1
+        return self.read(address)
+
+    def modify(self, mode, function):
+        if mode == 'acc':
+            self.a = self.set_nz(function(self.a))
+            return
+        address, _ = self.mode_address(mode)
+        self.write(address, self.set_nz(function(self.read(address))))
+
+    def store(self, mode, value):
+        address, _ = self.mode_address(mode)
+        self.write(address, value)
+
+    # loads and stores
+    def op_lda(self, mode): self.a = self.set_nz(self.operand(mode))
+    def op_ldx(self, mode): self.x = self.set_nz(self.operand(mode))
+    def op_ldy(self, mode): self.y = self.set_nz(self.operand(mode))
+    def op_sta(self, mode): self.store(mode, self.a)
+    def op_stx(self, mode): self.store(mode, self.x)
+    def op_sty(self, mode): self.store(mode, self.y)
+
+    # transfers
+    def op_tax(self, mode): self.x = self.set_nz(self.a)
+    def op_tay(self, mode): self.y = self.set_nz(self.a)
+    def op_txa(self, mode): self.a = self.set_nz(self.x)
+    def op_tya(self, mode): self.a = self.set_nz(self.y)
+    def op_tsx(self, mode): self.x = self.set_nz(self.s)
+    def op_txs(self, mode): self.s = self.x
+
+    # stack
+    def op_pha(self, mode): self.push(self.a)
+    def op_php(self, mode): self.push(self.p | B | U)
+    def op_pla(self, mode): self.a = self.set_nz(self.pull())
+    def op_plp(self, mode): self.p = (self.pull() & ~B) | U
+
+    # arithmetic and logic
+    def op_adc(self, mode): self.adc(self.operand(mode))
+    def op_sbc(self, mode): self.sbc(self.operand(mode))
+    def op_and(self, mode): self.a = self.set_nz(self.a & self.operand(mode))
+    def op_ora(self, mode): self.a = self.set_nz(self.a | self.operand(mode))
+    def op_eor(self, mode): self.a = self.set_nz(self.a ^ self.operand(mode))
+    def op_cmp(self, mode): self.compare(self.a, self.operand(mode))
+    def op_cpx(self, mode): self.compare(self.x, self.operand(mode))
+    def op_cpy(self, mode): self.compare(self.y, self.operand(mode))
+
+    def op_bit(self, mode):
+        value = self.operand(mode)
+        self.flag(Z, (self.a & value) == 0)
+        self.p = (self.p & ~(N | V)) | (value & (N | V))
+
+    # increments, decrements and shifts
+    def op_inc(self, mode): self.modify(mode, lambda v: (v + 1) & 0xff)
+    def op_dec(self, mode): self.modify(mode, lambda v: (v - 1) & 0xff)
+    def op_inx(self, mode): self.x = self.set_nz((self.x + 1) & 0xff)
+    def op_iny(self, mode): self.y = self.set_nz((self.y + 1) & 0xff)
+    def op_dex(self, mode): self.x = self.set_nz((self.x - 1) & 0xff)
+    def op_dey(self, mode): self.y = self.set_nz((self.y - 1) & 0xff)
+
+    def op_asl(self, mode):
+        def asl(v):
+            self.flag(C, v & 0x80)
+            return (v << 1) & 0xff
+        self.modify(mode, asl)
+
+    def op_lsr(self, mode):
+        def lsr(v):
+            self.flag(C, v & 1)
+            return v >> 1
+        self.modify(mode, lsr)
+
+    def op_rol(self, mode):
+        def rol(v):
+            carry = self.p & C
+            self.flag(C, v & 0x80)
+            return ((v << 1) | carry) & 0xff
+        self.modify(mode, rol)
+
+    def op_ror(self, mode):
+        def ror(v):
+            carry = self.p & C
+            self.flag(C, v & 1)
+            return (v >> 1) | (carry << 7)
+        self.modify(mode, ror)
+
+    # jumps and calls
+    def op_jmp(self, mode):
+        if mode == 'abs':
+            self.pc = self.fetch16()
+        else:
+            pointer = self.fetch16()
+            # The 6502 doesn't carry into the high byte of the pointer
+            self.pc = self.read(pointer) | self.read((pointer & 0xff00) | ((pointer + 1) & 0xff)) << 8
+
+    def op_jsr(self, mode):
+        target = self.fetch16()
+        return_address = (self.pc - 1) & 0xffff
+        self.push(return_address >> 8)
+        self.push(return_address & 0xff)
+        self.pc = target
+
+    def op_rts(self, mode):
+        low = self.pull()
+        self.pc = ((self.pull() << 8 | low) + 1) & 0xffff
+
+    def op_rti(self, mode):
+        self.p = (self.pull() & ~B) | U
+        low = self.pull()
+        self.pc = self.pull() << 8 | low
+
+    def op_brk(self, mode):
+        self.pc = (self.pc + 1) & 0xffff
+        self.push(self.pc >> 8)
+        self.push(self.pc & 0xff)
+        self.push(self.p | B | U)
+        self.p |= I
+        self.pc = self.read16(0xfffe)
+
+    # branches
+    def op_bpl(self, mode): self.branch(not self.p & N)
+    def op_bmi(self, mode): self.branch(self.p & N)
+    def op_bvc(self, mode): self.branch(not self.p & V)
+    def op_bvs(self, mode): self.branch(self.p & V)
+    def op_bcc(self, mode): self.branch(not self.p & C)
+    def op_bcs(self, mode): self.branch(self.p & C)
+    def op_bne(self, mode): self.branch(not self.p & Z)
+    def op_beq(self, mode): self.branch(self.p & Z)
+
+    # flags
+    def op_clc(self, mode): self.p &= ~C
+    def op_sec(self, mode): self.p |= C
+    def op_cli(self, mode): self.p &= ~I
+    def op_sei(self, mode): self.p |= I
+    def op_cld(self, mode): self.p &= ~D
+    def op_sed(self, mode): self.p |= D
+    def op_clv(self, mode): self.p &= ~V
+    def op_nop(self, mode): pass
+
+
+def _opcode_table():
+    table = {}
+
+    def add(name, modes):
+        for mode, (opcode, cycles) in modes.items():
+            table[opcode] = (name, mode, cycles)
+
+    # Read instructions: abx/aby/izy get +1 cycle on a page crossing (see Cpu.operand)
+    for name, base in (('ora', 0x00), ('and', 0x20), ('eor', 0x40), ('adc', 0x60),
+                       ('lda', 0xa0), ('cmp', 0xc0), ('sbc', 0xe0)):
+        add(name, {'izx': (base + 0x01, 6), 'zp': (base + 0x05, 3), 'imm': (base + 0x09, 2),
+                   'abs': (base + 0x0d, 4), 'izy': (base + 0x11, 5), 'zpx': (base + 0x15, 4),
+                   'aby': (base + 0x19, 4), 'abx': (base + 0x1d, 4)})
+    add('sta', {'izx': (0x81, 6), 'zp': (0x85, 3), 'abs': (0x8d, 4), 'izy': (0x91, 6),
+                'zpx': (0x95, 4), 'aby': (0x99, 5), 'abx': (0x9d, 5)})
+    add('stx', {'zp': (0x86, 3), 'abs': (0x8e, 4), 'zpy': (0x96, 4)})
+    add('sty', {'zp': (0x84, 3), 'abs': (0x8c, 4), 'zpx': (0x94, 4)})
+    add('ldx', {'imm': (0xa2, 2), 'zp': (0xa6, 3), 'abs': (0xae, 4), 'zpy': (0xb6, 4),
+                'aby': (0xbe, 4)})
+    add('ldy', {'imm': (0xa0, 2), 'zp': (0xa4, 3), 'abs': (0xac, 4), 'zpx': (0xb4, 4),
+                'abx': (0xbc, 4)})
+    add('cpx', {'imm': (0xe0, 2), 'zp': (0xe4, 3), 'abs': (0xec, 4)})
+    add('cpy', {'imm': (0xc0, 2), 'zp': (0xc4, 3), 'abs': (0xcc, 4)})
+    add('bit', {'zp': (0x24, 3), 'abs': (0x2c, 4)})
+    for name, base in (('asl', 0x00), ('rol', 0x20), ('lsr', 0x40), ('ror', 0x60)):
+        add(name, {'zp': (base + 0x06, 5), 'acc': (base + 0x0a, 2), 'abs': (base + 0x0e, 6),
+                   'zpx': (base + 0x16, 6), 'abx': (base + 0x1e, 7)})
+    add('dec', {'zp': (0xc6, 5), 'abs': (0xce, 6), 'zpx': (0xd6, 6), 'abx': (0xde, 7)})
+    add('inc', {'zp': (0xe6, 5), 'abs': (0xee, 6), 'zpx': (0xf6, 6), 'abx': (0xfe, 7)})
+    add('jmp', {'abs': (0x4c, 3), 'ind': (0x6c, 5)})
+    for name, opcode in (('bpl', 0x10), ('bmi', 0x30), ('bvc', 0x50), ('bvs', 0x70),
+                         ('bcc', 0x90), ('bcs', 0xb0), ('bne', 0xd0), ('beq', 0xf0)):
+        add(name, {'rel': (opcode, 2)})
+    for name, opcode, cycles in (
+            ('brk', 0x00, 7), ('php', 0x08, 3), ('clc', 0x18, 2), ('jsr', 0x20, 6),
+            ('plp', 0x28, 4), ('sec', 0x38, 2), ('rti', 0x40, 6), ('pha', 0x48, 3),
+            ('cli', 0x58, 2), ('rts', 0x60, 6), ('pla', 0x68, 4), ('sei', 0x78, 2),
+            ('dey', 0x88, 2), ('txa', 0x8a, 2), ('tya', 0x98, 2), ('txs', 0x9a, 2),
+            ('tay', 0xa8, 2), ('tax', 0xaa, 2), ('clv', 0xb8, 2), ('tsx', 0xba, 2),
+            ('iny', 0xc8, 2), ('dex', 0xca, 2), ('cld', 0xd8, 2), ('inx', 0xe8, 2),
+            ('nop', 0xea, 2), ('sed', 0xf8, 2)):
+        add(name, {'imp': (opcode, cycles)})
+    return table
+
+
+OPCODES = _opcode_table()
@@ -0,0 +1,175 @@
+#!/usr/bin/env python
+"""Test delta sync end to end: tools/pico_sync.py against firmware/page_sync.c.
+
+page_sync.c is compiled with the host's C compiler ($CC, default cc) and called through ctypes
+as the Pico's "manifest" and "patch" commands.  For each case the Pico's buffer and the host's
+image start out different by a few edited pages, a whole image, nothing or a short tail page.
+pico_sync.py reads the manifest page_sync.c prints, picks the pages to send, and its patch
+lines go through page_sync_apply(); after that the buffer must be the image, with no other
+page written.  Checksums must be FNV-1a's published values, and patches that are the wrong
+length, not hex or past the end must be refused and leave the buffer alone:
+
+    python tools/page_sync_test.py
+"""
+import ctypes
+import os
+import random
+import sys
+import tempfile
+
+import host_c
+import pico_sync
+
+PAGE_SIZE = host_c.header_define('page_sync.h', 'PAGE_SYNC_PAGE_SIZE')
+ROM_SIZE = 0x4000
+
+# 32 bit FNV-1a of some strings, from the reference's test vectors
+KNOWN_CHECKSUMS = [(b'', 0x811c9dc5), (b'a', 0xe40c292c), (b'foobar', 0xbf9cf968)]
+
+
+class Port:
+    """Lines the Pico printed, read back the way pico_sync.py reads the serial port"""
+
+    def __init__(self, text):
+        self.lines = text.splitlines(True)
+
+    def readline(self):
+        return self.lines.pop(0).encode() if self.lines else b''
+
+
+class Pico:
+    """A target buffer, with page_sync.c handling "manifest" and "patch" for it"""
+
+    def __init__(self, lib, data):
+        self.lib = lib
+        self.buffer = ctypes.create_string_buffer(bytes(data), len(data))
+        self.patched = []
+
+    def manifest(self):
+        """What "manifest" prints, from page_sync_print_manifest()'s stdout"""
+        with tempfile.TemporaryFile() as out:
+            sys.stdout.flush()
+            saved = os.dup(1)
+            os.dup2(out.fileno(), 1)
+            try:
+                self.lib.page_sync_print_manifest(self.buffer, ctypes.c_size_t(len(self.buffer)))
+                ctypes.CDLL(None).fflush(None)
+            finally:
+                os.dup2(saved, 1)
+                os.close(saved)
+            out.seek(0)
+            return out.read().decode()
+
+    def patch(self, line):
+        """A "patch" line, split like on_usb_patch().  Returns whether it was applied."""
+        _, _, page, hex_data = line.split()
+        applied = self.lib.page_sync_apply(self.buffer, ctypes.c_size_t(len(self.buffer)),
+                                           int(page), hex_data.encode())
+        if applied:
+            self.patched.append(int(page))
+        return applied
+
+    def data(self):
+        return self.buffer.raw
+
+
+def checksum(lib, data):
+    return lib.page_sync_checksum(bytes(data), ctypes.c_size_t(len(data)))
+
+
+def edited(rng, data, pages):
+    data = bytearray(data)
+    for page in pages:
+        offset = page * PAGE_SIZE + rng.randrange(min(PAGE_SIZE, len(data) - page * PAGE_SIZE))
+        data[offset] ^= 1 + rng.randrange(255)
+    return bytes(data)
+
+
+def cases():
+    """(name, target, the Pico's buffer, the host's image, pages that must be sent)"""
+    rng = random.Random(26)
+    nufli = bytes(rng.randrange(256) for _ in range(0x5a00 + 100))
+    pages = (len(nufli) + PAGE_SIZE - 1) // PAGE_SIZE
+    yield 'nothing changed', 'nufli', nufli, nufli, []
+    yield 'three pages', 'nufli', nufli, edited(rng, nufli, [0, 7, 40]), [0, 7, 40]
+    yield 'short last page', 'nufli', nufli, edited(rng, nufli, [pages - 1]), [pages - 1]
+    yield 'everything', 'nufli', nufli, edited(rng, nufli, range(pages)), list(range(pages))
+
+    rom = bytes(rng.randrange(256) for _ in range(ROM_SIZE))
+    # A smaller image goes at the start of the window, padded to a whole page with zeros
+    image = edited(rng, rom[:1000], [1])
+    yield 'rom, image smaller', 'rom', rom, image, [1, 3]
+    padded = rom[:3 * PAGE_SIZE + 100] + bytes(PAGE_SIZE - 100)
+    yield 'rom, padding matches', 'rom', padded + rom[len(padded):], \
+        padded[:3 * PAGE_SIZE + 100], []
+
+
+def check_sync(lib, target, remote, local, expected):
+    """Error messages for one sync"""
+    errors = []
+    pico = Pico(lib, remote)
+    manifest = pico_sync.read_response(Port(pico.manifest()))
+    if manifest != pico_sync.manifest(remote):
+        errors.append('page_sync.c and pico_sync.py checksum differently')
+    data, pages = pico_sync.pages_to_send(target, local, manifest)
+    if pages != expected:
+        errors.append(f'sends pages {pages}, expected {expected}')
+    for page in pages:
+        if not pico.patch(pico_sync.patch_line(target, data, page)):
+            errors.append(f'page {page} refused')
+    if pico.data()[:len(data)] != data or pico.data()[len(data):] != remote[len(data):]:
+        errors.append('buffer differs from the image after the sync')
+    if pico.patched != pages:
+        errors.append(f'patched {pico.patched}')
+    # A second sync finds nothing to send
+    _, again = pico_sync.pages_to_send(target, local,
+                                       pico_sync.read_response(Port(pico.manifest())))
+    if again:
+        errors.append(f'sends {again} again')
+    return errors
+
+
+def check_patches(lib):
+    """Error messages for patches page_sync_apply() must refuse, and known checksums"""
+    errors = []
+    for data, expected in KNOWN_CHECKSUMS:
+        if checksum(lib, data) != expected or pico_sync.checksum(data) != expected:
+            errors.append(f'checksum of {data!r} is {checksum(lib, data):08x}, '
+                          f'expected {expected:08x}')
+    original = bytes(range(256)) * 2 + bytes(10)
+    page = 'ab' * PAGE_SIZE
+    for name, line in (('short', f'patch nufli 0 {page[:-2]}'),
+                       ('long', f'patch nufli 0 {page}cd'),
+                       ('odd length', f'patch nufli 0 {page[:-1]}'),
+                       ('not hex', f'patch nufli 1 {page[:-2]}zz'),
+                       ('past the end', f'patch nufli 3 {page}'),
+                       ('longer than the tail', f'patch nufli 2 {"00" * 11}')):
+        pico = Pico(lib, original)
+        if pico.patch(line) or pico.data() != original:
+            errors.append(f'{name} patch applied')
+    pico = Pico(lib, original)
+    if not pico.patch(f'patch nufli 2 {"0A" * 10}') or pico.data()[512:] != b'\n' * 10:
+        errors.append('upper case tail page not applied')
+    return errors
+
+
+def main():
+    failures = 0
+    with tempfile.TemporaryDirectory() as build_dir:
+        lib = host_c.load(build_dir, 'page_sync.c')
+        lib.page_sync_checksum.restype = ctypes.c_uint32
+        lib.page_sync_apply.restype = ctypes.c_bool
+        for name, target, remote, local, expected in cases():
+            errors = check_sync(lib, target, remote, local, expected)
+            print(f'{name}: {len(expected)} pages sent' + ''.join(f'  FAIL: {e}' for e in errors))
+            failures += bool(errors)
+        errors = check_patches(lib)
+        print('checksums and refused patches' + ''.join(f'  FAIL: {e}' for e in errors))
+        failures += bool(errors)
+
+    print(f'{failures} failed' if failures else 'all OK')
+    sys.exit(1 if failures else 0)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,96 @@
+#!/usr/bin/env python
+"""Upload only the changed pages of an image to the Pico over USB serial.
+
+The Pico reports a checksum for each 256 byte page of the target buffer ("rom" for the live
+16K window, "nufli" for the image paged through it), and we send a patch for each page whose
+checksum doesn't match our copy.
+"""
+import argparse
+import sys
+
+PAGE_SIZE = 256
+
+
+def checksum(data):
+    """32-bit FNV-1a, matching page_sync_checksum() in the firmware."""
+    h = 0x811c9dc5
+    for b in data:
+        h ^= b
+        h = (h * 0x01000193) & 0xffffffff
+    return h
+
+
+def manifest(data):
+    return [checksum(data[i:i + PAGE_SIZE]) for i in range(0, len(data), PAGE_SIZE)]
+
+
+def changed_pages(local, remote_manifest):
+    """Page numbers of `local` that differ from the remote manifest."""
+    local_manifest = manifest(local)
+    if len(local_manifest) != len(remote_manifest):
+        raise ValueError(f'image has {len(local_manifest)} pages, pico has {len(remote_manifest)}')
+    return [n for n, (a, b) in enumerate(zip(local_manifest, remote_manifest)) if a != b]
+
+
+def pages_to_send(target, data, remote_manifest):
+    """The data as it's sent, and the numbers of its pages that differ from the Pico's"""
+    if target == 'rom':
+        # The ROM window is bigger than any image we put in it, so only compare our pages.
+        # Patches are whole pages, so pad the last one.
+        data += bytes(-len(data) % PAGE_SIZE)
+        remote_manifest = remote_manifest[:len(manifest(data))]
+    return data, changed_pages(data, remote_manifest)
+
+
+def patch_line(target, data, page):
+    return f'patch {target} {page} {data[page * PAGE_SIZE:(page + 1) * PAGE_SIZE].hex()}\n'
+
+
+def read_response(port):
+    """Collect "PAGE" lines until the "OK"/"ERR" line that ends the response."""
+    pages = []
+    while True:
+        line = port.readline().decode('ascii', 'replace').strip()
+        if not line:
+            raise TimeoutError('no response from pico')
+        if line.startswith('PAGE '):
+            _, n, value = line.split()
+            pages.append((int(n), int(value, 16)))
+        elif line.startswith('OK'):
+            return [value for _, value in sorted(pages)]
+        elif line.startswith('ERR'):
+            raise RuntimeError(line)
+        # Anything else is log output from the main loop
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--port', default='/dev/ttyACM0')
+    parser.add_argument('--skip', metavar='N', default=0, type=int,
+                        help='start N bytes into the source file (2 for a .nuf/.prg)')
+    parser.add_argument('--dry-run', action='store_true',
+                        help="only list the pages that would be sent")
+    parser.add_argument('target', choices=['rom', 'nufli'])
+    parser.add_argument('input')
+    args = parser.parse_args()
+
+    import serial  # pyserial, only needed when talking to the hardware
+
+    with open(args.input, 'rb') as f:
+        data = f.read()[args.skip:]
+
+    with serial.Serial(args.port, timeout=2) as port:
+        port.write(f'manifest {args.target}\n'.encode())
+        remote = read_response(port)
+        data, pages = pages_to_send(args.target, data, remote)
+        print(f'{len(pages)} of {len(manifest(data))} pages changed', file=sys.stderr)
+        if args.dry_run:
+            print(' '.join(str(n) for n in pages))
+            return
+        for page in pages:
+            port.write(patch_line(args.target, data, page).encode())
+            read_response(port)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,673 @@
+#!/usr/bin/env python
+"""Cycle-level simulation of the cartridge's PIO programs and read DMA chain.
+
+The .pio sources are parsed and run on a model of PIO0 with the same state machine and pin
+setup as c64_pico_ram_interface.c: two address_decoder state machines (ROMH and ROML), the read
+state machine, and the command state machine.  The read chain's two DMA channels (hal_pico.c)
+are modelled as a fixed number of system clock cycles per transfer, and the channels that count
+each decoder's reads for the activity counters (activity.h) as taking its pushes straight away.  The read_latency state
+machines that "latency on" starts on PIO1 run alongside, since they only watch the pins, and
+tools/capture_test.py steps the capture state machines on a PIO1 of their own with the same pins.
+
+The C64 side is a stream of reads at PAL or NTSC phi2 timing.  For each read, the simulator
+reports the latency from ROML/ROMH going low to OE going low with the data on D0..D7, and
+whether that meets the CPU's data setup deadline.  The exit status is 1 if any read misses its
+deadline, returns the wrong data, gets a count from read_latency that doesn't match its latency,
+or isn't counted once on its ROM line, so it can gate PIO changes:
+
+    python tools/pio_sim.py --video ntsc --sys-clock 125 --reads 2000
+
+The command SM starts locked, so the built-in patterns start with the reads that unlock it (see
+command.pio), and a --trace without them sees every command area read filtered.  The CPU side
+of the guard is modelled too: see CommandGuard and tools/guard_sim.py.
+
+Timing constants for the C64 and the DMA are estimates; see the options for what they are.
+"""
+import argparse
+import os
+import statistics
+import sys
+
+import pioparse
+
+FIRMWARE_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'firmware')
+C64_ROM_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'c64-rom')
+
+# Pin assignments from c64_pico_ram_interface.c
+PIN_D0 = 0
+PIN_A0 = 8
+PIN_A8 = 16
+PIN_ROML = 22
+PIN_ROMH = 26
+PIN_OE = 28
+
+FIFO_DEPTH = 4
+LATENCY_LIMIT = pioparse.parse(os.path.join(FIRMWARE_DIR, 'read_latency.pio'))[
+    'read_latency'].defines['LIMIT']
+PHI2_HZ = {'pal': 985248, 'ntsc': 1022727}
+MASK32 = 0xffffffff
+
+
+def mask(bits):
+    return MASK32 if bits >= 32 else (1 << bits) - 1
+
+
+class StateMachine:
+    def __init__(self, pio, index, program, *, in_base=0, out_base=0, out_count=0,
+                 sideset_base=0, jmp_pin=0, in_shift_right=True, status_tx_lessthan=None,
+                 autopush=None, fifo_depth=FIFO_DEPTH):
+        self.pio = pio
+        self.index = index
+        self.program = program
+        self.in_base = in_base
+        self.out_base = out_base
+        self.out_count = out_count
+        self.sideset_base = sideset_base
+        self.jmp_pin = jmp_pin
+        self.in_shift_right = in_shift_right
+        self.status_tx_lessthan = status_tx_lessthan
+        self.autopush = autopush        # push threshold in bits, or None for no autopush
+        self.fifo_depth = fifo_depth    # 8 with the FIFOs joined
+        self.pc = 0
+        self.wrap_target = program.wrap_target  # pio_sm_set_wrap can move it at run time
+        self.x = self.y = self.isr = self.osr = 0
+        self.isr_count = 0
+        self.osr_count = 32
+        self.rx = []
+        self.tx = []
+        self.delay = 0
+        self.max_rx = self.max_tx = 0
+
+    def in_value(self, src, bits):
+        if src == 'pins':
+            value = self.pio.inputs >> self.in_base
+        elif src == 'x':
+            value = self.x
+        elif src == 'y':
+            value = self.y
+        elif src == 'isr':
+            value = self.isr
+        elif src == 'osr':
+            value = self.osr
+        elif src == 'null':
+            value = 0
+        elif src == 'status':
+            value = MASK32 if len(self.tx) < self.status_tx_lessthan else 0
+        else:
+            raise ValueError(f'unsupported source {src}')
+        return value & mask(bits)
+
+    def write_pins(self, base, count, value):
+        for i in range(count):
+            self.pio.drive(base + i, (value >> i) & 1)
+
+    def step(self):
+        if self.delay:
+            self.delay -= 1
+            return
+        inst = self.program.instructions[self.pc]
+        if inst.side is not None:
+            self.pio.drive(self.sideset_base, inst.side)
+        next_pc = self.execute(inst)
+        if next_pc is None:
+            return  # stalled: retry the same instruction next cycle
+        self.pc = next_pc
+        self.delay = inst.delay
+
+    def execute(self, inst):
+        op, args = inst.op, inst.args
+        following = self.wrap_target if self.pc == self.program.wrap else self.pc + 1
+
+        if op == 'jmp':
+            cond, target = (args[0], args[1]) if len(args) == 2 else (None, args[0])
+            target = self.program.target(target)
+            if cond is None:
+                taken = True
+            elif cond == '!x':
+                taken = self.x == 0
+            elif cond == '!y':
+                taken = self.y == 0
+            elif cond == 'x--':
+                taken = self.x != 0
+                self.x = (self.x - 1) & MASK32
+            elif cond == 'y--':
+                taken = self.y != 0
+                self.y = (self.y - 1) & MASK32
+            elif cond == 'x!=y':
+                taken = self.x != self.y
+            elif cond == 'pin':
+                taken = (self.pio.inputs >> self.jmp_pin) & 1
+            elif cond == '!osre':
+                taken = self.osr_count < 32
+            else:
+                raise ValueError(f'unsupported jmp condition {cond}')
+            return target if taken else following
+
+        if op == 'wait':
+            polarity, source, index = int(args[0]), args[1], int(args[2])
+            if source == 'irq':
+                if self.pio.irq[index] != polarity:
+                    return None
+                if polarity:
+                    self.pio.irq_clear(index)
+            elif source == 'gpio':
+                if (self.pio.inputs >> index) & 1 != polarity:
+                    return None
+            elif source == 'pin':
+                if (self.pio.inputs >> (self.in_base + index)) & 1 != polarity:
+                    return None
+            return following
+
+        if op == 'in':
+            bits = int(args[1])
+            full = self.autopush and self.isr_count + bits >= self.autopush
+            if full and len(self.rx) >= self.fifo_depth:
+                return None  # autopush stalls until there's room
+            value = self.in_value(args[0], bits)
+            if self.in_shift_right:
+                self.isr = ((self.isr >> bits) | (value << (32 - bits))) & MASK32
+            else:
+                self.isr = ((self.isr << bits) | value) & MASK32
+            self.isr_count = min(32, self.isr_count + bits)
+            if full:
+                self.rx.append(self.isr)
+                self.max_rx = max(self.max_rx, len(self.rx))
+                self.isr = self.isr_count = 0
+            return following
+
+        if op == 'push':
+            block = 'noblock' not in args
+            if len(self.rx) >= self.fifo_depth:
+                if block:
+                    return None
+            else:
+                self.rx.append(self.isr)
+                self.max_rx = max(self.max_rx, len(self.rx))
+            self.isr = self.isr_count = 0
+            return following
+
+        if op == 'pull':
+            block = 'noblock' not in args
+            if self.tx:
+                self.osr = self.tx.pop(0)
+            elif block:
+                return None
+            else:
+                self.osr = self.x
+            self.osr_count = 0
+            return following
+
+        if op == 'out':
+            destination, bits = args[0], int(args[1])
+            value = self.osr & mask(bits)
+            self.osr = (self.osr >> bits) & MASK32
+            self.osr_count = min(32, self.osr_count + bits)
+            if destination == 'pins':
+                self.write_pins(self.out_base, self.out_count, value)
+            else:
+                raise ValueError(f'unsupported out destination {destination}')
+            return following
+
+        if op == 'mov':
+            destination, source = args[0], args[1]
+            invert = source.startswith(('!', '~'))
+            value = self.in_value(source.lstrip('!~'), 32)
+            if invert:
+                value ^= MASK32
+            if destination == 'pins':
+                self.write_pins(self.out_base, self.out_count, value)
+            elif destination == 'x':
+                self.x = value
+            elif destination == 'y':
+                self.y = value
+            elif destination == 'isr':
+                self.isr, self.isr_count = value, 0
+            elif destination == 'osr':
+                self.osr, self.osr_count = value, 0
+            else:
+                raise ValueError(f'unsupported mov destination {destination}')
+            return following
+
+        if op == 'irq':
+            mode = args[0] if len(args) == 2 else 'set'
+            index = int(args[-1])
+            if mode == 'clear':
+                self.pio.irq_clear(index)
+            else:
+                self.pio.irq_set(index)
+            return following
+
+        if op == 'nop':
+            return following
+
+        raise ValueError(f'unsupported instruction {inst.text}')
+
+
+class Pio:
+    """PIO block state shared by its state machines: GPIO, IRQ flags and output drivers."""
+
+    def __init__(self, sync_cycles):
+        self.pins = [1 if p in (PIN_ROML, PIN_ROMH, PIN_OE) else 0 for p in range(30)]
+        self.history = []
+        self.sync_cycles = sync_cycles
+        self.inputs = self._pack(self.pins)
+        self.irq = [0] * 8
+        self.irq_sets = [0] * 8  # times each flag was set, like the CPU's IRQ handler counts
+        self._irq_pending = []
+        self._drive_pending = {}
+        self.machines = []
+        self.latency_machines = {}  # ROM pin -> read_latency state machine
+
+    @staticmethod
+    def _pack(pins):
+        return sum(value << pin for pin, value in enumerate(pins))
+
+    def drive(self, pin, value):
+        # Higher numbered state machines win, as they step later
+        self._drive_pending[pin] = value
+
+    def irq_set(self, index):
+        self._irq_pending.append((index, 1))
+        self.irq_sets[index] += 1
+
+    def irq_clear(self, index):
+        self.irq[index] = 0
+
+    def cycle(self):
+        # Inputs go through the 2 flop synchronizer before the state machines see them
+        self.history.append(self._pack(self.pins))
+        if len(self.history) > self.sync_cycles:
+            self.history.pop(0)
+        self.inputs = self.history[0]
+
+        for machine in self.machines:
+            machine.step()
+
+        # IRQ flags and pin writes are visible from the next cycle
+        for index, value in self._irq_pending:
+            self.irq[index] = value
+        self._irq_pending.clear()
+        for pin, value in self._drive_pending.items():
+            self.pins[pin] = value
+        self._drive_pending.clear()
+
+
+class ReadDma:
+    """The write channel copies each address from the read SM's RX FIFO to the read channel's
+    READ_ADDR_TRIG, and the read channel copies one byte to the read SM's TX FIFO."""
+
+    def __init__(self, machine, memory, transfer_cycles):
+        self.machine = machine
+        self.memory = memory
+        self.transfer_cycles = transfer_cycles
+        self.write_done = None   # (cycle, address) of the write channel's transfer in flight
+        self.read_done = None    # (cycle, address) of the read channel's transfer in flight
+
+    def cycle(self, now):
+        if self.read_done and now >= self.read_done[0] and len(self.machine.tx) < FIFO_DEPTH:
+            self.machine.tx.append(self.memory[self.read_done[1] & 0x3fff])
+            self.machine.max_tx = max(self.machine.max_tx, len(self.machine.tx))
+            self.read_done = None
+        if self.write_done and now >= self.write_done[0] and self.read_done is None:
+            self.read_done = (now + self.transfer_cycles, self.write_done[1])
+            self.write_done = None
+        if self.write_done is None and self.machine.rx:
+            self.write_done = (now + self.transfer_cycles, self.machine.rx.pop(0))
+
+
+def load_rom():
+    """The ROM window as main() sets it up: the loader, then the first 1K of NUFLI at $8400."""
+    memory = bytearray(16384)
+    with open(os.path.join(C64_ROM_DIR, 'loader_rom.bin'), 'rb') as f:
+        loader = f.read()
+    memory[:len(loader)] = loader
+    with open(os.path.join(C64_ROM_DIR, 'raspi.nuf'), 'rb') as f:
+        nufli = f.read()[2:]
+    memory[0x400:0x800] = nufli[:0x400]
+    return memory
+
+
+def build_pio(memory, command_prefix, args):
+    decoder = pioparse.parse(os.path.join(FIRMWARE_DIR, 'address_decoder.pio'))
+    read = pioparse.parse(os.path.join(FIRMWARE_DIR, 'read.pio'))
+    command = pioparse.parse(os.path.join(FIRMWARE_DIR, 'command.pio'))
+    latency = pioparse.parse(os.path.join(FIRMWARE_DIR, 'read_latency.pio'))
+
+    pio = Pio(args.sync_cycles)
+    for index, rom_pin in enumerate((PIN_ROMH, PIN_ROML)):
+        machine = StateMachine(pio, index, decoder['address_decoder'], in_base=PIN_A8,
+                               sideset_base=PIN_OE, jmp_pin=rom_pin, in_shift_right=False)
+        machine.y = command_prefix
+        pio.machines.append(machine)
+    read_sm = StateMachine(pio, 2, read['read'], in_base=PIN_A0, out_base=PIN_D0, out_count=8,
+                           sideset_base=PIN_OE)
+    read_sm.y = 0x20000000 >> 14  # base address, as set by read_program_init
+    pio.machines.append(read_sm)
+    command_sm = StateMachine(pio, 3, command['command'], in_base=PIN_A0, out_base=PIN_D0,
+                              out_count=8, sideset_base=PIN_OE, in_shift_right=False,
+                              status_tx_lessthan=1)
+    command_sm.pc = command['command'].target('locked')
+    command_sm.y = command['command'].defines['UNLOCK_MAGIC']
+    command_sm.tx.append(1)  # the CPU is ready for a command
+    command_sm.max_tx = 1
+    pio.machines.append(command_sm)
+
+    # The read_latency state machines are on PIO1, but they only watch the pins, so they can
+    # step with the rest
+    for index, rom_pin in enumerate((PIN_ROMH, PIN_ROML)):
+        machine = StateMachine(pio, 4 + index, latency['read_latency'], in_base=rom_pin,
+                               jmp_pin=PIN_OE)
+        machine.y = latency['read_latency'].defines['LIMIT']
+        pio.latency_machines[rom_pin] = machine
+        pio.machines.append(machine)
+    return pio, ReadDma(read_sm, memory, args.dma_cycles), command_sm
+
+
+class CommandGuard:
+    """The CPU's side of the command area guard, as in c64_pico_ram_interface.c.
+
+    The command SM unlocks itself when it sees UNLOCK_MAGIC.  The CPU locks it again after
+    --guard-commands commands by moving its wrap target to locked one command early, or after
+    --guard-timeout-us ready without a command by jumping it to locked while it waits."""
+
+    def __init__(self, machine, commands, timeout_cycles):
+        self.machine = machine
+        self.locked = machine.program.target('locked')
+        self.start = machine.program.target('start')
+        self.commands = commands
+        self.timeout_cycles = timeout_cycles
+        self.count = 0
+        self.last = 0
+        self.relocks = 0
+        self.unlocks = 0        # seen by poll, like the activity counters see them
+        self.seen_unlocked = False
+
+    def unlocked(self):
+        return self.machine.pc >= self.start
+
+    def on_command(self, now):
+        self.count += 1
+        self.last = now
+
+    def on_ready(self, now):
+        # The SM has finished the last command by now, so a new wrap target applies to the next
+        self.last = now
+        if self.count >= self.commands:
+            self.machine.wrap_target = self.start
+            self.count = 0
+            self.relocks += 1
+        elif self.count == self.commands - 1:
+            self.machine.wrap_target = self.locked
+
+    def poll(self, now):
+        if self.unlocked() and not self.seen_unlocked:
+            self.unlocks += 1
+        self.seen_unlocked = self.unlocked()
+        if not self.unlocked():
+            self.last = now
+        elif now - self.last >= self.timeout_cycles and self.machine.pc == self.start:
+            self.machine.pc = self.locked
+            self.machine.wrap_target = self.start
+            self.count = 0
+            self.relocks += 1
+
+
+def unlock_reads(command_prefix):
+    """The command area reads that unlock the command SM, as the loader makes them."""
+    magic = pioparse.parse(os.path.join(FIRMWARE_DIR, 'command.pio'))['command'].defines[
+        'UNLOCK_MAGIC']
+    return [0x8000 + (command_prefix << 8) + ((magic >> shift) & 0xff) for shift in (24, 16, 8, 0)]
+
+
+def addresses(args, command_prefix):
+    """C64 addresses to read, one per C64 cycle."""
+    if args.trace:
+        with open(args.trace) as f:
+            for line in f:
+                line = line.split('#')[0].strip()
+                if line:
+                    yield int(line.lstrip('$'), 16)
+        return
+    yield from unlock_reads(command_prefix)
+    status = 0x8000 + (command_prefix << 8)
+    for i in range(args.reads):
+        if args.pattern == 'window':
+            yield 0x8400 + (i & 0x3ff)
+        elif args.pattern == 'status':
+            yield status
+        else:
+            # Like the loader's copy loop: poll status, then read four pages of the window
+            yield status if i % 5 == 0 else 0x8400 + (i % 5 - 1) * 0x100 + (i // 5) % 256
+
+
+class Run:
+    """What simulate() saw: (address, kind, latency ns, ok) for each read, where kind is
+    'read', 'command' or 'filtered' (a command area read while locked), and the commands the
+    CPU took from the RX FIFO.  measured has (PIO cycles, count) for each read: the latency
+    simulated, and the count the read_latency state machine pushed for it."""
+
+    def __init__(self, pio, guard, deadline_ns, cycle_ns):
+        self.pio = pio
+        self.guard = guard
+        self.deadline_ns = deadline_ns
+        self.cycle_ns = cycle_ns
+        self.results = []
+        self.commands = []
+        self.measured = []
+        self.counted = {PIN_ROMH: 0, PIN_ROML: 0}  # by the activity counters' DMA channels
+
+    @property
+    def ok(self):
+        return (all(ok for _, _, _, ok in self.results) and not self.latency_errors()
+                and not self.count_errors())
+
+    def count_errors(self):
+        """Reads the activity counters would have counted wrong, on either ROM line"""
+        errors = 0
+        for rom_pin, counted in self.counted.items():
+            reads = sum(1 for r in self.results if (PIN_ROMH if r[0] & 0x2000 else PIN_ROML)
+                        == rom_pin)
+            errors += abs(counted - reads)
+        return errors
+
+    def latency_errors(self):
+        """Answered reads the read_latency state machine got wrong: no count, or one that
+        doesn't put the latency in the last 2 cycles of its bin.  Reads that aren't answered
+        while ROML or ROMH is low have already failed."""
+        errors = 0
+        for cycles, count in self.measured:
+            if cycles is None:
+                continue
+            if count is None or count > LATENCY_LIMIT:
+                errors += 1
+            else:
+                bin_cycles = 2 * (LATENCY_LIMIT - count + 1)
+                errors += not bin_cycles - 2 < cycles <= bin_cycles
+        return errors
+
+
+def read_deadline_ns(args):
+    """When the data must be on the bus, after ROML/ROMH falls, for the CPU's setup time"""
+    return 1e9 / PHI2_HZ[args.video] / 2 - args.roml_delay - args.setup - args.buffer_delay
+
+
+def simulate(args, reads=None, pio1=None):
+    """Run the reads (default: from --trace or --pattern) and return a Run.  pio1 is another
+    Pio, like the capture state machines on PIO1, that steps along with PIO0 on its pins."""
+    command_prefix = pioparse.parse(
+        os.path.join(FIRMWARE_DIR, 'address_decoder.pio'))['address_decoder'].defines[
+        'COMMAND_PREFIX']
+    memory = load_rom()
+    pio, dma, command_sm = build_pio(memory, command_prefix, args)
+    if pio1 is not None:
+        pio1.pins = pio.pins
+
+    cycle_ns = 1000.0 / args.sys_clock * args.clkdiv
+    period_ns = 1e9 / PHI2_HZ[args.video]
+    deadline_ns = read_deadline_ns(args)
+    guard = CommandGuard(command_sm, args.guard_commands,
+                         int(args.guard_timeout_us * 1000 / cycle_ns))
+    run = Run(pio, guard, deadline_ns, cycle_ns)
+    cycle = 0
+    command_busy_until = None
+
+    def run_until(ns):
+        nonlocal cycle, command_busy_until
+        while cycle * cycle_ns < ns:
+            if cycle % args.clkdiv == 0:
+                pio.cycle()
+                dma.cycle(cycle)
+                for machine, rom_pin in zip(pio.machines, (PIN_ROMH, PIN_ROML)):
+                    run.counted[rom_pin] += len(machine.rx)
+                    machine.rx.clear()
+                if pio1 is not None:
+                    pio1.cycle()
+            # The CPU takes each command and signals it's ready again after --command-us, once
+            # there are no more queued
+            if command_sm.rx and command_busy_until is None:
+                run.commands.append(command_sm.rx.pop(0))
+                guard.on_command(cycle)
+                command_busy_until = cycle + int(args.command_us * 1000 / cycle_ns)
+            if command_busy_until is not None and cycle >= command_busy_until:
+                if not command_sm.rx:
+                    command_sm.tx.append(1)
+                    command_sm.max_tx = max(command_sm.max_tx, len(command_sm.tx))
+                guard.on_ready(cycle)
+                command_busy_until = None
+            if command_busy_until is None:
+                guard.poll(cycle)
+            cycle += 1
+
+    # Counts from the read_latency state machines come after the read is answered, or when the
+    # count runs out, so they're matched up with the reads waiting for them as they arrive
+    waiting = {machine: [] for machine in pio.latency_machines.values()}
+
+    def collect_counts():
+        for machine, reads in waiting.items():
+            while machine.rx and reads:
+                run.measured[reads.pop(0)][1] = machine.rx.pop(0)
+
+    # Let the state machines settle
+    run_until(200)
+    start_ns = cycle * cycle_ns
+    if reads is None:
+        reads = addresses(args, command_prefix)
+    for n, address in enumerate(reads):
+        phi2_rise = start_ns + n * period_ns + period_ns / 2
+        phi2_fall = start_ns + (n + 1) * period_ns
+        run_until(phi2_rise)
+        collect_counts()
+        for i in range(14):
+            pio.pins[PIN_A0 + i] = (address >> i) & 1
+        rom_pin = PIN_ROMH if address & 0x2000 else PIN_ROML
+        kind = 'read'
+        if (address >> 8) & 0x3f == command_prefix:
+            kind = 'command' if guard.unlocked() else 'filtered'
+        run_until(phi2_rise + args.roml_delay)
+        pio.pins[rom_pin] = 0
+        fall_cycle = cycle
+
+        valid_cycle = None
+        while cycle * cycle_ns < phi2_fall + args.hold:
+            run_until((cycle + 1) * cycle_ns)
+            if valid_cycle is None and pio.pins[PIN_OE] == 0:
+                valid_cycle = cycle
+                data = sum(pio.pins[PIN_D0 + i] << i for i in range(8))
+        pio.pins[rom_pin] = 1
+
+        if valid_cycle is None:
+            # A locked command SM doesn't answer
+            latency_ns, ok = None, kind == 'filtered'
+        else:
+            latency_ns = (valid_cycle - fall_cycle) * cycle_ns + args.buffer_delay
+            if kind == 'read':
+                expected_ok = data == memory[address & 0x3fff]
+            else:
+                expected_ok = kind == 'command' and data in (0x00, 0xff)
+            ok = expected_ok and latency_ns <= deadline_ns
+        run.results.append((address, kind, latency_ns, ok))
+        waiting[pio.latency_machines[rom_pin]].append(len(run.measured))
+        run.measured.append([None if valid_cycle is None
+                             else (valid_cycle - fall_cycle) // args.clkdiv, None])
+        if args.verbose:
+            latency = 'no data' if latency_ns is None else f'{latency_ns:6.1f} ns'
+            print(f'${address:04X} {kind:8} {latency}{"" if ok else "  FAIL"}')
+
+    run_until(cycle * cycle_ns + period_ns)
+    collect_counts()
+    return run
+
+
+def report(run):
+    results, deadline_ns, cycle_ns = run.results, run.deadline_ns, run.cycle_ns
+    for label in ('read', 'command'):
+        latencies = [r[2] for r in results if r[1] == label and r[2] is not None]
+        missing = sum(1 for r in results if r[1] == label and r[2] is None)
+        if not latencies:
+            if missing:
+                print(f'{label}: {missing} reads, none answered')
+            continue
+        print(f'{label}: {len(latencies) + missing} reads, '
+              f'latency min {min(latencies):.1f} / mean {statistics.mean(latencies):.1f} / '
+              f'max {max(latencies):.1f} ns ({max(latencies) / cycle_ns:.0f} PIO cycles), '
+              f'margin {deadline_ns - max(latencies):.1f} ns'
+              + (f', {missing} never answered' if missing else ''))
+    filtered = sum(1 for r in results if r[1] == 'filtered')
+    print(f'filtered: {filtered} command area reads while locked '
+          f'({filtered - run.guard.unlocks} after {run.guard.unlocks} unlocks), '
+          f'{len(run.commands)} commands to the CPU, {run.guard.relocks} relocks')
+    print(f'deadline: {deadline_ns:.1f} ns after ROML/ROMH falls')
+    for machine, name in zip(run.pio.machines, ('decoder ROMH', 'decoder ROML', 'read', 'command')):
+        print(f'{name} sm: max RX FIFO {machine.max_rx}, max TX FIFO {machine.max_tx}')
+    latency_errors = run.latency_errors()
+    answered = sum(1 for cycles, _ in run.measured if cycles is not None)
+    print(f'read_latency sm: {answered - latency_errors} of {answered} answered reads measured '
+          f'right')
+    print('activity: ' + ', '.join(f'{name} {run.counted[pin]} reads counted'
+                                   for name, pin in (('ROMH', PIN_ROMH), ('ROML', PIN_ROML)))
+          + (f', {run.count_errors()} wrong' if run.count_errors() else ''))
+    failures = sum(1 for r in results if not r[3]) + latency_errors + run.count_errors()
+    print(f'{failures} failures' if failures else 'all reads OK')
+
+
+def add_arguments(parser):
+    parser.add_argument('--video', choices=PHI2_HZ, default='pal')
+    parser.add_argument('--sys-clock', metavar='MHZ', type=float, default=125.0,
+                        help='RP2040 system clock (default %(default)s)')
+    parser.add_argument('--clkdiv', type=int, default=1, help='PIO clock divider')
+    parser.add_argument('--dma-cycles', type=int, default=4,
+                        help='system clock cycles per DMA transfer (default %(default)s)')
+    parser.add_argument('--sync-cycles', type=int, default=2,
+                        help='GPIO input synchronizer delay (default %(default)s)')
+    parser.add_argument('--roml-delay', metavar='NS', type=float, default=60.0,
+                        help='phi2 rising to ROML/ROMH low (default %(default)s)')
+    parser.add_argument('--setup', metavar='NS', type=float, default=100.0,
+                        help='6510 data setup before phi2 falls (default %(default)s)')
+    parser.add_argument('--buffer-delay', metavar='NS', type=float, default=10.0,
+                        help='bus buffer propagation delay (default %(default)s)')
+    parser.add_argument('--hold', metavar='NS', type=float, default=10.0,
+                        help='phi2 falling to ROML/ROMH high (default %(default)s)')
+    parser.add_argument('--command-us', type=float, default=20.0,
+                        help='CPU time to handle a command (default %(default)s)')
+    parser.add_argument('--guard-commands', type=int, default=128,
+                        help='commands per unlock, COMMAND_GUARD_COMMANDS (default %(default)s)')
+    parser.add_argument('--guard-timeout-us', type=float, default=1e6,
+                        help='idle time before relocking (default %(default)s)')
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    add_arguments(parser)
+    parser.add_argument('--pattern', choices=['mixed', 'window', 'status'], default='mixed')
+    parser.add_argument('--reads', type=int, default=1000)
+    parser.add_argument('--trace', help='file of hex addresses to read, one per line')
+    parser.add_argument('--verbose', '-v', action='store_true')
+    args = parser.parse_args()
+    run = simulate(args)
+    report(run)
+    sys.exit(0 if run.ok else 1)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,244 @@
+#!/usr/bin/env python
+"""Work out the worst case time the PIO programs take to answer a C64 read, from their source.
+
+The .pio files are parsed with pioparse.py and each path the firmware wires them into is
+walked instruction by instruction, from ROML/ROMH changing to OE changing.  Every jmp the
+program's state decides is tried both ways and the slowest way is kept.  A jmp pin the path
+starts in is a poll, which can just miss the edge.  An IRQ hands over to the state machine
+waiting on it, and the read program's pull waits for the two DMA transfers after its push:
+
+- read: address_decoder's IRQ 4, then read puts the byte from DMA on the data bus
+- command: address_decoder's IRQ 5, then command puts the status on the data bus
+- release: address_decoder sees ROML/ROMH go high again and turns OE off
+
+The cycles are counted with the same model as tools/pio_sim.py (the same options, with the
+GPIO synchronizer counted in PIO cycles, which also covers the edge landing just after a PIO
+clock) and turned into ns at --sys-clock and --clkdiv.  The read and command paths are checked
+against the C64's data setup deadline, and the exit status is 1 if either has less than
+--min-margin to spare.  The firmware build runs this for NTSC, the shorter cycle, so a PIO
+change that eats the margin fails the build:
+
+    python tools/pio_timing.py --video ntsc --verbose
+    python tools/pio_timing.py --sys-clock 200 --dma-cycles 6 --min-margin 100
+"""
+import argparse
+import os
+import sys
+
+import pio_sim
+import pioparse
+
+FIRMWARE_DIR = pio_sim.FIRMWARE_DIR
+
+
+class TimingError(ValueError):
+    pass
+
+
+class Stage:
+    """A state machine's part of a path: from start (a label, or the wrap target) until an
+    instruction stop() accepts.  pin is the value its jmp pin has meanwhile."""
+
+    def __init__(self, source, program, start, stop, *, pin=None, poll=False, dma=False):
+        self.source = source
+        self.program = program
+        self.start = start
+        self.stop = stop
+        self.pin = pin
+        self.poll = poll    # start is a jmp pin polling for the edge
+        self.dma = dma      # a blocking pull waits for the read DMA
+
+
+def sets_irq(index):
+    def stop(inst):
+        return inst.op == 'irq' and inst.args[-1] == str(index) \
+            and (len(inst.args) == 1 or inst.args[0] in ('set', 'nowait'))
+    stop.text = f'IRQ {index} set'
+    return stop
+
+
+def sets_side(value):
+    def stop(inst):
+        return inst.side == value
+    stop.text = f'side {value}'
+    return stop
+
+
+# How c64_pico_ram_interface.c wires the programs, with address_decoder's jmp pin on ROML/ROMH
+# and OE on the side-set pin
+PATHS = {
+    'read': ('ROML/ROMH falling to OE low with the data', [
+        Stage('address_decoder.pio', 'address_decoder', 'wait_read', sets_irq(4), pin=0,
+              poll=True),
+        Stage('read.pio', 'read', None, sets_side(0), dma=True)]),
+    'command': ('ROML/ROMH falling to OE low with the status', [
+        Stage('address_decoder.pio', 'address_decoder', 'wait_read', sets_irq(5), pin=0,
+              poll=True),
+        Stage('command.pio', 'command', 'start', sets_side(0))]),
+    'release': ('ROML/ROMH rising to OE high', [
+        Stage('address_decoder.pio', 'address_decoder', 'wait_finished', sets_side(1), pin=1,
+              poll=True)]),
+}
+
+
+def successors(program, pc, pin):
+    """Where execution can go after pc: both ways for a jmp on the state machine's registers"""
+    inst = program.instructions[pc]
+    following = program.next_pc(pc)
+    if inst.op != 'jmp':
+        return [following]
+    if len(inst.args) == 1:
+        return [program.target(inst.args[0])]
+    cond, target = inst.args[0], program.target(inst.args[1])
+    if cond == 'pin':
+        if pin is None:
+            raise TimingError(f'{program.name} line {inst.line}: jmp pin with the pin unknown')
+        return [target if pin else following]
+    return [target] if target == following else [target, following]
+
+
+def poll_cycles(program, pc, pin):
+    """Cycles around the loop that polls the jmp pin at pc, while it still has the old value"""
+    cycles = 0
+    at = pc
+    while True:
+        cycles += 1 + program.instructions[at].delay
+        (at,) = successors(program, at, 1 - pin)
+        if at == pc:
+            return cycles
+        if cycles > len(program.instructions) * 32:
+            raise TimingError(f'{program.name} line {program.instructions[pc].line}: '
+                              f'jmp pin isn\'t a poll')
+
+
+def longest(program, stage, dma_cycles):
+    """The slowest way through a stage, as a list of (instruction, cycles)"""
+    start = program.wrap_target if stage.start is None else program.target(stage.start)
+    best = None
+
+    def walk(pc, path, seen):
+        nonlocal best
+        inst = program.instructions[pc]
+        if pc in seen:
+            # Around a loop without getting there: a way that waits for something else, unless
+            # it counts down, which could get there after any number of times round
+            loop = [i for i, _ in path][[i is inst for i, _ in path].index(True):]
+            if any(i.op == 'jmp' and i.args[0] in ('x--', 'y--') for i in loop):
+                raise TimingError(f'{program.name} line {inst.line}: loop with no static '
+                                  f'bound before {stage.stop.text}')
+            return
+        stall = 0
+        if inst.op == 'wait' and pc != start:
+            raise TimingError(f'{program.name} line {inst.line}: waits partway through')
+        if inst.op == 'pull' and 'noblock' not in inst.args:
+            if not stage.dma:
+                raise TimingError(f'{program.name} line {inst.line}: pull with nothing to wait '
+                                  f'for')
+            stall = dma_cycles
+        if stage.stop(inst):
+            # Side-set and IRQs take effect in the instruction's first cycle, before its delay
+            path = path + [(inst, 1 + stall)]
+            if best is None or sum(c for _, c in path) > sum(c for _, c in best):
+                best = path
+            return
+        path = path + [(inst, 1 + stall + inst.delay)]
+        for next_pc in successors(program, pc, stage.pin):
+            walk(next_pc, path, seen | {pc})
+
+    walk(start, [], set())
+    if best is None:
+        raise TimingError(f'{program.name}: never gets to {stage.stop.text}')
+    return best
+
+
+class Path:
+    """The cycles a path takes, as (state machine, what, cycles) steps"""
+
+    def __init__(self, name, description, steps, cycle_ns):
+        self.name = name
+        self.description = description
+        self.steps = steps
+        self.cycle_ns = cycle_ns
+
+    @property
+    def cycles(self):
+        return sum(cycles for _, _, cycles in self.steps)
+
+    @property
+    def ns(self):
+        return self.cycles * self.cycle_ns
+
+
+def analyse(args):
+    """Return a Path for each of PATHS with the options from pio_sim.add_arguments"""
+    cycle_ns = 1000.0 / args.sys_clock * args.clkdiv
+    # Each of the DMA's two transfers finishes on the next PIO clock, like pio_sim's ReadDma
+    dma_cycles = 2 * -(-args.dma_cycles // args.clkdiv)
+    programs = {}
+    paths = {}
+    for name, (description, stages) in PATHS.items():
+        steps = [('gpio', 'input synchronizer', args.sync_cycles)]
+        for stage in stages:
+            if stage.source not in programs:
+                programs[stage.source] = pioparse.parse(os.path.join(FIRMWARE_DIR,
+                                                                     stage.source))
+            program = programs[stage.source][stage.program]
+            if stage.poll:
+                pc = program.target(stage.start)
+                missed = poll_cycles(program, pc, stage.pin) - 1
+                if missed:
+                    steps.append((program.name, f'poll just missed the edge (line '
+                                  f'{program.instructions[pc].line})', missed))
+            for inst, cycles in longest(program, stage, dma_cycles):
+                text = inst.text + (' (DMA)' if cycles > 1 + inst.delay and
+                                    inst.op == 'pull' else '')
+                steps.append((program.name, f'{text} (line {inst.line})', cycles))
+        paths[name] = Path(name, description, steps, cycle_ns)
+    return paths
+
+
+def report(paths, deadline_ns, min_margin, verbose=False):
+    """The paths as text, and whether the read and command paths have min_margin to spare"""
+    lines = []
+    ok = True
+    for path in paths.values():
+        line = f'{path.name}: {path.cycles} PIO cycles, {path.ns:.1f} ns worst case from ' \
+               f'{path.description}'
+        if path.name != 'release':
+            margin = deadline_ns - path.ns
+            line += f', margin {margin:.1f} ns'
+            if margin < min_margin:
+                line += f'  FAIL: under {min_margin:g} ns'
+                ok = False
+        lines.append(line)
+        if verbose:
+            lines += [f'  {machine:16} {cycles:3}  {what}' for machine, what, cycles in path.steps]
+    lines.append(f'deadline: {deadline_ns:.1f} ns after ROML/ROMH falls')
+    return ''.join(line + '\n' for line in lines), ok
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    pio_sim.add_arguments(parser)
+    parser.add_argument('--min-margin', metavar='NS', type=float, default=50.0,
+                        help='least time to spare before the deadline (default %(default)s)')
+    parser.add_argument('--output', '-o', help='also write the report here if it passes')
+    parser.add_argument('--verbose', '-v', action='store_true',
+                        help='list the instructions on each path')
+    args = parser.parse_args()
+
+    try:
+        paths = analyse(args)
+    except TimingError as e:
+        sys.exit(f'pio_timing: {e}')
+    text, ok = report(paths, pio_sim.read_deadline_ns(args), args.min_margin, args.verbose)
+    print(text, end='')
+    if ok and args.output:
+        with open(args.output, 'w') as f:
+            f.write(text)
+    sys.exit(0 if ok else 1)
+
+
+if __name__ == '__main__':
+    main()
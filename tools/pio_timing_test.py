@@ -0,0 +1,239 @@
+#!/usr/bin/env python
+"""Test tools/pio_timing.py against tools/pio_sim.py and small programs with known timing.
+
+For the firmware's programs, at several system clocks, DMA and synchronizer delays, the worst
+case pio_timing.py works out for each path must be no less than the slowest pio_sim.py
+simulates, and at most a cycle more: pio_sim.py starts counting at the first PIO clock after
+the edge, where the worst case is the edge just after the one before.  The walk itself is
+checked on programs written here: the slowest branch is kept, delays count except on the
+instruction that ends a stage, a poll can miss the edge by its whole loop, and a countdown loop,
+a wait partway through or a stage that never ends are refused.  The exit status must follow
+--min-margin, and --output only be written when it passes.  pio_sim.py must fail a read
+exactly when its margin to the deadline is negative:
+
+    python tools/pio_timing_test.py
+"""
+import argparse
+import os
+import subprocess
+import sys
+import tempfile
+
+import pio_sim
+import pio_timing
+import pioparse
+
+TOOL = os.path.join(os.path.dirname(os.path.abspath(__file__)), 'pio_timing.py')
+COMMAND_AREA = 0x9e00
+CMD_NEXT_PAGE = COMMAND_AREA + 0x01
+
+
+def options(*argv):
+    parser = argparse.ArgumentParser()
+    pio_sim.add_arguments(parser)
+    args = parser.parse_args(list(argv))
+    args.verbose = False
+    return args
+
+
+def simulated(args):
+    """The slowest read and command pio_sim.py simulates, in PIO cycles"""
+    prefix = (COMMAND_AREA >> 8) & 0x3f
+    reads = pio_sim.unlock_reads(prefix)
+    for i in range(60):
+        reads += [0x8400 + i * 37 % 0x400, COMMAND_AREA, CMD_NEXT_PAGE, 0xa000 + i]
+    run = pio_sim.simulate(args, reads)
+    worst = {}
+    for (address, kind, latency, ok), (cycles, _) in zip(run.results, run.measured):
+        if cycles is not None:
+            worst[kind] = max(worst.get(kind, 0), cycles)
+    return worst
+
+
+def simulated_release(args):
+    """The slowest pio_sim.py's address_decoder takes to turn OE off after ROML goes high, at
+    each phase of its poll"""
+    worst = 0
+    for phase in range(4):
+        pio, dma, _ = pio_sim.build_pio(bytearray(16384), (COMMAND_AREA >> 8) & 0x3f, args)
+        now = 0
+
+        def step():
+            nonlocal now
+            pio.cycle()
+            dma.cycle(now)
+            now += 1
+
+        for _ in range(50):
+            step()
+        pio.pins[pio_sim.PIN_ROML] = 0
+        while pio.pins[pio_sim.PIN_OE]:
+            step()
+        for _ in range(phase):
+            step()
+        pio.pins[pio_sim.PIN_ROML] = 1
+        cycles = 0
+        while not pio.pins[pio_sim.PIN_OE]:
+            step()
+            cycles += 1
+        worst = max(worst, cycles)
+    return worst
+
+
+def check_firmware(argv):
+    """Error messages for the firmware's programs with these pio_sim.py options"""
+    errors = []
+    args = options(*argv)
+    paths = pio_timing.analyse(args)
+    worst = simulated(args)
+    worst['release'] = simulated_release(args)
+    for name, kind in (('read', 'read'), ('command', 'command'), ('release', 'release')):
+        static = paths[name].cycles
+        if not worst[kind] <= static <= worst[kind] + 1:
+            errors.append(f'{name} {static} cycles, pio_sim.py {worst[kind]}')
+    return errors, paths
+
+
+PROGRAMS = """
+.program branches
+.side_set 1 opt
+start:
+    wait 1 irq 4
+    jmp !x, short
+    nop [3]
+    irq set 4
+short:
+    nop             side 0 [7]
+
+.program countdown
+.side_set 1 opt
+start:
+    wait 1 irq 4
+loop:
+    jmp x--, loop
+    nop             side 0
+
+.program waits
+.side_set 1 opt
+start:
+    wait 1 irq 4
+    wait 0 pin 0
+    nop             side 0
+
+.program endless
+.side_set 1 opt
+start:
+    wait 1 irq 4
+    jmp start
+
+.program poller
+poll:
+    jmp pin go
+    nop [2]
+    jmp poll
+go:
+    irq set 4
+
+.program fetch
+.side_set 1 opt
+    wait 1 irq 4
+    push noblock
+    pull block
+    out pins, 8     side 0
+"""
+
+
+def check_programs(build_dir):
+    """Error messages for the walks through PROGRAMS"""
+    errors = []
+    path = os.path.join(build_dir, 'programs.pio')
+    with open(path, 'w') as f:
+        f.write(PROGRAMS)
+    programs = pioparse.parse(path)
+    side0 = pio_timing.sets_side(0)
+
+    def cycles(program, stage, dma_cycles=0):
+        return sum(c for _, c in pio_timing.longest(programs[program], stage, dma_cycles))
+
+    got = cycles('branches', pio_timing.Stage(path, 'branches', 'start', side0))
+    if got != 8:
+        errors.append(f'branches: {got} cycles, expected 8')
+    got = cycles('fetch', pio_timing.Stage(path, 'fetch', None, side0, dma=True), 8)
+    if got != 12:
+        errors.append(f'fetch: {got} cycles, expected 12')
+    got = (pio_timing.poll_cycles(programs['poller'], programs['poller'].target('poll'), 1),
+           cycles('poller', pio_timing.Stage(path, 'poller', 'poll', pio_timing.sets_irq(4),
+                                             pin=1)))
+    if got != (5, 2):
+        errors.append(f'poller: {got}, expected a 5 cycle poll and 2 cycles')
+    for name, stage in (('countdown', pio_timing.Stage(path, 'countdown', 'start', side0)),
+                        ('waits', pio_timing.Stage(path, 'waits', 'start', side0)),
+                        ('endless', pio_timing.Stage(path, 'endless', 'start', side0)),
+                        ('fetch without DMA', pio_timing.Stage(path, 'fetch', None, side0))):
+        try:
+            cycles(stage.program, stage)
+            errors.append(f'{name}: accepted')
+        except pio_timing.TimingError:
+            pass
+    return errors
+
+
+def check_exit(build_dir):
+    """Error messages for the exit status and --output"""
+    errors = []
+    output = os.path.join(build_dir, 'pio_timing.txt')
+    for margin, expected in (('0', 0), ('1000', 1)):
+        if os.path.exists(output):
+            os.remove(output)
+        result = subprocess.run([sys.executable, TOOL, '--min-margin', margin, '-o', output],
+                                capture_output=True, text=True)
+        if result.returncode != expected:
+            errors.append(f'--min-margin {margin}: exit {result.returncode}')
+        if os.path.exists(output) != (expected == 0):
+            errors.append(f'--min-margin {margin}: --output '
+                          + ('written' if expected else 'not written'))
+    return errors
+
+
+def check_verdict():
+    """Error messages for pio_sim.py's pass or fail against the margin it prints, with the
+    setup time moved so the slowest read is just inside or just outside the deadline"""
+    errors = []
+    args = options()
+    reads = [0x8400 + i * 37 % 0x400 for i in range(60)]
+    slowest = max(r[2] for r in pio_sim.simulate(args, reads).results)
+    for margin in (1.0, -1.0, -args.buffer_delay / 2):
+        args = options()
+        args.setup += pio_sim.read_deadline_ns(args) - slowest - margin
+        results = pio_sim.simulate(args, reads).results
+        failed = [latency for _, _, latency, ok in results if not ok]
+        late = [latency for _, _, latency, _ in results
+                if latency > pio_sim.read_deadline_ns(args)]
+        if failed != late or (margin < 0) != bool(late):
+            errors.append(f'margin {margin} ns: {len(failed)} reads fail, {len(late)} late')
+    return errors
+
+
+def main():
+    failures = 0
+    for argv in ([], ['--video', 'ntsc'], ['--sys-clock', '200'], ['--sys-clock', '133'],
+                 ['--dma-cycles', '7'], ['--sync-cycles', '3'], ['--dma-cycles', '1']):
+        errors, paths = check_firmware(argv)
+        print(f'{" ".join(argv) or "defaults"}: '
+              + ', '.join(f'{name} {path.cycles}' for name, path in paths.items())
+              + ''.join(f'  FAIL: {e}' for e in errors))
+        failures += bool(errors)
+
+    with tempfile.TemporaryDirectory() as build_dir:
+        for name, errors in (('programs', check_programs(build_dir)),
+                             ('exit status', check_exit(build_dir)),
+                             ('pass or fail by margin', check_verdict())):
+            print(f'{name}: ' + ('OK' if not errors else ''.join(f'  FAIL: {e}' for e in errors)))
+            failures += bool(errors)
+
+    print(f'{failures} failed' if failures else 'all OK')
+    sys.exit(1 if failures else 0)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,109 @@
+"""Parse the subset of pioasm syntax used by the firmware's .pio programs.
+
+Only what the host tools need is kept: instructions with their side-set and delay, labels,
+wrap points and public defines.  The "% c-sdk" blocks are skipped.
+"""
+import re
+from dataclasses import dataclass, field
+
+
+@dataclass
+class Instruction:
+    op: str                # jmp, wait, in, out, push, pull, mov, irq, set, nop
+    args: list             # operands, split on commas and whitespace
+    side: int = None       # side-set value, or None if not set
+    delay: int = 0
+    line: int = 0          # line number in the source file
+    text: str = ''
+
+
+@dataclass
+class Program:
+    name: str
+    instructions: list = field(default_factory=list)
+    labels: dict = field(default_factory=dict)   # label -> instruction index
+    defines: dict = field(default_factory=dict)  # name -> value
+    side_set_bits: int = 0
+    side_set_opt: bool = False
+    wrap_target: int = 0
+    wrap: int = None       # index of the last instruction before wrapping
+
+    def target(self, label):
+        return self.labels[label]
+
+    def next_pc(self, pc):
+        """Where execution goes after instruction pc, taking .wrap into account."""
+        if pc == self.wrap:
+            return self.wrap_target
+        return pc + 1
+
+
+def _parse_int(text):
+    return int(text, 0)
+
+
+def parse_instruction(text, line):
+    delay = 0
+    side = None
+    match = re.search(r'\[\s*(\w+)\s*\]', text)
+    if match:
+        delay = _parse_int(match.group(1))
+        text = text[:match.start()] + text[match.end():]
+    match = re.search(r'\bside\s+(\w+)', text)
+    if match:
+        side = _parse_int(match.group(1))
+        text = text[:match.start()] + text[match.end():]
+    words = text.replace(',', ' ').split()
+    return Instruction(op=words[0].lower(), args=words[1:], side=side, delay=delay, line=line,
+                       text=text.strip())
+
+
+def parse(path):
+    """Return a dict of program name -> Program for every .program in the file."""
+    programs = {}
+    program = None
+    in_sdk_block = False
+    with open(path) as f:
+        for line_number, line in enumerate(f, 1):
+            if in_sdk_block:
+                if line.strip().startswith('%}'):
+                    in_sdk_block = False
+                continue
+            if line.strip().startswith('%'):
+                in_sdk_block = True
+                continue
+
+            line = re.split(r';|//', line, maxsplit=1)[0].strip()
+            if not line:
+                continue
+
+            match = re.match(r'(?:public\s+)?(\w+):\s*(.*)', line)
+            if match and not line.startswith('.'):
+                program.labels[match.group(1)] = len(program.instructions)
+                line = match.group(2)
+                if not line:
+                    continue
+
+            words = line.split()
+            if words[0] == '.program':
+                program = Program(words[1])
+                programs[program.name] = program
+            elif words[0] == '.side_set':
+                program.side_set_bits = int(words[1])
+                program.side_set_opt = 'opt' in words[2:]
+            elif words[0] == '.wrap_target':
+                program.wrap_target = len(program.instructions)
+            elif words[0] == '.wrap':
+                program.wrap = len(program.instructions) - 1
+            elif words[0] == '.define':
+                name, value = [w for w in words[1:] if w != 'public']
+                program.defines[name] = _parse_int(value)
+            elif words[0].startswith('.'):
+                pass
+            else:
+                program.instructions.append(parse_instruction(line, line_number))
+
+    for program in programs.values():
+        if program.wrap is None:
+            program.wrap = len(program.instructions) - 1
+    return programs
@@ -0,0 +1,136 @@
+#!/usr/bin/env python
+"""Parse C64 .prg files the way the firmware does (firmware/prg.c).
+
+A .prg is a 2 byte load address followed by the data.  The start address is the SYS of a BASIC
+program whose first line is one ("10 SYS 2064"), otherwise the load address, unless --exec
+gives one.  The cartridge can't load a file over the CPU port or under its own ROM window, and
+data under the I/O area is stored with I/O banked out.
+
+Prints where the file loads and starts, with an estimate of how long a stock 1541 takes to
+load it for comparison:
+
+    python tools/prg.py game.prg
+    python tools/prg.py c64-rom/raspi.nuf --exec 0x3000
+"""
+import argparse
+import ctypes
+import sys
+
+import host_c
+
+BASIC_START = 0x0801
+IO_START = 0xd000
+IO_END = 0xe000
+TOKEN_SYS = 0x9e
+
+# A stock 1541 with the KERNAL's serial routines manages roughly 400 bytes a second
+DRIVE_1541_BYTES_PER_SECOND = 400
+
+
+class PrgError(ValueError):
+    pass
+
+
+class Prg:
+    def __init__(self, load, data, exec_address, under_io):
+        self.load = load
+        self.data = data
+        self.end = load + len(data)
+        self.exec_address = exec_address
+        self.under_io = under_io
+
+
+def find_sys(data):
+    """The address of the SYS the first BASIC line starts with, or None"""
+    i = 4  # after the next line pointer and line number
+    while i < len(data) and data[i] == ord(' '):
+        i += 1
+    if i >= len(data) or data[i] != TOKEN_SYS:
+        return None
+    i += 1
+    while i < len(data) and data[i] in b' (':
+        i += 1
+    digits = b''
+    while i < len(data) and ord('0') <= data[i] <= ord('9'):
+        digits += data[i:i + 1]
+        if int(digits) > 0xffff:
+            return None
+        i += 1
+    return int(digits) if digits else None
+
+
+def overlaps(start, end, range_start, range_end):
+    return start < range_end and range_start < end
+
+
+def parse(file, exec_address=None):
+    """Return a Prg, or raise PrgError with the same reasons as prg_parse()"""
+    if len(file) < 3:
+        raise PrgError('too short')
+    load = file[0] | (file[1] << 8)
+    data = bytes(file[2:])
+    end = load + len(data)
+    if end > 0x10000:
+        raise PrgError('runs past $FFFF')
+    if overlaps(load, end, 0x0000, 0x0002):
+        raise PrgError('loads over $00-$01')
+    if overlaps(load, end, 0x8000, 0xc000):
+        raise PrgError('loads under the cartridge at $8000-$BFFF')
+    if not exec_address and load == BASIC_START:
+        exec_address = find_sys(data)
+        if not exec_address:
+            raise PrgError('BASIC program with no SYS')
+    return Prg(load, data, exec_address or load, overlaps(load, end, IO_START, IO_END))
+
+
+class CPrg(ctypes.Structure):
+    _fields_ = [('load', ctypes.c_uint16), ('end', ctypes.c_uint32), ('exec', ctypes.c_uint16),
+                ('data', ctypes.c_void_p), ('size', ctypes.c_size_t), ('under_io', ctypes.c_bool)]
+
+
+class CLibrary:
+    """firmware/prg.c, compiled for the host, with the same parse() as this module"""
+
+    def __init__(self, build_dir):
+        self.lib = host_c.load(build_dir, 'prg.c')
+        self.lib.prg_error_name.restype = ctypes.c_char_p
+
+    def parse(self, file, exec_address=None):
+        """Like parse(), with prg_parse()'s error names in the PrgError"""
+        file = bytes(file)
+        parsed = CPrg()
+        error = self.lib.prg_parse(file, ctypes.c_size_t(len(file)),
+                                   ctypes.c_uint16(exec_address or 0), ctypes.byref(parsed))
+        if error:
+            raise PrgError(self.lib.prg_error_name(error).decode())
+        program = Prg(parsed.load, ctypes.string_at(parsed.data, parsed.size), parsed.exec,
+                      parsed.under_io)
+        program.end = parsed.end
+        return program
+
+
+def drive_1541_seconds(size):
+    """Estimated time for a stock 1541 to LOAD a file of size bytes (without the search)"""
+    return size / DRIVE_1541_BYTES_PER_SECOND
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('prg')
+    parser.add_argument('--exec', dest='exec_address', type=lambda s: int(s, 0),
+                        help='start address, instead of the SYS or load address')
+    args = parser.parse_args()
+
+    with open(args.prg, 'rb') as f:
+        try:
+            prg = parse(f.read(), args.exec_address)
+        except PrgError as e:
+            sys.exit(f'{args.prg}: {e}')
+    print(f'${prg.load:04X}-${prg.end - 1:04X} ({len(prg.data)} bytes), '
+          f'start ${prg.exec_address:04X}' + (', under I/O' if prg.under_io else ''))
+    print(f'1541: about {drive_1541_seconds(len(prg.data)):.1f} s')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,167 @@
+#!/usr/bin/env python
+"""Load .prg files through the cartridge on the emulated 6502, and compare with a 1541.
+
+Each file is parsed by firmware/prg.c and tools/prg.py, which must agree, and served the way
+the "run" USB command serves it (see loader_sim.py --prg).  firmware/prg.c and copy_gen.c are
+compiled with the host's C compiler ($CC, default cc) and called through ctypes, and each chunk
+of the routine they generate, with I/O banked out or not, must be byte for byte what
+tools/copy_gen.py gives.  The loader must reach the file's start address with every byte in
+place, including any under the I/O area, and files the cartridge can't load must be rejected
+by both parsers with the same reason.
+
+The built-in files are raspi.nuf and three generated programs: a BASIC program that starts with
+SYS, one that loads through the I/O area, and one that starts and ends part way through chunks
+either side of it.  Pass .prg files to test those instead:
+
+    python tools/prg_test.py
+    python tools/prg_test.py game.prg demo.prg
+"""
+import argparse
+import os
+import random
+import sys
+import tempfile
+
+import c64cart
+import copy_gen
+import loader_sim
+import prg
+
+
+def basic_sys_prg(size):
+    """A BASIC program "10 SYS2064" followed by code and data, size bytes in all"""
+    line = bytes([0x0c, 0x08, 10, 0, prg.TOKEN_SYS]) + b'2064' + bytes([0, 0, 0])
+    data = bytes(random.Random(1).randrange(256) for _ in range(size - (0x0810 - 0x0801)))
+    return bytes([0x01, 0x08]) + line + bytes(0x0810 - 0x0801 - len(line)) + data
+
+
+def io_prg():
+    """Code and data from $C000 to $DFFF, under the I/O area"""
+    data = bytes(random.Random(2).randrange(256) for _ in range(0x2000))
+    return bytes([0x00, 0xc0]) + data
+
+
+def across_io_prg():
+    """$CC00-$E122, starting and ending part way through chunks either side of the I/O area"""
+    data = bytes(random.Random(3).randrange(256) for _ in range(0x1523))
+    return bytes([0x00, 0xcc]) + data
+
+
+def builtin_files():
+    with open(os.path.join(loader_sim.C64_ROM_DIR, 'raspi.nuf'), 'rb') as f:
+        yield 'raspi.nuf (exec $3000)', f.read(), 0x3000
+    yield 'BASIC with SYS 2064', basic_sys_prg(0x4000), None
+    yield '$C000-$DFFF under I/O', io_prg(), None
+    yield '$CC00-$E122 across I/O', across_io_prg(), None
+
+
+def rejected_files():
+    yield 'under the cartridge', bytes([0x00, 0x70]) + bytes(0x2000)
+    yield 'BASIC without SYS', bytes([0x01, 0x08, 0x0b, 0x08, 10, 0, 0x99, 0x22, 0x48, 0x22,
+                                      0, 0, 0])
+    yield 'over the CPU port', bytes([0x00, 0x00]) + bytes(16)
+
+
+def parse_both(prg_c, file, exec_address=None):
+    """The file parsed by prg.c, and error messages where prg.py disagrees.  Raises PrgError if
+    both refuse it for the same reason."""
+    try:
+        program = prg.parse(file, exec_address)
+    except prg.PrgError as e:
+        program = e
+    try:
+        parsed = prg_c.parse(file, exec_address)
+    except prg.PrgError as e:
+        if isinstance(program, prg.PrgError) and str(program) == str(e):
+            raise
+        return None, [f'prg.c refuses it ({e}), prg.py says {program}']
+    if isinstance(program, prg.PrgError):
+        return None, [f'prg.py refuses it ({program}), prg.c doesn\'t']
+    fields = ('load', 'end', 'exec_address', 'under_io', 'data')
+    return parsed, [f'prg.c {name} is {getattr(parsed, name)!r:.40}, prg.py '
+                    f'{getattr(program, name)!r:.40}' for name in fields
+                    if getattr(parsed, name) != getattr(program, name)]
+
+
+def check_routine(copy_gen_c, program, config):
+    """Error messages for chunks and stubs copy_gen.c generates differently from copy_gen.py,
+    and the number of chunks with I/O banked out"""
+    errors = []
+    banked = 0
+    for offset in range(0, len(program.data), copy_gen.CHUNK_SIZE):
+        start = program.load + offset
+        end = min(program.end, start + copy_gen.CHUNK_SIZE)
+        under_io = start < prg.IO_END and prg.IO_START < end
+        banked += under_io
+        code = copy_gen_c.chunk(program.data, offset, config)
+        if code != copy_gen.chunk(program.data, offset, config):
+            errors.append(f'chunk at ${start:04X}' + (' (I/O banked out)' if under_io else '')
+                          + ' differs from copy_gen.py')
+    if copy_gen_c.stubs(config) != copy_gen.stubs(config):
+        errors.append('stubs differ from copy_gen.py')
+    return errors, banked
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('prgs', nargs='*', metavar='prg')
+    parser.add_argument('--loader', default=os.path.join(loader_sim.C64_ROM_DIR,
+                                                         'loader_rom.bin'))
+    parser.add_argument('--video', choices=c64cart.PHI2_HZ, default='pal')
+    parser.add_argument('--command-us', type=float, default=20.0,
+                        help='time for the Pico to handle CMD_NEXT_PAGE (default %(default)s)')
+    args = parser.parse_args()
+
+    with open(args.loader, 'rb') as f:
+        loader = f.read()
+    files = builtin_files()
+    if args.prgs:
+        files = [(path, open(path, 'rb').read(), None) for path in args.prgs]
+
+    failures = 0
+    with tempfile.TemporaryDirectory() as build_dir:
+        prg_c = prg.CLibrary(build_dir)
+        copy_gen_c = copy_gen.CLibrary(build_dir)
+        for name, file, exec_address in files:
+            try:
+                program, errors = parse_both(prg_c, file, exec_address)
+            except prg.PrgError as e:
+                print(f'{name}: FAIL: {e}')
+                failures += 1
+                continue
+            if not program:
+                print(f'{name}: FAIL: {errors[0]}')
+                failures += 1
+                continue
+            config = copy_gen.Config(dest=program.load, exec_address=program.exec_address)
+            routine_errors, banked = check_routine(copy_gen_c, program, config)
+            errors += routine_errors
+            cartridge, cpu, _, _ = loader_sim.load(loader, program.data, config, 'immediate',
+                                                   args.video, args.command_us)
+            seconds = cpu.cycles / c64cart.PHI2_HZ[args.video]
+            drive = prg.drive_1541_seconds(len(program.data))
+            error = loader_sim.check(cartridge)
+            if error:
+                errors.append(error)
+            print(f'{name}: ${program.load:04X}-${program.end - 1:04X} start '
+                  f'${program.exec_address:04X}, {banked} chunks with I/O banked out, '
+                  f'{seconds * 1000:.1f} ms (1541 about {drive:.1f} s, {drive / seconds:.0f}x)'
+                  + ''.join(f'  FAIL: {e}' for e in errors))
+            failures += bool(errors)
+
+        if not args.prgs:
+            for name, file in rejected_files():
+                try:
+                    _, errors = parse_both(prg_c, file)
+                    print(f'{name}: FAIL: ' + (errors[0] if errors else 'not rejected'))
+                    failures += 1
+                except prg.PrgError as e:
+                    print(f'{name}: rejected ({e})')
+
+    print(f'{failures} failed' if failures else 'all OK')
+    sys.exit(1 if failures else 0)
+
+
+if __name__ == '__main__':
+    main()
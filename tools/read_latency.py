@@ -0,0 +1,157 @@
+#!/usr/bin/env python
+"""Fetch and show the read latency histogram from the Pico.
+
+The firmware measures how long each read from the C64 takes to answer, from ROML or ROMH going
+low to OE going low, after the "latency on" USB command (see firmware/read_latency.h).  This
+reads the histogram with the "latency" command and prints it with the percentiles, converting
+PIO cycles to nanoseconds at --sys-clock.  --csv prints one "cycles,ns,reads" line per bin for
+a spreadsheet.  --on and --reset start it or empty it first:
+
+    python tools/read_latency.py --on
+    python tools/read_latency.py --csv > latency.csv
+
+The binning and the text format are repeated here from read_latency.c so
+tools/read_latency_test.py has something to compare it with.
+"""
+import argparse
+import sys
+
+LIMIT = 55          # READ_LATENCY_LIMIT
+BINS = LIMIT + 1
+UNANSWERED = 0xffffffff
+
+
+def cycles(bin_index):
+    """The most PIO cycles a read in the bin took: the PIO program checks OE 2 cycles after it
+    sees the ROM line go low, and every 2 cycles after that"""
+    return 2 * (bin_index + 1)
+
+
+class Histogram:
+    def __init__(self):
+        self.bins = [0] * BINS
+        self.unanswered = 0
+
+    def add(self, count):
+        """Add a count pushed by the read_latency PIO program"""
+        if count > LIMIT:
+            self.unanswered += 1
+        else:
+            self.bins[LIMIT - count] += 1
+
+    @property
+    def reads(self):
+        return sum(self.bins)
+
+    def percentile(self, permille):
+        """PIO cycles that permille thousandths of the answered reads are within"""
+        needed = -(-self.reads * permille // 1000)
+        seen = 0
+        for index, count in enumerate(self.bins):
+            seen += count
+            if seen and seen >= needed:
+                return cycles(index)
+        return 0
+
+    def export(self):
+        """The text the "latency" USB command prints before its OK"""
+        lines = [f'LATENCY reads {self.reads} unanswered {self.unanswered} '
+                 f'p50 {self.percentile(500)} p99 {self.percentile(990)} '
+                 f'max {self.percentile(1000)}']
+        lines += [f'BIN {cycles(index)} {count}' for index, count in enumerate(self.bins) if count]
+        return ''.join(line + '\n' for line in lines)
+
+
+class ExportError(ValueError):
+    pass
+
+
+def parse_export(lines):
+    """Return a Histogram and the summary (reads, unanswered, p50, p99, max) from the lines the
+    "latency" USB command prints, up to its OK.  Other lines are log output and are skipped."""
+    histogram = Histogram()
+    summary = None
+    for line in lines:
+        words = line.split()
+        if not words:
+            continue
+        if words[0] == 'OK':
+            break
+        if words[0] == 'ERR':
+            raise ExportError(line.strip())
+        if words[0] == 'LATENCY':
+            fields = dict(zip(words[1::2], words[2::2]))
+            try:
+                summary = tuple(int(fields[key]) for key in
+                                ('reads', 'unanswered', 'p50', 'p99', 'max'))
+            except (KeyError, ValueError):
+                raise ExportError(f'bad summary: {line.strip()}')
+            histogram.unanswered = summary[1]
+        elif words[0] == 'BIN':
+            if len(words) != 3 or not words[1].isdigit() or not words[2].isdigit():
+                raise ExportError(f'bad bin: {line.strip()}')
+            bin_cycles, count = int(words[1]), int(words[2])
+            if bin_cycles % 2 or not 2 <= bin_cycles <= cycles(LIMIT):
+                raise ExportError(f'no bin for {bin_cycles} cycles')
+            histogram.bins[bin_cycles // 2 - 1] = count
+    if summary is None:
+        raise ExportError('no LATENCY line')
+    if summary[0] != histogram.reads:
+        raise ExportError(f'summary has {summary[0]} reads, bins have {histogram.reads}')
+    return histogram, summary
+
+
+def command(port, text):
+    """Send a USB command and return its lines up to the OK"""
+    port.write(f'{text}\n'.encode())
+    lines = []
+    while True:
+        line = port.readline().decode('ascii', 'replace')
+        if not line:
+            raise TimeoutError('no response from pico')
+        lines.append(line)
+        if line.startswith(('OK', 'ERR')):
+            return lines
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--port', default='/dev/ttyACM0')
+    parser.add_argument('--sys-clock', metavar='MHZ', type=float, default=125.0,
+                        help='RP2040 system clock, for nanoseconds (default %(default)s)')
+    parser.add_argument('--on', action='store_true', help='start measuring first')
+    parser.add_argument('--reset', action='store_true', help='empty the histogram first')
+    parser.add_argument('--csv', action='store_true', help='print the bins as CSV')
+    args = parser.parse_args()
+
+    import serial  # pyserial, only needed when talking to the hardware
+
+    with serial.Serial(args.port, timeout=2) as port:
+        for flag, text in ((args.on, 'latency on'), (args.reset, 'latency reset')):
+            if flag:
+                command(port, text)
+        try:
+            histogram, (reads, unanswered, p50, p99, worst) = parse_export(
+                command(port, 'latency'))
+        except ExportError as e:
+            sys.exit(f'pico: {e}')
+
+    ns = 1000.0 / args.sys_clock
+    if args.csv:
+        print('cycles,ns,reads')
+        for index, count in enumerate(histogram.bins):
+            print(f'{cycles(index)},{cycles(index) * ns:.1f},{count}')
+        return
+    print(f'{reads} reads, {unanswered} unanswered')
+    for name, value in (('p50', p50), ('p99', p99), ('max', worst)):
+        print(f'{name}: {value} PIO cycles ({value * ns:.0f} ns)')
+    peak = max(histogram.bins) or 1
+    for index, count in enumerate(histogram.bins):
+        if count:
+            print(f'{cycles(index):4} {cycles(index) * ns:6.0f} ns {count:10} '
+                  + '#' * max(1, count * 50 // peak))
+
+
+if __name__ == '__main__':
+    main()
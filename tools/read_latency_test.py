@@ -0,0 +1,173 @@
+#!/usr/bin/env python
+"""Test the read latency histogram in firmware/read_latency.c against tools/read_latency.py.
+
+read_latency.c is compiled with the host's C compiler ($CC, default cc) and called through
+ctypes.  Each case is a list of counts as the read_latency PIO program pushes them; both must
+bin them the same, give the same p50, p99 and max, and export the same text, which
+read_latency.py must parse back into the same histogram.  The limit must be the same in
+read_latency.pio, read_latency.h and read_latency.py, and broken exports must be refused:
+
+    python tools/read_latency_test.py
+"""
+import ctypes
+import os
+import random
+import sys
+import tempfile
+
+import host_c
+import pioparse
+import read_latency
+
+FIRMWARE_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'firmware')
+
+
+class CHistogram(ctypes.Structure):
+    _fields_ = [('bins', ctypes.c_uint32 * read_latency.BINS), ('unanswered', ctypes.c_uint32)]
+
+
+class CLatency:
+    """firmware/read_latency.c, compiled for the host"""
+
+    def __init__(self, build_dir):
+        self.lib = host_c.load(build_dir, 'read_latency.c')
+        self.lib.read_latency_reads.restype = ctypes.c_uint32
+        self.lib.read_latency_percentile.restype = ctypes.c_uint
+        self.lib.read_latency_export.restype = ctypes.c_size_t
+
+    def histogram(self, counts):
+        histogram = CHistogram()
+        self.lib.read_latency_reset(ctypes.byref(histogram))
+        for count in counts:
+            self.lib.read_latency_add(ctypes.byref(histogram), ctypes.c_uint32(count))
+        return histogram
+
+    def percentile(self, histogram, permille):
+        return self.lib.read_latency_percentile(ctypes.byref(histogram), permille)
+
+    def export(self, histogram, size=None):
+        """The export text, and the length read_latency_export returned"""
+        size = 96 + read_latency.BINS * 20 if size is None else size
+        out = ctypes.create_string_buffer(size + 1)
+        length = self.lib.read_latency_export(ctypes.byref(histogram), out, ctypes.c_size_t(size))
+        return out.value.decode(), length
+
+
+def header_define(name):
+    return host_c.header_define('read_latency.h', name)
+
+
+def cases():
+    rng = random.Random(41)
+    limit = read_latency.LIMIT
+    yield 'empty', []
+    yield 'one read', [limit - 10]
+    yield 'all unanswered', [read_latency.UNANSWERED] * 5
+    yield 'edges', [0, limit, limit + 1, read_latency.UNANSWERED, 0x80000000]
+    # 99 fast reads and a slow one: p99 is the fast bin, max the slow one
+    yield '99 fast, 1 slow', [limit - 9] * 99 + [limit - 40]
+    # 98 fast and 2 slow: p99 is slow
+    yield '98 fast, 2 slow', [limit - 9] * 98 + [limit - 40] * 2
+    yield 'uniform', [rng.randrange(limit + 1) for _ in range(5000)]
+    yield 'like a read', [limit - rng.choice((9, 9, 9, 10, 10, 11, 16)) for _ in range(10000)]
+    yield 'mixed', [rng.choice((rng.randrange(limit + 1), read_latency.UNANSWERED))
+                    for _ in range(3000)]
+
+
+def check(c, name, counts):
+    """Error messages for one case"""
+    errors = []
+    expected = read_latency.Histogram()
+    for count in counts:
+        expected.add(count)
+    histogram = c.histogram(counts)
+    if list(histogram.bins) != expected.bins or histogram.unanswered != expected.unanswered:
+        errors.append('C and read_latency.py bin differently')
+    if c.lib.read_latency_reads(ctypes.byref(histogram)) != expected.reads:
+        errors.append('C counts the reads differently')
+    for permille in (0, 1, 500, 990, 999, 1000):
+        got = c.percentile(histogram, permille)
+        if got != expected.percentile(permille):
+            errors.append(f'{permille} permille: C {got}, read_latency.py '
+                          f'{expected.percentile(permille)}')
+
+    text, length = c.export(histogram)
+    if text != expected.export() or length != len(text):
+        errors.append('C and read_latency.py export differently')
+    try:
+        parsed, summary = read_latency.parse_export(
+            ['log output\n'] + text.splitlines(True) + ['OK\n', 'BIN 2 1\n'])
+    except read_latency.ExportError as e:
+        errors.append(f'export doesn\'t parse: {e}')
+    else:
+        if parsed.bins != expected.bins or parsed.unanswered != expected.unanswered:
+            errors.append('parsed export differs')
+        if summary[2:] != tuple(expected.percentile(p) for p in (500, 990, 1000)):
+            errors.append('parsed percentiles differ')
+
+    # A short buffer gets a truncated export, and the full length like snprintf
+    short, short_length = c.export(histogram, 20)
+    if short != text[:19] or short_length != len(text):
+        errors.append('truncated export is wrong')
+    return errors
+
+
+def check_known(c):
+    """Error messages for a histogram worked out by hand: two reads answered 2 PIO cycles after
+    the ROM line fell, one after 8, and one not answered"""
+    limit = read_latency.LIMIT
+    histogram = c.histogram([limit, limit, limit - 3, read_latency.UNANSWERED])
+    text, _ = c.export(histogram)
+    expected = 'LATENCY reads 3 unanswered 1 p50 2 p99 8 max 8\nBIN 2 2\nBIN 8 1\n'
+    return [] if text == expected else [f'exports {text!r}, expected {expected!r}']
+
+
+def main():
+    failures = 0
+    limits = {'read_latency.pio': pioparse.parse(
+                  os.path.join(FIRMWARE_DIR, 'read_latency.pio'))['read_latency'].defines['LIMIT'],
+              'read_latency.h': header_define('READ_LATENCY_LIMIT'),
+              'read_latency.py': read_latency.LIMIT}
+    ok = len(set(limits.values())) == 1
+    print('limit: ' + (f'{read_latency.LIMIT}' if ok else f'FAIL: {limits}'))
+    failures += not ok
+
+    with tempfile.TemporaryDirectory() as build_dir:
+        c = CLatency(build_dir)
+        for name, counts in cases():
+            errors = check(c, name, counts)
+            expected = read_latency.Histogram()
+            for count in counts:
+                expected.add(count)
+            print(f'{name}: {expected.reads} reads, p50 {expected.percentile(500)} '
+                  f'p99 {expected.percentile(990)} max {expected.percentile(1000)}'
+                  + ''.join(f'  FAIL: {e}' for e in errors))
+            failures += bool(errors)
+        errors = check_known(c)
+        print('known histogram' + ''.join(f'  FAIL: {e}' for e in errors))
+        failures += bool(errors)
+
+    broken = [
+        ('no summary', ['BIN 2 1\n', 'OK\n']),
+        ('summary disagrees', ['LATENCY reads 2 unanswered 0 p50 2 p99 2 max 2\n', 'BIN 2 1\n',
+                               'OK\n']),
+        ('odd cycles', ['LATENCY reads 1 unanswered 0 p50 3 p99 3 max 3\n', 'BIN 3 1\n', 'OK\n']),
+        ('past the limit', ['LATENCY reads 1 unanswered 0 p50 2 p99 2 max 2\n',
+                            f'BIN {read_latency.cycles(read_latency.BINS)} 1\n', 'OK\n']),
+        ('error', ['ERR usage: latency [on|off|reset]\n']),
+    ]
+    for name, lines in broken:
+        try:
+            read_latency.parse_export(lines)
+            error = 'accepted'
+        except read_latency.ExportError:
+            error = None
+        print(f'refuse {name}' + (f'  FAIL: {error}' if error else ''))
+        failures += bool(error)
+
+    print(f'{failures} failed' if failures else 'all OK')
+    sys.exit(1 if failures else 0)
+
+
+if __name__ == '__main__':
+    main()
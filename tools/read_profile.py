@@ -0,0 +1,220 @@
+#!/usr/bin/env python
+"""Profile the C64 code running from the cartridge, from the addresses it reads.
+
+The firmware counts the addresses the C64 reads from the ROM window after the "profile on" USB
+command, in buckets of 1 to 256 bytes (see firmware/read_profile.h).  This fetches the histogram
+with the "profile" command and joins it with a KickAssembler symbol file, the .vs built with
+-vicesymbols or the .sym, to print the reads in each routine, busiest first.  A routine runs
+from its label to the next one in the window; a bucket is counted in the routine its first byte
+is in, so 1 byte buckets (--bucket 1, covering 4K from --start) split routines exactly.
+
+The cartridge port has no SYNC line, so every read counts, not only opcode fetches: a routine's
+reads include its operands and any data tables in it.
+
+    python tools/read_profile.py --on --bucket 1 --start a000
+    (run the code on the C64)
+    python tools/read_profile.py --symbols c64-rom/loader_rom.vs
+    python tools/read_profile.py --export profile.txt --symbols c64-rom/loader_rom.vs
+
+--export reads a saved copy of the "profile" output instead of asking the Pico.  Profile
+below bins reads into buckets exactly as read_profile.c does, so tools/read_profile_test.py can
+compare the two.
+"""
+import argparse
+import re
+import sys
+
+import loader_sim
+
+BUCKETS = 4096          # READ_PROFILE_BUCKETS
+BUCKET_MAX = 256        # READ_PROFILE_BUCKET_MAX
+WINDOW = 0x8000         # READ_PROFILE_WINDOW
+WINDOW_SIZE = 0x4000    # READ_PROFILE_WINDOW_SIZE
+
+
+class Profile:
+    def __init__(self, start=WINDOW, bucket=16):
+        if not WINDOW <= start < WINDOW + WINDOW_SIZE:
+            raise ValueError(f'start ${start:04X} is outside the window')
+        if bucket < 1 or bucket > BUCKET_MAX or bucket & (bucket - 1):
+            raise ValueError(f'bucket size {bucket} isn\'t a power of two up to {BUCKET_MAX}')
+        self.start = start
+        self.bucket = bucket
+        self.buckets = [0] * BUCKETS
+        self.reads = 0
+        self.outside = 0
+
+    def add(self, address):
+        """Add a read of a RAM address pushed by the read program"""
+        offset = WINDOW + (address & (WINDOW_SIZE - 1)) - self.start
+        index = offset // self.bucket
+        if 0 <= index < BUCKETS:
+            self.buckets[index] += 1
+            self.reads += 1
+        else:
+            self.outside += 1
+
+    def address(self, index):
+        """C64 address of the first byte in a bucket"""
+        return (self.start + index * self.bucket) & 0xffff
+
+    def hits(self):
+        """(address, reads) for each bucket with reads in it"""
+        return [(self.address(index), reads) for index, reads in enumerate(self.buckets) if reads]
+
+    def export(self):
+        """The text the "profile" USB command prints before its OK"""
+        lines = [f'PROFILE start {self.start:04X} bucket {self.bucket} reads {self.reads} '
+                 f'outside {self.outside}']
+        lines += [f'HITS {address:04X} {reads}' for address, reads in self.hits()]
+        return ''.join(line + '\n' for line in lines)
+
+
+class ExportError(ValueError):
+    pass
+
+
+def parse_export(lines):
+    """Return a Profile from the lines the "profile" USB command prints, up to its OK.  Other
+    lines are log output and are skipped.  The firmware keeps counting while it prints, so the
+    buckets can add up to more than the summary's reads."""
+    profile = None
+    for line in lines:
+        words = line.split()
+        if not words:
+            continue
+        if words[0] == 'OK':
+            break
+        if words[0] == 'ERR':
+            raise ExportError(line.strip())
+        if words[0] == 'PROFILE':
+            fields = dict(zip(words[1::2], words[2::2]))
+            try:
+                profile = Profile(int(fields['start'], 16), int(fields['bucket']))
+                profile.reads, profile.outside = int(fields['reads']), int(fields['outside'])
+            except (KeyError, ValueError) as e:
+                raise ExportError(f'bad summary: {line.strip()} ({e})')
+        elif words[0] == 'HITS':
+            if profile is None:
+                raise ExportError('HITS before the PROFILE line')
+            try:
+                address, reads = int(words[1], 16), int(words[2])
+            except (IndexError, ValueError):
+                raise ExportError(f'bad line: {line.strip()}')
+            offset = (address - profile.start) & 0xffff
+            if offset % profile.bucket or offset // profile.bucket >= BUCKETS:
+                raise ExportError(f'no bucket at ${address:04X}')
+            profile.buckets[offset // profile.bucket] = reads
+    if profile is None:
+        raise ExportError('no PROFILE line')
+    return profile
+
+
+def read_symbols(path):
+    """Address -> label from a KickAssembler symbol file: a .vs in VICE's format, or a .sym,
+    where labels in a .namespace get its name in front"""
+    if path.endswith('.vs'):
+        return loader_sim.read_symbols(path)
+    symbols = {}
+    namespaces = []
+    with open(path) as f:
+        for line in f:
+            namespace = re.match(r'\s*\.namespace\s+(\w+)\s*\{', line)
+            label = re.match(r'\s*\.label\s+([\w.]+)\s*=\s*\$([0-9a-fA-F]+)', line)
+            if namespace:
+                namespaces.append(namespace.group(1))
+            elif label:
+                name = '.'.join(namespaces + [label.group(1)])
+                symbols.setdefault(int(label.group(2), 16), name)
+            elif line.strip() == '}' and namespaces:
+                namespaces.pop()
+    return symbols
+
+
+def routines(profile, symbols):
+    """(label, first address, last address, reads) for each routine with reads in it, busiest
+    first.  Reads before the first label in the window are in one named by its address."""
+    labels = sorted((address, name) for address, name in symbols.items()
+                    if WINDOW <= address < WINDOW + WINDOW_SIZE)
+    if not labels or labels[0][0] > WINDOW:
+        labels.insert(0, (WINDOW, f'${WINDOW:04X}'))
+    ends = [address - 1 for address, _ in labels[1:]] + [WINDOW + WINDOW_SIZE - 1]
+    reads = [0] * len(labels)
+    index = 0
+    for address, count in profile.hits():
+        if not WINDOW <= address < WINDOW + WINDOW_SIZE:
+            continue
+        while index + 1 < len(labels) and labels[index + 1][0] <= address:
+            index += 1
+        reads[index] += count
+    found = [(name, start, end, count)
+             for (start, name), end, count in zip(labels, ends, reads) if count]
+    return sorted(found, key=lambda routine: (-routine[3], routine[1]))
+
+
+def report(profile, symbols, top=None):
+    """The per-routine profile as text"""
+    total = sum(reads for _, reads in profile.hits())
+    lines = [f'{total} reads in {profile.bucket} byte buckets from ${profile.start:04X}, '
+             f'{profile.outside} outside']
+    found = routines(profile, symbols)
+    peak = found[0][3] if found else 1
+    for name, start, end, reads in found[:top]:
+        lines.append(f'{name:>20} ${start:04X}-${end:04X} {reads:10} '
+                     f'{100 * reads / total:5.1f}% ' + '#' * max(1, reads * 40 // peak))
+    return ''.join(line + '\n' for line in lines)
+
+
+def command(port, text):
+    """Send a USB command and return its lines up to the OK"""
+    port.write(f'{text}\n'.encode())
+    lines = []
+    while True:
+        line = port.readline().decode('ascii', 'replace')
+        if not line:
+            raise TimeoutError('no response from pico')
+        lines.append(line)
+        if line.startswith(('OK', 'ERR')):
+            return lines
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--port', default='/dev/ttyACM0')
+    parser.add_argument('--symbols', help='KickAssembler .vs or .sym file for the code')
+    parser.add_argument('--export', help='read a saved "profile" output instead of the Pico')
+    parser.add_argument('--on', action='store_true', help='start profiling from empty')
+    parser.add_argument('--off', action='store_true', help='stop profiling after fetching it')
+    parser.add_argument('--bucket', type=int, default=16,
+                        help='bucket size in bytes for --on (default %(default)s)')
+    parser.add_argument('--start', type=lambda s: int(s, 16), default=WINDOW,
+                        help='hex C64 address of the first bucket for --on (default 8000)')
+    parser.add_argument('--top', type=int, help='only print the busiest TOP routines')
+    args = parser.parse_args()
+
+    symbols = read_symbols(args.symbols) if args.symbols else {}
+    try:
+        if args.export:
+            with open(args.export) as f:
+                profile = parse_export(f)
+        else:
+            import serial  # pyserial, only needed when talking to the hardware
+
+            with serial.Serial(args.port, timeout=2) as port:
+                if args.on:
+                    response = command(port, f'profile on {args.bucket} {args.start:04X}')
+                    if response[-1].startswith('ERR'):
+                        sys.exit(f'pico: {response[-1].strip()}')
+                    print('profiling; run this again without --on for the profile')
+                    return
+                profile = parse_export(command(port, 'profile'))
+                if args.off:
+                    command(port, 'profile off')
+    except ExportError as e:
+        sys.exit(f'pico: {e}')
+    print(report(profile, symbols, args.top), end='')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,292 @@
+#!/usr/bin/env python
+"""Test the read profile in firmware/read_profile.c against tools/read_profile.py.
+
+read_profile.c is compiled with the host's C compiler ($CC, default cc) and called through
+ctypes.  Each case is a bucket size, a start address and a list of RAM addresses as the read
+program pushes them; both must bin them the same and export the same text, a buffer at a time,
+which read_profile.py must parse back.  Both must refuse the same bucket sizes and starts, and
+the sizes in read_profile.h and read_profile.py must match.
+
+The symbol join is checked on .vs and .sym files with known routines, and on a profile of the
+loader loading the NUFLI image on the emulated 6502 (tools/loader_sim.py): every read of the
+window must end up in the routine it was read from.
+
+    python tools/read_profile_test.py
+"""
+import ctypes
+import os
+import random
+import sys
+import tempfile
+
+import copy_gen
+import host_c
+import loader_sim
+import mos6502
+import read_profile
+
+
+# The ROM window has to be 16K aligned in the Pico's RAM, like rom_data
+RAM_BASE = 0x20008000
+
+
+class CProfile(ctypes.Structure):
+    _fields_ = [('buckets', ctypes.c_uint32 * read_profile.BUCKETS), ('start', ctypes.c_uint16),
+                ('shift', ctypes.c_uint8), ('reads', ctypes.c_uint32),
+                ('outside', ctypes.c_uint32)]
+
+
+class CReadProfile:
+    """firmware/read_profile.c, compiled for the host"""
+
+    def __init__(self, build_dir):
+        self.lib = host_c.load(build_dir, 'read_profile.c')
+        self.lib.read_profile_reset.restype = ctypes.c_bool
+        self.lib.read_profile_summary.restype = ctypes.c_size_t
+        self.lib.read_profile_export.restype = ctypes.c_size_t
+
+    def profile(self, start, bucket, addresses):
+        """The profile, or None if read_profile_reset refuses start and bucket"""
+        profile = CProfile()
+        if not self.lib.read_profile_reset(ctypes.byref(profile), start, bucket):
+            return None
+        for address in addresses:
+            self.lib.read_profile_add(ctypes.byref(profile), ctypes.c_uint32(address))
+        return profile
+
+    def export(self, profile, size):
+        """The export text, the summary then HITS lines a size byte buffer at a time, and
+        whether every buffer was within size"""
+        out = ctypes.create_string_buffer(max(size, header_define('READ_PROFILE_SUMMARY_MAX')))
+        self.lib.read_profile_summary(ctypes.byref(profile), out, ctypes.c_size_t(len(out)))
+        text = out.value.decode()
+        fits = True
+        bucket = ctypes.c_uint(0)
+        while bucket.value < read_profile.BUCKETS:
+            length = self.lib.read_profile_export(ctypes.byref(profile), ctypes.byref(bucket),
+                                                  out, ctypes.c_size_t(size))
+            fits &= length < size and length == len(out.value)
+            text += out.value.decode()
+        return text, fits
+
+
+def header_define(name):
+    return host_c.header_define('read_profile.h', name)
+
+
+def cases():
+    rng = random.Random(43)
+    window = [RAM_BASE + offset for offset in range(read_profile.WINDOW_SIZE)]
+    yield 'empty', 0x8000, 16, []
+    yield 'whole window', 0x8000, 16, window
+    yield 'bytes from $8000', 0x8000, 1, window
+    yield 'bytes from $A000', 0xa000, 1, window
+    yield 'unaligned start', 0x8123, 4, window
+    yield 'big buckets', 0xbf00, 256, window
+    yield 'random', 0x8400, 2, [RAM_BASE + rng.randrange(0x4000) for _ in range(20000)]
+    yield 'other bank', 0x8000, 8, [0x2003c000 + rng.randrange(0x4000) for _ in range(1000)]
+    yield 'last byte', 0xbfff, 1, [RAM_BASE + 0x3fff, RAM_BASE + 0x3ffe]
+    for start, bucket in ((0x7fff, 16), (0xc000, 16), (0x8000, 0), (0x8000, 3), (0x8000, 512),
+                          (0x8000, 0x80000001), (0x18000, 16)):
+        yield f'refuse start ${start:04X} bucket {bucket}', start, bucket, []
+
+
+def check(c, name, start, bucket, addresses):
+    """Error messages for one case"""
+    try:
+        expected = read_profile.Profile(start, bucket)
+    except ValueError:
+        expected = None
+    profile = c.profile(start, bucket, addresses)
+    if (profile is None) != (expected is None):
+        return ['C and read_profile.py disagree on refusing it']
+    if expected is None:
+        return []
+
+    errors = []
+    for address in addresses:
+        expected.add(address)
+    if list(profile.buckets) != expected.buckets or profile.reads != expected.reads \
+            or profile.outside != expected.outside:
+        errors.append('C and read_profile.py bin differently')
+    for size in (header_define('READ_PROFILE_LINE_MAX'), 100, 1024):
+        text, fits = c.export(profile, size)
+        if text != expected.export():
+            errors.append(f'C and read_profile.py export differently with {size} byte buffers')
+        if not fits:
+            errors.append(f'export overran or miscounted a {size} byte buffer')
+    try:
+        parsed = read_profile.parse_export(['log\n'] + expected.export().splitlines(True)
+                                           + ['OK\n', 'HITS 8000 1\n'])
+    except read_profile.ExportError as e:
+        errors.append(f'export doesn\'t parse: {e}')
+    else:
+        if (parsed.start, parsed.bucket, parsed.buckets, parsed.reads, parsed.outside) != \
+                (expected.start, expected.bucket, expected.buckets, expected.reads,
+                 expected.outside):
+            errors.append('parsed export differs')
+    return errors
+
+
+def check_known(c):
+    """Error messages for a profile worked out by hand: 16 byte buckets from $8000, with reads of
+    $8000, $8001 and $8020, and one of $8000 through the RAM's other alias"""
+    profile = c.profile(0x8000, 16, [RAM_BASE, RAM_BASE + 1, RAM_BASE + 0x20, 0x20030000])
+    text, _ = c.export(profile, 1024)
+    expected = ('PROFILE start 8000 bucket 16 reads 4 outside 0\nHITS 8000 3\n'
+                'HITS 8020 1\n')
+    return [] if text == expected else [f'exports {text!r}, expected {expected!r}']
+
+
+def check_symbols(build_dir):
+    """Error messages for the symbol files and the join"""
+    errors = []
+    vs = os.path.join(build_dir, 'code.vs')
+    with open(vs, 'w') as f:
+        f.write('al C:0400 .screen\nal C:8000 .start\nal C:8010 .loop\nal C:8020 .table\n'
+                'al C:a000 .copy\n')
+    sym = os.path.join(build_dir, 'code.sym')
+    with open(sym, 'w') as f:
+        f.write('.label screen=$0400\n.label start=$8000\n.namespace copy {\n'
+                '    .label loop=$a000\n}\n.label table=$8020\n')
+    if read_profile.read_symbols(vs) != {0x400: 'screen', 0x8000: 'start', 0x8010: 'loop',
+                                         0x8020: 'table', 0xa000: 'copy'}:
+        errors.append('.vs read wrong')
+    if read_profile.read_symbols(sym) != {0x400: 'screen', 0x8000: 'start',
+                                          0xa000: 'copy.loop', 0x8020: 'table'}:
+        errors.append('.sym read wrong')
+
+    symbols = read_profile.read_symbols(vs)
+    profile = read_profile.Profile(0x8000, 1)
+    for address, reads in ((0x8000, 3), (0x800f, 1), (0x8010, 50), (0x801f, 50), (0x8020, 7),
+                           (0x8fff, 2)):
+        for _ in range(reads):
+            profile.add(RAM_BASE + address - 0x8000)
+    expected = [('loop', 0x8010, 0x801f, 100), ('table', 0x8020, 0x9fff, 9),
+                ('start', 0x8000, 0x800f, 4)]
+    if read_profile.routines(profile, symbols) != expected:
+        errors.append(f'join is wrong: {read_profile.routines(profile, symbols)}')
+
+    # 16 byte buckets are counted where they start, so $801F is before "start" like $8005, and
+    # reads before the first label get a routine of their own
+    profile = read_profile.Profile(0x8000, 16)
+    for address in (0x8005, 0x801f, 0x8025, 0xa00f, 0xbfff):
+        profile.add(RAM_BASE + address - 0x8000)
+    expected = [('$8000', 0x8000, 0x8017, 2), ('start', 0x8018, 0x9fff, 1),
+                ('copy', 0xa000, 0xbfff, 2)]
+    if sorted(read_profile.routines(profile, {0x8018: 'start', 0xa000: 'copy'}),
+              key=lambda r: r[1]) != expected:
+        errors.append('bucket join is wrong')
+    return errors
+
+
+class ProfiledCartridge(loader_sim.LoaderCartridge):
+    """The loader's cartridge, keeping the RAM address of each window read like read_program"""
+
+    def __init__(self, *args, **kwargs):
+        self.reads = []
+        super().__init__(*args, **kwargs)
+
+    def read(self, address):
+        if 0x8000 <= address < self.rom_end and not self.is_command_area(address):
+            self.reads.append(RAM_BASE + (address & 0x3fff))
+        return super().read(address)
+
+
+def check_loader(c):
+    """Error messages for profiling the loader loading the NUFLI image, and the report"""
+    with open(os.path.join(loader_sim.C64_ROM_DIR, 'loader_rom.bin'), 'rb') as f:
+        loader = f.read()
+    with open(os.path.join(loader_sim.C64_ROM_DIR, 'raspi.nuf'), 'rb') as f:
+        image = f.read()[2:]
+    config = copy_gen.Config(dest=0x2000, exec_address=0x3000)
+    cartridge = ProfiledCartridge(loader, image, config, 'sections')
+    for address in loader_sim.KERNAL_STUBS:
+        cartridge.ram[address] = 0x60  # rts
+    cpu = mos6502.Cpu(cartridge)
+    cartridge.attach(cpu)
+    cpu.pc = cpu.read16(0x8000)
+    while cpu.pc != config.exec_address:
+        if cpu.cycles > 10_000_000:
+            return [f'loader still running at ${cpu.pc:04X}']
+        cpu.step()
+
+    # The regions of the window main() sets up, as labels
+    symbols = {0x8000: 'loader', 0x8400: 'window', 0x8800: 'mailbox', 0xa000: 'copy_routine',
+               0xbf00: 'stubs'}
+    errors = []
+    for bucket in (1, 16):
+        profile = c.profile(0x8000, bucket, cartridge.reads)
+        if profile.reads + profile.outside != len(cartridge.reads):
+            errors.append(f'{bucket} byte buckets lost reads')
+        text, _ = c.export(profile, 1024)
+        found = read_profile.routines(read_profile.parse_export(text.splitlines(True)), symbols)
+        expected = {}
+        for address in cartridge.reads:
+            offset = address - RAM_BASE
+            if offset >= read_profile.BUCKETS * bucket:
+                continue
+            label = max(a for a in symbols if a <= 0x8000 + offset)
+            expected[symbols[label]] = expected.get(symbols[label], 0) + 1
+        got = {name: reads for name, _, _, reads in found}
+        if got != expected:
+            errors.append(f'{bucket} byte buckets: routines {got}, reads {expected}')
+    print(read_profile.report(read_profile.parse_export(text.splitlines(True)), symbols), end='')
+    return errors
+
+
+def main():
+    failures = 0
+    defines = {'READ_PROFILE_BUCKETS': read_profile.BUCKETS,
+               'READ_PROFILE_BUCKET_MAX': read_profile.BUCKET_MAX,
+               'READ_PROFILE_WINDOW': read_profile.WINDOW,
+               'READ_PROFILE_WINDOW_SIZE': read_profile.WINDOW_SIZE}
+    wrong = {name: header_define(name) for name, value in defines.items()
+             if header_define(name) != value}
+    print('defines: ' + (f'FAIL: {wrong}' if wrong else 'OK'))
+    failures += bool(wrong)
+
+    with tempfile.TemporaryDirectory() as build_dir:
+        c = CReadProfile(build_dir)
+        for name, start, bucket, addresses in cases():
+            errors = check(c, name, start, bucket, addresses)
+            print(f'{name}: {len(addresses)} reads' + ''.join(f'  FAIL: {e}' for e in errors))
+            failures += bool(errors)
+
+        errors = check_known(c)
+        print('known profile' + ''.join(f'  FAIL: {e}' for e in errors))
+        failures += bool(errors)
+
+        errors = check_symbols(build_dir)
+        print('symbols' + ''.join(f'  FAIL: {e}' for e in errors))
+        failures += bool(errors)
+
+        errors = check_loader(c)
+        print('loader profile' + ''.join(f'  FAIL: {e}' for e in errors))
+        failures += bool(errors)
+
+    broken = [
+        ('no summary', ['HITS 8000 1\n', 'OK\n']),
+        ('no PROFILE line', ['OK\n']),
+        ('bad start', ['PROFILE start 4000 bucket 16 reads 0 outside 0\n', 'OK\n']),
+        ('unaligned bucket', ['PROFILE start 8000 bucket 16 reads 1 outside 0\n',
+                              'HITS 8008 1\n', 'OK\n']),
+        ('past the buckets', ['PROFILE start 8000 bucket 1 reads 1 outside 0\n',
+                              'HITS 9000 1\n', 'OK\n']),
+        ('error', ['ERR usage: profile [on [bytes] [start]|off|reset]\n']),
+    ]
+    for name, lines in broken:
+        try:
+            read_profile.parse_export(lines)
+            error = 'accepted'
+        except read_profile.ExportError:
+            error = None
+        print(f'refuse {name}' + (f'  FAIL: {error}' if error else ''))
+        failures += bool(error)
+
+    print(f'{failures} failed' if failures else 'all OK')
+    sys.exit(1 if failures else 0)
+
+
+if __name__ == '__main__':
+    main()
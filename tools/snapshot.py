@@ -0,0 +1,245 @@
+#!/usr/bin/env python
+"""Read and write C64 memory snapshots, and generate the routine that restores them.
+
+firmware/snapshot.c reads the same files and writes the same restore routine.  A snapshot is
+the 64K of RAM, the CPU registers, and what was last written to the VIC-II, SID, CIA and colour
+RAM:
+
+    $000  "C64SNAP", then the version (1)
+    $008  PC (little endian), A, X, Y, SP, P, then the CPU port's $00 and $01
+    $020  VIC-II $D000-$D02E
+    $050  SID $D400-$D418
+    $070  CIA 1 $DC00-$DC0F, with the interrupt mask at $0D
+    $080  CIA 2 $DD00-$DD0F, the same
+    $100  colour RAM $D800-$DBE7, in the low nibbles
+    $500  RAM $0000-$FFFF
+
+The "run" USB command resumes one: the loader restores RAM from $0200 up with the immediate
+layout, and then runs restore_code() from the ROM window.  That writes the registers, zero
+page and the stack, and returns into the program with rti from a trampoline just below the
+stack pointer.
+
+info prints a snapshot's registers.  from-prg makes one that starts a .prg with the I/O set up
+like the KERNAL leaves it, for benchmarking the restore:
+
+    python tools/snapshot.py info game.snap
+    python tools/snapshot.py from-prg --exec 0x3000 c64-rom/raspi.nuf raspi.snap
+"""
+import argparse
+import struct
+import sys
+
+import prg
+
+MAGIC = b'C64SNAP'
+VERSION = 1
+CPU = 0x008
+VIC = 0x020
+SID = 0x050
+CIA1 = 0x070
+CIA2 = 0x080
+COLOR = 0x100
+RAM = 0x500
+SIZE = RAM + 0x10000
+
+VIC_REGS = 47
+SID_REGS = 25
+CIA_REGS = 16
+COLORS = 1000
+LOAD = 0x0200       # RAM below is restored by the routine
+STACK_USED = 16     # trampoline, 3 bytes for an NMI, and the rti frame, below the stack pointer
+
+LDA_IMM = 0xa9
+LDA_ABS = 0xad
+LDX_IMM = 0xa2
+LDY_IMM = 0xa0
+STA_ABS = 0x8d
+STA_ZP = 0x85
+TXS = 0x9a
+JMP = 0x4c
+RTI = 0x40
+
+VIC_IRQ = 0xd019
+VIC_COLLISIONS = (0xd01e, 0xd01f)
+CIA_ADDRESSES = (0xdc00, 0xdd00)
+CIA_ICR = 0x0d
+CIA_CRA = 0x0e
+CIA_CRB = 0x0f
+CIA_FORCE_LOAD = 0x10
+CIA_SET_MASK = 0x80
+PORT_LORAM = 0x01   # CPU port lines that map the cartridge in
+PORT_HIRAM = 0x02
+
+# I/O as the KERNAL leaves it after a reset, for from-prg
+KERNAL_VIC = bytes([0] * 16 + [0, 0x1b, 0, 0, 0, 0, 0x08, 0, 0x14, 0x0f, 0, 0, 0, 0, 0, 0,
+                    0x0e, 0x06, 0x01, 0x02, 0x03, 0x04, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+                    0x06, 0x07, 0x0c])
+KERNAL_CIA1 = bytes([0x7f, 0xff, 0xff, 0x00, 0x25, 0x40, 0xff, 0xff, 0, 0, 0, 0, 0, 0x81, 0x11,
+                     0x08])
+KERNAL_CIA2 = bytes([0x97, 0xff, 0x3f, 0x00, 0xff, 0xff, 0xff, 0xff, 0, 0, 0, 0, 0, 0x00, 0x08,
+                     0x08])
+
+
+class SnapshotError(ValueError):
+    pass
+
+
+class Snapshot:
+    def __init__(self, pc=0, a=0, x=0, y=0, sp=0xff, p=0x24, port_ddr=0x2f, port=0x37,
+                 vic=bytes(VIC_REGS), sid=bytes(SID_REGS), cia1=bytes(CIA_REGS),
+                 cia2=bytes(CIA_REGS), color=bytes(COLORS), ram=bytes(0x10000)):
+        self.pc, self.a, self.x, self.y, self.sp, self.p = pc, a, x, y, sp, p
+        self.port_ddr, self.port = port_ddr, port
+        self.vic, self.sid, self.cia1, self.cia2 = vic, sid, cia1, cia2
+        self.color, self.ram = color, ram
+
+
+def hidden_by_cartridge(port_ddr, port):
+    """The RAM the cartridge hides from a program with this CPU port setting, which it would see
+    on a C64 without one (see snapshot.h)"""
+    lines = port | ~port_ddr & 0xff     # lines set as inputs are pulled up
+    if lines & PORT_HIRAM and lines & PORT_LORAM:
+        return range(0x8000, 0xa000)    # ROML, and ROMH over BASIC
+    if lines & PORT_HIRAM:
+        return range(0xa000, 0xc000)    # ROMH
+    return range(0)
+
+
+def parse(data):
+    """Return a Snapshot, or raise SnapshotError like snapshot_parse()"""
+    if len(data) != SIZE or data[:len(MAGIC)] != MAGIC:
+        raise SnapshotError('not a snapshot')
+    if data[len(MAGIC)] != VERSION:
+        raise SnapshotError('newer snapshot version')
+    pc, a, x, y, sp, p, port_ddr, port = struct.unpack('<H7B', data[CPU:CPU + 9])
+    if sp < STACK_USED - 1:
+        raise SnapshotError('no room below the stack pointer')
+    if any(data[RAM + address] for address in hidden_by_cartridge(port_ddr, port)):
+        raise SnapshotError('uses RAM under the cartridge at $8000-$BFFF')
+    return Snapshot(pc, a, x, y, sp, p, port_ddr, port, data[VIC:VIC + VIC_REGS],
+                    data[SID:SID + SID_REGS], data[CIA1:CIA1 + CIA_REGS],
+                    data[CIA2:CIA2 + CIA_REGS], data[COLOR:COLOR + COLORS], data[RAM:])
+
+
+def build(snapshot):
+    data = bytearray(SIZE)
+    data[:len(MAGIC) + 1] = MAGIC + bytes([VERSION])
+    s = snapshot
+    data[CPU:CPU + 9] = struct.pack('<H7B', s.pc, s.a, s.x, s.y, s.sp, s.p, s.port_ddr, s.port)
+    for offset, block in ((VIC, s.vic), (SID, s.sid), (CIA1, s.cia1), (CIA2, s.cia2),
+                          (COLOR, s.color), (RAM, s.ram)):
+        data[offset:offset + len(block)] = block
+    return bytes(data)
+
+
+def store(address):
+    if address < 0x100:
+        return bytes([STA_ZP, address])
+    return bytes([STA_ABS, address & 0xff, address >> 8])
+
+
+def set_register(address, value):
+    return bytes([LDA_IMM, value]) + store(address)
+
+
+def sorted_stores(values, addresses):
+    """Store each value at its address, one lda # per value, in the order emit_sorted() uses"""
+    code = bytearray()
+    last = None
+    for value, address in sorted(zip(values, addresses), key=lambda pair: pair[0]):
+        if value != last:
+            code += bytes([LDA_IMM, value])
+            last = value
+        code += store(address)
+    return code
+
+
+def trampoline_address(snapshot):
+    return 0x100 + snapshot.sp - (STACK_USED - 1)
+
+
+def restore_code(snapshot, command_area=0x9e00, next_page=0x01):
+    """The routine that restores everything but RAM from LOAD up, like snapshot_restore_code()"""
+    s = snapshot
+    code = bytearray()
+    for reg in range(VIC_REGS):
+        address = 0xd000 + reg
+        if address != VIC_IRQ and address not in VIC_COLLISIONS:
+            code += set_register(address, s.vic[reg])
+    code += set_register(VIC_IRQ, 0xff)
+    for reg in range(SID_REGS):
+        code += set_register(0xd400 + reg, s.sid[reg])
+    code += sorted_stores([c & 0x0f for c in s.color], range(0xd800, 0xd800 + COLORS))
+
+    for base, regs in zip(CIA_ADDRESSES, (s.cia1, s.cia2)):
+        code += set_register(base + CIA_ICR, ~CIA_SET_MASK & 0xff)
+        for reg in range(8):
+            code += set_register(base + reg, regs[reg])
+        code += set_register(base + CIA_CRA, regs[CIA_CRA] | CIA_FORCE_LOAD)
+        code += set_register(base + CIA_CRB, regs[CIA_CRB] | CIA_FORCE_LOAD)
+        code += bytes([LDA_ABS, CIA_ICR, base >> 8])
+    code += set_register(CIA_ADDRESSES[0] + CIA_ICR, s.cia1[CIA_ICR] | CIA_SET_MASK)
+
+    low_ram = bytearray(s.ram[:0x200])
+    sp = 0x100 + s.sp
+    low_ram[sp - 2:sp + 1] = bytes([s.p, s.pc & 0xff, s.pc >> 8])
+    trampoline = trampoline_address(s)
+    command = command_area + next_page
+    low_ram[trampoline:trampoline + 10] = bytes([LDA_ABS, command & 0xff, command >> 8,
+                                                 LDA_IMM, s.port, STA_ZP, 0x01,
+                                                 LDA_IMM, s.a, RTI])
+    code += sorted_stores(low_ram[2:], range(2, 0x200))
+
+    code += set_register(0x00, s.port_ddr)
+    code += bytes([LDX_IMM, s.sp - 3, TXS])
+    code += set_register(CIA_ADDRESSES[1] + CIA_ICR, s.cia2[CIA_ICR] | CIA_SET_MASK)
+    code += bytes([LDX_IMM, s.x, LDY_IMM, s.y, JMP, trampoline & 0xff, trampoline >> 8])
+    return bytes(code)
+
+
+def from_prg(program):
+    """A snapshot that starts program with the I/O as the KERNAL leaves it"""
+    ram = bytearray(0x10000)
+    ram[program.load:program.end] = program.data
+    return Snapshot(pc=program.exec_address, sp=0xf6, p=0x24, vic=KERNAL_VIC,
+                    sid=bytes(SID_REGS), cia1=KERNAL_CIA1, cia2=KERNAL_CIA2,
+                    color=bytes([0x0e]) * COLORS, ram=bytes(ram))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    commands = parser.add_subparsers(dest='command', required=True)
+    info_parser = commands.add_parser('info', help='print the registers')
+    info_parser.add_argument('snapshot')
+    prg_parser = commands.add_parser('from-prg', help='make a snapshot that starts a .prg')
+    prg_parser.add_argument('--exec', dest='exec_address', type=lambda s: int(s, 0),
+                            help='start address, if the file has no BASIC SYS')
+    prg_parser.add_argument('prg')
+    prg_parser.add_argument('snapshot')
+    args = parser.parse_args()
+
+    if args.command == 'from-prg':
+        with open(args.prg, 'rb') as f:
+            try:
+                program = prg.parse(f.read(), args.exec_address)
+            except prg.PrgError as e:
+                sys.exit(f'{args.prg}: {e}')
+        with open(args.snapshot, 'wb') as f:
+            f.write(build(from_prg(program)))
+        return
+
+    with open(args.snapshot, 'rb') as f:
+        try:
+            s = parse(f.read())
+        except SnapshotError as e:
+            sys.exit(f'{args.snapshot}: {e}')
+    print(f'PC ${s.pc:04X}  A ${s.a:02X}  X ${s.x:02X}  Y ${s.y:02X}  SP ${s.sp:02X}  '
+          f'P ${s.p:02X}  $00 ${s.port_ddr:02X}  $01 ${s.port:02X}')
+    print(f'VIC bank ${(3 - (s.cia2[0] & 3)) * 0x4000:04X}, $D011 ${s.vic[0x11]:02X}, '
+          f'$D016 ${s.vic[0x16]:02X}, $D018 ${s.vic[0x18]:02X}')
+    print(f'restore routine {len(restore_code(s))} bytes')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,267 @@
+#!/usr/bin/env python
+"""Resume a C64 memory snapshot on the emulated 6502, and check the C64 matches it.
+
+Each case is a random snapshot built with tools/snapshot.py: random RAM, colours and VIC-II,
+SID and CIA registers, and CPU registers with the stack pointer anywhere there's room.
+loader_rom.bin boots against a model of the firmware's side of "run <snapshot>": RAM from $0200
+up with the immediate layout, then CMD_NEXT_PAGE after the last chunk putting the restore
+routine at $A000, like load_restore_routine().  The run ends when rti returns to the snapshot's
+PC, and then the CPU registers, RAM, CPU port and the I/O registers written must all match the
+snapshot, except for the bytes below the stack pointer that snapshot.h says are used.  The whole
+restore must take under a second.
+
+firmware/snapshot.c is compiled with the host's C compiler ($CC, default cc) and called
+through ctypes, and must generate the same restore routine and errors as snapshot.py.  Both
+must refuse a snapshot with anything in the RAM the cartridge would hide from it:
+
+    python tools/snapshot_test.py
+"""
+import argparse
+import ctypes
+import os
+import random
+import sys
+import tempfile
+
+import copy_gen
+import host_c
+import loader_sim
+import mos6502
+import snapshot
+
+
+RTI = 0x40
+FLAGS_PULLED = 0xcf  # rti doesn't restore B or the unused bit
+MAX_SECONDS = 1.0
+
+
+class CSnapshot(ctypes.Structure):
+    _fields_ = [('file', ctypes.c_void_p), ('pc', ctypes.c_uint16), ('a', ctypes.c_uint8),
+                ('x', ctypes.c_uint8), ('y', ctypes.c_uint8), ('sp', ctypes.c_uint8),
+                ('p', ctypes.c_uint8), ('port_ddr', ctypes.c_uint8), ('port', ctypes.c_uint8)]
+
+
+class CGenerator:
+    """firmware/snapshot.c, compiled for the host"""
+
+    def __init__(self, build_dir):
+        self.lib = host_c.load(build_dir, 'snapshot.c')
+        self.lib.snapshot_restore_code.restype = ctypes.c_size_t
+        self.lib.snapshot_error_name.restype = ctypes.c_char_p
+
+    def restore_code(self, file, command_area, next_page):
+        """The restore routine, or the error name"""
+        buffer = ctypes.create_string_buffer(file, len(file))
+        parsed = CSnapshot()
+        error = self.lib.snapshot_parse(buffer, ctypes.c_size_t(len(file)), ctypes.byref(parsed))
+        if error:
+            return self.lib.snapshot_error_name(error).decode()
+        code = ctypes.create_string_buffer(0x2000)
+        size = self.lib.snapshot_restore_code(ctypes.byref(parsed), command_area, next_page,
+                                              code)
+        return code.raw[:size]
+
+
+def python_restore_code(file, command_area, next_page):
+    try:
+        return snapshot.restore_code(snapshot.parse(file), command_area, next_page)
+    except snapshot.SnapshotError as e:
+        return str(e)
+
+
+def known_file(sp):
+    """A snapshot made byte by byte: PC $1234, A 1, X 2, Y 3, P $30, the CPU port $2F/$37, the
+    given stack pointer, and everything else zero"""
+    file = bytearray(b'C64SNAP' + bytes([1]) + bytes(0x500 + 0x10000 - 8))
+    file[0x008:0x011] = bytes([0x34, 0x12, 1, 2, 3, sp, 0x30, 0x2f, 0x37])
+    return bytes(file)
+
+
+def check_known(generator, command_area, next_page):
+    """Error messages for the C generator against a routine's ends worked out by hand: it
+    starts setting $D000, and ends setting the CPU port's direction, the stack pointer below the
+    rti frame, CIA 2's interrupts, X and Y, and jumping to the trampoline 15 bytes below the
+    stack pointer.  And for the snapshots it must refuse."""
+    errors = []
+    code = generator.restore_code(known_file(0xf0), command_area, next_page)
+    head = bytes.fromhex('a9 00 8d 00 d0')
+    tail = bytes.fromhex('a9 2f 85 00 a2 ed 9a a9 80 8d 0d dd a2 02 a0 03 4c e1 01')
+    if isinstance(code, str) or code[:len(head)] != head or code[-len(tail):] != tail:
+        errors.append('the hand-made snapshot gives '
+                      + (code if isinstance(code, str) else code.hex(' ')))
+    error = generator.restore_code(known_file(14), command_area, next_page)
+    if error != 'no room below the stack pointer':
+        errors.append(f'a stack pointer of $0E gives {error!r}')
+    # With $01 $37 ROML hides $9FFF, but $A000 was BASIC
+    for address, expected in ((0x9fff, 'uses RAM under the cartridge at $8000-$BFFF'),
+                              (0xa000, None)):
+        file = bytearray(known_file(0xf0))
+        file[0x500 + address] = 1
+        error = generator.restore_code(bytes(file), command_area, next_page)
+        if (error if isinstance(error, str) else None) != expected:
+            errors.append(f'RAM at ${address:04X} gives '
+                          + (repr(error) if isinstance(error, str) else 'a routine'))
+    return errors
+
+
+def random_snapshot(seed, sp=None, port_ddr=0x2f, port=None, hidden=0x00):
+    """Random everything, with the RAM the cartridge hides filled with hidden"""
+    rng = random.Random(seed)
+
+    def data(size):
+        return bytes(rng.randrange(256) for _ in range(size))
+
+    port = rng.choice((0x35, 0x36, 0x37)) if port is None else port
+    ram = bytearray(data(0x10000))
+    for address in snapshot.hidden_by_cartridge(port_ddr, port):
+        ram[address] = hidden
+    return snapshot.Snapshot(
+        pc=rng.randrange(0x0200, 0x8000), a=rng.randrange(256), x=rng.randrange(256),
+        y=rng.randrange(256), sp=rng.randrange(snapshot.STACK_USED - 1, 0x100) if sp is None
+        else sp, p=rng.randrange(256) | 0x30, port_ddr=port_ddr, port=port,
+        vic=data(snapshot.VIC_REGS), sid=data(snapshot.SID_REGS), cia1=data(snapshot.CIA_REGS),
+        cia2=data(snapshot.CIA_REGS), color=data(snapshot.COLORS), ram=bytes(ram))
+
+
+class SnapshotCartridge(loader_sim.LoaderCartridge):
+    """The cartridge after "run <snapshot>": the snapshot's RAM from snapshot.LOAD up, then the
+    restore routine"""
+
+    def __init__(self, loader, s, command_us):
+        config = copy_gen.Config(dest=snapshot.LOAD, exec_address=copy_gen.Config().origin)
+        super().__init__(loader, s.ram[snapshot.LOAD:], config, 'immediate',
+                         command_us=command_us)
+        self.snapshot = s
+        self.restoring = False
+        self.on_command(config.next_page, command_us, SnapshotCartridge.next_page)
+
+    def next_page(self):
+        if not self.restoring and self.stream_offset + self.page_size >= len(self.stream):
+            code = snapshot.restore_code(self.snapshot, self.config.command_area,
+                                         self.config.next_page)
+            offset = loader_sim.COPY_ROUTINE_OFFSET
+            self.rom[offset:offset + len(code)] = code
+            self.restoring = True
+            return
+        self.restoring = False
+        super().next_page()
+
+
+def resume(loader, s, command_us, max_cycles=5_000_000):
+    """Boot the loader with the cartridge serving s, and run until it returns into s.  Returns
+    the cartridge and CPU."""
+    cartridge = SnapshotCartridge(loader, s, command_us)
+    for address in loader_sim.KERNAL_STUBS:
+        cartridge.ram[address] = 0x60  # rts
+    cpu = mos6502.Cpu(cartridge)
+    cartridge.attach(cpu)
+    cpu.pc = cpu.read16(0x8000)
+    while not (cpu.pc == s.pc and cartridge.ram[cpu.last_opcode_pc] == RTI
+               and cpu.last_opcode_pc < 0x200):
+        if cpu.cycles > max_cycles:
+            raise RuntimeError(f'still running after {max_cycles} cycles, at ${cpu.pc:04X}')
+        cpu.step()
+    return cartridge, cpu
+
+
+def differences(cartridge, cpu, s):
+    """What doesn't match the snapshot after resuming it"""
+    found = []
+    for name, got, expected in (('A', cpu.a, s.a), ('X', cpu.x, s.x), ('Y', cpu.y, s.y),
+                                ('SP', cpu.s, s.sp),
+                                ('P', cpu.p & FLAGS_PULLED, s.p & FLAGS_PULLED),
+                                ('$00', cartridge.ram[0x00], s.port_ddr),
+                                ('$01', cartridge.ram[0x01], s.port)):
+        if got != expected:
+            found.append(f'{name} ${got:02X}, not ${expected:02X}')
+
+    used = range(0x100 + s.sp - (snapshot.STACK_USED - 1), 0x100 + s.sp + 1)
+    ram = [address for address in range(2, 0x10000)
+           if address not in used and cartridge.ram[address] != s.ram[address]]
+    if ram:
+        found.append(f'RAM differs at {len(ram)} addresses from ${ram[0]:04X}')
+
+    io = {}
+    for reg in range(snapshot.VIC_REGS):
+        io[0xd000 + reg] = s.vic[reg]
+    io[snapshot.VIC_IRQ] = 0xff
+    for reg in snapshot.VIC_COLLISIONS:
+        del io[reg]
+    for reg in range(snapshot.SID_REGS):
+        io[0xd400 + reg] = s.sid[reg]
+    for i, color in enumerate(s.color):
+        io[0xd800 + i] = color & 0x0f
+    for base, regs in zip(snapshot.CIA_ADDRESSES, (s.cia1, s.cia2)):
+        for reg in range(8):
+            io[base + reg] = regs[reg]
+        io[base + snapshot.CIA_ICR] = regs[snapshot.CIA_ICR] | snapshot.CIA_SET_MASK
+        io[base + snapshot.CIA_CRA] = regs[snapshot.CIA_CRA] | snapshot.CIA_FORCE_LOAD
+        io[base + snapshot.CIA_CRB] = regs[snapshot.CIA_CRB] | snapshot.CIA_FORCE_LOAD
+    wrong = [address for address, value in sorted(io.items())
+             if cartridge.io[address & 0xfff] != value]
+    if wrong:
+        found.append(f'I/O differs at {len(wrong)} registers from ${wrong[0]:04X}')
+    return found
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--loader', default=os.path.join(loader_sim.C64_ROM_DIR,
+                                                         'loader_rom.bin'))
+    parser.add_argument('--command-us', type=float, default=20.0,
+                        help='time for the Pico to handle CMD_NEXT_PAGE (default %(default)s)')
+    parser.add_argument('--cases', type=int, default=4,
+                        help='random snapshots to resume, as well as one at each end of the '
+                             'stack (default %(default)s)')
+    args = parser.parse_args()
+
+    failures = 0
+    config = copy_gen.Config()
+    files = [('random', snapshot.build(random_snapshot(seed))) for seed in range(8)]
+    files += [(f'SP ${sp:02X}', snapshot.build(random_snapshot(100 + sp, sp)))
+              for sp in (snapshot.STACK_USED - 1, 0x80, 0xff)]
+    good = files[0][1]
+    files += [('short file', good[:-1]), ('bad magic', b'X' + good[1:]),
+              ('newer version', good[:7] + bytes([snapshot.VERSION + 1]) + good[8:]),
+              ('stack full', snapshot.build(random_snapshot(0, snapshot.STACK_USED - 2)))]
+    # The RAM the cartridge hides must be empty, with HIRAM an input as well as an output
+    files += [(f'$00 ${ddr:02X} $01 ${port:02X}, RAM under the cartridge',
+               snapshot.build(random_snapshot(200 + port, port_ddr=ddr, port=port, hidden=1)))
+              for ddr, port in ((0x2f, 0x37), (0x2f, 0x36), (0x2d, 0x35))]
+    with tempfile.TemporaryDirectory() as build_dir:
+        generator = CGenerator(build_dir)
+        for name, file in files:
+            c_code = generator.restore_code(file, config.command_area, config.next_page)
+            python_code = python_restore_code(file, config.command_area, config.next_page)
+            describe = c_code if isinstance(c_code, str) else f'{len(c_code)} byte routine'
+            ok = c_code == python_code
+            print(f'{name}: {describe}' + ('' if ok else '  FAIL: C and snapshot.py differ'))
+            failures += not ok
+        errors = check_known(generator, config.command_area, config.next_page)
+        print('hand-made snapshot: ' + ('OK' if not errors else
+                                        ''.join(f'  FAIL: {e}' for e in errors)))
+        failures += bool(errors)
+
+    with open(args.loader, 'rb') as f:
+        loader = f.read()
+    # The stack pointer at both ends of its range puts the trampoline at $0100 and the rti frame
+    # at $01FF
+    resumes = [random_snapshot(1000 + seed) for seed in range(args.cases)]
+    resumes += [random_snapshot(2000, snapshot.STACK_USED - 1), random_snapshot(2001, 0xff)]
+    for s in resumes:
+        cartridge, cpu = resume(loader, s, args.command_us)
+        seconds = cpu.cycles / (cartridge.cycles_per_us * 1e6)
+        errors = differences(cartridge, cpu, s)
+        if seconds >= MAX_SECONDS:
+            errors.append(f'over {MAX_SECONDS:.0f} s')
+        print(f'resume PC ${s.pc:04X} SP ${s.sp:02X}: {cpu.cycles} cycles, '
+              f'{seconds * 1000:.0f} ms' + ''.join(f'  FAIL: {e}' for e in errors))
+        failures += bool(errors)
+
+    print(f'{failures} failed' if failures else 'all OK')
+    sys.exit(1 if failures else 0)
+
+
+if __name__ == '__main__':
+    main()